@@ -27,6 +27,7 @@
 #include "behaviac/common/meta/meta.h"
 
 #include "behaviac/agent/agentstate.h"
+#include "behaviac/agent/tickrecorder.h"
 #include "behaviac/common/object/member.h"
 
 namespace behaviac
@@ -36,8 +37,14 @@ namespace behaviac
 #endif //BEHAVIAC_UNUSED_CODE
     class BehaviorTreeTask;
     class State_t;
+    class SnapshotWriter;
+    class SnapshotReader;
+    struct ResumeState_t;
+    struct BatchSlot_t;
     class IProperty;
     class IValue;
+    class AgentMeta;
+    class Context;
 
     /*! \addtogroup Agent
      * @{
@@ -69,6 +76,33 @@ namespace behaviac
 
         bool btload(const State_t& state);
         bool btsave(State_t& state);
+
+        /**
+        the size of the binary snapshot of the current state, btsavesnapshot needs a buffer of at least this size.
+
+        it varies with the state only if there are variables of the types which are written in their string form.
+        */
+        uint32_t btsnapshotsize();
+
+        /**
+        write the variables and the current behavior tree's tasks into 'buffer' as a binary snapshot (see SnapshotHeader),
+        nothing is allocated unless there are variables of the types which are written in their string form.
+
+        @return the size written, 0 if 'bufferSize' is not enough
+        */
+        uint32_t btsavesnapshot(void* buffer, uint32_t bufferSize);
+
+        /**
+        restore the snapshot written by btsavesnapshot in place into the current behavior tree's tasks,
+        the tree is set current first if it is not. the variables not in the snapshot keep their values.
+
+        the trees pushed by btreferencetree are not in the snapshot.
+
+        the snapshot is validated as a whole before anything is restored, a bad one leaves the agent unchanged.
+
+        @return false if it is not a snapshot of this version or of this agent class, or it doesn't match the tree
+        */
+        bool btloadsnapshot(const void* buffer, uint32_t size);
         void LogJumpTree(string newTree)
         {
             BEHAVIAC_UNUSED_VAR(newTree);
@@ -144,6 +178,36 @@ namespace behaviac
         BehaviorTreeTask* btgetcurrent();
         const BehaviorTreeTask* btgetcurrent() const;
 
+        /**
+        the continuation of the action or the state being executed, 0 when none is being executed.
+        a resumable method uses it to continue where it suspended, see ResumeState_t
+        */
+        ResumeState_t* GetResumeState() const
+        {
+            return this->m_resumeState;
+        }
+
+        /**
+        called by the method of an action which starts some async work, e.g. a path finding or a server request,
+        the method then returns BT_RUNNING.
+
+        the agent is parked, it is not ticked until the work is completed by Context::CompleteAsync with the token
+        returned, then its action ends with the status the work is completed with. the work is cancelled
+        if the action is aborted or the agent is destroyed before.
+
+        the actions running at the same time, e.g. in a Parallel, each wait for their own work. the agent is
+        ticked again once any of them is completed, and parked again while the others are still waiting.
+
+        @return the token to complete the work with
+        */
+        uint32_t BeginAsync();
+
+        /// true if the agent is not ticked as all its actions running are waiting for their async work
+        bool IsParked() const
+        {
+            return this->m_bParked;
+        }
+
         /**
         exec the BT specified by 'btName'. if 'btName' is null, exec the current behavior tree specified by 'btsetcurrent'.
         */
@@ -203,6 +267,11 @@ namespace behaviac
             return this->m_context_id;
         }
 
+        /**
+        the same as Context::GetContext(GetContextId()), the context is cached so that it doesn't lock the contexts
+        */
+        Context& GetContext() const;
+
         /**
         return if the agent is active or not.
 
@@ -223,6 +292,66 @@ namespace behaviac
         {
             this->m_bActive = bActive ? 1 : 0;
         }
+
+        /**
+        tick the agent once every 'tickInterval' frames of its context, 1 by default.
+        the frames are counted from its last tick, so a tick carried over by the frame budget delays the next ones.
+
+        @sa Context::SetFrameBudget
+        */
+        void SetTickInterval(int tickInterval);
+
+        int GetTickInterval() const
+        {
+            return this->m_tickInterval;
+        }
+
+        /**
+        the cost of btexec, measured by the context when it has a frame budget.
+        all the costs are in microseconds.
+        */
+        struct TickStats_t
+        {
+            uint32_t	tickCount;
+
+            //the number of the frames it was due but carried over as the budget was used up
+            uint32_t	deferredCount;
+
+            uint32_t	lastCost;
+            uint32_t	averageCost;
+            uint32_t	maxCost;
+        };
+
+        const TickStats_t& GetTickStats() const
+        {
+            return this->m_tickStats;
+        }
+
+        void ResetTickStats();
+
+        /**
+        set the level of detail of the agent, 0 (the full detail) by default.
+
+        the context ticks the agent every Context::GetLODTickInterval(lod) frames, the agents of a level are spread over
+        the frames of its interval. the agent runs the tree set by SetLODTree for 'lod', or for the nearest level of more
+        detail which has one. switching the tree restarts it.
+
+        the Wait and DecoratorTime nodes measure the time elapsed, they still end on time at the first tick after it,
+        and the same for WaitFrames and DecoratorFrames with the frames.
+        */
+        void SetLOD(int lod);
+
+        int GetLOD() const
+        {
+            return this->m_lod;
+        }
+
+        /**
+        run 'relativePath' at the level 'lod' and at the levels of less detail which have no tree of their own,
+        0 to clear it. the current tree is kept as the tree of the level 0 if it has none.
+        if the agent is at one of these levels, it switches to the tree at once.
+        */
+        void SetLODTree(int lod, const char* relativePath);
         ///////////////////////////////////////////////////////////////////////////////////////
         ///////////////////////////////////////////////////////////////////////////////////////
         //static void FireEvent(Agent* pAgent, const char* eventName);
@@ -275,20 +404,84 @@ namespace behaviac
         BEHAVIAC_FORCEINLINE bool IsVariableExisting(const char* variableName) const;
 
     public:
+        inline IInstantiatedVariable* GetLocalVariable(uint32_t varId) const
+        {
+            if (this->m_excutingTreeTask != NULL && this->m_excutingTreeTask->m_localVars.size() > 0)
+            {
+                behaviac::map<uint32_t, IInstantiatedVariable*>::const_iterator it = this->m_excutingTreeTask->m_localVars.find(varId);
+
+                if (it != this->m_excutingTreeTask->m_localVars.end())
+                {
+                    return it->second;
+                }
+            }
+
+            return NULL;
+        }
+
         inline IInstantiatedVariable* GetInstantiatedVariable(uint32_t varId) const
         {
             // local var
-            if (this->m_excutingTreeTask != NULL && this->m_excutingTreeTask->m_localVars.find(varId) != this->m_excutingTreeTask->m_localVars.end())
+            IInstantiatedVariable* pVar = this->GetLocalVariable(varId);
+
+            if (pVar != NULL)
             {
-                return this->m_excutingTreeTask->m_localVars[varId];
+                return pVar;
             }
 
             // customized var
-            IInstantiatedVariable* pVar = ((Agent*)this)->GetVariables()->GetVariable(varId);
+            pVar = ((Agent*)this)->GetVariables()->GetVariable(varId);
 
             return pVar;
         };
 
+        /**
+        the same as GetInstantiatedVariable, 'slot' is the one given to the customized property when its meta is loaded.
+
+        the variable found is kept in the slot until the variables of the agent are changed, the states pushed by
+        the planner or the referenced trees are looked up the usual way as long as they are there.
+        */
+        inline IInstantiatedVariable* GetBoundVariable(uint32_t varId, uint32_t slot) const
+        {
+            // local var
+            IInstantiatedVariable* pVar = this->GetLocalVariable(varId);
+
+            if (pVar != NULL)
+            {
+                return pVar;
+            }
+
+            Agent* pThis = (Agent*)this;
+            AgentState* pState = pThis->GetVariables();
+
+            if (!pState->IsFlat())
+            {
+                return pState->GetVariable(varId);
+            }
+
+            if (pThis->m_variableSlotsVersion != pState->GetVersion())
+            {
+                pThis->m_variableSlots.clear();
+                pThis->m_variableSlotsVersion = pState->GetVersion();
+            }
+
+            if (slot >= pThis->m_variableSlots.size())
+            {
+                pThis->m_variableSlots.resize(slot + 1);
+            }
+
+            //the slots of the properties of different metas can be the same, the id tells them apart
+            VariableSlot_t& variableSlot = pThis->m_variableSlots[slot];
+
+            if (variableSlot.id != varId)
+            {
+                variableSlot.id = varId;
+                variableSlot.pVar = pState->Variables::GetVariable(varId);
+            }
+
+            return variableSlot.pVar;
+        }
+
         IProperty* GetProperty(uint32_t propId) const;
     public:
 
@@ -313,6 +506,10 @@ namespace behaviac
         template<typename VariableType>
         BEHAVIAC_FORCEINLINE bool GetVarValue(uint32_t variableId, int index, VariableType*& value) const;
 
+        //'slot' is the one of the customized property, see GetBoundVariable
+        template<typename VariableType>
+        BEHAVIAC_FORCEINLINE bool GetBoundVarValue(uint32_t variableId, uint32_t slot, VariableType*& value) const;
+
         /**
         set a variable by its name, its type(agent/par/singleton) is determined by the name
         */
@@ -331,6 +528,44 @@ namespace behaviac
         template<typename VariableType>
         BEHAVIAC_FORCEINLINE bool SetVarValue(uint32_t varId, int index, const VariableType* value);
 
+        template<typename VariableType>
+        BEHAVIAC_FORCEINLINE bool SetBoundVarValue(uint32_t varId, uint32_t slot, const VariableType* value);
+
+        /**
+        turn on the change tracking of the properties, the variables and the events, it is turned on by SelectorLoop
+        when its 'ReevaluateOnChange' is set. the writes done by behaviac (SetVariable, assignments, effectors, etc.)
+        and FireEvent are tracked, a member changed directly in c++ needs to be reported by NotifyVariableChanged.
+        */
+        void EnableChangeTracking();
+
+        bool IsChangeTrackingEnabled() const
+        {
+            return this->m_changeStamps != NULL;
+        }
+
+        /**
+        mark the property, the variable or the event as changed, 0 marks everything as changed
+        */
+        BEHAVIAC_FORCEINLINE void NotifyVariableChanged(uint32_t variableId)
+        {
+            if (this->m_changeStamps != NULL)
+            {
+                this->markChanged(variableId);
+            }
+        }
+
+        void NotifyVariableChanged(const char* variableName);
+
+        /**
+        the stamp of the last change, a variable is changed after it if GetVariableChangeStamp returns a greater one
+        */
+        uint64_t GetChangeStamp() const
+        {
+            return this->m_changeStamp;
+        }
+
+        uint64_t GetVariableChangeStamp(uint32_t variableId) const;
+
         /**
         log changed variables(propery and par)
         */
@@ -514,6 +749,12 @@ namespace behaviac
 
         void _btsetcurrent(const char* relativePath, TriggerMode triggerMode = TM_Transfer, bool bByEvent = false);
 
+        void btsavesnapshot_(SnapshotWriter& writer);
+        bool btloadsnapshot_(SnapshotReader& reader);
+
+        //switch to the tree of the current level of detail
+        void setLODTree_();
+
         void btunload_pars(const BehaviorTree* bt);
 
 #if BEHAVIAC_ENABLE_NETWORKD
@@ -677,6 +918,69 @@ namespace behaviac
 #endif//
 
         bool						_balckboard_bound;
+
+        //the ids are hashed into kChangeStampCount buckets, a collision only causes a needless reevaluation
+        enum { kChangeStampCount = 64 };
+        void markChanged(uint32_t variableId);
+
+        uint64_t*					m_changeStamps;
+        uint64_t					m_changeStamp;
+        uint64_t					m_allChangedStamp;
+
+        //scheduled by the context with a frame budget
+        int							m_tickInterval;
+        uint32_t					m_lastTickFrame;
+        bool						m_bTickDeferred;
+        TickStats_t					m_tickStats;
+
+        //see SetLOD, the phase spreads the agents of a level over the frames of its interval
+        int							m_lod;
+        uint32_t					m_lodPhase;
+        behaviac::vector<behaviac::string> m_lodTrees;
+        friend class Context;
+
+        struct VariableSlot_t
+        {
+            VariableSlot_t() : id(0), pVar(0)
+            {}
+
+            uint32_t				id;
+            IInstantiatedVariable*	pVar;
+        };
+
+        //see GetBoundVariable
+        behaviac::vector<VariableSlot_t>	m_variableSlots;
+        uint32_t					m_variableSlotsVersion;
+
+        //set by ActionTask, PlannerTaskAction and StateTask while their method is executed
+        ResumeState_t*				m_resumeState;
+        friend class ActionTask;
+        friend class PlannerTaskAction;
+        friend class StateTask;
+
+        //the work begun by the method being executed, its ActionTask takes it over once the method returns
+        uint32_t					m_asyncToken;
+
+        //set by Context::ParkAgent and cleared by Context::UnparkAgent
+        bool						m_bParked;
+
+        //set by BatchExecutor while the agent is ticked
+        BatchSlot_t*				m_batchSlot;
+        friend class BatchExecutor;
+
+        //set by the context while it is recording
+        TickRecorder*				m_tickRecorder;
+
+        //see GetContext, it is looked up again after the contexts are cleaned up
+        mutable Context*			m_context;
+        mutable uint32_t			m_contextVersion;
+
+        //the meta of the class of the agent, resolved again after the metas are unregistered
+        AgentMeta* getMeta_() const;
+
+        mutable AgentMeta*			m_meta;
+        mutable uint32_t			m_metaVersion;
+
         //debug
     private:
         behaviac::map<uint32_t, IInstantiatedVariable*> GetCustomizedVariables();
@@ -226,19 +226,33 @@ namespace behaviac
 
     BEHAVIAC_FORCEINLINE void Agent::FireEvent(const char* eventName)
     {
+        if (this->m_tickRecorder != NULL)
+        {
+            this->m_tickRecorder->RecordEvent(this, eventName, 0, NULL);
+        }
+
         this->btonevent(eventName, NULL);
     }
 
+    //the names and the ids of the event params
+#define BEHAVIAC_EVENT_PARAM_NAME(index)	BEHAVIAC_LOCAL_TASK_PARAM_PRE #index
+#define BEHAVIAC_EVENT_PARAM_ID(index)		BEHAVIAC_VARID(BEHAVIAC_EVENT_PARAM_NAME(index))
+
     template<class ParamType1>
     BEHAVIAC_FORCEINLINE void Agent::FireEvent(const char* eventName, const ParamType1& param1)
     {
         //Agent::FireEvent(this, eventName, param1);
         behaviac::map<uint32_t, IInstantiatedVariable*> eventParams;
-        char paramName[1024];
 
-        string_sprintf(paramName, "%s%d", BEHAVIAC_LOCAL_TASK_PARAM_PRE, 0);
-        uint32_t paramId = MakeVariableId(paramName);
-        eventParams[paramId] = BEHAVIAC_NEW CVariable<ParamType1>(paramName, param1);
+        eventParams[BEHAVIAC_EVENT_PARAM_ID(0)] = BEHAVIAC_NEW CVariable<ParamType1>(BEHAVIAC_EVENT_PARAM_NAME(0), param1);
+
+        if (this->m_tickRecorder != NULL)
+        {
+            TraceValue_t params[1];
+            params[0].Set(param1);
+
+            this->m_tickRecorder->RecordEvent(this, eventName, 1, params);
+        }
 
         this->btonevent(eventName, &eventParams);
     }
@@ -248,15 +262,18 @@ namespace behaviac
     {
         //Agent::FireEvent(this, eventName, param1, param2);
         behaviac::map<uint32_t, IInstantiatedVariable*> eventParams;
-        char paramName[1024];
 
-        string_sprintf(paramName, "%s%d", BEHAVIAC_LOCAL_TASK_PARAM_PRE, 0);
-        uint32_t paramId = MakeVariableId(paramName);
-        eventParams[paramId] = BEHAVIAC_NEW CVariable<ParamType1>(paramName, param1);
+        eventParams[BEHAVIAC_EVENT_PARAM_ID(0)] = BEHAVIAC_NEW CVariable<ParamType1>(BEHAVIAC_EVENT_PARAM_NAME(0), param1);
+        eventParams[BEHAVIAC_EVENT_PARAM_ID(1)] = BEHAVIAC_NEW CVariable<ParamType2>(BEHAVIAC_EVENT_PARAM_NAME(1), param2);
+
+        if (this->m_tickRecorder != NULL)
+        {
+            TraceValue_t params[2];
+            params[0].Set(param1);
+            params[1].Set(param2);
 
-        string_sprintf(paramName, "%s%d", BEHAVIAC_LOCAL_TASK_PARAM_PRE, 1);
-        paramId = MakeVariableId(paramName);
-        eventParams[paramId] = BEHAVIAC_NEW CVariable<ParamType2>(paramName, param2);
+            this->m_tickRecorder->RecordEvent(this, eventName, 2, params);
+        }
 
         this->btonevent(eventName, &eventParams);
     }
@@ -265,23 +282,26 @@ namespace behaviac
     BEHAVIAC_FORCEINLINE void Agent::FireEvent(const char* eventName, const ParamType1& param1, const ParamType2& param2, const ParamType3& param3)
     {
         behaviac::map<uint32_t, IInstantiatedVariable*> eventParams;
-        char paramName[1024];
 
-        string_sprintf(paramName, "%s%d", BEHAVIAC_LOCAL_TASK_PARAM_PRE, 0);
-        uint32_t paramId = MakeVariableId(paramName);
-        eventParams[paramId] = BEHAVIAC_NEW CVariable<ParamType1>(paramName, param1);
+        eventParams[BEHAVIAC_EVENT_PARAM_ID(0)] = BEHAVIAC_NEW CVariable<ParamType1>(BEHAVIAC_EVENT_PARAM_NAME(0), param1);
+        eventParams[BEHAVIAC_EVENT_PARAM_ID(1)] = BEHAVIAC_NEW CVariable<ParamType2>(BEHAVIAC_EVENT_PARAM_NAME(1), param2);
+        eventParams[BEHAVIAC_EVENT_PARAM_ID(2)] = BEHAVIAC_NEW CVariable<ParamType3>(BEHAVIAC_EVENT_PARAM_NAME(2), param3);
 
-        string_sprintf(paramName, "%s%d", BEHAVIAC_LOCAL_TASK_PARAM_PRE, 1);
-        paramId = MakeVariableId(paramName);
-        eventParams[paramId] = BEHAVIAC_NEW CVariable<ParamType2>(paramName, param2);
+        if (this->m_tickRecorder != NULL)
+        {
+            TraceValue_t params[3];
+            params[0].Set(param1);
+            params[1].Set(param2);
+            params[2].Set(param3);
 
-        string_sprintf(paramName, "%s%d", BEHAVIAC_LOCAL_TASK_PARAM_PRE, 2);
-        paramId = MakeVariableId(paramName);
-        eventParams[paramId] = BEHAVIAC_NEW CVariable<ParamType3>(paramName, param3);
+            this->m_tickRecorder->RecordEvent(this, eventName, 3, params);
+        }
 
         this->btonevent(eventName, &eventParams);
     }
 
+#undef BEHAVIAC_EVENT_PARAM_ID
+#undef BEHAVIAC_EVENT_PARAM_NAME
 
     BEHAVIAC_FORCEINLINE bool Agent::IsVariableExisting(const char* variableName) const
     {
@@ -442,6 +462,22 @@ namespace behaviac
         return false;
     }
 
+    template<typename VariableType>
+    BEHAVIAC_FORCEINLINE bool Agent::GetBoundVarValue(uint32_t variableId, uint32_t slot, VariableType*& pValue) const
+    {
+        IInstantiatedVariable* v = this->GetBoundVariable(variableId, slot);
+
+        if (v != NULL)
+        {
+            pValue = (VariableType*)((Agent*)this)->GetValueObject(v);
+            return true;
+        }
+
+        pValue = 0;
+
+        return false;
+    }
+
     template<typename VariableType, bool bRefType>
     struct VariableSettterDispatcher
     {
@@ -469,6 +505,7 @@ namespace behaviac
             CVariable<VariableType>* var = (CVariable<VariableType>*)v;
 
             var->SetValue(this, value);
+            this->NotifyVariableChanged(varId);
             return true;
         }
 
@@ -484,6 +521,23 @@ namespace behaviac
             CArrayItemVariable<VariableType>* arrayItemVar = (CArrayItemVariable<VariableType>*)v;
 
             arrayItemVar->SetValueElement(this, value, index);
+            this->NotifyVariableChanged(varId);
+            return true;
+        }
+
+        return false;
+    }
+
+    template<typename VariableType>
+    BEHAVIAC_FORCEINLINE bool Agent::SetBoundVarValue(uint32_t varId, uint32_t slot, const VariableType* value)
+    {
+        IInstantiatedVariable* v = this->GetBoundVariable(varId, slot);
+        if (v != NULL)
+        {
+            CVariable<VariableType>* var = (CVariable<VariableType>*)v;
+
+            var->SetValue(this, value);
+            this->NotifyVariableChanged(varId);
             return true;
         }
 
@@ -505,6 +559,15 @@ namespace behaviac
         {
             variableId = MakeVariableId(variableName);
         }
+
+        if (this->m_tickRecorder != NULL)
+        {
+            TraceValue_t traceValue;
+            traceValue.Set(value);
+
+            this->m_tickRecorder->RecordWrite(this, variableId, traceValue);
+        }
+
         //var 
         if (this->SetVarValue(variableId, &value))
         {
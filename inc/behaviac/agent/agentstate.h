@@ -42,12 +42,26 @@ namespace behaviac
     private:
 
         behaviac::vector<AgentState*>			state_stack;
-        static behaviac::Mutex					ms_mutex;
-        static behaviac::vector<AgentState*>	pool;
+
+        //the pool is split so that the threads ticking different contexts seldom wait for each other
+        static const uint32_t kPoolCount = 16;
+
+        struct Pool_t
+        {
+            behaviac::Mutex					mutex;
+            behaviac::vector<AgentState*>	states;
+        };
+
+        static Pool_t							ms_pools[kPoolCount];
+        static Pool_t& GetPool();
         AgentState* 							parent;
 #if BEHAVIAC_ENABLE_PUSH_OPT
         bool									m_forced;
         int										m_pushed;
+#endif
+#if BEHAVIAC_USE_HTN
+        behaviac::vector<uint32_t>*				m_readIds;
+        bool									m_bUntrackedRead;
 #endif
     public:
         AgentState();
@@ -72,6 +86,43 @@ namespace behaviac
 
         virtual IInstantiatedVariable* GetVariable(uint32_t varId) const;
 
+        /**
+        true if no state is pushed and the reads are not recorded, i.e. the planner is not running,
+        a variable is then found in this state itself
+        */
+        bool IsFlat() const
+        {
+#if BEHAVIAC_USE_HTN
+            if (this->m_readIds != NULL)
+            {
+                return false;
+            }
+#endif
+            return this->state_stack.size() == 0;
+        }
+
+#if BEHAVIAC_USE_HTN
+        /**
+        the ids of the variables looked up are appended to 'readIds' until it is set to NULL,
+        the planner uses it to know what a plan depends on
+        */
+        void SetReadIds(behaviac::vector<uint32_t>* readIds);
+
+        /// a read while recording which can't be recorded as an id, e.g. of another agent's property
+        void SetUntrackedRead()
+        {
+            if (this->m_readIds != NULL)
+            {
+                this->m_bUntrackedRead = true;
+            }
+        }
+
+        bool HasUntrackedRead() const
+        {
+            return this->m_bUntrackedRead;
+        }
+#endif
+
     private:
         void PopTop();
     };
@@ -0,0 +1,174 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Tencent is pleased to support the open source community by making behaviac available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except in compliance with
+// the License. You may obtain a copy of the License at http://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and limitations under the License.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _BEHAVIAC_BATCHEXECUTOR_H_
+#define _BEHAVIAC_BATCHEXECUTOR_H_
+
+#include "behaviac/common/base.h"
+#include "behaviac/agent/agent.h"
+
+namespace behaviac
+{
+    class BehaviorNode;
+    class Condition;
+    class BatchExecutor;
+
+    /*! \addtogroup Agent
+    * @{
+    * \addtogroup BatchExecutor
+    * @{ */
+
+    /// where the batched results of the agent being ticked are
+    struct BatchSlot_t
+    {
+        BatchExecutor*	executor;
+
+        //0 if the agent is ticked without batching
+        void*			group;
+        int				index;
+    };
+
+    /**
+    ticks the agents grouped by their tree and the node they are in, before the agents of a group are ticked,
+    the conditions evaluated in that node are compared for all of them at once over the arrays of their operands.
+    the condition nodes then take their batched results instead of evaluating them again.
+
+    only the conditions whose operands are the properties and the variables of 'Self' or constants are batched, and
+    a result is only taken if none of its inputs is changed since it is batched and no action of any agent is executed
+    since then in the frame, as its method may change the members of any agent, so the agents of a group are still
+    ticked one by one and behave as if they were not batched. like the reevaluation of SelectorLoop, it relies on the
+    change tracking of the agents, a member changed directly in c++ outside of the ticks, e.g. between the frames,
+    needs to be reported by NotifyVariableChanged.
+
+    the executor keeps the condition nodes, so Clear should be called after the behavior trees are reloaded.
+
+    @sa Context::SetBatchExecution Agent::EnableChangeTracking
+    */
+    class BEHAVIAC_API BatchExecutor
+    {
+    public:
+        struct Stats_t
+        {
+            //the results of the conditions compared in batches
+            uint32_t	batched;
+
+            //the evaluations which took a batched result
+            uint32_t	hits;
+
+            //the evaluations which found the inputs of their batched result changed
+            uint32_t	stale;
+
+            //the evaluations which found no batched result
+            uint32_t	misses;
+
+            //the groups of the last frame
+            uint32_t	groups;
+        };
+
+        BatchExecutor();
+        ~BatchExecutor();
+
+        /**
+        tick the active ones of 'agents' in their order, it stops when Workspace::IsExecAgents is turned off
+        */
+        void Exec(const behaviac::vector<Agent*>& agents);
+
+        /// a group with less agents is ticked without batching, 4 by default
+        void SetMinBatchSize(int minBatchSize);
+
+        int GetMinBatchSize() const
+        {
+            return this->m_minBatchSize;
+        }
+
+        const Stats_t& GetStats() const
+        {
+            return this->m_stats;
+        }
+
+        void ResetStats();
+
+        /// forget the groups and the conditions they learned
+        void Clear();
+
+        /**
+        return true if the result of 'pCondition' for 'pAgent' is batched and its inputs are not changed since then
+        */
+        static bool GetResult(Agent* pAgent, Condition* pCondition, bool& result)
+        {
+            if (pAgent->m_batchSlot == 0)
+            {
+                return false;
+            }
+
+            return GetResult_(pAgent, pCondition, result);
+        }
+
+        /// no batched result is taken any more in the frame, ActionTask calls it after the action of 'pAgent' is executed
+        static void MarkChanged(Agent* pAgent)
+        {
+            if (pAgent->m_batchSlot != 0)
+            {
+                pAgent->m_batchSlot->executor->m_actionEpoch++;
+            }
+        }
+
+    private:
+        static bool GetResult_(Agent* pAgent, Condition* pCondition, bool& result);
+
+        //a group learns the conditions from the ones evaluated without a batched result
+        enum { kMaxConditions = 16, kChunkSize = 64 };
+
+        struct BatchCondition_t
+        {
+            Condition*					pCondition;
+            bool						bBatchable;
+            behaviac::vector<uint32_t>	inputIds;
+        };
+
+        struct Group_t
+        {
+            Group_t() : frame(0), batchedCount(0)
+            {}
+
+            behaviac::vector<BatchCondition_t>	conditions;
+            behaviac::vector<Agent*>			agents;
+            behaviac::vector<uint64_t>			stamps;
+
+            //batchedCount results of each agent
+            behaviac::vector<uint8_t>			results;
+
+            uint32_t							frame;
+            uint32_t							batchedCount;
+        };
+
+        void batch(Group_t* pGroup);
+
+        typedef std::pair<const BehaviorNode*, const BehaviorNode*> GroupKey_t;
+        typedef behaviac::map<GroupKey_t, Group_t*> Groups_t;
+
+        Groups_t						m_groups;
+        behaviac::vector<BatchSlot_t>	m_slots;
+        uint32_t						m_frame;
+
+        //the actions executed, the results are batched at m_batchEpoch
+        uint32_t						m_actionEpoch;
+        uint32_t						m_batchEpoch;
+        int								m_minBatchSize;
+        Stats_t							m_stats;
+    };
+    /*! @} */
+    /*! @} */
+}
+
+#endif//_BEHAVIAC_BATCHEXECUTOR_H_
@@ -24,9 +24,14 @@
 #include "behaviac/behaviortree/behaviortree_task.h"
 #include "behaviac/agent/state.h"
 #include "behaviac/agent/context.h"
+#include "behaviac/common/thread/mutex_lock.h"
+#include "behaviac/common/container/mpscring.h"
 namespace behaviac
 {
     class Agent;
+    class RandomGenerator;
+    class BatchExecutor;
+    class TickRecorder;
     class BehaviorTreeTask;
     class Variables;
     class State_t;
@@ -47,13 +52,41 @@ namespace behaviac
         typedef behaviac::map<int, Context*> Contexts_t;
 
         static Contexts_t* ms_contexts;
+        static Mutex ms_contextsMutex;
+
+        //incremented when contexts are deleted, see Agent::GetContext
+        static uint32_t ms_contextsVersion;
 
         void LogCurrentState();
 
     public:
+        /**
+        tick the agents of the specified context, or all the contexts if contextId is -1.
+
+        the contexts are independent, each context can be ticked by its own thread at the same time as long as
+        its agents are only created, destroyed and ticked by that thread. the behavior trees should have been loaded
+        before the threads start as the workspace only reads them when ticking.
+        */
         static void execAgents(int contextId);
         static Context& GetContext(int contextId);
 
+        /**
+        the random generator used by the nodes ticked in this context.
+
+        by default each context owns one, seeded from the seed of RandomGenerator::GetInstance() and the context id
+        when the context is created, so set the seed of the instance before the agents are created.
+        */
+        RandomGenerator* GetRandomGenerator()
+        {
+            return this->m_randomGenerator;
+        }
+
+        /**
+        install 'pRandomGenerator' for the nodes ticked in this context, it is not owned by the context.
+        0 to restore the own generator of the context.
+        */
+        void SetRandomGenerator(RandomGenerator* pRandomGenerator);
+
 		void AddAgent(Agent* pAgent);
 		void RemoveAgent(Agent* pAgent);
 
@@ -99,6 +132,95 @@ namespace behaviac
         bool Save(States_t& states);
         bool Load(const States_t& states);
 
+        /**
+        bound the cost of ticking the agents to 'microseconds' per frame, 0 by default to tick all the active agents every frame.
+
+        with a budget, the agents which don't fit in the budget are carried over and ticked first in the next frame.
+        at least one agent is ticked every frame.
+
+        @sa Agent::SetTickInterval Agent::GetTickStats
+        */
+        void SetFrameBudget(uint32_t microseconds);
+
+        uint32_t GetFrameBudget() const
+        {
+            return this->m_frameBudget;
+        }
+
+        /// the cost of ticking the agents in the last frame, in microseconds, only measured with a frame budget
+        uint32_t GetLastFrameCost() const
+        {
+            return this->m_lastFrameCost;
+        }
+
+        /// the number of the agents carried over to the next frame
+        uint32_t GetDeferredAgentCount() const
+        {
+            return (uint32_t)this->m_deferredAgents.size();
+        }
+
+        /**
+        tick the agents of the level of detail 'lod' once every 'tickInterval' frames, 1 by default.
+        with a frame budget, an agent is ticked at the frames of its level when its own tick interval is elapsed.
+
+        @sa Agent::SetLOD
+        */
+        void SetLODTickInterval(int lod, int tickInterval);
+
+        int GetLODTickInterval(int lod) const
+        {
+            return lod < (int)this->m_lodTickIntervals.size() ? this->m_lodTickIntervals[lod] : 1;
+        }
+
+        /**
+        tick the agents grouped by their tree and their running node with a BatchExecutor, off by default.
+        it is only used when there is no frame budget, and it should not be turned off when the context is being ticked.
+
+        @sa BatchExecutor
+        */
+        void SetBatchExecution(bool bBatch);
+
+        /// the executor of the batch execution, 0 if it is off
+        BatchExecutor* GetBatchExecutor() const
+        {
+            return this->m_batchExecutor;
+        }
+
+        /**
+        record the frames of this context into a ring of 'bufferSize' bytes with a keyframe every 'keyframeInterval' frames,
+        it starts over if it is already recording. it should not be called when the context is being ticked.
+
+        @sa TickRecorder TickReplay
+        */
+        void StartRecording(uint32_t bufferSize, uint32_t keyframeInterval = 30);
+        void StopRecording();
+
+        /// the recorder of the frames, 0 if it is not recording
+        TickRecorder* GetTickRecorder() const
+        {
+            return this->m_tickRecorder;
+        }
+
+        /**
+        complete the async work of 'token' with 'status', it can be called from any thread.
+
+        the agent parked on it is ticked again once the completion is handled by ResumeCompletedAgents,
+        and its action waiting for the work ends with 'status'. the tokens unknown or cancelled are ignored.
+
+        @sa Agent::BeginAsync
+        */
+        static void CompleteAsync(uint32_t token, EBTStatus status);
+
+        /**
+        put the agents whose async work is completed back to be ticked, Workspace::Update calls it before ticking the agents.
+        it can be called while the contexts are ticked by their own threads, the agents are queued to their context
+        and only put back by the thread ticking it at the beginning of its next frame.
+        */
+        static void ResumeCompletedAgents();
+
+        /// the number of the agents parked on their async work in all the contexts
+        static uint32_t GetParkedAgentCount();
+
         typedef behaviac::map<int, Agent*> Agents_t;
         struct HeapItem_t
         {
@@ -141,9 +263,68 @@ namespace behaviac
 		void DelayProcessingAgents();
 		void addAgent_(Agent* pAgent);
 		void removeAgent_(Agent* pAgent);
+		void execAgentsScheduled_();
+		void tickScheduled_(Agent* pAgent, int64_t frameStart, uint32_t& tickedCount);
+
+        //the parked agents are not ticked until their async work is completed or cancelled
+        static uint32_t RegisterAsync(Agent* pAgent);
+        static void UnregisterAsync(uint32_t token);
+
+        //all the works of the agent
+        static void UnregisterAsync(Agent* pAgent);
+
+        //BT_RUNNING until the work is completed, BT_INVALID if it is unknown or cancelled
+        static EBTStatus GetAsyncStatus(uint32_t token);
+
+        //they do nothing if the agent is already parked, or not parked
+		void ParkAgent(Agent* pAgent);
+		void UnparkAgent(Agent* pAgent);
+
+        //the resumed agents are unparked by the thread ticking the context, see ResumeCompletedAgents
+        void queueResumedAgent_(Agent* pAgent);
+        void removeResumedAgent_(Agent* pAgent);
+        void unparkResumedAgents_();
+
+        void setTickRecorder_(TickRecorder* pRecorder);
+
+        uint32_t nextLODPhase_(int lod);
+
+        //at the frames of its level of detail and its tick interval is elapsed
+        bool isTickDue_(const Agent* pAgent) const;
+
+        friend class Agent;
+        friend class ActionTask;
 
 		behaviac::vector<Agent*> delayAddedAgents;
 		behaviac::vector<Agent*> delayRemovedAgents;
+		behaviac::vector<Agent*> delayParkedAgents;
+
+        behaviac::vector<Agent*> m_resumedAgents;
+        Mutex m_resumedMutex;
+
+        //the completed works are kept until their ActionTask takes the status
+        struct AsyncWork_t
+        {
+            Agent*		agent;
+            EBTStatus	status;
+        };
+
+        typedef behaviac::map<uint32_t, AsyncWork_t> AsyncAgents_t;
+        static AsyncAgents_t* ms_asyncAgents;
+        static uint32_t ms_asyncSerial;
+        static Mutex ms_asyncMutex;
+        static volatile Atomic32 ms_parkedCount;
+
+        //the completions are written by any thread without locking, only the ones not fitting in the ring are locked
+        static const uint32_t kCompletionRingSize = 32 * 1024;
+        static MPSCRing<kCompletionRingSize> ms_completions;
+
+        struct Completion_t
+        {
+            uint32_t	token;
+            uint32_t	status;
+        };
+        static behaviac::vector<Completion_t>* ms_overflowCompletions;
 
         typedef behaviac::map<behaviac::string, Agent*> NamedAgents_t;
         NamedAgents_t m_namedAgents;
@@ -160,6 +341,25 @@ namespace behaviac
         int     m_context_id;
         bool    m_bCreatedByMe;
 		bool	m_IsExecuting;
+
+        //the thread in execAgents_, 0 between the frames, the agents are only added and removed by it while ticking
+        THREAD_ID_TYPE	m_tickingThreadId;
+
+        RandomGenerator* m_randomGenerator;
+        RandomGenerator* m_ownRandomGenerator;
+
+        uint32_t	m_frameBudget;
+        uint32_t	m_frame;
+        uint32_t	m_lastFrameCost;
+        behaviac::vector<Agent*> m_deferredAgents;
+
+        behaviac::vector<int> m_lodTickIntervals;
+        behaviac::vector<uint32_t> m_lodPhases;
+
+        BatchExecutor* m_batchExecutor;
+        behaviac::vector<Agent*> m_batchAgents;
+
+        TickRecorder* m_tickRecorder;
     };
     /*! @} */
     /*! @} */
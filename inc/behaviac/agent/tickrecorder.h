@@ -0,0 +1,305 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Tencent is pleased to support the open source community by making behaviac available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except in compliance with
+// the License. You may obtain a copy of the License at http://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and limitations under the License.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _BEHAVIAC_TICKRECORDER_H_
+#define _BEHAVIAC_TICKRECORDER_H_
+
+#include "behaviac/common/base.h"
+#include "behaviac/common/container/vector.h"
+#include "behaviac/common/container/map.h"
+
+#include <string.h>
+
+namespace behaviac
+{
+    class Agent;
+    class Context;
+
+    /*! \addtogroup Agent
+    * @{
+    * \addtogroup TickRecorder
+    * @{ */
+
+    /// the types of the values a trace keeps, the others are recorded as TVT_None without their values
+    enum ETraceValueType
+    {
+        TVT_None = 0,
+        TVT_Bool,
+        TVT_Char,
+        TVT_UChar,
+        TVT_Short,
+        TVT_UShort,
+        TVT_Int,
+        TVT_UInt,
+        TVT_Long,
+        TVT_ULong,
+        TVT_LongLong,
+        TVT_ULongLong,
+        TVT_Float,
+        TVT_Double
+    };
+
+    template<typename T> struct TraceValueType
+    {
+        enum { Value = TVT_None };
+    };
+
+#define BEHAVIAC_TRACE_VALUE_TYPE(T, V)			\
+    template<> struct TraceValueType<T>			\
+    {											\
+        enum { Value = V };						\
+    };
+
+    BEHAVIAC_TRACE_VALUE_TYPE(bool, TVT_Bool)
+    BEHAVIAC_TRACE_VALUE_TYPE(char, TVT_Char)
+    BEHAVIAC_TRACE_VALUE_TYPE(unsigned char, TVT_UChar)
+    BEHAVIAC_TRACE_VALUE_TYPE(short, TVT_Short)
+    BEHAVIAC_TRACE_VALUE_TYPE(unsigned short, TVT_UShort)
+    BEHAVIAC_TRACE_VALUE_TYPE(int, TVT_Int)
+    BEHAVIAC_TRACE_VALUE_TYPE(unsigned int, TVT_UInt)
+    BEHAVIAC_TRACE_VALUE_TYPE(long, TVT_Long)
+    BEHAVIAC_TRACE_VALUE_TYPE(unsigned long, TVT_ULong)
+    BEHAVIAC_TRACE_VALUE_TYPE(long long, TVT_LongLong)
+    BEHAVIAC_TRACE_VALUE_TYPE(unsigned long long, TVT_ULongLong)
+    BEHAVIAC_TRACE_VALUE_TYPE(float, TVT_Float)
+    BEHAVIAC_TRACE_VALUE_TYPE(double, TVT_Double)
+
+#undef BEHAVIAC_TRACE_VALUE_TYPE
+
+    /// a value of a write or of an event param
+    struct TraceValue_t
+    {
+        uint32_t	type;
+        uint8_t		bytes[8];
+
+        template<typename T>
+        void Set(const T& value)
+        {
+            this->type = TraceValueType<T>::Value;
+            memset(this->bytes, 0, sizeof(this->bytes));
+
+            if (this->type != TVT_None && sizeof(T) <= sizeof(this->bytes))
+            {
+                memcpy(this->bytes, &value, sizeof(T));
+            }
+        }
+    };
+
+    /// the header of the trace written by TickRecorder::SaveTrace, in the native byte order
+    struct TraceHeader
+    {
+        enum
+        {
+            kMagic = 0x52545442,	//"BTTR"
+            kVersion = 2
+        };
+
+        uint32_t	magic;
+        uint32_t	version;
+
+        /// the size of the whole trace including this header
+        uint32_t	size;
+
+        /// the number of the frames in the trace
+        uint32_t	frameCount;
+    };
+
+    /**
+    records what is needed to tick the agents of a context again into a ring buffer of binary records.
+
+    each frame begins with the state of the random generator of the context and the time and the frame since startup
+    of the workspace, every 'keyframeInterval' frames it is followed by the snapshots of all the agents
+    (see Agent::btsavesnapshot). then it records the agents ticked,
+    and between the ticks, the variables set by SetVariable and the events fired by FireEvent. what the ticks do
+    themselves is not recorded, it is done again by the replay.
+
+    the oldest records are overwritten when the ring is full, SaveTrace keeps the frames since the oldest keyframe left.
+    the members of the agents are only in the trace as far as they are set by SetVariable, and only the values of
+    the TraceValueType types are recorded.
+
+    @sa Context::StartRecording TickReplay
+    */
+    class BEHAVIAC_API TickRecorder
+    {
+    public:
+        enum ERecordType
+        {
+            TRT_Frame = 1,
+            TRT_Snapshot,
+            TRT_Tick,
+            TRT_Write,
+            TRT_Event
+        };
+
+        struct Record_t
+        {
+            uint8_t		type;
+            uint8_t		valueType;
+            uint16_t	count;
+            int32_t		agentId;
+
+            //the size of the record including this header, a multiple of 4
+            uint32_t	size;
+        };
+
+        struct Frame_t
+        {
+            uint32_t	frame;
+            uint32_t	seed;
+            uint32_t	bKeyframe;
+
+            //Workspace::GetFrameSinceStartup, -1 if it is not set
+            int32_t		frameSinceStartup;
+
+            //the double of Workspace::GetTimeSinceStartup, the records are only aligned to 4 bytes
+            uint8_t		timeSinceStartup[8];
+        };
+
+        struct Stats_t
+        {
+            uint32_t	frames;
+            uint32_t	keyframes;
+
+            //the records overwritten to make room for the new ones
+            uint32_t	overwritten;
+
+            //the records too big for the ring
+            uint32_t	dropped;
+        };
+
+        TickRecorder(uint32_t bufferSize, uint32_t keyframeInterval);
+        ~TickRecorder();
+
+        uint32_t GetKeyframeInterval() const
+        {
+            return this->m_keyframeInterval;
+        }
+
+        const Stats_t& GetStats() const
+        {
+            return this->m_stats;
+        }
+
+        /**
+        copy the records since the oldest keyframe into 'trace' with a TraceHeader ahead of them
+
+        @return false if there is no keyframe in the ring
+        */
+        bool SaveTrace(behaviac::vector<uint8_t>& trace) const;
+
+        /// Context::execAgents begins a frame, it is to be called when the agents are ticked by btexec instead
+        void BeginFrame(Context& context);
+
+        void BeginTick(Agent* pAgent);
+        void EndTick(Agent* pAgent);
+
+        void RecordWrite(Agent* pAgent, uint32_t variableId, const TraceValue_t& value);
+        void RecordEvent(Agent* pAgent, const char* eventName, int paramCount, const TraceValue_t* params);
+
+    private:
+        uint8_t* reserve(uint8_t type, int32_t agentId, uint32_t payloadSize);
+        void evictOldest();
+        void recordKeyframe(Context& context);
+
+        const Record_t* next(const Record_t* pRecord) const;
+
+        uint8_t*	m_buffer;
+        uint32_t	m_bufferSize;
+
+        //the records are in [m_begin, m_wrap) and [0, m_end) if m_bWrapped, otherwise in [m_begin, m_end)
+        uint32_t	m_begin;
+        uint32_t	m_end;
+        uint32_t	m_wrap;
+        bool		m_bWrapped;
+        uint32_t	m_count;
+
+        uint32_t	m_keyframeInterval;
+        uint32_t	m_frame;
+        Agent*		m_tickingAgent;
+        Stats_t		m_stats;
+    };
+
+    /**
+    ticks the agents of a trace saved by TickRecorder::SaveTrace again, frame by frame.
+
+    the agents are created by 'creator' and restored from the first keyframe of the trace, the agents only in the later
+    keyframes are created when they are met. before each frame, the random generator of 'contextId' and the time and
+    the frame since startup of the workspace are set to the state recorded, the frames whose random generator was not in
+    it already are counted as diverged, which means that the state not in the trace made the ticks different.
+    */
+    class BEHAVIAC_API TickReplay
+    {
+    public:
+        typedef Agent* (*AgentCreator_t)(const char* agentType, int contextId, void* pUserData);
+
+        TickReplay();
+        ~TickReplay();
+
+        /// the trace is referenced, it needs to be kept until the replay is done
+        bool Open(const void* trace, uint32_t size, int contextId, AgentCreator_t creator, void* pUserData);
+
+        /// replay a frame, return false if there is no frame left
+        bool ReplayFrame();
+
+        uint32_t GetFrameCount() const
+        {
+            return this->m_frameCount;
+        }
+
+        uint32_t GetReplayedFrameCount() const
+        {
+            return this->m_replayedCount;
+        }
+
+        /// the frames whose random generator was not in the state recorded
+        uint32_t GetDivergedFrameCount() const
+        {
+            return this->m_divergedCount;
+        }
+
+        /// the records which couldn't be replayed, e.g. the writes of the values not recorded
+        uint32_t GetSkippedCount() const
+        {
+            return this->m_skippedCount;
+        }
+
+        /// the agent created for the agent of 'recordedId' in the trace
+        Agent* GetAgent(int recordedId) const;
+
+        /// the agents created, they are to be destroyed by the caller
+        void GetAgents(behaviac::vector<Agent*>& agents) const;
+
+    private:
+        bool restore(const TickRecorder::Record_t* pRecord, bool bCreateOnly);
+        void write(Agent* pAgent, uint32_t variableId, const TraceValue_t& value);
+        void fire(Agent* pAgent, const char* eventName, int paramCount, const TraceValue_t* params);
+
+        const uint8_t*	m_trace;
+        uint32_t		m_size;
+        uint32_t		m_offset;
+        uint32_t		m_frameCount;
+        uint32_t		m_replayedCount;
+        uint32_t		m_divergedCount;
+        uint32_t		m_skippedCount;
+        int				m_contextId;
+        AgentCreator_t	m_creator;
+        void*			m_pUserData;
+
+        typedef behaviac::map<int, Agent*> Agents_t;
+        Agents_t		m_agents;
+    };
+    /*! @} */
+    /*! @} */
+}
+
+#endif//_BEHAVIAC_TICKRECORDER_H_
@@ -49,7 +49,7 @@ namespace behaviac
         class ActionConfig
         {
         public:
-            behaviac::string m_typeName;
+            CStringAtom			m_typeName;
             IInstanceMember*		m_opl;
             IInstanceMember*        m_opr1;
             EOperatorType	    m_operator ;
@@ -19,6 +19,8 @@
 #include "behaviac/common/rttibase.h"
 #include "behaviac/common/object/tagobject.h"
 #include "behaviac/common/factory.h"
+#include "behaviac/common/string/stringatom.h"
+#include "behaviac/common/thread/wrapper.h"
 
 #include "behaviac/common/workspace.h"
 
@@ -209,6 +211,20 @@ namespace behaviac
         }
 
         void Clear();
+
+        /// the attachments are owned by their node, they are deleted and 'attachments' is emptied
+        template<typename T>
+        static void DeleteAttachments(behaviac::vector<T*>& attachments)
+        {
+            for (size_t i = 0; i < attachments.size(); ++i)
+            {
+                BehaviorNode* pAttachment = attachments[i];
+                BEHAVIAC_DELETE(pAttachment);
+            }
+
+            attachments.clear();
+        }
+
         virtual bool CheckPreconditions(const Agent* pAgent, bool bIsAlive) const;
         virtual void ApplyEffects(Agent* pAgent, BehaviorNode::EPhase phase) const;
         bool CheckEvents(const char* eventName, Agent* pAgent, behaviac::map<uint32_t, IInstantiatedVariable*>* eventParams) const;
@@ -222,6 +238,23 @@ namespace behaviac
             return false;
         }
 
+        //collect the ids of the properties and the variables which the result of the node depends on,
+        //returns false if they can't be known, i.e. the node is not a pure condition or it has attachments.
+        virtual bool GetInputIds(behaviac::vector<uint32_t>& inputIds) const;
+
+        //return true if 'node' is loaded from the same content as this node, i.e. the same id, class, properties,
+        //attachments and custom condition. the children are not compared but their count.
+        bool HasSameContent(const BehaviorNode* node) const;
+
+        //the precomputed "treeName.xml->ClassName[id]" used by the tick info, empty if it is not built or it depends on the agent
+        CStringAtom GetTickInfoDescriptor() const
+        {
+            return this->m_tickInfoDescriptor;
+        }
+
+        //build the descriptors of this node and its descendants, it is called after the tree is loaded
+        void BuildTickInfoDescriptors(const behaviac::string& treeName);
+
         //return true for Parallel, SelectorLoop, etc., which is responsible to update all its children just like sub trees
         //so that they are treated as a return-running node and the next update will continue them.
         virtual bool IsManagingChildrenAsSubTrees() const;
@@ -260,13 +293,18 @@ namespace behaviac
         virtual EBTStatus update_impl(Agent* pAgent, EBTStatus childStatus);
 
         void SetClassNameString(const char* className);
-        const behaviac::string& GetClassNameString() const;
+        CStringAtom GetClassNameString() const;
 
 		int16_t GetId() const;
 		void SetId(int16_t id);
 
         void SetAgentType(const behaviac::string& agentType);
 
+        bool HasAttachments() const;
+
+        void CombineSignature(uint32_t value);
+        void CombineAttachmentSignature(const BehaviorNode* pAttachment, bool bIsPrecondition, bool bIsEffector, bool bIsTransition);
+
         bool EvaluteCustomCondition(const Agent* pAgent);
         void SetCustomCondition(BehaviorNode* node);
 
@@ -277,9 +315,14 @@ namespace behaviac
         static CFactory<BehaviorNode>* ms_factory;
         behaviac::vector<BehaviorNode*>	m_preconditions;
 
-        behaviac::string		m_className;
-        behaviac::string		m_agentType;
+        //interned, the nodes of all the trees share the same strings
+        CStringAtom				m_className;
+        CStringAtom				m_agentType;
+        CStringAtom				m_tickInfoDescriptor;
 		int16_t					m_id;
+
+        //hash of the loaded properties and attachments, used to patch the running tasks when the tree is hot reloaded
+        uint32_t				m_signature;
         char					m_enter_precond;
         char					m_update_precond;
         char					m_both_precond;
@@ -289,6 +332,11 @@ namespace behaviac
         behaviac::vector<BehaviorNode*>		m_effectors;
         behaviac::vector<BehaviorNode*>		m_events;
 
+        //the preconditions and the effectors sorted by their phases when they are attached,
+        //it is only created for the nodes having any of them
+        struct AttachmentProgram;
+        AttachmentProgram*					m_attachmentProgram;
+
     protected:
         
 
@@ -377,6 +425,29 @@ namespace behaviac
 
         void AddPar(const char* agentType, const char* typeName, const char* name, const char* value);
 
+        /**
+        the count of the tasks of the tree and the tree itself, it is freed by the last one released
+        so that a task destroyed after its tree doesn't touch the tree.
+        */
+        struct TaskRefs_t
+        {
+            volatile Atomic32	refs;
+        };
+
+        static TaskRefs_t* AcquireTaskRefs(TaskRefs_t* taskRefs);
+        static void ReleaseTaskRefs(TaskRefs_t* taskRefs);
+
+        TaskRefs_t* GetTaskRefs() const
+        {
+            return this->m_taskRefs;
+        }
+
+        //true if a task still uses the tree
+        bool HasTasks() const
+        {
+            return this->m_taskRefs->refs > 1;
+        }
+
     protected:
         BEHAVIAC_DECLARE_MEMORY_OPERATORS(BehaviorTree);
         BEHAVIAC_DECLARE_DYNAMIC_TYPE(BehaviorTree, BehaviorNode);
@@ -397,6 +468,7 @@ namespace behaviac
         bool					m_bIsFSM;
         behaviac::string		m_name;
         behaviac::string		m_domains;
+        TaskRefs_t*				m_taskRefs;
         //Descriptors_t			m_descriptorRefs;
         friend class BehaviorTreeTask;
         friend class BehaviorNode;
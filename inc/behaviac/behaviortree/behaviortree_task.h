@@ -19,6 +19,7 @@
 #include "behaviac/common/rttibase.h"
 #include "behaviac/common/object/tagobject.h"
 #include "behaviac/behaviortree/behaviortree.h"
+#include "behaviac/common/serialization/snapshot.h"
 
 namespace behaviac
 {
@@ -70,6 +71,15 @@ namespace behaviac
         static behaviac::string GetTickInfo(const behaviac::Agent* pAgent, const behaviac::BehaviorNode* n, const char* action);
         static behaviac::string GetTickInfo(const behaviac::Agent* pAgent, const behaviac::BehaviorTask* b, const char* action);
 
+        /**
+        write the tick info, e.g. "TestBehaviorGroup\scratch.xml->EventetTask[0]:enter", into 'buffer' without any allocation,
+        it is truncated if 'bufferSize' is not enough.
+
+        @return the length written, 0 if there is no tick info, i.e. the agent is not masked or it is an intermediate node
+        */
+        static uint32_t GetTickInfo(const behaviac::Agent* pAgent, const behaviac::BehaviorNode* n, const char* action, char* buffer, uint32_t bufferSize);
+        static uint32_t GetTickInfo(const behaviac::Agent* pAgent, const behaviac::BehaviorTask* b, const char* action, char* buffer, uint32_t bufferSize);
+
     public:
         BEHAVIAC_DECLARE_MEMORY_OPERATORS(BehaviorTask);
         BEHAVIAC_DECLARE_ROOT_DYNAMIC_TYPE(BehaviorTask, CRTTIBase);
@@ -79,7 +89,17 @@ namespace behaviac
         virtual void save(IIONode* node) const = 0;
         virtual void load(IIONode* node) = 0;
 
-        const behaviac::string& GetClassNameString() const;
+        /**
+        write the status and the small state of this task and its children into the binary snapshot.
+
+        the tasks are written in the order of the tree so that they are read back in place into a tree of the same behavior.
+        */
+        virtual void saveSnapshot(SnapshotWriter& writer) const;
+
+        /// return false if the snapshot doesn't match this task, i.e. it is of another behavior
+        virtual bool loadSnapshot(Agent* pAgent, SnapshotReader& reader);
+
+        CStringAtom GetClassNameString() const;
         uint16_t GetId() const;
         void SetId(uint16_t id);
 
@@ -145,6 +165,16 @@ namespace behaviac
         virtual const BehaviorTask* GetTaskById(int id) const;
         virtual int GetNextStateId() const;
 
+        /**
+        rebind the task to 'node', which is the same node loaded again from the modified behavior file.
+
+        the tasks of the unchanged nodes keep their states, the tasks of the changed nodes are recreated if they are not running.
+        it is done in two passes, the first one with bApply false only checks, the second one with bApply true patches.
+
+        @return false if it can't be patched, i.e. the node of a running task is changed
+        */
+        virtual bool patch(const BehaviorNode* node, bool bApply);
+
     protected:
         BehaviorTask();
         virtual ~BehaviorTask();
@@ -257,6 +287,8 @@ namespace behaviac
         virtual void copyto(BehaviorTask* target) const;
         virtual void save(IIONode* node) const;
         virtual void load(IIONode* node);
+        virtual void saveSnapshot(SnapshotWriter& writer) const;
+        virtual bool loadSnapshot(Agent* pAgent, SnapshotReader& reader);
 
         EBTStatus execCurrentTask(Agent* pAgent, EBTStatus childStatus);
 
@@ -284,6 +316,8 @@ namespace behaviac
 
         virtual void traverse(bool childFirst, NodeHandler_t handler, Agent* pAgent, void* user_data);
         BehaviorTask* GetChildById(int nodeId) const;
+
+        virtual bool patch(const BehaviorNode* node, bool bApply);
     protected:
         CompositeTask();
         virtual ~CompositeTask();
@@ -292,6 +326,8 @@ namespace behaviac
         virtual void copyto(BehaviorTask* target) const;
         virtual void save(IIONode* node) const;
         virtual void load(IIONode* node);
+        virtual void saveSnapshot(SnapshotWriter& writer) const;
+        virtual bool loadSnapshot(Agent* pAgent, SnapshotReader& reader);
 
         virtual void addChild(BehaviorTask* pBehavior);
         virtual const BehaviorTask* GetTaskById(int id) const;
@@ -312,6 +348,8 @@ namespace behaviac
         BEHAVIAC_DECLARE_DYNAMIC_TYPE(SingeChildTask, BranchTask);
 
         virtual void traverse(bool childFirst, NodeHandler_t handler, Agent* pAgent, void* user_data);
+
+        virtual bool patch(const BehaviorNode* node, bool bApply);
     protected:
         SingeChildTask();
         virtual ~SingeChildTask();
@@ -320,6 +358,8 @@ namespace behaviac
         virtual void copyto(BehaviorTask* target) const;
         virtual void save(IIONode* node) const;
         virtual void load(IIONode* node);
+        virtual void saveSnapshot(SnapshotWriter& writer) const;
+        virtual bool loadSnapshot(Agent* pAgent, SnapshotReader& reader);
 
         virtual EBTStatus update(Agent* pAgent, EBTStatus childStatus);
 
@@ -374,6 +414,9 @@ namespace behaviac
         void Save(IIONode* node) const;
         void Load(IIONode* node);
 
+        void SaveSnapshot(SnapshotWriter& writer) const;
+        bool LoadSnapshot(Agent* pAgent, SnapshotReader& reader);
+
         EBTStatus resume(Agent* pAgent, EBTStatus status);
 
 		template<typename VariableType>
@@ -386,6 +429,8 @@ namespace behaviac
         const behaviac::string& GetName() const;
 
         void Clear();
+
+        virtual bool patch(const BehaviorNode* node, bool bApply);
     protected:
         BEHAVIAC_DECLARE_MEMORY_OPERATORS(BehaviorTreeTask);
         BEHAVIAC_DECLARE_DYNAMIC_TYPE(BehaviorTreeTask, SingeChildTask);
@@ -397,6 +442,8 @@ namespace behaviac
         virtual void copyto(BehaviorTask* target) const;
         virtual void save(IIONode* node) const;
         virtual void load(IIONode* node);
+        virtual void saveSnapshot(SnapshotWriter& writer) const;
+        virtual bool loadSnapshot(Agent* pAgent, SnapshotReader& reader);
 
         virtual bool onenter(Agent* pAgent);
         virtual void onexit(Agent* pAgent, EBTStatus s);
@@ -415,6 +462,8 @@ namespace behaviac
     private:
         bool load(const char* file);
 
+        //keeps the retired tree of a hot reload until the task is done with it
+        BehaviorTree::TaskRefs_t* m_treeRefs;
     };
 } // namespace behaviac
 
@@ -14,6 +14,8 @@
 #ifndef _BEHAVIAC_GENERATOR_H_
 #define _BEHAVIAC_GENERATOR_H_
 
+#include "behaviac/behaviortree/nodes/actions/action.h"
+
 /*
 void generator_test()
 {
@@ -63,4 +65,51 @@ struct _generator
     _rv = (V); return true; case __LINE__:;\
     } while (0)
 
+/*
+the resumable method of an action or a state, its continuation is kept in the ActionTask, the PlannerTaskAction
+or the StateTask, see ResumeState_t
+
+behaviac::EBTStatus AgentActionTest::Walk(int steps)
+{
+    $resumable_state(this);
+
+    // the locals used across the suspensions are in the slots of the state
+    int& i = _rs.ints[0];
+
+    $resumable_begin
+
+    for (i = 0; i < steps; ++i)
+    {
+        this->Step();
+        $suspend; // returns BT_RUNNING, the next tick continues from here
+    }
+
+    $resumable_end(behaviac::BT_SUCCESS);
+}
+
+$resumable(this) is $resumable_state(this) and $resumable_begin for a method which needs no locals.
+when the method is not executed by one of those tasks, e.g. it is called directly, it asserts and
+runs with a state of its own, so that it always starts from the beginning.
+*/
+
+#define $resumable_state(AGENT) \
+    behaviac::ResumeState_t _rsLocal; \
+    behaviac::ResumeState_t& _rs = (AGENT)->GetResumeState() ? *(AGENT)->GetResumeState() : _rsLocal; \
+    BEHAVIAC_ASSERT(&_rs != &_rsLocal, "not executed by an action or a state, it can't be resumed")
+
+#define $resumable_begin \
+    switch(_rs.point) { case 0:;
+
+#define $resumable(AGENT) \
+    $resumable_state(AGENT); \
+    $resumable_begin
+
+#define $suspend  \
+    do {\
+        _rs.point=__LINE__;\
+    return behaviac::BT_RUNNING; case __LINE__:;\
+    } while (0)
+
+#define $resumable_end(S)  } _rs.point = 0; return (S);
+
 #endif//_BEHAVIAC_GENERATOR_H_
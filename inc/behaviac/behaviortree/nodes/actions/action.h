@@ -26,6 +26,41 @@ namespace behaviac
     * \addtogroup Action
     * @{ */
 
+    /**
+    the continuation of a resumable action, it is kept in the ActionTask between the ticks,
+    or in the PlannerTaskAction or the StateTask for the actions of a plan and the states of a fsm.
+
+    a method of an action gets it by Agent::GetResumeState while it is executed, and uses it with
+    $resumable/$suspend/$resumable_end of generator.h to continue where it suspended at the next tick,
+    the locals it needs across the suspensions are kept in 'ints' and 'floats'.
+    it is reset when the action is entered, so that the method starts from the beginning.
+    */
+    struct BEHAVIAC_API ResumeState_t
+    {
+        static const int kSlotCount = 4;
+
+        ResumeState_t()
+        {
+            this->Reset();
+        }
+
+        void Reset()
+        {
+            this->point = 0;
+
+            for (int i = 0; i < kSlotCount; ++i)
+            {
+                this->ints[i] = 0;
+                this->floats[i] = 0.0f;
+            }
+        }
+
+        ///0 to start from the beginning, otherwise where it suspended
+        int32_t		point;
+        int32_t		ints[kSlotCount];
+        float		floats[kSlotCount];
+    };
+
     ///An action is a member function of agent
     /**
     Action node is the bridge between behavior tree and agent member function.
@@ -70,10 +105,18 @@ namespace behaviac
         virtual void copyto(BehaviorTask* target) const;
         virtual void save(IIONode* node) const;
         virtual void load(IIONode* node);
+        virtual void saveSnapshot(SnapshotWriter& writer) const;
+        virtual bool loadSnapshot(Agent* pAgent, SnapshotReader& reader);
 
         virtual bool onenter(Agent* pAgent);
         virtual void onexit(Agent* pAgent, EBTStatus s);
         virtual EBTStatus update(Agent* pAgent, EBTStatus childStatus);
+
+    private:
+        ResumeState_t		m_resumeState;
+
+        //the async work its method started, see Agent::BeginAsync
+        uint32_t			m_asyncToken;
     };
     /*! @} */
     /*! @} */
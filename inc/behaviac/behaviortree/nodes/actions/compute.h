@@ -89,7 +89,7 @@ namespace behaviac
 
         EOperatorType	            m_operator;
 
-        behaviac::string	m_typeName;
+        CStringAtom		m_typeName;
 
         friend class ComputeTask;
     };
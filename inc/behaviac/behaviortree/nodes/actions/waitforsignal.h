@@ -58,6 +58,8 @@ namespace behaviac
         virtual void copyto(BehaviorTask* target) const;
         virtual void save(IIONode* node) const;
         virtual void load(IIONode* node);
+        virtual void saveSnapshot(SnapshotWriter& writer) const;
+        virtual bool loadSnapshot(Agent* pAgent, SnapshotReader& reader);
 
         virtual void Init(const BehaviorNode* node);
         virtual bool onenter(Agent* pAgent);
@@ -62,6 +62,8 @@ namespace behaviac
         virtual void copyto(BehaviorTask* target) const;
         virtual void save(IIONode* node) const;
         virtual void load(IIONode* node);
+        virtual void saveSnapshot(SnapshotWriter& writer) const;
+        virtual bool loadSnapshot(Agent* pAgent, SnapshotReader& reader);
 
         virtual bool onenter(Agent* pAgent);
         virtual void onexit(Agent* pAgent, EBTStatus s);
@@ -31,6 +31,9 @@ namespace behaviac
     one's precondtion node returns success, it picks it and execute it, and before executing,
     it first cleans up the original executing one. all its children are WithPreconditionTask
     or its derivatives.
+
+    when 'ReevaluateOnChange' is set, a precondition which failed is not executed again until
+    any of its inputs is changed, see WithPrecondition::DeclareInput and Agent::NotifyVariableChanged.
     */
     class BEHAVIAC_API SelectorLoop : public BehaviorNode
     {
@@ -41,10 +44,15 @@ namespace behaviac
         virtual ~SelectorLoop();
         virtual void load(int version, const char* agentType, const properties_t& properties);
         virtual bool IsManagingChildrenAsSubTrees() const;
+
+        void SetReevaluateOnChange(bool bReevaluateOnChange);
+        bool IsReevaluateOnChange() const;
     protected:
         virtual bool IsValid(Agent* pAgent, BehaviorTask* pTask) const;
     private:
         virtual BehaviorTask* createTask() const;
+
+        bool		m_bReevaluateOnChange;
         //protected:
         //	Nodes*		m_preconditions;
         //	Nodes*		m_actions;
@@ -63,11 +71,18 @@ namespace behaviac
         virtual void copyto(BehaviorTask* target) const;
         virtual void save(IIONode* node) const;
         virtual void load(IIONode* node);
+        virtual bool loadSnapshot(Agent* pAgent, SnapshotReader& reader);
 
         virtual bool onenter(Agent* pAgent);
         virtual void onexit(Agent* pAgent, EBTStatus s);
         virtual EBTStatus update_current(Agent* pAgent, EBTStatus childStatus);
         virtual EBTStatus update(Agent* pAgent, EBTStatus childStatus);
+
+    private:
+        EBTStatus execPrecondition(Agent* pAgent, uint32_t index);
+
+        //the change stamp of the agent when the precondition failed, 0 if it needs to be executed
+        behaviac::vector<uint64_t>	m_failedStamps;
     };
     /*! @} */
     /*! @} */
@@ -38,10 +38,30 @@ namespace behaviac
         WithPrecondition();
         virtual ~WithPrecondition();
         virtual void load(int version, const char* agentType, const properties_t& properties);
+
+        /**
+        declare a property, a variable or an event which the precondition depends on.
+        the inputs are inferred from the precondition if it only consists of Condition/And/Or/True/False comparing
+        the properties or the variables of 'Self', the declared ones are needed when it can't be inferred,
+        e.g. methods are called. it is used by SelectorLoop when its 'ReevaluateOnChange' is set.
+        */
+        void DeclareInput(const char* name);
+
+        bool IsInputKnown() const;
+        bool IsInputChangedSince(const Agent* pAgent, uint64_t stamp) const;
+
     protected:
         virtual bool IsValid(Agent* pAgent, BehaviorTask* pTask) const;
     private:
         virtual BehaviorTask* createTask() const;
+
+        //at the first use, the generated trees add a node before its own children
+        void inferInput_() const;
+
+        mutable behaviac::vector<uint32_t>	m_inputIds;
+        mutable bool						m_bInputInferred;
+        mutable Atomic32					m_bInputResolved;
+        bool								m_bInputDeclared;
     };
 
     class BEHAVIAC_API WithPreconditionTask : public SequenceTask
@@ -38,6 +38,7 @@ namespace behaviac
         virtual ~And();
         virtual void load(int version, const char* agentType, const properties_t& properties);
         virtual bool Evaluate(Agent* pAgent);
+        virtual bool GetInputIds(behaviac::vector<uint32_t>& inputIds) const;
     protected:
         virtual bool IsValid(Agent* pAgent, BehaviorTask* pTask) const;
     private:
@@ -92,6 +92,10 @@ namespace behaviac
         virtual void load(int version, const char* agentType, const properties_t& properties);
         virtual bool Evaluate(Agent* pAgent);
 
+        /// Evaluate for each of the 'count' agents into 'results', the operands are compared in a batch
+        virtual void EvaluateBatch(Agent* const* agents, int count, bool* results);
+        virtual bool GetInputIds(behaviac::vector<uint32_t>& inputIds) const;
+
     protected:
         virtual bool IsValid(Agent* pAgent, BehaviorTask* pTask) const;
 
@@ -37,6 +37,7 @@ namespace behaviac
         True();
         virtual ~True();
         virtual void load(int version, const char* agentType, const properties_t& properties);
+        virtual bool GetInputIds(behaviac::vector<uint32_t>& inputIds) const;
     protected:
         virtual bool IsValid(Agent* pAgent, BehaviorTask* pTask) const;
     private:
@@ -0,0 +1,230 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Tencent is pleased to support the open source community by making behaviac available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except in compliance with
+// the License. You may obtain a copy of the License at http://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and limitations under the License.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _BEHAVIAC_COMMON_CONTAINER_MPSCRING_H_
+#define _BEHAVIAC_COMMON_CONTAINER_MPSCRING_H_
+
+#include "behaviac/common/thread/wrapper.h"
+
+#include <cstring>
+
+namespace behaviac
+{
+    /**
+    a ring of the variable sized records written by any number of threads and read by one thread.
+
+    a writer reserves its record by moving the write index with a compare-exchange, fills the data in place
+    and commits it. the reader reads the committed records in the order they are reserved, so the records
+    of the different threads need no sorting, and releases them once it is done with them.
+
+    a record never wraps around the end of the ring, so that its data is always in one block.
+    */
+    template<uint32_t TSize>
+    class MPSCRing
+    {
+    public:
+        struct Record
+        {
+            // the bytes from this record to the next one, 0 until it is committed
+            uint32_t	size;
+
+            // the bytes of the data following the header, kPadding if it only skips the end of the ring
+            uint32_t	dataSize;
+
+            // any word the writer passes to the reader
+            uint32_t	tag;
+
+            // the write index it is reserved at
+            uint32_t	index;
+
+            uint8_t* GetData()
+            {
+                return (uint8_t*)(this + 1);
+            }
+        };
+
+        static const uint32_t kPadding = 0xFFFFFFFF;
+
+        MPSCRing() : m_writeIndex(0), m_readIndex(0)
+        {
+            memset(m_buffer, 0, sizeof(m_buffer));
+        }
+
+        static uint32_t GetRecordSize(uint32_t dataSize)
+        {
+            return (sizeof(Record) + dataSize + sizeof(Record) - 1) & ~(uint32_t)(sizeof(Record) - 1);
+        }
+
+        /**
+        return the data of a new record of 'dataSize' bytes, 0 if there is no space for it.
+        the record is not read until it is committed by Commit.
+        */
+        uint8_t* Reserve(uint32_t dataSize, uint32_t tag)
+        {
+            const uint32_t recordSize = GetRecordSize(dataSize);
+
+            if (recordSize > TSize)
+            {
+                return 0;
+            }
+
+            for (;;)
+            {
+                const Atomic32 writeIndex = Load_Acquire(m_writeIndex);
+                const uint32_t offset = (uint32_t)writeIndex & (TSize - 1);
+                const uint32_t padding = (offset + recordSize > TSize) ? (TSize - offset) : 0;
+                const uint32_t used = (uint32_t)writeIndex - (uint32_t)Load_Acquire(m_readIndex);
+
+                if (used + padding + recordSize > TSize)
+                {
+                    return 0;
+                }
+
+                const Atomic32 nextIndex = (Atomic32)((uint32_t)writeIndex + padding + recordSize);
+
+                if (AtomicCompareExchange(m_writeIndex, nextIndex, writeIndex) != writeIndex)
+                {
+                    continue;
+                }
+
+                if (padding > 0)
+                {
+                    Record* pPadding = (Record*)(m_buffer + offset);
+                    pPadding->dataSize = kPadding;
+                    pPadding->tag = 0;
+                    pPadding->index = (uint32_t)writeIndex;
+                    Store_Release(pPadding->size, padding);
+                }
+
+                Record* pRecord = (Record*)(m_buffer + (offset + padding) % TSize);
+                pRecord->dataSize = dataSize;
+                pRecord->tag = tag;
+                pRecord->index = (uint32_t)writeIndex + padding;
+
+                return pRecord->GetData();
+            }
+        }
+
+        /**
+        'pData' is returned by Reserve
+        */
+        void Commit(uint8_t* pData)
+        {
+            Record* pRecord = (Record*)pData - 1;
+
+            Store_Release(pRecord->size, GetRecordSize(pRecord->dataSize));
+        }
+
+        /**
+        for the reader only, the index to read the records from
+        */
+        uint32_t GetReadIndex() const
+        {
+            return (uint32_t)Load_Relaxed(m_readIndex);
+        }
+
+        /**
+        for the reader only, return the committed record at 'readIndex' and move it to the next record,
+        0 if the record there is not committed yet.
+
+        the records read are still kept until Release, so they can be read again from the same index.
+        */
+        Record* Read(uint32_t& readIndex)
+        {
+            for (;;)
+            {
+                //beyond it are the records read before, which are not released yet
+                if (readIndex == (uint32_t)Load_Acquire(m_writeIndex))
+                {
+                    return 0;
+                }
+
+                Record* pRecord = (Record*)(m_buffer + (readIndex & (TSize - 1)));
+                const uint32_t size = Load_Acquire(pRecord->size);
+
+                if (size == 0)
+                {
+                    return 0;
+                }
+
+                readIndex += size;
+
+                if (pRecord->dataSize != kPadding)
+                {
+                    return pRecord;
+                }
+            }
+        }
+
+        /**
+        for the reader only, the records before 'readIndex' are released and their space is to be reserved again
+        */
+        void Release(uint32_t readIndex)
+        {
+            const uint32_t index = this->GetReadIndex();
+            const uint32_t offset = index & (TSize - 1);
+            const uint32_t bytes = readIndex - index;
+
+            //the headers reserved later are not to be seen committed before they are
+            if (offset + bytes > TSize)
+            {
+                memset(m_buffer + offset, 0, TSize - offset);
+                memset(m_buffer, 0, bytes - (TSize - offset));
+            }
+            else
+            {
+                memset(m_buffer + offset, 0, bytes);
+            }
+
+            Store_Release(m_readIndex, (Atomic32)readIndex);
+        }
+
+        /**
+        for the reader only, release all the committed records without reading them
+        */
+        void Drop()
+        {
+            uint32_t readIndex = this->GetReadIndex();
+
+            while (this->Read(readIndex))
+            {
+            }
+
+            this->Release(readIndex);
+        }
+
+        bool IsEmpty() const
+        {
+            return (uint32_t)Load_Acquire(m_writeIndex) == (uint32_t)Load_Acquire(m_readIndex);
+        }
+
+    private:
+        MPSCRing(const MPSCRing&);
+        MPSCRing& operator=(const MPSCRing&);
+
+        static const int kCacheLineSize = 64;
+        typedef uint8_t	PadBuffer[kCacheLineSize - sizeof(Atomic32)];
+
+        BEHAVIAC_STATIC_ASSERT((TSize & (TSize - 1)) == 0);
+
+        // the writers and the reader don't share a cache line
+        PadBuffer			m_padding0;
+        Atomic32			m_writeIndex;
+        PadBuffer			m_padding1;
+        Atomic32			m_readIndex;
+        PadBuffer			m_padding2;
+        uint8_t				m_buffer[TSize];
+    };
+} // behaviac
+
+#endif//_BEHAVIAC_COMMON_CONTAINER_MPSCRING_H_
@@ -70,7 +70,7 @@ namespace behaviac
         SPSCQueue(const SPSCQueue&);
         SPSCQueue& operator=(const SPSCQueue&);
 
-        static const int kCacheLineSize = 32;
+        static const int kCacheLineSize = 64;
         typedef uint8_t	PadBuffer[kCacheLineSize - 4];
 
         uint32_t		m_pushIndex;
@@ -17,12 +17,73 @@
 #include "behaviac/common/config.h"
 #include "behaviac/common/basictypes.h"
 
+//the ids can be computed by the compiler when constexpr is supported
+#ifndef BEHAVIAC_CONSTEXPR_CRC
+#if __cplusplus >= 201103L || (defined(_MSC_VER) && _MSC_VER >= 1900)
+#define BEHAVIAC_CONSTEXPR_CRC 1
+#else
+#define BEHAVIAC_CONSTEXPR_CRC 0
+#endif
+#endif//BEHAVIAC_CONSTEXPR_CRC
+
 namespace behaviac {
 	namespace CRC32
 	{
 		BEHAVIAC_API  uint32_t CalcCRC(const char* str);
 		BEHAVIAC_API  uint32_t CalcCRCNoCase(const char* str);
+
+#if BEHAVIAC_CONSTEXPR_CRC
+		namespace Private
+		{
+			//the entries of the table used by CalcCRC
+			constexpr uint32_t TableEntry(uint32_t c, int bits)
+			{
+				return bits == 0 ? c : TableEntry((c & 1) ? (0xEDB88320u ^ (c >> 1)) : (c >> 1), bits - 1);
+			}
+
+			constexpr uint32_t UpdateB(uint32_t crc, uint8_t b)
+			{
+				return TableEntry((crc ^ b) & 0xFF, 8) ^ (crc >> 8);
+			}
+
+			//the length is mixed in at the end, the same as CalcCRC
+			constexpr uint32_t Calc(const char* str, uint32_t length, uint32_t crc)
+			{
+				return str[length] ? Calc(str, length + 1, UpdateB(crc, (uint8_t)str[length])) : UpdateB(crc, (uint8_t)length);
+			}
+		}
+
+		/// the same value as CalcCRC, evaluated at compile time when 'str' is a literal
+		constexpr uint32_t CalcCRCConst(const char* str)
+		{
+			return Private::Calc(str, 0, 0xFFFFFFFF);
+		}
+
+		template <uint32_t crc>
+		struct Constant
+		{
+			static constexpr uint32_t value = crc;
+		};
+
+		template <uint32_t crc>
+		constexpr uint32_t Constant<crc>::value;
+#endif//BEHAVIAC_CONSTEXPR_CRC
 	}
 }//
 
+/**
+the id of a variable, a method, an event, etc. the same as MakeVariableId(name), 'name' needs to be a string literal.
+
+it is computed at compile time when constexpr is supported:
+
+	float dist = pAgent->GetVariable<float>(BEHAVIAC_VARID("par_SmallDisance"));
+*/
+#if BEHAVIAC_CONSTEXPR_CRC
+#define BEHAVIAC_VARID(name)				(behaviac::CRC32::Constant<behaviac::CRC32::CalcCRCConst(name)>::value)
+#define BEHAVIAC_ASSERT_VARID(name, id)		static_assert(BEHAVIAC_VARID(name) == (id), "the id of " name " is out of date")
+#else
+#define BEHAVIAC_VARID(name)				behaviac::CRC32::CalcCRC(name)
+#define BEHAVIAC_ASSERT_VARID(name, id)		BEHAVIAC_ASSERT(behaviac::CRC32::CalcCRC(name) == (id))
+#endif//BEHAVIAC_CONSTEXPR_CRC
+
 #endif // #ifndef _BEHAVIAC_COMMON_CRC_H_
@@ -0,0 +1,123 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Tencent is pleased to support the open source community by making behaviac available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except in compliance with
+// the License. You may obtain a copy of the License at http://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and limitations under the License.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _BEHAVIAC_COMMON_BEHAVIORBUNDLE_H_
+#define _BEHAVIAC_COMMON_BEHAVIORBUNDLE_H_
+
+#include "behaviac/common/base.h"
+#include "behaviac/common/container/string.h"
+#include "behaviac/common/container/vector.h"
+
+namespace behaviac
+{
+	/**
+	a bundle is one file holding the exported trees, the index at its head maps the hashes of their relative paths
+	to where their data is. it is opened once and mapped, a tree is found by a binary search of the index,
+	without probing its extensions or opening its own file.
+
+	the layout, in the byte order of the machine writing it:
+	Header_t | Entry_t[entryCount] sorted by hash and format | the zero terminated paths | the data of the trees
+	*/
+	class BEHAVIAC_API CBehaviorBundle
+	{
+	public:
+		BEHAVIAC_DECLARE_MEMORY_OPERATORS(CBehaviorBundle);
+
+		//"BTBN"
+		static const uint32_t kMagic = 0x4E425442;
+		static const uint32_t kVersion = 1;
+
+		//the data of the trees are aligned to it
+		static const uint32_t kAlignment = 8;
+
+		struct Header_t
+		{
+			uint32_t	magic;
+			uint32_t	version;
+			uint32_t	entryCount;
+			uint32_t	pathsSize;
+		};
+
+		struct Entry_t
+		{
+			/// CRC32::CalcCRC of the relative path
+			uint32_t	hash;
+
+			/// Workspace::EFF_xml or Workspace::EFF_bson
+			uint32_t	format;
+
+			/// in the paths
+			uint32_t	pathOffset;
+
+			/// from the head of the bundle
+			uint32_t	offset;
+			uint32_t	size;
+		};
+
+		/// a tree to write into a bundle
+		struct Item_t
+		{
+			behaviac::string	relativePath;
+			uint32_t			format;
+			behaviac::string	data;
+		};
+
+		CBehaviorBundle();
+		~CBehaviorBundle();
+
+		/**
+		the file is mapped if it can be, otherwise it is read in one go through CFileManager.
+
+		@return false if it is not a valid bundle
+		*/
+		bool Open(const char* fullPath);
+		void Close();
+
+		bool IsOpen() const;
+		const char* GetFullPath() const;
+
+		uint32_t GetEntryCount() const;
+		const Entry_t& GetEntry(uint32_t index) const;
+
+		/**
+		@param formats
+		the formats accepted, the xml is preferred if there are more than one
+
+		@return 0 if 'relativePath' is not in the bundle in one of 'formats'
+		*/
+		const Entry_t* Find(const char* relativePath, uint32_t formats) const;
+
+		const char* GetPath(const Entry_t& entry) const;
+
+		/// it is in the mapped bundle, read only, and it is not zero terminated
+		const char* GetData(const Entry_t& entry) const;
+
+		static bool Write(const char* fullPath, const behaviac::vector<Item_t>& items);
+
+	private:
+		bool Validate() const;
+
+		behaviac::string	m_fullPath;
+
+		const char*			m_pData;
+		uint64_t			m_size;
+		bool				m_bMapped;
+
+		const Entry_t*		m_entries;
+		const char*			m_paths;
+		uint32_t			m_entryCount;
+		uint32_t			m_pathsSize;
+	};
+}//namespace behaviac
+
+#endif//_BEHAVIAC_COMMON_BEHAVIORBUNDLE_H_
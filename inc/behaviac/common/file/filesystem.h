@@ -122,6 +122,13 @@ namespace behaviac
 
 		static uint64_t GetFileSize(Handle hFile);
 
+		/**
+		maps the whole file read only, 0 is returned if it can't be mapped, e.g. it is empty or an asset.
+		the mapping is kept until UnmapFile, the file itself can be closed or replaced meanwhile
+		*/
+		static const void* MapFile(const char* szFullPath, uint64_t& fileSize);
+		static void UnmapFile(const void* pData, uint64_t fileSize);
+
 		static bool Move(const char* srcFullPath, const char* destFullPath);
 
 		static void MakeSureDirectoryExist(const char* filename);
@@ -147,9 +154,19 @@ namespace behaviac
 
 		static void ReadError(Handle);
 
+		struct SModifiedFile
+		{
+			// relative to the monitored directory
+			behaviac::string	path;
+
+			// read by the monitoring thread after the file stops changing, empty if it is not prefetched
+			behaviac::string	content;
+		};
+
 		static bool StartMonitoringDirectory(const wchar_t* dir);
 		static void StopMonitoringDirectory();
 		static void GetModifiedFiles(behaviac::vector<behaviac::string>& modifiedFiles);
+		static void GetModifiedFiles(behaviac::vector<SModifiedFile>& modifiedFiles);
 	};
 }
 
@@ -20,6 +20,9 @@
 #include "behaviac/common/socket/socketconnect.h"
 #include "behaviac/common/string/stringutils.h"
 #include "behaviac/common/string/tostring.h"
+#include "behaviac/common/thread/mutex_lock.h"
+#include "behaviac/common/thread/thread.h"
+#include "behaviac/common/thread/wrapper.h"
 #include <map>
 
 namespace behaviac
@@ -49,6 +52,33 @@ namespace behaviac
         ELM_log
     };
 
+    /**
+    a shard file starts with LogSegmentHeader and the records follow it, each one is a LogRecordHeader
+    and 'size' bytes of the text logged, see LogManager::SetLogShards and tools/logsplitter.
+    */
+    struct LogSegmentHeader
+    {
+        enum
+        {
+            kMagic = 0x474C5442,	//"BTLG"
+            kVersion = 1
+        };
+
+        uint32_t	magic;
+        uint32_t	version;
+        uint32_t	shard;
+        uint32_t	segment;
+    };
+
+    struct LogRecordHeader
+    {
+        //-1 for the records not logged by an agent
+        int32_t		agentId;
+        uint32_t	size;
+    };
+
+    class LogRing;
+
     class BEHAVIAC_API LogManager
     {
     public:
@@ -59,6 +89,15 @@ namespace behaviac
         */
         void SetLogFilePath(const char* logFilePath);
 
+        /**
+        by default, all the agents are logged into the one text file of SetLogFilePath.
+
+        with 'shardCount' > 0, the agents are logged into 'shardCount' files named as "<log file path>.<shard>.<segment>",
+        an agent always into the same one, and a file is closed to start the next segment of its shard once it has
+        about 'segmentSize' bytes, 0 not to rotate them. the records are tagged with the agent ids, tools/logsplitter splits them into a log per agent.
+        */
+        void SetLogShards(int shardCount, uint32_t segmentSize);
+
         //action
         void Log(const behaviac::Agent* pAgent, const char* btMsg, behaviac::EActionResult actionResult, behaviac::LogMode mode = behaviac::ELM_tick);
 
@@ -97,15 +136,46 @@ namespace behaviac
         static LogManager* GetInstance();
 		static void Cleanup();
     private:
-        FILE* GetFile(const behaviac::Agent* pAgent);
-
 		void LogVar(const behaviac::Agent* pAgent, const char* propertyName, const behaviac::string& typeNameStr, const behaviac::string& valueStr);
+
 		//you can override this to customize the output
+        //by default, the messages are queued and written into the files by a background thread every few milliseconds
         virtual void Output(const behaviac::Agent* pAgent, const char* msg);
 
-        typedef behaviac::map<int, FILE*> Logs_t;
-        Logs_t				m_logs;
+        static unsigned int BEHAVIAC_STDCALL FlushThread(void* arg);
+        LogRing* StartFlushThread();
+
+        //write the messages queued, only one thread writes them at a time
+        void WriteRecords(bool bFlush);
+        void WriteQueuedRecords();
+        void WriteRecord(int agentId, int64_t loggedTime, const char* text, uint32_t length);
+
+        FILE* GetFile(int shard);
+        void CloseFiles();
+
+        struct Shard_t
+        {
+            FILE*		fp;
+
+            //the bytes written into the current segment
+            uint32_t	size;
+            uint32_t	segment;
+        };
+
+        behaviac::vector<Shard_t>	m_shards;
+        int					m_shardCount;
+        uint32_t			m_segmentSize;
         const char*			m_logFilePath;
+
+        LogRing*			m_ring;
+        thread::ThreadHandle	m_flushThread;
+        volatile Atomic32	m_terminating;
+
+        //the time is formatted once a second
+        int64_t				m_lastTime;
+        char				m_timeStr[16];
+
+        behaviac::Mutex		m_mutex;
         static LogManager*	ms_instance;
     };
 }//namespace behaviac
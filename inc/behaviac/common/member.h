@@ -21,6 +21,7 @@
 #include "behaviac/agent/agent.h"
 #include "behaviac/common/operation.h"
 #include "behaviac/common/logger/logmanager.h"
+#include "behaviac/common/serialization/snapshot.h"
 
 namespace behaviac
 {
@@ -403,6 +404,16 @@ namespace behaviac
             BEHAVIAC_ASSERT(false);
             return false;
         }
+
+        // Compare for each of the 'count' agents into 'results'
+        virtual void CompareBatch(behaviac::Agent* const* agents, int count, IInstanceMember* right, EOperatorType comparisonType, bool* results)
+        {
+            for (int i = 0; i < count; ++i)
+            {
+                results[i] = this->Compare(agents[i], right, comparisonType);
+            }
+        }
+
         virtual void Compute(behaviac::Agent* self, IInstanceMember* right1, IInstanceMember* right2, EOperatorType computeType)
         {
             BEHAVIAC_ASSERT(false);
@@ -412,6 +423,14 @@ namespace behaviac
         {
             return false;
         }
+
+        // collect the ids of the properties and the variables of 'Self' which the value depends on,
+        // returns false if they can't be known, e.g. methods or members of other agents
+        virtual bool GetInputIds(behaviac::vector<uint32_t>& inputIds) const
+        {
+            BEHAVIAC_UNUSED_VAR(inputIds);
+            return false;
+        }
         /////////////////////////////////////////////////////////////////////////////////
         //method stuff
         virtual IInstanceMember* clone()
@@ -503,6 +522,24 @@ namespace behaviac
             BEHAVIAC_ASSERT(false);
         }
 
+        /// the type written into the binary snapshot, 0 if the variable is not in the snapshot, e.g. it is a pointer
+        virtual uint32_t GetSnapshotTypeId() const
+        {
+            return 0;
+        }
+
+        virtual void SaveSnapshot(SnapshotWriter& writer) const
+        {
+            BEHAVIAC_UNUSED_VAR(writer);
+            BEHAVIAC_ASSERT(false);
+        }
+
+        virtual bool LoadSnapshot(SnapshotReader& reader)
+        {
+            BEHAVIAC_UNUSED_VAR(reader);
+            BEHAVIAC_ASSERT(false);
+            return false;
+        }
     };
 
     class IProperty
@@ -546,6 +583,20 @@ namespace behaviac
             return false;
         }
 
+        //the id passed to Agent::NotifyVariableChanged when it is set, 0 if it is not tracked
+        virtual uint32_t GetChangeId() const
+        {
+            return 0;
+        }
+
+        //write the value of 'self' in the form of the snapshot, false if it is not written, e.g. it is a pointer
+        virtual bool SaveSnapshotValue(const behaviac::Agent* self, SnapshotWriter& writer)
+        {
+            BEHAVIAC_UNUSED_VAR(self);
+            BEHAVIAC_UNUSED_VAR(writer);
+            return false;
+        }
+
         //for customized property
         virtual IInstantiatedVariable* Instantiate() const
         {
@@ -554,6 +605,12 @@ namespace behaviac
             return NULL;
         }
 
+        //for customized property, the slot it is given when it is registered, see Agent::GetBoundVariable
+        virtual void SetSlot(uint32_t slot)
+        {
+            BEHAVIAC_UNUSED_VAR(slot);
+        }
+
         virtual IValue* CreateIValue()
         {
             BEHAVIAC_ASSERT(false);
@@ -570,6 +627,51 @@ namespace behaviac
 #endif
     };
 
+    // the values of the fundamental types are gathered into arrays and compared with OperationUtils::CompareBatch,
+    // the others are compared one by one
+    template<typename T, bool bFundamental>
+    struct TCompareBatch
+    {
+        static void Compare(IInstanceMember* left, behaviac::Agent* const* agents, int count, IInstanceMember* right, EOperatorType comparisonType, bool* results)
+        {
+            for (int i = 0; i < count; ++i)
+            {
+                results[i] = left->Compare(agents[i], right, comparisonType);
+            }
+        }
+    };
+
+    template<typename T>
+    struct TCompareBatch<T, true>
+    {
+        enum { kChunkSize = 64 };
+
+        static void Compare(IInstanceMember* left, behaviac::Agent* const* agents, int count, IInstanceMember* right, EOperatorType comparisonType, bool* results)
+        {
+            T leftValues[kChunkSize];
+            T rightValues[kChunkSize];
+
+            for (int start = 0; start < count; start += kChunkSize)
+            {
+                int size = count - start < (int)kChunkSize ? count - start : (int)kChunkSize;
+
+                for (int i = 0; i < size; ++i)
+                {
+                    behaviac::Agent* self = agents[start + i];
+                    leftValues[i] = *(const T*)left->GetValue(self);
+                    rightValues[i] = *(const T*)right->GetValue(self);
+                }
+
+                OperationUtils::CompareBatch(leftValues, rightValues, size, comparisonType, results + start);
+            }
+        }
+    };
+
+    template<>
+    struct TCompareBatch<void, true> : public TCompareBatch<void, false>
+    {
+    };
+
     template<typename T, bool bTypeIsVector>
     class CInstanceMember : public IInstanceMember
     {
@@ -686,6 +788,11 @@ namespace behaviac
             return OperationUtils::Compare(*leftValue, *rightValue, comparisonType);
         }
 
+        virtual void CompareBatch(behaviac::Agent* const* agents, int count, IInstanceMember* right, EOperatorType comparisonType, bool* results)
+        {
+            TCompareBatch<RealBaseType, behaviac::Meta::IsFundamental<RealBaseType>::Result>::Compare(this, agents, count, right, comparisonType, results);
+        }
+
         virtual void Compute(behaviac::Agent* self, IInstanceMember* right1, IInstanceMember* right2, EOperatorType computeType)
         {
             const RealBaseType* rightValue1 = (const RealBaseType*)right1->GetValue(self);
@@ -871,6 +978,14 @@ namespace behaviac
         {
             Agent* agent = Agent::GetParentAgent(self, this->_instance);
 
+#if BEHAVIAC_USE_HTN
+            //only the planning agent's own reads are recorded by the planner
+            if (agent != self && self != NULL && self->m_planningTop > -1)
+            {
+                self->m_variables->SetUntrackedRead();
+            }
+#endif
+
             if (this->_indexMember != NULL)
             {
                 int indexValue = *(int*)this->_indexMember->GetValue(self);
@@ -898,6 +1013,18 @@ namespace behaviac
             }
         }
 
+        virtual bool GetInputIds(behaviac::vector<uint32_t>& inputIds) const
+        {
+            uint32_t id = _property->GetChangeId();
+
+            if (id == 0 || this->_indexMember != NULL || strcmp(this->_instance, "Self") != 0)
+            {
+                return false;
+            }
+
+            inputIds.push_back(id);
+            return true;
+        }
     };
 
     template<typename T>
@@ -921,6 +1048,12 @@ namespace behaviac
         virtual const void* GetValue(const behaviac::Agent* self, bool bVector = false, const int returnTypeId = 0)
         {
             BEHAVIAC_ASSERT(_gfp != NULL);
+#if BEHAVIAC_USE_HTN
+            if (self != NULL && self->m_planningTop > -1)
+            {
+                self->m_variables->SetUntrackedRead();
+            }
+#endif
             const void* pData = _gfp();
             return pData;
         }
@@ -965,6 +1098,12 @@ namespace behaviac
         virtual const void* GetValueElement(const behaviac::Agent* self, int index)
         {
             BEHAVIAC_ASSERT(_gfp != NULL);
+#if BEHAVIAC_USE_HTN
+            if (self != NULL && self->m_planningTop > -1)
+            {
+                self->m_variables->SetUntrackedRead();
+            }
+#endif
             const void* pData = _gfp(index);
             return pData;
         }
@@ -977,6 +1116,9 @@ namespace behaviac
         }
     };
 
+    template <typename T>
+    struct SnapshotValueSelector;
+
     template<typename T>
     class CMemberProperty :public CProperty<T>
     {
@@ -988,6 +1130,7 @@ namespace behaviac
 
         SetFunctionPointer _sfp;
         GetFunctionPointer _gfp;
+        uint32_t _id;
 
     public:
         CMemberProperty(const char* name, SetFunctionPointer sfp, GetFunctionPointer gfp)
@@ -995,6 +1138,26 @@ namespace behaviac
         {
             _sfp = sfp;
             _gfp = gfp;
+            _id = MakeVariableId(name);
+        }
+
+        virtual uint32_t GetChangeId() const
+        {
+            return _id;
+        }
+
+        virtual bool SaveSnapshotValue(const behaviac::Agent* self, SnapshotWriter& writer)
+        {
+            typedef typename SnapshotValueSelector<ValueType>::Type SnapshotValue_t;
+
+            if (SnapshotValue_t::GetTypeId() == 0)
+            {
+                return false;
+            }
+
+            SnapshotValue_t::Save(writer, *(const ValueType*)_gfp((behaviac::Agent*)self));
+
+            return true;
         }
 
         virtual const void* GetValue(const behaviac::Agent* self, bool bVector = false, const int returnTypeId = 0)
@@ -1003,8 +1166,7 @@ namespace behaviac
 #if BEHAVIAC_USE_HTN
             if (self->m_planningTop > -1)
             {
-                uint32_t id = MakeVariableId(this->Name());
-                IInstantiatedVariable* pVar = self->m_variables->GetVariable(id);
+                IInstantiatedVariable* pVar = self->m_variables->GetVariable(_id);
                 if (pVar != NULL)
                 {
                     CVariable<T>* pTVar = (CVariable<T>*)pVar;
@@ -1022,12 +1184,11 @@ namespace behaviac
 #if BEHAVIAC_USE_HTN
             if (self->m_planningTop > -1)
             {
-                uint32_t id = MakeVariableId(this->Name());
-                IInstantiatedVariable* pVar = self->m_variables->GetVariable(id);
+                IInstantiatedVariable* pVar = self->m_variables->GetVariable(_id);
                 if (pVar == NULL)
                 {
                     pVar = BEHAVIAC_NEW CVariable<T>(this->Name(), *(ValueType*)pValueAddr);
-                    self->m_variables->AddVariable(id, pVar, 1);
+                    self->m_variables->AddVariable(_id, pVar, 1);
                 }
                 else
                 {
@@ -1039,6 +1200,7 @@ namespace behaviac
 #endif//
             {
                 _sfp(self, *(T*)pValueAddr);
+                self->NotifyVariableChanged(_id);
             }
         }
     };
@@ -1054,6 +1216,9 @@ namespace behaviac
         SetFunctionPointer _sfp;
         GetFunctionPointer _gfp;
 
+        //the id of the vector, i.e. the name without "[]"
+        uint32_t _id;
+
     public:
         CMemberArrayItemProperty(const char* name, SetFunctionPointer sfp, GetFunctionPointer gfp)
             :CProperty<T>(name)
@@ -1061,6 +1226,16 @@ namespace behaviac
 
             _sfp = sfp;
             _gfp = gfp;
+
+            behaviac::string vectorName = name;
+            size_t pos = vectorName.rfind("[]");
+
+            if (pos != behaviac::string::npos)
+            {
+                vectorName.erase(pos);
+            }
+
+            _id = MakeVariableId(vectorName.c_str());
         }
 
 #if !BEHAVIAC_RELEASE
@@ -1085,6 +1260,7 @@ namespace behaviac
             BEHAVIAC_ASSERT(_sfp != NULL);
 
             _sfp(self, *(T*)value, index);
+            self->NotifyVariableChanged(_id);
         }
     };
 
@@ -1112,6 +1288,7 @@ namespace behaviac
     {
     private:
         uint32_t _id;
+        uint32_t _slot;
         T _defaultValue;
 
     public:
@@ -1119,6 +1296,7 @@ namespace behaviac
             :CProperty<T>(name)
         {
             _id = id;
+            _slot = 0;
 
             SetFromString_t<T, behaviac::Meta::IsPtr<T>::Result>::Set(valueStr, this->_defaultValue);
         }
@@ -1126,7 +1304,7 @@ namespace behaviac
         virtual const void* GetValue(const behaviac::Agent* self, bool bVector = false, const int returnTypeId = 0)
         {
             T* pInstanceValue = 0;
-            if (self && self->GetVarValue<T>(_id, pInstanceValue))
+            if (self && self->GetBoundVarValue<T>(_id, _slot, pInstanceValue))
             {
                 return pInstanceValue;
             }
@@ -1143,11 +1321,21 @@ namespace behaviac
 
         virtual void SetValue(behaviac::Agent* self, const void* value)
         {
-            bool bOk = self->SetVarValue(_id, (T*)value);
+            bool bOk = self->SetBoundVarValue(_id, _slot, (T*)value);
             BEHAVIAC_ASSERT(bOk);
             BEHAVIAC_UNUSED_VAR(bOk);
         }
 
+        virtual uint32_t GetChangeId() const
+        {
+            return _id;
+        }
+
+        virtual void SetSlot(uint32_t slot)
+        {
+            _slot = slot;
+        }
+
     public:
         virtual bool IsCustomized() const
         {
@@ -1161,6 +1349,109 @@ namespace behaviac
     };
 
 
+    /**
+    the fundamental types and the enums are written into the snapshot as raw bytes,
+    the other types as their string form and the pointers are not written.
+    */
+    template <typename T, int kind>
+    struct SnapshotValue
+    {
+        static uint32_t GetTypeId()
+        {
+            return 0;
+        }
+
+        static void Save(SnapshotWriter& writer, const T& value)
+        {
+            BEHAVIAC_UNUSED_VAR(writer);
+            BEHAVIAC_UNUSED_VAR(value);
+        }
+
+        static bool Load(SnapshotReader& reader, T& value)
+        {
+            BEHAVIAC_UNUSED_VAR(reader);
+            BEHAVIAC_UNUSED_VAR(value);
+            return false;
+        }
+    };
+
+    template <typename T>
+    struct SnapshotValue<T, 1>
+    {
+        static uint32_t GetTypeId()
+        {
+            static const uint32_t s_typeId = CRC32::CalcCRC(GetClassTypeName((T*)0));
+
+            return s_typeId;
+        }
+
+        static void Save(SnapshotWriter& writer, const T& value)
+        {
+            writer.Write(value);
+        }
+
+        static bool Load(SnapshotReader& reader, T& value)
+        {
+            return reader.Load(value);
+        }
+    };
+
+    template <typename T>
+    struct SnapshotValue<T, 2>
+    {
+        static uint32_t GetTypeId()
+        {
+            static const uint32_t s_typeId = CRC32::CalcCRC(GetClassTypeName((T*)0));
+
+            return s_typeId;
+        }
+
+        static void Save(SnapshotWriter& writer, const T& value)
+        {
+            behaviac::string valueStr = StringUtils::ToString(value);
+
+            writer.Write((uint32_t)valueStr.size());
+            writer.WriteBytes(valueStr.c_str(), (uint32_t)valueStr.size());
+        }
+
+        static bool Load(SnapshotReader& reader, T& value)
+        {
+            uint32_t length = 0;
+
+            if (reader.Read(length))
+            {
+                const char* p = (const char*)reader.Skip(length);
+
+                if (p)
+                {
+                    behaviac::string valueStr(p, length);
+
+                    if (!reader.IsApplying())
+                    {
+                        T temp(value);
+
+                        return StringUtils::ParseString(valueStr.c_str(), temp);
+                    }
+
+                    return StringUtils::ParseString(valueStr.c_str(), value);
+                }
+            }
+
+            return false;
+        }
+    };
+
+    template <typename T>
+    struct SnapshotValueSelector
+    {
+        enum
+        {
+            Kind = behaviac::Meta::IsPtr<T>::Result ? 0 : ((behaviac::Meta::IsFundamental<T>::Result || behaviac::Meta::IsEnum<T>::Result) ? 1 : 2)
+        };
+
+        typedef SnapshotValue<T, Kind> Type;
+    };
+
     template <typename T>
     class CVariable : public IInstantiatedVariable
     {
@@ -1257,6 +1548,29 @@ namespace behaviac
             varNode->setAttr(valueId, this->_value);
         }
 
+        virtual uint32_t GetSnapshotTypeId() const
+        {
+            return SnapshotValueSelector<T>::Type::GetTypeId();
+        }
+
+        virtual void SaveSnapshot(SnapshotWriter& writer) const
+        {
+            SnapshotValueSelector<T>::Type::Save(writer, this->_value);
+        }
+
+        virtual bool LoadSnapshot(SnapshotReader& reader)
+        {
+            bool bOk = SnapshotValueSelector<T>::Type::Load(reader, this->_value);
+
+#if !BEHAVIAC_RELEASE
+            if (reader.IsApplying())
+            {
+                m_bIsModified = true;
+            }
+#endif
+            return bOk;
+        }
+
         IInstantiatedVariable* clone()
         {
             CVariable* p = BEHAVIAC_NEW CVariable<T>(this->_name, this->_value);
@@ -1627,6 +1941,17 @@ namespace behaviac
                 agent->SetVariable<T>("", _id, *(T*)value);
             }
         }
+
+        virtual bool GetInputIds(behaviac::vector<uint32_t>& inputIds) const
+        {
+            if (this->_indexMember != NULL || strcmp(this->_instance, "Self") != 0)
+            {
+                return false;
+            }
+
+            inputIds.push_back(_id);
+            return true;
+        }
     };
 
     template<typename T>
@@ -1655,6 +1980,12 @@ namespace behaviac
         {
             _value = *(T*)value;
         }
+
+        virtual bool GetInputIds(behaviac::vector<uint32_t>& inputIds) const
+        {
+            BEHAVIAC_UNUSED_VAR(inputIds);
+            return true;
+        }
     };
 
     template<typename T>
@@ -0,0 +1,156 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Tencent is pleased to support the open source community by making behaviac available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except in compliance with
+// the License. You may obtain a copy of the License at http://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and limitations under the License.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _BEHAVIAC_COMMON_MEMORY_SLABALLOCATOR_H_
+#define _BEHAVIAC_COMMON_MEMORY_SLABALLOCATOR_H_
+
+#include "behaviac/common/config.h"
+#include "behaviac/common/memory/memory.h"
+#include "behaviac/common/thread/mutex_lock.h"
+
+namespace behaviac
+{
+	/**
+	a size-class slab allocator with per-thread magazines.
+
+	small blocks (up to kMaxSmallSize bytes) are served from a magazine owned by the calling thread, no lock is taken
+	unless the magazine is empty or full, in which case half a magazine is exchanged with the size class's depot.
+	the slabs are committed from one range of address space reserved up front, a block is known as a slab block by its address.
+	larger blocks, blocks with an alignment above kAlignment or blocks which don't fit in the range go to the system heap.
+
+	all the blocks are aligned to kAlignment bytes as the system heap does. the magazine of a thread is returned to the depots
+	when the thread exits.
+
+	the size classes are tuned for the objects the runtime churns the most:
+	BehaviorTask subclasses, CVariable<T>, AgentState, PlannerTask and the nodes of behaviac::map.
+
+	it needs to be selected before anything is allocated, i.e. at the very beginning of the program:
+
+		behaviac::SetMemoryAllocator(behaviac::GetSlabMemoryAllocator());
+
+	blocks which don't carry the slab header (allocated by the system heap before the switch) are released to the system heap.
+	*/
+	class BEHAVIAC_API MemSlabAllocator : public IMemAllocator
+	{
+	public:
+		enum
+		{
+			kSizeClassCount = 16,
+			kMaxSmallSize = 512,
+			kAlignment = 16,
+			kMagazineSize = 64,
+			kSlabSize = 64 * 1024
+		};
+
+		struct SizeClassStats
+		{
+			uint32_t	blockSize;
+			uint32_t	slabCount;
+			uint64_t	allocCount;
+			uint64_t	freeCount;
+		};
+
+		struct Stats
+		{
+			SizeClassStats	sizeClasses[kSizeClassCount];
+
+			uint64_t		largeAllocCount;
+			uint64_t		largeFreeCount;
+
+			/// bytes taken from the system heap for the slabs and the large blocks
+			size_t			reservedBytes;
+
+			/// bytes currently handed out, the small blocks are counted with their header
+			size_t			allocatedBytes;
+
+			uint32_t		threadCacheCount;
+		};
+
+		MemSlabAllocator();
+		virtual ~MemSlabAllocator();
+
+		virtual size_t GetMaxAllocationSize(void) const;
+		virtual size_t GetAllocatedSize() const;
+		virtual void* Alloc(size_t size, const char* tag, const char* pFile, unsigned int Line);
+		virtual void* Realloc(void* pOldPtr, size_t size, const char* tag, const char* pFile, unsigned int Line);
+		virtual void Free(void* pData, const char* tag, const char* pFile, unsigned int Line);
+		virtual void* AllocAligned(size_t size, size_t alignment, const char* tag, const char* pFile, unsigned int Line);
+		virtual void* ReallocAligned(void* pOldPtr, size_t size, size_t alignment, const char* tag, const char* pFile, unsigned int Line);
+		virtual void FreeAligned(void* pData, size_t alignment, const char* tag, const char* pFile, unsigned int Line);
+		virtual const char* GetName(void) const;
+
+		/// the counters are summed over all the thread caches without stopping them, so they are only approximate while other threads run
+		void GetStats(Stats& stats) const;
+
+		/// returns the blocks cached by the calling thread to the depots, it is done anyway when the thread exits
+		void FlushThreadCache();
+
+		struct ThreadCache;
+		struct Counters;
+
+		/// called when a thread which allocated from this allocator exits
+		void ReleaseThreadCache(ThreadCache* pCache);
+
+	private:
+		struct Depot;
+		struct LargeBlocks;
+
+		void* AllocSmall(uint32_t sizeClass);
+		void FreeSmall(void* pBlock, uint32_t sizeClass);
+		void* AllocLarge(size_t size, size_t alignment);
+		bool FreeLarge(void* pData);
+		bool IsLargeBlock(const void* pData) const;
+		size_t GetUsableSize(const void* pData) const;
+
+		ThreadCache* GetThreadCache();
+		ThreadCache* CreateThreadCache();
+		void Refill(ThreadCache* pCache, uint32_t sizeClass);
+		void Flush(ThreadCache* pCache, uint32_t sizeClass, uint32_t count);
+		char* CommitSlab();
+		bool IsSlabBlock(const void* pData) const
+		{
+			return (size_t)((const char*)pData - m_arena) < m_arenaSize;
+		}
+
+		uint32_t		m_id;
+		Depot*			m_depots;
+		ThreadCache*	m_threadCaches;
+		mutable Mutex	m_threadCachesLock;
+
+		//the counters of the threads which exited
+		Counters*		m_retiredCounters;
+
+		//the thread exit callback key of the platform
+		size_t			m_threadExitKey;
+
+		//the reserved address range of the slabs, [m_arena, m_arena + m_arenaCommitted) is committed
+		char*			m_arena;
+		size_t			m_arenaSize;
+		size_t			m_arenaCommitted;
+		Mutex			m_arenaLock;
+
+		LargeBlocks*	m_largeBlocks;
+		mutable Mutex	m_largeBlocksLock;
+
+		MemSlabAllocator(const MemSlabAllocator&);
+		MemSlabAllocator& operator=(const MemSlabAllocator&);
+	};
+
+	/// Call this function to retrieve the slab allocator, pass it to SetMemoryAllocator to use it
+	BEHAVIAC_API MemSlabAllocator& GetSlabMemoryAllocator();
+
+	/// Call this function to cleanup the slab allocator, all the blocks allocated from it are released
+	BEHAVIAC_API void CleanupSlabMemoryAllocator();
+}
+
+#endif//_BEHAVIAC_COMMON_MEMORY_SLABALLOCATOR_H_
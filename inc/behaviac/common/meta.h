@@ -125,7 +125,23 @@ namespace behaviac
         behaviac::map<uint32_t, IInstantiatedVariable*>         _customizedStaticVars;
         behaviac::map<uint32_t, IInstanceMember*>               _methods;
 
+        //the properties and the methods of the maps above by their ids, in an open addressing table of a power of 2 size
+        struct Member_t
+        {
+            uint32_t            id;
+            IProperty*          property;
+            IProperty*          memberProperty;
+            IInstanceMember*    method;
+        };
+
+        behaviac::vector<Member_t>                              _members;
+        uint32_t                                                _memberCount;
+
+        Member_t& addMember(uint32_t id);
+        const Member_t* findMember(uint32_t id) const;
+
         static behaviac::map<uint32_t, AgentMeta*>              _agentMetas;
+        static uint32_t                                         ms_version;
         static CppBehaviorLoader*                               ms_cppBehaviorLoader;
 
         static behaviac::map<behaviac::string, TypeCreator*>    _Creators;
@@ -143,6 +159,13 @@ namespace behaviac
         static void UnRegisterMeta();
 
         static AgentMeta*                                           GetMeta(uint32_t classId);
+
+        /// changed when the metas are unregistered, the metas cached with an older version are deleted
+        static uint32_t GetVersion()
+        {
+            return ms_version;
+        }
+
         static behaviac::map<uint32_t, AgentMeta*>&                 GetAgentMetas();
         static void                                                 SetInstance(CppBehaviorLoader* cppBehaviorLoader);
         behaviac::map<uint32_t, IInstantiatedVariable*>             InstantiateCustomizedProperties();
@@ -154,7 +177,7 @@ namespace behaviac
 
         IProperty* GetProperty(uint32_t propId);
         IProperty* GetMemberProperty(uint32_t propId);
-        behaviac::map<uint32_t, IProperty*> GetMemberProperties();
+        const behaviac::map<uint32_t, IProperty*>& GetMemberProperties() const;
         IInstanceMember* GetMethod(uint32_t methodId);
 
 		static IProperty* CreateProperty(const behaviac::string& typeName, uint32_t propId, const char* propName, const char* valueStr);
@@ -268,6 +291,31 @@ namespace behaviac
         }
 
         static IInstanceMember* ParseProperty(const char* value);
+
+        struct SharedPropertyStats
+        {
+            /// the calls of ParseSharedProperty
+            uint32_t	requests;
+
+            /// the requests returning an operand parsed before
+            uint32_t	hits;
+
+            /// the distinct operands kept
+            uint32_t	operands;
+        };
+
+        /**
+        the same as ParseProperty, but the operands of the same value are parsed once and shared by all the nodes,
+        the constants and the properties keep no state of their own. the one returned is to be released by
+        ReleaseSharedProperty instead of being deleted, it is deleted when the last node using it releases it.
+        */
+        static IInstanceMember* ParseSharedProperty(const char* value);
+
+        /// 'pMember' is deleted if it is not returned by ParseSharedProperty, e.g. it is a method
+        static void ReleaseSharedProperty(IInstanceMember* pMember);
+
+        static SharedPropertyStats GetSharedPropertyStats();
+
         static IInstanceMember* ParseMethod(const char* valueStr, char* methodName);
         static IInstanceMember* ParseMethod(const char* valueStr);
 
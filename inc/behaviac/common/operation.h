@@ -125,6 +125,61 @@ namespace behaviac
             BEHAVIAC_ASSERT(false);
             return false;
         }
+
+        // compares 'count' pairs of the contiguous 'left' and 'right' into 'results',
+        // the switch is out of the loops so that each of them can be vectorized
+        template<typename T>
+        static void CompareBatch(const T* left, const T* right, int count, EOperatorType comparisonType, bool* results)
+        {
+            switch (comparisonType)
+            {
+            case E_EQUAL:
+                for (int i = 0; i < count; ++i)
+                {
+                    results[i] = behaviac::PrivateDetails::Equal(left[i], right[i]);
+                }
+                break;
+
+            case E_NOTEQUAL:
+                for (int i = 0; i < count; ++i)
+                {
+                    results[i] = !behaviac::PrivateDetails::Equal(left[i], right[i]);
+                }
+                break;
+
+            case E_GREATER:
+                for (int i = 0; i < count; ++i)
+                {
+                    results[i] = behaviac::PrivateDetails::Greater(left[i], right[i]);
+                }
+                break;
+
+            case E_GREATEREQUAL:
+                for (int i = 0; i < count; ++i)
+                {
+                    results[i] = behaviac::PrivateDetails::GreaterEqual(left[i], right[i]);
+                }
+                break;
+
+            case E_LESS:
+                for (int i = 0; i < count; ++i)
+                {
+                    results[i] = behaviac::PrivateDetails::Less(left[i], right[i]);
+                }
+                break;
+
+            case E_LESSEQUAL:
+                for (int i = 0; i < count; ++i)
+                {
+                    results[i] = behaviac::PrivateDetails::LessEqual(left[i], right[i]);
+                }
+                break;
+
+            default:
+                BEHAVIAC_ASSERT(false);
+                break;
+            }
+        }
     public:
         template<typename T>
         static T Compute(T left, T right, EOperatorType computeType)
@@ -26,6 +26,9 @@ namespace behaviac
     class RandomGenerator
     {
     public:
+        virtual ~RandomGenerator()
+        {}
+
         static RandomGenerator* GetInstance()
         {
             RandomGenerator* pRandomGenerator = RandomGenerator::_GetInstance();
@@ -55,16 +58,25 @@ namespace behaviac
             srand(seed);
 #endif//#if _SYS_RANDOM_
         }
+
+        //the state of the generator, setSeed with it makes the same numbers again
+        unsigned int getSeed() const
+        {
+            return this->m_seed;
+        }
     protected:
-        RandomGenerator(unsigned int seed = 0) : m_seed(seed)
+        //the ones not registered as the instance are owned by the contexts
+        RandomGenerator(unsigned int seed = 0, bool bIsInstance = true) : m_seed(seed)
         {
-            RandomGenerator::_SetInstance(this);
+            if (bIsInstance)
+            {
+                RandomGenerator::_SetInstance(this);
+            }
         }
 
-        virtual ~RandomGenerator()
-        {}
-
     private:
+        friend class Context;
+
         static RandomGenerator* ms_pInstance;
         static void _SetInstance(RandomGenerator* pInstance);
         static RandomGenerator* _GetInstance();
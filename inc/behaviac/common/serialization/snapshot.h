@@ -0,0 +1,193 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Tencent is pleased to support the open source community by making behaviac available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except in compliance with
+// the License. You may obtain a copy of the License at http://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and limitations under the License.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _BEHAVIAC_COMMON_SNAPSHOT_H_
+#define _BEHAVIAC_COMMON_SNAPSHOT_H_
+
+#include "behaviac/common/base.h"
+
+#include <string.h>
+
+namespace behaviac
+{
+    /**
+    the header of the binary snapshot written by Agent::btsavesnapshot.
+
+    the snapshot is in the native byte order, it is meant to be moved between the processes of the same build.
+    */
+    struct SnapshotHeader
+    {
+        enum
+        {
+            kMagic = 0x4E535442,	//"BTSN"
+            kVersion = 2
+        };
+
+        uint32_t	magic;
+        uint32_t	version;
+
+        /// the size of the whole snapshot including this header
+        uint32_t	size;
+
+        /// the crc of the agent's class name
+        uint32_t	agentType;
+    };
+
+    /**
+    writes a snapshot into a caller buffer without any allocation.
+
+    it keeps counting when the buffer is not big enough, or if it is 0, so that GetSize tells the size needed.
+    */
+    class SnapshotWriter
+    {
+    public:
+        SnapshotWriter(void* buffer, uint32_t bufferSize) : m_buffer((uint8_t*)buffer), m_bufferSize(bufferSize), m_size(0)
+        {
+        }
+
+        void WriteBytes(const void* data, uint32_t size)
+        {
+            if (this->m_buffer && this->m_size + size <= this->m_bufferSize)
+            {
+                memcpy(this->m_buffer + this->m_size, data, size);
+            }
+
+            this->m_size += size;
+        }
+
+        template<typename T>
+        void Write(const T& value)
+        {
+            this->WriteBytes(&value, sizeof(T));
+        }
+
+        /// overwrite what has been written at 'offset', it is used to fill in the sizes known afterwards
+        template<typename T>
+        void WriteAt(uint32_t offset, const T& value)
+        {
+            if (this->m_buffer && offset + sizeof(T) <= this->m_bufferSize)
+            {
+                memcpy(this->m_buffer + offset, &value, sizeof(T));
+            }
+        }
+
+        uint32_t GetSize() const
+        {
+            return this->m_size;
+        }
+
+        bool IsOverflowed() const
+        {
+            return !this->m_buffer || this->m_size > this->m_bufferSize;
+        }
+
+    private:
+        uint8_t*	m_buffer;
+        uint32_t	m_bufferSize;
+        uint32_t	m_size;
+    };
+
+    /**
+    reads a snapshot in place, the failure is sticky so that it only needs to be checked at the end.
+
+    a reader which is not applying only validates the snapshot, the loaders read it the same way
+    but don't change anything, so that a bad snapshot is found before anything is restored.
+    */
+    class SnapshotReader
+    {
+    public:
+        SnapshotReader(const void* buffer, uint32_t size, bool bApply = true) : m_buffer((const uint8_t*)buffer), m_size(size), m_offset(0), m_bFailed(false), m_bApply(bApply)
+        {
+        }
+
+        bool ReadBytes(void* data, uint32_t size)
+        {
+            const void* p = this->Skip(size);
+
+            if (p)
+            {
+                memcpy(data, p, size);
+                return true;
+            }
+
+            return false;
+        }
+
+        template<typename T>
+        bool Read(T& value)
+        {
+            return this->ReadBytes(&value, sizeof(T));
+        }
+
+        /// read into the state being restored, it is only moved over when validating
+        template<typename T>
+        bool Load(T& value)
+        {
+            if (this->m_bApply)
+            {
+                return this->Read(value);
+            }
+
+            return this->Skip(sizeof(T)) != 0;
+        }
+
+        /// return the bytes in the buffer and move over them, 0 if there are not so many bytes left
+        const void* Skip(uint32_t size)
+        {
+            if (this->m_bFailed || size > this->m_size - this->m_offset)
+            {
+                this->m_bFailed = true;
+                return 0;
+            }
+
+            const void* p = this->m_buffer + this->m_offset;
+            this->m_offset += size;
+
+            return p;
+        }
+
+        void SetFailed()
+        {
+            this->m_bFailed = true;
+        }
+
+        bool IsFailed() const
+        {
+            return this->m_bFailed;
+        }
+
+        uint32_t GetOffset() const
+        {
+            return this->m_offset;
+        }
+
+        uint32_t GetSize() const
+        {
+            return this->m_size;
+        }
+
+        bool IsApplying() const
+        {
+            return this->m_bApply;
+        }
+
+    private:
+        const uint8_t*	m_buffer;
+        uint32_t		m_size;
+        uint32_t		m_offset;
+        bool			m_bFailed;
+        bool			m_bApply;
+    };
+}
+
+#endif//_BEHAVIAC_COMMON_SNAPSHOT_H_
@@ -23,11 +23,26 @@
 
 namespace behaviac
 {
+    class Agent;
+
     namespace Socket
     {
 		BEHAVIAC_API bool IsConnected();
 
         BEHAVIAC_API void SendText(const char* text);
+
+        /**
+        return the mask of the clients subscribing to the agent's messages of 'kindMask'(MessageKind), 0 if there is none.
+        'pAgent' is 0 for the messages not about an agent.
+
+        it is to be checked before the messages are formatted, so that the agents nobody watches cost nothing more.
+        */
+        BEHAVIAC_API uint32_t GetSubscribers(const Agent* pAgent, uint32_t kindMask);
+
+        /**
+        send 'text' to the clients of the mask returned by GetSubscribers
+        */
+        BEHAVIAC_API void SendText(const char* text, uint32_t clients);
         BEHAVIAC_API void SendWorkspace(const char* text);
 
         /**
@@ -28,10 +28,6 @@
 // It has a slight memory/performance overhead.
 #define USING_BEHAVIAC_SEQUENTIAL	1
 
-#if USING_BEHAVIAC_SEQUENTIAL
-#include <cstdlib>
-#endif
-
 namespace behaviac
 {
 #if USING_BEHAVIAC_SEQUENTIAL
@@ -60,8 +56,13 @@ namespace behaviac
     const size_t	kMaxPacketDataSize = 230;
     const size_t	kMaxPacketSize = 256;
     const size_t	kSocketBufferSize = 16384;
-    const size_t	kGlobalQueueSize = (1024 * 32);
-    const size_t	kLocalQueueSize = (1024 * 8);
+
+    // The bytes of the ring all the threads write their packets into, it must be power of two.
+    const uint32_t	kPacketRingSize = (1024 * 512);
+
+    // The number of the designers connected at the same time, each one is a bit in Packet::clients.
+    const int		kMaxClients = 8;
+    const uint32_t	kAllClients = 0xFFFFFFFF;
 
     inline uint32_t ByteSwap32(uint32_t i)
     {
@@ -142,6 +143,20 @@ namespace behaviac
         };
     }
 
+    // The kinds of the traced messages a client subscribes to.
+    namespace MessageKind
+    {
+        enum Enum
+        {
+            MSGKIND_TICK = 0x01,		// [tick], [jump], [return]
+            MSGKIND_BREAKPOINT = 0x02,	// [breaked], [continue]
+            MSGKIND_PROPERTY = 0x04,	// [property]
+            MSGKIND_PROFILER = 0x08,	// [profiler]
+            MSGKIND_LOG = 0x10,			// [applog], [log]
+            MSGKIND_ALL = 0xFF
+        };
+    }
+
 	const uint32_t kMaxTextLength = 228;
 
     struct Text
@@ -164,6 +179,7 @@ namespace behaviac
         {
             this->messageSize = 0;
             this->command = commandId;
+            this->clients = kAllClients;
 
 #if USING_BEHAVIAC_SEQUENTIAL
             this->seq = seq_;
@@ -187,6 +203,9 @@ namespace behaviac
 
         uint8_t				data[kMaxPacketDataSize];
 
+        // the mask of the clients the packet is sent to, it's not being sent either.
+        uint32_t			clients;
+
         // IMPORTANT: has to be the last member variable, it's not being sent
         // to tracer application.
 #if USING_BEHAVIAC_SEQUENTIAL
@@ -196,29 +215,7 @@ namespace behaviac
 
     BEHAVIAC_STATIC_ASSERT(sizeof(Packet) < kMaxPacketSize);
 
-#if USING_BEHAVIAC_SEQUENTIAL
-	//BEHAVIAC_STATIC_ASSERT((BEHAVIAC_OFFSETOF_POD(Packet, seq) == (sizeof(Packet) - sizeof(behaviac::Atomic32))));	// seq must be the last member
-
-    inline int PacketCompare(const void* lhs, const void* rhs)
-    {
-        const Packet& pa = *(const Packet*)lhs;
-        const Packet& pb = *(const Packet*)rhs;
-
-		BEHAVIAC_ASSERT((BEHAVIAC_OFFSETOF_POD(Packet, seq) == (sizeof(Packet) - sizeof(behaviac::Atomic32))));	// seq must be the last member
-
-        if (pa.seq < pb.seq)
-        {
-            return -1;
-        }
-
-        if (pa.seq > pb.seq)
-        {
-            return 1;
-        }
-
-        return 0;
-    }
-#else
+#if !USING_BEHAVIAC_SEQUENTIAL
     BEHAVIAC_STATIC_ASSERT(sizeof(Packet) == sizeof(AllocInfo) + 2);
 #endif
 
@@ -247,7 +244,40 @@ namespace behaviac
 
         BEHAVIAC_API bool Write(Handle& h, const void* buffer, size_t bytes, size_t& outBytesWritten);
 
-        BEHAVIAC_API size_t Read(Handle& h, const void* buffer, size_t bytes);
+        const int kMaxWriteBuffers = 64;
+
+        struct Buffer
+        {
+            const void*	data;
+            size_t		bytes;
+        };
+
+        // Writes at most kMaxWriteBuffers buffers in one call, it is Write of the buffers one after another.
+        BEHAVIAC_API bool WriteV(Handle& h, const Buffer* buffers, int count, size_t& outBytesWritten);
+
+        BEHAVIAC_API size_t Read(Handle& h, void* buffer, size_t bytes);
+
+        // Waits for any of the added sockets to be readable.
+        // It is epoll on linux/android and select elsewhere.
+        class BEHAVIAC_API Poller
+        {
+        public:
+            enum { kMaxHandles = kMaxClients + 1 };
+
+            Poller();
+            ~Poller();
+
+            bool Add(Handle h);
+            void Remove(Handle h);
+
+            // Writes the readable sockets into 'ready', returns the number of them, 0 on timeout.
+            int Wait(Handle* ready, int maxReady, int timeoutMs);
+
+        private:
+            Handle	m_handles[kMaxHandles];
+            int		m_count;
+            int		m_epoll;
+        };
 
         BEHAVIAC_API size_t GetPacketsSent();
         BEHAVIAC_API size_t GetPacketsReceived();
@@ -261,10 +291,54 @@ namespace behaviac
         };
     }
 
+    /**
+    what a connected designer subscribes to, the messages of an agent are only sent to the clients whose filter matches.
+
+    an empty set of the agents, the trees or the kinds matches any of them, so a client subscribing nothing watches everything.
+    the client changes it by sending the lines of:
+        [subscribe] agent 12
+        [subscribe] tree ships/suicide
+        [subscribe] kind tick|breakpoint|property|profiler|log
+        [unsubscribe]
+    */
+    struct SubscriptionFilter
+    {
+        enum
+        {
+            kMaxAgents = 32,
+            kMaxTrees = 16
+        };
+
+        SubscriptionFilter()
+        {
+            this->Clear();
+        }
+
+        void Clear();
+
+        bool AddAgent(int agentId);
+        bool AddTree(const char* treeName);
+        void AddKinds(uint32_t kindMask);
+
+        /**
+        return false if 'line' is not a subscription, it is then left to the workspace
+        */
+        bool Parse(const char* line);
+
+        /**
+        'agentId' is -1 for the messages not about an agent, 'treeId' is the crc of the agent's current tree
+        */
+        bool Match(uint32_t kindMask, int agentId, uint32_t treeId) const;
+
+        uint32_t	kinds;
+        int			agentCount;
+        int			agents[kMaxAgents];
+        int			treeCount;
+        uint32_t	trees[kMaxTrees];
+    };
+
     struct Packet;
-    class PacketBuffer;
-    class PacketCollection;
-    class CustomObjectPool;
+    class PacketRing;
 
     class ConnectorInterface
     {
@@ -272,7 +346,7 @@ namespace behaviac
         ConnectorInterface();
         virtual ~ConnectorInterface();
 
-        bool Init(int maxTracedThreads, unsigned short port, bool bBlocking);
+        bool Init(unsigned short port, bool bBlocking);
         void Close();
 
         void CreateAndStartThread();
@@ -282,50 +356,92 @@ namespace behaviac
         bool IsConnectedFinished() const;
         bool IsInited() const;
         void SetConnectPort(unsigned short port);
-        void AddPacket(const Packet& packet, bool bReserve);
+        void AddPacket(const Packet& packet);
         void RecordText(const char* text);
         virtual void OnConnection() = 0;
         virtual void OnRecieveMessages(const behaviac::string& msgs);
         void SendAllPackets();
 
-        int GetBufferIndex(bool bReserve);
-
-        behaviac::Socket::Handle GetWriteSocket()
-        {
-            return this->m_writeSocket;
-        }
-
         /**
-        return true if 'msgCheck' is received
+        return true if 'msgCheck' is received, from the client being connected if any
         */
         bool ReceivePackets(const char* msgCheck = 0);
+
+        /**
+        return the mask of the clients whose subscriptions match, 0 if there is none.
+
+        the filters are only changed on the socket thread and read here without locking,
+        a message racing with a subscription change might be sent by the old filter.
+        */
+        uint32_t GetSubscribers(uint32_t kindMask, int agentId, const char* treeName) const;
         void ThreadFunc();
 
         size_t GetMemoryOverhead() const;
-        size_t GetNumTrackedThreads() const;
         int GetPacketsCount() const;
 
-        void SendText(const char* text, uint8_t commandId = CommandId::CMDID_TEXT);
+        void SendText(const char* text, uint8_t commandId = CommandId::CMDID_TEXT, uint32_t clients = kAllClients);
         bool ReadText(behaviac::string& text);
     protected:
-        int ReserveThreadPacketBuffer();
+        /**
+        return the bytes to write a packet of 'dataSize' bytes into, 0 if it is not to be sent.
+        it is sent after it is committed by CommitPacket, in the order it is reserved in.
+        */
+        uint8_t* ReservePacket(uint32_t dataSize, uint32_t clients);
+        void CommitPacket(uint8_t* pData);
+
         void Log(const char* msg);
         virtual void Clear();
         void SendExistingPackets();
 
-        unsigned short				m_port;
-        behaviac::Socket::Handle	m_writeSocket;
+        /// the socket of the client in OnConnection
+        behaviac::Socket::Handle& GetConnectingSocket();
 
-        PacketBuffer**				m_packetBuffers;
-        PacketCollection*			m_packetCollection;
-        CustomObjectPool*			m_packetPool;
-        int							m_maxTracedThreads;
+        struct Client
+        {
+            Client() : socket(0), accepted(0), filterSeq(0), bSubscribing(false)
+            {
+            }
+
+            // it is closed and reset by Socket::Write/Read on the errors
+            behaviac::Socket::Handle	socket;
+
+            // the socket as it is accepted, the client is removed when 'socket' is closed
+            behaviac::Socket::Handle	accepted;
+
+            // they are only written by the socket thread, GetSubscribers reads them again if 'filterSeq' is changed meanwhile
+            SubscriptionFilter			filter;
+            volatile Atomic32			filterSeq;
+            bool						bSubscribing;
+
+            // the part of the last line not received yet
+            behaviac::string			received;
+        };
+
+        void AcceptClient();
+        void PublishFilter(Client& client, const SubscriptionFilter& filter, bool bSubscribing);
+        bool ReceiveFrom(int clientIndex, const char* msgCheck);
+        void RemoveClosedClients();
+
+        unsigned short				m_port;
+        behaviac::Socket::Handle	m_serverSocket;
+        behaviac::Socket::Poller*	m_poller;
+        Client						m_clients[kMaxClients];
+        volatile int				m_connectingClient;
+        THREAD_ID_TYPE				m_socketThreadId;
+        bool						m_bAccepting;
+
+        PacketRing*					m_packetRing;
+        // the texts of RecordText, they are sent to the clients when they are connected
+        PacketRing*					m_recordedRing;
         volatile Atomic32			m_isInited;
+        // the number of the connected clients
         volatile Atomic32			m_isConnected;
         volatile Atomic32			m_isDisconnected;
         volatile Atomic32			m_isConnectedFinished;
         volatile Atomic32			m_terminating;
-        volatile int				m_packetsCount;
+        volatile Atomic32			m_packetsCount;
+        // notified when the sent packets are released from m_packetRing, ReservePacket waits in it when it is full
+        behaviac::ConditionVariable	m_packetsReleased;
 
         struct PacketsStats
         {
@@ -338,7 +454,6 @@ namespace behaviac
         };
 
         thread::ThreadHandle		s_tracerThread;
-        Mutex						m_packetBuffersLock;
         behaviac::string			ms_texts;
         behaviac::Mutex				ms_cs;
         volatile bool				m_bHandleMessage;
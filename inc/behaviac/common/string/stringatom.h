@@ -0,0 +1,116 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Tencent is pleased to support the open source community by making behaviac available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except in compliance with
+// the License. You may obtain a copy of the License at http://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and limitations under the License.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _BEHAVIAC_COMMON_STRINGATOM_H_
+#define _BEHAVIAC_COMMON_STRINGATOM_H_
+
+#include "behaviac/common/config.h"
+#include "behaviac/common/assert.h"
+#include "behaviac/common/basictypes.h"
+
+namespace behaviac
+{
+	/**
+	the global table of the interned strings, each one is kept once and is identified by its index.
+
+	the strings are only removed by Cleanup, which is called when behaviac is stopped, as the nodes built in code
+	keep their strings too, so the pointers returned by GetString stay valid until then and are read without locking.
+	*/
+	class BEHAVIAC_API StringTable
+	{
+	public:
+		struct Stats
+		{
+			/// the distinct strings kept, the empty string included
+			uint32_t	strings;
+
+			/// the bytes of the strings kept, the terminators included
+			uint32_t	bytes;
+
+			/// the bytes allocated by the table, its index included
+			uint32_t	allocated;
+
+			/// the calls of Intern, each of them would have been a copy of the string
+			uint32_t	requests;
+
+			/// the bytes of the strings requested, the terminators included
+			uint32_t	requestedBytes;
+		};
+
+		/// return the index of 'str', it is added if it is not in the table yet. 0 is the empty string.
+		static uint32_t Intern(const char* str);
+
+		static const char* GetString(uint32_t index);
+
+		static Stats GetStats();
+
+		enum { kSubBTIndex = 1 };
+
+		/// "SubBT" is interned first each time the table is created, its index doesn't change
+		static uint32_t GetSubBTIndex();
+
+		static void Cleanup();
+	};
+
+	/// an interned string, it is compared as an integer
+	class BEHAVIAC_API CStringAtom
+	{
+	public:
+		CStringAtom() : m_index(0)
+		{
+		}
+
+		explicit CStringAtom(const char* str) : m_index(StringTable::Intern(str))
+		{
+		}
+
+		/// 'index' is returned by StringTable
+		static CStringAtom FromIndex(uint32_t index)
+		{
+			CStringAtom atom;
+			atom.m_index = index;
+
+			return atom;
+		}
+
+		const char* c_str() const
+		{
+			return StringTable::GetString(this->m_index);
+		}
+
+		bool empty() const
+		{
+			return this->m_index == 0;
+		}
+
+		uint32_t GetIndex() const
+		{
+			return this->m_index;
+		}
+
+		bool operator==(const CStringAtom& other) const
+		{
+			return this->m_index == other.m_index;
+		}
+
+		bool operator!=(const CStringAtom& other) const
+		{
+			return this->m_index != other.m_index;
+		}
+
+	private:
+		uint32_t m_index;
+	};
+}//namespace behaviac
+
+#endif //#ifndef _BEHAVIAC_COMMON_STRINGATOM_H_
@@ -41,6 +41,34 @@ namespace behaviac
         uint8_t        m_Shadow[kMutexShadowSize];
     };
 
+    /**
+    the threads wait in it until another thread notifies them, or until the timeout.
+
+    the notifications are counted, a thread takes the count before checking what it waits for and
+    then waits with that count, it returns at once if a notification has come since, so none is missed.
+    */
+    class BEHAVIAC_API ConditionVariable
+    {
+    public:
+        ConditionVariable();
+        ~ConditionVariable();
+
+        uint32_t GetCount();
+
+        /// return false if it is timed out
+        bool Wait(uint32_t count, long timeoutMs);
+
+        void NotifyAll();
+
+    private:
+        struct ConditionVariableImpl;
+        struct ConditionVariableImpl* _impl;
+
+        static const int kConditionVariableShadowSize = 128;
+
+        uint8_t        m_Shadow[kConditionVariableShadowSize];
+    };
+
     class BEHAVIAC_API ScopedLock
     {
         Mutex& m_mutex_;
@@ -46,6 +46,11 @@ namespace behaviac
         BEHAVIAC_API void StopThread(ThreadHandle th);
 
         BEHAVIAC_API void Sleep(long ms);
+
+        /**
+        a monotonic clock in microseconds, only the differences between two calls are meaningful
+        */
+        BEHAVIAC_API int64_t GetMicroseconds();
     }//namespace thread
 }//namespace behaviac
 
@@ -27,8 +27,8 @@
 #define MemoryReadBarrier	_ReadBarrier
 #define MemoryWriteBarrier	_WriteBarrier
 #else
-#define MemoryReadBarrier
-#define MemoryWriteBarrier
+#define MemoryReadBarrier	__sync_synchronize
+#define MemoryWriteBarrier	__sync_synchronize
 #endif//BEHAVIAC_CCDEFINE_MSVC
 
 #include <cassert>
@@ -53,23 +53,27 @@ namespace behaviac
     inline T Load_Acquire(const T& v)
     {
         T ret = v;
-#if _MSC_VER >= 1500
+#if !BEHAVIAC_CCDEFINE_MSVC || _MSC_VER >= 1500
         MemoryReadBarrier();
-#endif//#if _MSC_VER >= 1500
+#endif//#if !BEHAVIAC_CCDEFINE_MSVC || _MSC_VER >= 1500
         return ret;
     }
     template<typename T>
     inline void Store_Release(T& dst, T v)
     {
-#if _MSC_VER >= 1500
+#if !BEHAVIAC_CCDEFINE_MSVC || _MSC_VER >= 1500
         MemoryWriteBarrier();
-#endif//#if _MSC_VER >= 1500
+#endif//#if !BEHAVIAC_CCDEFINE_MSVC || _MSC_VER >= 1500
         dst = v;
     }
 
     // Returns a new value of i
     Atomic32 AtomicInc(volatile Atomic32& i);
     Atomic32 AtomicDec(volatile Atomic32& i);
+    Atomic32 AtomicAdd(volatile Atomic32& i, Atomic32 value);
+
+    // Returns the value of i before, it is only set to 'exchange' if it was 'comparand'
+    Atomic32 AtomicCompareExchange(volatile Atomic32& i, Atomic32 exchange, Atomic32 comparand);
 
     template<typename T>
     class ScopedInt
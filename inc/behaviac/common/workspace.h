@@ -19,6 +19,7 @@
 
 #include "behaviac/common/base.h"
 #include "behaviac/common/logger/logmanager.h"
+#include "behaviac/common/file/behaviorbundle.h"
 
 namespace behaviac
 {
@@ -55,6 +56,10 @@ namespace behaviac
         static bool IsLogging();
         static void SetLogging(bool bLogging);
 
+        /**
+        the log is written by a background thread every few milliseconds, by default the files are flushed
+        each time. otherwise, they are only flushed when LogManager::Flush is called or their buffers are full
+        */
         static bool IsLoggingFlush();
         static void SetLoggingFlush(bool bFlush);
 
@@ -196,6 +201,31 @@ namespace behaviac
         */
         bool Load(const char* relativePath, bool bForce = false);
         void UnLoad(const char* relativePath);
+
+        /**
+        the trees in the bundle are loaded from it instead of from their own files, see CBehaviorBundle.
+        the trees not in it are still loaded from their files. the bundle is kept open until CloseBundle or Cleanup.
+
+        @param bundlePath
+        either a full path or a path relative to the workspace exported path, with its extension
+
+        @return false if it is not a valid bundle
+        */
+        bool OpenBundle(const char* bundlePath);
+        void CloseBundle();
+
+        /// 0 if no bundle is open
+        const CBehaviorBundle* GetBundle() const;
+
+        /**
+        copies 'relativePath' in the bundle into the file buffer, zero terminated, it is released by PopFileFromBuffer
+
+        @param f
+        the formats accepted, it is set as the format of the one found
+
+        @return 0 if no bundle is open or 'relativePath' is not in it
+        */
+        char* ReadBundledFile(const char* relativePath, EFileFormat& f, uint32_t& bufferSize);
         void UnLoadAll();
 
         BehaviorTree* LoadBehaviorTree(const char* relativePath);
@@ -256,6 +286,9 @@ namespace behaviac
         bool LoadWorkspaceFile(const char* file);
 
 		char* ReadFileToBuffer(const char* file, uint32_t& bufferSize);
+		char* AllocFileBuffer(uint32_t bufferSize);
+		char* ReadBundledFile(const CBehaviorBundle::Entry_t& entry, uint32_t& bufferSize);
+		bool LoadBundledTree(BehaviorTree* pBT, const CBehaviorBundle::Entry_t& entry);
 
 		void PopFileFromBuffer(char* pBuffer, uint32_t bufferSize);
 
@@ -335,11 +368,24 @@ namespace behaviac
         };
         typedef behaviac::map<behaviac::string, BTItem_t> AllBehaviorTreeTasks_t;
         AllBehaviorTreeTasks_t* m_allBehaviorTreeTasks;
+
+        //the tasks are created and destroyed by the threads ticking the contexts
+        behaviac::Mutex m_behaviorTreeTasksMutex;
+
+        //the trees replaced by the hot reloaded ones, the tasks not managed by the workspace(saved states, etc.) might still use them
+        behaviac::vector<BehaviorTree*> m_retiredBehaviorTrees;
+
+        void FreeRetiredBehaviorTrees();
+
+        BehaviorTree* ReloadBehaviorTree(const char* relativePath, EFileFormat f, behaviac::string& content);
+        void PatchBehaviorTreeTasks(const char* relativePath, BTItem_t& btItems, BehaviorTree* behaviorTree);
 #endif//BEHAVIAC_ENABLE_HOTRELOAD
 
         BehaviorNodeLoader		m_pBehaviorNodeLoader;
         BehaviorTreeCreators_t* m_behaviortreeCreators;
 
+        CBehaviorBundle*		m_bundle;
+
 		// we keep 5 (kFileBuffers) buffers, each buffer is allocated once and used from buffer[0] until 
 		// it is used out then to try to use buffer[1], etc. 
 		// our goal is to use memory as less as possible and allocate as not often as possible
@@ -362,6 +408,9 @@ namespace behaviac
 protected:
 		double m_timeSinceStartup;
 		int m_frameSinceStartup;
+
+		//to record them only if they are set
+		friend class TickRecorder;
     };
 }//namespace behaviac
 
@@ -53,6 +53,9 @@ namespace behaviac
         virtual EBTStatus update(Agent* pAgent, EBTStatus childStatus);
 	protected:
         int m_nextStateId;
+
+        //the continuation of the method of the state, see ActionTask
+        ResumeState_t m_resumeState;
     };
 
 }
@@ -39,7 +39,50 @@ namespace behaviac
         Task* m_rootTaskNode;
         PlannerTask* m_rootTask;
 
+        /// a plan built before, it is used again if the variables read when building it are not changed
+        struct CachedPlan
+        {
+            Task*						root;
+
+            /// the ids of the variables read when it was built, sorted
+            behaviac::vector<uint32_t>	readIds;
+
+            /// the values of readIds in the form of the snapshot
+            behaviac::vector<uint8_t>	values;
+
+            PlannerTask*				plan;
+        };
+
+        /// the least recently used is the first
+        behaviac::vector<CachedPlan>	m_planCache;
+        behaviac::vector<uint8_t>		m_values;
+
+        static uint32_t					ms_planCacheCapacity;
+        static bool						ms_partialReplanning;
+
     public:
+        /// the counters of the plans built and of the work the partial replanning saved
+        struct ReplanStats
+        {
+            /// the plans built from the root task
+            uint32_t	plans;
+
+            /// the plans used again from the plan cache instead of being built
+            uint32_t	planCacheHits;
+
+            /// the failed methods replaced by decomposing only their task again
+            uint32_t	replans;
+
+            /// no method of the task applies any more, the failure goes up to the parent
+            uint32_t	failedReplans;
+
+            /// the tasks of the plans kept by the replans instead of being decomposed again
+            uint32_t	tasksKept;
+
+            /// the tasks decomposed by the replans
+            uint32_t	tasksDecomposed;
+        };
+
         void Init(Agent* pAgent, Task* rootTask);
 
         void Uninit();
@@ -47,9 +90,53 @@ namespace behaviac
         {
             AutoReplan = true;
         }
+
+        ~Planner();
+
+        /**
+        keep up to 'capacity' plans for each planner, 0 by default to disable the cache.
+
+        a plan is used again without decomposing the task if the variables and the properties read when
+        building it have the same values. the methods called in the preconditions and the local variables
+        of the tree are not taken into account, so it should only be enabled when the plans only depend on
+        the variables and the properties. the plans reading a pointer, or the properties of another agent
+        or the static ones, are not kept.
+        */
+        static void SetPlanCacheCapacity(uint32_t capacity);
+        static uint32_t GetPlanCacheCapacity();
+
+        /**
+        false by default, a failure in the plan fails it and a new plan is built from the root task.
+
+        when it is enabled, the task whose method fails is decomposed again from the current state and
+        the method found replaces the failed one, the other tasks of the plan are kept and the plan goes on.
+        if no method applies, the failure goes up to the task above, and so on up to the root.
+        */
+        static void SetPartialReplanning(bool bEnabled);
+        static bool IsPartialReplanning();
+
+        static ReplanStats GetReplanStats();
+        static void ResetReplanStats();
+
+        /**
+        decompose 'task' again from the current state as its method 'failedTask' of the running plan fails.
+
+        @return the method task to replace 'failedTask', NULL if no method applies
+        */
+        PlannerTask* ReplanTask(Task* task, int depth, const PlannerTask* failedTask);
+
     private:
         void OnDisable();
 
+        PlannerTask* FindCachedPlan(Task* root);
+        void AddCachedPlan(Task* root, behaviac::vector<uint32_t>& readIds, PlannerTask* plan);
+        bool IsCached(const PlannerTask* plan) const;
+        void RemoveCachedPlan(uint32_t index);
+        void ClearPlanCache();
+
+        /// write the current values of 'readIds' into m_values, false if one of them can't be written
+        bool SaveValues(const behaviac::vector<uint32_t>& readIds);
+
     public:
         EBTStatus Update();
 
@@ -18,11 +18,13 @@
 #include "behaviac/behaviortree/behaviortree.h"
 #include "behaviac/behaviortree/behaviortree_task.h"
 #include "behaviac/property/properties.h"
+#include "behaviac/behaviortree/nodes/actions/action.h"
 
 #if BEHAVIAC_USE_HTN
 namespace behaviac
 {
     class AgentState;
+    class Planner;
     class PlannerTask : public BehaviorTask
     {
         typedef PlannerTask* (*TaskCreator)(BehaviorNode* node, Agent* pAgent);
@@ -49,6 +51,9 @@ namespace behaviac
 
         bool IsHigherPriority(PlannerTask* other);
 
+        /// the number of the tasks of the plan from this task, itself included
+        virtual uint32_t GetPlanSize() const;
+
         virtual void traverse(bool childFirst, NodeHandler_t handler, Agent* pAgent, void* user_data);
     protected:
         virtual void Init(const BehaviorNode* node);
@@ -72,6 +77,9 @@ namespace behaviac
 
     protected:
         virtual EBTStatus update(Agent* pAgent, EBTStatus childStatus);
+
+        //the continuation of the method of the action, see ActionTask
+        ResumeState_t m_resumeState;
     };
 
     class PlannerTaskComplex : public PlannerTask
@@ -86,6 +94,9 @@ namespace behaviac
         void RemoveChild(PlannerTask* childTask);
 
         PlannerTaskComplex(BehaviorNode* node, Agent* pAgent);
+        virtual ~PlannerTaskComplex();
+
+        virtual uint32_t GetPlanSize() const;
 
     protected:
         virtual bool onenter(Agent* pAgent);
@@ -155,6 +166,7 @@ namespace behaviac
     {
     public:
         PlannerTaskReference(BehaviorNode* node, Agent* pAgent);
+        virtual ~PlannerTaskReference();
 
         void SetSubTreeTask(BehaviorTreeTask* treeTask ) {
             this->m_subTree = treeTask;
@@ -181,11 +193,17 @@ namespace behaviac
     public:
         PlannerTaskTask(BehaviorNode* node, Agent* pAgent);
 
+        /// the planner and the depth it was decomposed with, to decompose it again when its method fails
+        void SetPlanner(Planner* planner, int depth);
+
     protected:
         virtual bool onenter(Agent* pAgent);
         virtual void onexit(Agent* pAgent, EBTStatus s);
 
         virtual EBTStatus update(Agent* pAgent, EBTStatus childStatus);
+
+        Planner*	m_planner;
+        int			m_depth;
     };
 
     class PlannerTaskMethod : public  PlannerTaskComplex
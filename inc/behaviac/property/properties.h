@@ -27,6 +27,8 @@ namespace behaviac
     class Agent;
     class IInstantiatedVariable;
     class IInstanceMember;
+    class SnapshotWriter;
+    class SnapshotReader;
     BEHAVIAC_API uint32_t MakeVariableId(const char* idString);
 
     class BEHAVIAC_API Variables
@@ -63,15 +65,35 @@ namespace behaviac
         void Save(IIONode* node) const;
         void Load(IIONode* node);
 
+        /**
+        write the variables into the binary snapshot, each one with its id and type so that
+        the ones not existing or of another type are skipped when loading, they keep their values.
+        */
+        static void SaveSnapshot(const behaviac::map<uint32_t, IInstantiatedVariable*>& vars, SnapshotWriter& writer);
+        static bool LoadSnapshot(behaviac::map<uint32_t, IInstantiatedVariable*>& vars, SnapshotReader& reader);
+
         virtual IInstantiatedVariable* GetVariable(uint32_t varId) const;
         virtual void AddVariable(uint32_t varId, IInstantiatedVariable* pVar, int stackIndex);
 
+        /**
+        changed whenever a variable is added, removed or replaced, the pointers looked up before
+        are not valid any more then, see Agent::GetBoundVariable
+        */
+        uint32_t GetVersion() const
+        {
+            return this->m_version;
+        }
+
     protected:
         typedef behaviac::map<uint32_t, IInstantiatedVariable*> Variables_t;
         Variables_t m_variables;
+        uint32_t	m_version;
     public:
         behaviac::map<uint32_t, IInstantiatedVariable*>& Vars()
         {
+            //the map can be changed by the caller
+            this->m_version++;
+
             return this->m_variables;
         };
     };
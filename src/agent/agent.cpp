@@ -24,6 +24,7 @@
 #include "behaviac/behaviortree/behaviortree_task.h"
 
 #include "behaviac/common/profiler/profiler.h"
+#include "behaviac/common/serialization/snapshot.h"
 
 #include "./propertynode.h"
 #include "behaviac/common/meta.h"
@@ -63,6 +64,9 @@ namespace behaviac
     }
 
     int Agent::ms_agent_index = 0;
+
+    //the agents might be created and destroyed by the threads ticking different contexts
+    static behaviac::Mutex gs_agentsMutex;
     CFactory<Agent>* Agent::ms_factory;
 
     Agent::AgentMetas_t* Agent::ms_metas;
@@ -107,8 +111,12 @@ namespace behaviac
     }
 
     //m_id == -1, not a valid agent
-    Agent::Agent() : m_context_id(-1), m_currentBT(0), m_id(-1), m_priority(0), m_bActive(1), m_referencetree(false), _balckboard_bound(false), m_excutingTreeTask(0), m_variables(0), m_idFlag(0xffffffff), m_planningTop(-1)
+    Agent::Agent() : m_context_id(-1), m_currentBT(0), m_id(-1), m_priority(0), m_bActive(1), m_referencetree(false), _balckboard_bound(false), m_changeStamps(0), m_changeStamp(0), m_allChangedStamp(0),
+        m_tickInterval(1), m_lastTickFrame(0), m_bTickDeferred(false), m_lod(0), m_lodPhase(0), m_variableSlotsVersion(0), m_resumeState(0), m_asyncToken(0), m_bParked(false), m_batchSlot(0), m_tickRecorder(0), m_context(0), m_contextVersion(0), m_meta(0), m_metaVersion(0),
+        m_excutingTreeTask(0), m_variables(0), m_idFlag(0xffffffff), m_planningTop(-1)
     {
+        this->ResetTickStats();
+
 		bool bOk = TryStart();
 		BEHAVIAC_ASSERT(bOk);
 		BEHAVIAC_UNUSED_VAR(bOk);
@@ -186,6 +194,8 @@ namespace behaviac
 			char aName[1024];
 			string_sprintf(aName, "%s#%s", agentClassName, instanceName.c_str());
 
+			behaviac::ScopedLock lock(gs_agentsMutex);
+
 			Agent::Agents_t::iterator it = agents->find(aName);
 			if (it != agents->end()) {
 				agents->erase(it);
@@ -224,7 +234,133 @@ namespace behaviac
         {
             this->m_variables->Clear(true);
         }
+
+        BEHAVIAC_DELETE_ARRAY this->m_changeStamps;
+    }
+
+    void Agent::EnableChangeTracking()
+    {
+        if (this->m_changeStamps == NULL)
+        {
+            this->m_changeStamps = BEHAVIAC_NEW_ARRAY uint64_t[kChangeStampCount];
+
+            for (int i = 0; i < kChangeStampCount; ++i)
+            {
+                this->m_changeStamps[i] = 0;
+            }
+
+            //nothing was tracked before, so everything is regarded as changed
+            this->markChanged(0);
+        }
+    }
+
+    void Agent::markChanged(uint32_t variableId)
+    {
+        this->m_changeStamp++;
+
+        if (variableId == 0)
+        {
+            this->m_allChangedStamp = this->m_changeStamp;
+        }
+        else
+        {
+            this->m_changeStamps[variableId % kChangeStampCount] = this->m_changeStamp;
+        }
+    }
+
+    void Agent::NotifyVariableChanged(const char* variableName)
+    {
+        if (this->m_changeStamps != NULL)
+        {
+            this->markChanged(MakeVariableId(variableName));
+        }
+    }
+
+    uint64_t Agent::GetVariableChangeStamp(uint32_t variableId) const
+    {
+        //not tracked, it is always regarded as changed
+        if (this->m_changeStamps == NULL)
+        {
+            return (uint64_t) - 1;
+        }
+
+        uint64_t stamp = this->m_changeStamps[variableId % kChangeStampCount];
+
+        return stamp > this->m_allChangedStamp ? stamp : this->m_allChangedStamp;
+    }
+
+    void Agent::SetTickInterval(int tickInterval)
+    {
+        BEHAVIAC_ASSERT(tickInterval >= 1);
+        this->m_tickInterval = tickInterval >= 1 ? tickInterval : 1;
+    }
+
+    void Agent::ResetTickStats()
+    {
+        memset(&this->m_tickStats, 0, sizeof(this->m_tickStats));
+    }
+
+    void Agent::SetLOD(int lod)
+    {
+        BEHAVIAC_ASSERT(lod >= 0);
+
+        if (lod < 0)
+        {
+            lod = 0;
+        }
+
+        if (lod != this->m_lod)
+        {
+            this->m_lod = lod;
+            this->m_lodPhase = this->GetContext().nextLODPhase_(lod);
+        }
+
+        this->setLODTree_();
+    }
+
+    void Agent::setLODTree_()
+    {
+        const int lod = this->m_lod;
+
+        //the tree of the level or of the nearest level above it
+        for (int i = (int)this->m_lodTrees.size() - 1 < lod ? (int)this->m_lodTrees.size() - 1 : lod; i >= 0; --i)
+        {
+            const behaviac::string& treePath = this->m_lodTrees[i];
+
+            if (!treePath.empty())
+            {
+                if (this->m_currentBT == 0 || treePath != this->m_currentBT->GetName())
+                {
+                    this->btsetcurrent(treePath.c_str());
+                }
+
+                break;
+            }
+        }
     }
+
+    void Agent::SetLODTree(int lod, const char* relativePath)
+    {
+        BEHAVIAC_ASSERT(lod >= 0);
+
+        if ((int)this->m_lodTrees.size() <= lod)
+        {
+            this->m_lodTrees.resize(lod + 1);
+        }
+
+        if (lod > 0 && this->m_lodTrees[0].empty() && this->m_currentBT != 0)
+        {
+            this->m_lodTrees[0] = this->m_currentBT->GetName();
+        }
+
+        this->m_lodTrees[lod] = relativePath ? relativePath : "";
+
+        if (lod <= this->m_lod)
+        {
+            this->setLODTree_();
+        }
+    }
+
     void Agent::SetVariableFromString(const char* variableName, const char* valueStr)
     {
         uint32_t variableId = MakeVariableId(variableName);
@@ -234,6 +370,7 @@ namespace behaviac
         if (v != NULL)
         {
             v->SetValue(this, (void*)valueMember->GetValueObject(this));
+            this->NotifyVariableChanged(variableId);
             return;
 		}
 
@@ -246,6 +383,16 @@ namespace behaviac
 		int contextId = this->GetContextId();
 		Context& c = Context::GetContext(contextId);
 
+		//the completions of its async work are ignored, including the ones queued to be resumed
+		Context::UnregisterAsync(this);
+		c.removeResumedAgent_(this);
+		this->m_asyncToken = 0;
+
+		if (this->m_bParked)
+		{
+			c.UnparkAgent(this);
+		}
+
 		c.RemoveAgent(this);
 
 		// It should be deleted absolutely here.
@@ -264,26 +411,36 @@ namespace behaviac
         BEHAVIAC_ASSERT(contextId >= 0, "invalid context id");
 
         pAgent->m_context_id = contextId;
-        pAgent->m_id = ms_agent_index++;
+        pAgent->m_context = NULL;
         pAgent->m_priority = priority;
 
-        pAgent->SetName(agentInstanceName);
+        {
+            behaviac::ScopedLock lock(gs_agentsMutex);
+
+            pAgent->m_id = ms_agent_index++;
+            pAgent->SetName(agentInstanceName);
+        }
+
         pAgent->InitVariableRegistry();
 
         Context& c = Context::GetContext(contextId);
         c.AddAgent(pAgent);
 
 #if !BEHAVIAC_RELEASE
-        Agent::Agents_t* agents = Agents(false);
-        BEHAVIAC_ASSERT(agents);
+        {
+            behaviac::ScopedLock lock(gs_agentsMutex);
+
+            Agent::Agents_t* agents = Agents(false);
+            BEHAVIAC_ASSERT(agents);
 
-        const char* agentClassName = pAgent->GetObjectTypeName();
-        const behaviac::string& instanceName = pAgent->GetName();
+            const char* agentClassName = pAgent->GetObjectTypeName();
+            const behaviac::string& instanceName = pAgent->GetName();
 
-		char aName[1024];
-        string_sprintf(aName, "%s#%s", agentClassName, instanceName.c_str());
+            char aName[1024];
+            string_sprintf(aName, "%s#%s", agentClassName, instanceName.c_str());
 
-        (*agents)[aName] = pAgent;
+            (*agents)[aName] = pAgent;
+        }
 #endif//BEHAVIAC_RELEASE
 
 #if BEHAVIAC_ENABLE_NETWORKD
@@ -342,11 +499,34 @@ namespace behaviac
         return false;
     }
 
+    AgentMeta* Agent::getMeta_() const
+    {
+        if (this->m_meta == NULL || this->m_metaVersion != AgentMeta::GetVersion())
+        {
+            const char* agentClassName = this->GetObjectTypeName();
+            uint32_t agentClassId = MakeVariableId(agentClassName);
+
+            this->m_meta = AgentMeta::GetMeta(agentClassId);
+            this->m_metaVersion = AgentMeta::GetVersion();
+        }
+
+        return this->m_meta;
+    }
+
+    Context& Agent::GetContext() const
+    {
+        if (this->m_context == NULL || this->m_contextVersion != Context::ms_contextsVersion)
+        {
+            this->m_context = &Context::GetContext(this->m_context_id);
+            this->m_contextVersion = Context::ms_contextsVersion;
+        }
+
+        return *this->m_context;
+    }
+
     behaviac::map<uint32_t, IInstantiatedVariable*> Agent::GetCustomizedVariables()
     {
-        const char* agentClassName = this->GetObjectTypeName();
-        uint32_t agentClassId = MakeVariableId(agentClassName);
-        AgentMeta* meta = AgentMeta::GetMeta(agentClassId);
+        AgentMeta* meta = this->getMeta_();
         behaviac::map<uint32_t, IInstantiatedVariable*> vars;
         if (meta != NULL)
         {
@@ -515,15 +695,13 @@ namespace behaviac
         BEHAVIAC_UNUSED_VAR(bForce);
 #if !BEHAVIAC_RELEASE
 
-        if (Config::IsLoggingOrSocketing())
+        if (Config::IsLogging() || Socket::GetSubscribers(this, MessageKind::MSGKIND_PROPERTY) != 0)
         {
             BEHAVIAC_PROFILE("Agent::LogVariables");
 
             this->GetVariables()->Log(this, bForce);
             //property 
-            const char* className = this->GetClassTypeName();
-            uint32_t classId = MakeVariableId(className);
-            AgentMeta* meta = AgentMeta::GetMeta(classId);
+            AgentMeta* meta = this->getMeta_();
 
             if (meta != NULL)
             {
@@ -539,8 +717,8 @@ namespace behaviac
                     }
                 }
                 //member property 
-                behaviac::map<uint32_t, IProperty*> memberProperties = meta->GetMemberProperties();
-                for (behaviac::map<uint32_t, IProperty*>::iterator it = memberProperties.begin();
+                const behaviac::map<uint32_t, IProperty*>& memberProperties = meta->GetMemberProperties();
+                for (behaviac::map<uint32_t, IProperty*>::const_iterator it = memberProperties.begin();
                     it != memberProperties.end();
                     ++it)
                 {
@@ -838,6 +1016,11 @@ namespace behaviac
 
             this->UpdateVariableRegistry();
 
+            if (this->m_tickRecorder != NULL)
+            {
+                this->m_tickRecorder->BeginTick(this);
+            }
+
             EBTStatus s = this->btexec_();
 
             while (this->m_referencetree && s == BT_RUNNING)
@@ -846,6 +1029,11 @@ namespace behaviac
                 s = this->btexec_();
             }
 
+            if (this->m_tickRecorder != NULL)
+            {
+                this->m_tickRecorder->EndTick(this);
+            }
+
             if (this->IsMasked())
             {
                 this->LogVariables(false);
@@ -865,15 +1053,15 @@ namespace behaviac
     {
         if (this->m_currentBT != NULL)
         {
-            const char* agentClassName = this->GetObjectTypeName();
-            uint32_t agentClassId = MakeVariableId(agentClassName);
-            AgentMeta* meta = AgentMeta::GetMeta(agentClassId);
+            AgentMeta* meta = this->getMeta_();
             if (meta != NULL)
             {
                 uint32_t eventId = MakeVariableId(btEvent);
                 IInstanceMember* e = meta->GetMethod(eventId);
                 if (e != NULL)
                 {
+                    this->NotifyVariableChanged(eventId);
+
 #if !BEHAVIAC_RELEASE
 			BEHAVIAC_ASSERT(this->m_debug_in_exec == 0, "FireEvent should not be called during the Agent is in btexec");
 
@@ -898,6 +1086,19 @@ namespace behaviac
         return m_currentBT;
     }
 
+    uint32_t Agent::BeginAsync()
+    {
+        //the work begun before by the same method is not waited for any more
+        if (this->m_asyncToken != 0)
+        {
+            Context::UnregisterAsync(this->m_asyncToken);
+        }
+
+        this->m_asyncToken = Context::RegisterAsync(this);
+
+        return this->m_asyncToken;
+    }
+
     bool Agent::btload(const char* relativePath, bool bForce)
     {
         bool bOk = Workspace::GetInstance()->Load(relativePath, bForce);
@@ -1162,9 +1363,7 @@ namespace behaviac
 
     IProperty* Agent::GetProperty(uint32_t propId) const
     {
-        const char* className = GetObjectTypeName();
-        uint32_t classId = MakeVariableId(className);
-        AgentMeta* meta = AgentMeta::GetMeta(classId);
+        AgentMeta* meta = this->getMeta_();
         if (meta != NULL)
         {
             IProperty* prop = meta->GetProperty(propId);
@@ -1429,6 +1628,127 @@ namespace behaviac
         return false;
     }
 
+    void Agent::btsavesnapshot_(SnapshotWriter& writer)
+    {
+        SnapshotHeader header;
+        header.magic = SnapshotHeader::kMagic;
+        header.version = SnapshotHeader::kVersion;
+        header.size = 0;
+        header.agentType = CRC32::CalcCRC(this->GetObjectTypeName());
+        writer.Write(header);
+
+        Variables::SaveSnapshot(this->GetVariables()->Vars(), writer);
+
+        uint32_t length = this->m_currentBT ? (uint32_t)this->m_currentBT->GetName().size() : 0;
+        writer.Write(length);
+
+        if (this->m_currentBT)
+        {
+            writer.WriteBytes(this->m_currentBT->GetName().c_str(), length);
+            this->m_currentBT->SaveSnapshot(writer);
+        }
+
+        header.size = writer.GetSize();
+        writer.WriteAt(0, header);
+    }
+
+    uint32_t Agent::btsnapshotsize()
+    {
+        SnapshotWriter writer(0, 0);
+        this->btsavesnapshot_(writer);
+
+        return writer.GetSize();
+    }
+
+    uint32_t Agent::btsavesnapshot(void* buffer, uint32_t bufferSize)
+    {
+#if BEHAVIAC_ENABLE_PROFILING
+        BEHAVIAC_PROFILE("Agent::btsavesnapshot");
+#endif
+        SnapshotWriter writer(buffer, bufferSize);
+        this->btsavesnapshot_(writer);
+
+        return writer.IsOverflowed() ? 0 : writer.GetSize();
+    }
+
+    bool Agent::btloadsnapshot_(SnapshotReader& reader)
+    {
+        SnapshotHeader header;
+
+        if (!reader.Read(header) || header.magic != SnapshotHeader::kMagic || header.version != SnapshotHeader::kVersion ||
+            header.size > reader.GetSize() || header.agentType != CRC32::CalcCRC(this->GetObjectTypeName()))
+        {
+            return false;
+        }
+
+        if (!Variables::LoadSnapshot(this->GetVariables()->Vars(), reader))
+        {
+            return false;
+        }
+
+        uint32_t length = 0;
+        reader.Read(length);
+        const char* szTreePath = (const char*)reader.Skip(length);
+
+        if (reader.IsFailed() || length == 0)
+        {
+            return !reader.IsFailed();
+        }
+
+        if (this->m_currentBT && this->m_currentBT->GetName().size() == length && memcmp(this->m_currentBT->GetName().c_str(), szTreePath, length) == 0)
+        {
+            return this->m_currentBT->LoadSnapshot(this, reader);
+        }
+
+        behaviac::string treePath(szTreePath, length);
+
+        if (!reader.IsApplying())
+        {
+            //the tree is only set current when the snapshot is applied, it is validated against a task dropped afterwards
+            BehaviorTreeTask* pTask = Workspace::GetInstance()->CreateBehaviorTreeTask(treePath.c_str());
+
+            if (!pTask)
+            {
+                return false;
+            }
+
+            bool bOk = pTask->LoadSnapshot(this, reader);
+
+            Workspace::GetInstance()->DestroyBehaviorTreeTask(pTask, this);
+
+            return bOk;
+        }
+
+        this->btsetcurrent(treePath.c_str());
+
+        if (!this->m_currentBT || this->m_currentBT->GetName() != treePath)
+        {
+            return false;
+        }
+
+        return this->m_currentBT->LoadSnapshot(this, reader);
+    }
+
+    bool Agent::btloadsnapshot(const void* buffer, uint32_t size)
+    {
+#if BEHAVIAC_ENABLE_PROFILING
+        BEHAVIAC_PROFILE("Agent::btloadsnapshot");
+#endif
+        //the whole snapshot is validated first so that a bad one changes nothing
+        SnapshotReader validator(buffer, size, false);
+
+        if (!this->btloadsnapshot_(validator))
+        {
+            return false;
+        }
+
+        SnapshotReader reader(buffer, size);
+        bool bOk = this->btloadsnapshot_(reader);
+        BEHAVIAC_ASSERT(bOk);
+
+        return bOk;
+    }
+
     Agent* Agent::GetParentAgent(const Agent* pAgent, const char* instanceName)
     {
         Agent* pParent = const_cast<Agent*>(pAgent);
@@ -0,0 +1,306 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Tencent is pleased to support the open source community by making behaviac available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except in compliance with
+// the License. You may obtain a copy of the License at http://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and limitations under the License.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "behaviac/agent/batchexecutor.h"
+#include "behaviac/behaviortree/behaviortree.h"
+#include "behaviac/behaviortree/behaviortree_task.h"
+#include "behaviac/behaviortree/nodes/conditions/condition.h"
+#include "behaviac/common/workspace.h"
+
+namespace behaviac
+{
+    BatchExecutor::BatchExecutor() : m_frame(0), m_actionEpoch(0), m_batchEpoch(0), m_minBatchSize(4)
+    {
+        this->ResetStats();
+    }
+
+    BatchExecutor::~BatchExecutor()
+    {
+        this->Clear();
+    }
+
+    void BatchExecutor::SetMinBatchSize(int minBatchSize)
+    {
+        BEHAVIAC_ASSERT(minBatchSize >= 1);
+        this->m_minBatchSize = minBatchSize >= 1 ? minBatchSize : 1;
+    }
+
+    void BatchExecutor::ResetStats()
+    {
+        memset(&this->m_stats, 0, sizeof(this->m_stats));
+    }
+
+    void BatchExecutor::Clear()
+    {
+        for (Groups_t::iterator it = this->m_groups.begin(); it != this->m_groups.end(); ++it)
+        {
+            BEHAVIAC_DELETE it->second;
+        }
+
+        this->m_groups.clear();
+    }
+
+    void BatchExecutor::Exec(const behaviac::vector<Agent*>& agents)
+    {
+        this->m_frame++;
+        this->m_slots.resize(agents.size());
+
+        //the agents of a group are mostly next to each other
+        GroupKey_t lastKey(0, 0);
+        Group_t* pLastGroup = 0;
+
+        //group the agents by their tree and the innermost running node
+        for (uint32_t i = 0; i < agents.size(); ++i)
+        {
+            Agent* pAgent = agents[i];
+            BatchSlot_t& slot = this->m_slots[i];
+            slot.executor = this;
+            slot.group = 0;
+            slot.index = -1;
+
+            BehaviorTreeTask* pTreeTask = pAgent->btgetcurrent();
+
+            if (!pAgent->IsActive() || pTreeTask == 0)
+            {
+                continue;
+            }
+
+            const BehaviorTask* pTask = pTreeTask;
+
+            while (pTask->GetCurrentTask() != 0)
+            {
+                pTask = pTask->GetCurrentTask();
+            }
+
+            GroupKey_t key(pTreeTask->GetNode(), pTask->GetNode());
+            Group_t* pGroup = pLastGroup;
+
+            if (pGroup == 0 || key != lastKey)
+            {
+                Group_t*& pFound = this->m_groups[key];
+
+                if (pFound == 0)
+                {
+                    pFound = BEHAVIAC_NEW Group_t;
+                }
+
+                pGroup = pFound;
+                pLastGroup = pFound;
+                lastKey = key;
+            }
+
+            if (pGroup->frame != this->m_frame)
+            {
+                pGroup->frame = this->m_frame;
+                pGroup->agents.clear();
+            }
+
+            slot.group = pGroup;
+            slot.index = (int)pGroup->agents.size();
+            pGroup->agents.push_back(pAgent);
+        }
+
+        this->m_stats.groups = 0;
+
+        for (Groups_t::iterator it = this->m_groups.begin(); it != this->m_groups.end();)
+        {
+            Group_t* pGroup = it->second;
+
+            //the agents left the node
+            if (pGroup->frame != this->m_frame)
+            {
+                BEHAVIAC_DELETE pGroup;
+                this->m_groups.erase(it++);
+                continue;
+            }
+
+            this->m_stats.groups++;
+
+            if ((int)pGroup->agents.size() >= this->m_minBatchSize)
+            {
+                this->batch(pGroup);
+            }
+            else
+            {
+                pGroup->batchedCount = 0;
+            }
+
+            ++it;
+        }
+
+        this->m_batchEpoch = this->m_actionEpoch;
+
+        for (uint32_t i = 0; i < agents.size(); ++i)
+        {
+            Agent* pAgent = agents[i];
+
+            if (pAgent->IsActive())
+            {
+                //the agents not batched still report their actions
+                pAgent->m_batchSlot = &this->m_slots[i];
+
+                pAgent->btexec();
+
+                pAgent->m_batchSlot = 0;
+            }
+
+            // in case IsExecAgents was set to false by pAgent's bt
+            if (!Workspace::GetInstance()->IsExecAgents())
+            {
+                break;
+            }
+        }
+    }
+
+    void BatchExecutor::batch(Group_t* pGroup)
+    {
+        const uint32_t agentCount = (uint32_t)pGroup->agents.size();
+        const uint32_t conditionCount = (uint32_t)pGroup->conditions.size();
+
+        pGroup->batchedCount = 0;
+
+        if (conditionCount == 0)
+        {
+            return;
+        }
+
+        for (uint32_t i = 0; i < agentCount; ++i)
+        {
+            Agent* pAgent = pGroup->agents[i];
+
+            if (!pAgent->IsChangeTrackingEnabled())
+            {
+                pAgent->EnableChangeTracking();
+            }
+        }
+
+        pGroup->results.resize(conditionCount * agentCount);
+        bool results[kChunkSize];
+
+        for (uint32_t c = 0; c < conditionCount; ++c)
+        {
+            const BatchCondition_t& condition = pGroup->conditions[c];
+
+            if (!condition.bBatchable)
+            {
+                continue;
+            }
+
+            uint8_t* pResults = &pGroup->results[c * agentCount];
+
+            for (uint32_t start = 0; start < agentCount; start += kChunkSize)
+            {
+                uint32_t size = agentCount - start < (uint32_t)kChunkSize ? agentCount - start : (uint32_t)kChunkSize;
+
+                condition.pCondition->EvaluateBatch(&pGroup->agents[start], (int)size, results);
+
+                for (uint32_t i = 0; i < size; ++i)
+                {
+                    pResults[start + i] = results[i] ? 1 : 0;
+                }
+            }
+
+            this->m_stats.batched += agentCount;
+        }
+
+        pGroup->stamps.resize(agentCount);
+
+        for (uint32_t i = 0; i < agentCount; ++i)
+        {
+            pGroup->stamps[i] = pGroup->agents[i]->GetChangeStamp();
+        }
+
+        pGroup->batchedCount = conditionCount;
+    }
+
+    bool BatchExecutor::GetResult_(Agent* pAgent, Condition* pCondition, bool& result)
+    {
+        BatchSlot_t* pSlot = pAgent->m_batchSlot;
+        BatchExecutor* pExecutor = pSlot->executor;
+        Group_t* pGroup = (Group_t*)pSlot->group;
+        Stats_t& stats = pExecutor->m_stats;
+
+        //the condition is evaluated for another agent
+        if (pGroup == 0 || pGroup->agents[pSlot->index] != pAgent)
+        {
+            return false;
+        }
+
+        const uint32_t conditionCount = (uint32_t)pGroup->conditions.size();
+        uint32_t c = 0;
+
+        for (; c < conditionCount; ++c)
+        {
+            if (pGroup->conditions[c].pCondition == pCondition)
+            {
+                break;
+            }
+        }
+
+        if (c == conditionCount)
+        {
+            //to be batched from the next frame on
+            if (conditionCount < kMaxConditions)
+            {
+                pGroup->conditions.push_back(BatchCondition_t());
+                BatchCondition_t& condition = pGroup->conditions.back();
+                condition.pCondition = pCondition;
+                condition.bBatchable = pCondition->GetInputIds(condition.inputIds);
+            }
+
+            stats.misses++;
+            return false;
+        }
+
+        const BatchCondition_t& condition = pGroup->conditions[c];
+
+        if (c >= pGroup->batchedCount || !condition.bBatchable)
+        {
+            stats.misses++;
+            return false;
+        }
+
+        //an action of this or another agent is executed since the results are batched
+        if (pExecutor->m_actionEpoch != pExecutor->m_batchEpoch)
+        {
+            stats.stale++;
+            return false;
+        }
+
+        const uint64_t stamp = pGroup->stamps[pSlot->index];
+
+        //constants only, it is only changed when everything is marked as changed
+        if (condition.inputIds.size() == 0)
+        {
+            if (pAgent->GetVariableChangeStamp(0) > stamp)
+            {
+                stats.stale++;
+                return false;
+            }
+        }
+
+        for (uint32_t i = 0; i < condition.inputIds.size(); ++i)
+        {
+            if (pAgent->GetVariableChangeStamp(condition.inputIds[i]) > stamp)
+            {
+                stats.stale++;
+                return false;
+            }
+        }
+
+        stats.hits++;
+        result = pGroup->results[c * pGroup->agents.size() + pSlot->index] != 0;
+
+        return true;
+    }
+}
@@ -14,16 +14,38 @@
 #include "behaviac/agent/context.h"
 #include "behaviac/agent/agent.h"
 #include "behaviac/agent/state.h"
+#include "behaviac/agent/batchexecutor.h"
+#include "behaviac/agent/tickrecorder.h"
 
 #include "behaviac/common/thread/mutex_lock.h"
 #include "behaviac/common/file/filesystem.h"
+#include "behaviac/common/randomgenerator/randomgenerator.h"
+#include "behaviac/common/thread/thread.h"
 
 namespace behaviac
 {
     Context::Contexts_t* Context::ms_contexts = NULL;
+    Mutex Context::ms_contextsMutex;
+    uint32_t Context::ms_contextsVersion = 0;
 
-    Context::Context(int contextId) : m_context_id(contextId), m_bCreatedByMe(false), m_IsExecuting(false)
+    Context::AsyncAgents_t* Context::ms_asyncAgents = NULL;
+    uint32_t Context::ms_asyncSerial = 0;
+    Mutex Context::ms_asyncMutex;
+    volatile Atomic32 Context::ms_parkedCount = 0;
+    MPSCRing<Context::kCompletionRingSize> Context::ms_completions;
+    behaviac::vector<Context::Completion_t>* Context::ms_overflowCompletions = NULL;
+
+    //a context may be ticked on any thread, but only on one at a time
+#define ASSERT_TICKING_THREAD()  BEHAVIAC_ASSERT(this->m_tickingThreadId == 0 || this->m_tickingThreadId == behaviac::GetTID(), "called in a thread different from the one ticking the context")
+
+    Context::Context(int contextId) : m_context_id(contextId), m_bCreatedByMe(false), m_IsExecuting(false), m_tickingThreadId(0),
+        m_frameBudget(0), m_frame(0), m_lastFrameCost(0), m_batchExecutor(0), m_tickRecorder(0)
     {
+        //the contexts get different sequences, which all follow the seed of the instance
+        unsigned int seed = RandomGenerator::GetInstance()->getSeed() + (unsigned int)contextId * 2654435761u;
+
+        this->m_ownRandomGenerator = BEHAVIAC_NEW RandomGenerator(seed, false);
+        this->m_randomGenerator = this->m_ownRandomGenerator;
     }
 
     Context::~Context()
@@ -41,6 +63,15 @@ namespace behaviac
         this->CleanupStaticVariables();
         this->CleanupInstances();
 
+        BEHAVIAC_DELETE(this->m_ownRandomGenerator);
+        this->m_ownRandomGenerator = 0;
+        this->m_randomGenerator = 0;
+
+        BEHAVIAC_DELETE(this->m_batchExecutor);
+        this->m_batchExecutor = 0;
+
+        this->StopRecording();
+
 #if BEHAVIAC_UNUSED_CODE
         for (AgentStaticEvents_t::iterator it = ms_eventInfosGlobal.begin(); it != ms_eventInfosGlobal.end(); ++it)
         {
@@ -57,14 +88,22 @@ namespace behaviac
 #endif //BEHAVIAC_UNUSED_CODE
     }
 
+    void Context::SetRandomGenerator(RandomGenerator* pRandomGenerator)
+    {
+        this->m_randomGenerator = pRandomGenerator ? pRandomGenerator : this->m_ownRandomGenerator;
+    }
+
     Context& Context::GetContext(int contextId)
     {
+        BEHAVIAC_ASSERT(contextId >= 0);
+
+        ScopedLock lock(ms_contextsMutex);
+
         if (!ms_contexts)
         {
             ms_contexts = BEHAVIAC_NEW Contexts_t;
         }
 
-        BEHAVIAC_ASSERT(contextId >= 0);
         Contexts_t::iterator it = ms_contexts->find(contextId);
 
         if (it != ms_contexts->end())
@@ -79,33 +118,72 @@ namespace behaviac
         return *pContext;
     }
 
+    //the contexts are deleted out of the lock as their agents might look up their contexts when being destroyed
     void Context::Cleanup(int contextId)
     {
         if (ms_contexts)
         {
             if (contextId == -1)
             {
-                for (Contexts_t::iterator it = ms_contexts->begin(); it != ms_contexts->end(); ++it)
+                vector<Context*> contexts;
+
                 {
-                    Context* pContext = it->second;
+                    ScopedLock lock(ms_contextsMutex);
+
+                    for (Contexts_t::iterator it = ms_contexts->begin(); it != ms_contexts->end(); ++it)
+                    {
+                        contexts.push_back(it->second);
+                    }
+                }
+
+                for (vector<Context*>::iterator it = contexts.begin(); it != contexts.end(); ++it)
+                {
+                    Context* pContext = *it;
 
                     BEHAVIAC_DELETE(pContext);
                 }
 
-                ms_contexts->clear();
+                {
+                    ScopedLock lock(ms_contextsMutex);
+
+                    ms_contextsVersion++;
+                    ms_contexts->clear();
+
+                    BEHAVIAC_DELETE(ms_contexts);
+                    ms_contexts = 0;
+                }
+
+                ScopedLock lock(ms_asyncMutex);
+
+                BEHAVIAC_DELETE(ms_asyncAgents);
+                ms_asyncAgents = 0;
 
-                BEHAVIAC_DELETE(ms_contexts);
-                ms_contexts = 0;
+                BEHAVIAC_DELETE(ms_overflowCompletions);
+                ms_overflowCompletions = 0;
+
+                ms_completions.Drop();
             }
             else
             {
-                Contexts_t::iterator it = ms_contexts->find(contextId);
+                Context* pContext = 0;
 
-                if (it != ms_contexts->end())
                 {
-                    Context* pContext = it->second;
+                    ScopedLock lock(ms_contextsMutex);
+
+                    Contexts_t::iterator it = ms_contexts->find(contextId);
 
+                    if (it != ms_contexts->end())
+                    {
+                        pContext = it->second;
+                    }
+                }
+
+                if (pContext)
+                {
                     BEHAVIAC_DELETE(pContext);
+
+                    ScopedLock lock(ms_contextsMutex);
+                    ms_contextsVersion++;
                     ms_contexts->erase(contextId);
                 }
                 else
@@ -289,6 +367,8 @@ namespace behaviac
     {
         if (pAgent != NULL)
         {
+            pAgent->m_tickRecorder = this->m_tickRecorder;
+
             if (IsExecuting())
             {
                 delayAddedAgents.push_back(pAgent);
@@ -317,7 +397,7 @@ namespace behaviac
 
     void Context::addAgent_(Agent* pAgent)
     {
-        ASSERT_MAIN_THREAD();
+        ASSERT_TICKING_THREAD();
 
         int agentId = pAgent->GetId();
         int priority = pAgent->GetPriority();
@@ -339,11 +419,14 @@ namespace behaviac
 
     void Context::removeAgent_(Agent* pAgent)
     {
-        ASSERT_MAIN_THREAD();
+        ASSERT_TICKING_THREAD();
 
         int agentId = pAgent->GetId();
         int priority = pAgent->GetPriority();
 
+        //the recorder may be deleted by StopRecording while the agent is out of the context
+        pAgent->m_tickRecorder = 0;
+
         vector<behaviac::Context::HeapItem_t>::iterator it = std::find_if(this->m_agents.begin(), this->m_agents.end(), HeapFinder_t(priority));
 
         if (it != this->m_agents.end())
@@ -357,10 +440,33 @@ namespace behaviac
                 pa.agents.erase(ita);
             }
         }
+
+        if (pAgent->m_bTickDeferred)
+        {
+            pAgent->m_bTickDeferred = false;
+
+            vector<Agent*>::iterator itd = std::find(this->m_deferredAgents.begin(), this->m_deferredAgents.end(), pAgent);
+
+            if (itd != this->m_deferredAgents.end())
+            {
+                this->m_deferredAgents.erase(itd);
+            }
+        }
     }
 
     void Context::DelayProcessingAgents()
     {
+        //before the added ones, an agent parked and then resumed in the same frame is to be ticked
+        if (delayParkedAgents.size() > 0)
+        {
+            for (unsigned int i = 0; i < delayParkedAgents.size(); ++i)
+            {
+                removeAgent_(delayParkedAgents[i]);
+            }
+
+            delayParkedAgents.clear();
+        }
+
         if (delayAddedAgents.size() > 0)
         {
             for (unsigned int i = 0; i < delayAddedAgents.size(); ++i)
@@ -395,9 +501,21 @@ namespace behaviac
         }
         else if (ms_contexts != NULL)
         {
-            for (Contexts_t::iterator it = ms_contexts->begin(); it != ms_contexts->end(); ++it)
+            //the agents might create contexts when being ticked
+            vector<Context*> contexts;
+
+            {
+                ScopedLock lock(ms_contextsMutex);
+
+                for (Contexts_t::iterator it = ms_contexts->begin(); it != ms_contexts->end(); ++it)
+                {
+                    contexts.push_back(it->second);
+                }
+            }
+
+            for (vector<Context*>::iterator it = contexts.begin(); it != contexts.end(); ++it)
             {
-                Context* pContext = it->second;
+                Context* pContext = *it;
 
                 pContext->execAgents_();
             }
@@ -411,27 +529,67 @@ namespace behaviac
             return;
         }
 
+        if (this->m_tickRecorder != 0)
+        {
+            this->m_tickRecorder->BeginFrame(*this);
+        }
+
+        this->m_tickingThreadId = behaviac::GetTID();
+
+        //before the tick, an agent resumed is ticked in this frame
+        this->unparkResumedAgents_();
+
         m_IsExecuting = true;
 
+        this->m_frame++;
+
         std::make_heap(this->m_agents.begin(), this->m_agents.end(), HeapCompare_t());
 
-        for (vector<behaviac::Context::HeapItem_t>::iterator it = this->m_agents.begin(); it != this->m_agents.end(); ++it)
+        if (this->m_frameBudget > 0)
         {
-            HeapItem_t& pa = *it;
+            this->execAgentsScheduled_();
+        }
+        else if (this->m_batchExecutor != 0)
+        {
+            this->m_batchAgents.clear();
 
-            for (Agents_t::iterator ita = pa.agents.begin(); ita != pa.agents.end(); ++ita)
+            for (vector<behaviac::Context::HeapItem_t>::iterator it = this->m_agents.begin(); it != this->m_agents.end(); ++it)
             {
-                Agent* pA = ita->second;
-
-                if (pA->IsActive())
+                for (Agents_t::iterator ita = it->agents.begin(); ita != it->agents.end(); ++ita)
                 {
-                    pA->btexec();
+                    Agent* pA = ita->second;
+
+                    if (pA->IsActive() && this->isTickDue_(pA))
+                    {
+                        pA->m_lastTickFrame = this->m_frame;
+                        this->m_batchAgents.push_back(pA);
+                    }
                 }
+            }
 
-                // in case IsExecAgents was set to false by pA's bt
-                if (!Workspace::GetInstance()->IsExecAgents())
+            this->m_batchExecutor->Exec(this->m_batchAgents);
+        }
+        else
+        {
+            for (vector<behaviac::Context::HeapItem_t>::iterator it = this->m_agents.begin(); it != this->m_agents.end(); ++it)
+            {
+                HeapItem_t& pa = *it;
+
+                for (Agents_t::iterator ita = pa.agents.begin(); ita != pa.agents.end(); ++ita)
                 {
-                    break;
+                    Agent* pA = ita->second;
+
+                    if (pA->IsActive() && this->isTickDue_(pA))
+                    {
+                        pA->m_lastTickFrame = this->m_frame;
+                        pA->btexec();
+                    }
+
+                    // in case IsExecAgents was set to false by pA's bt
+                    if (!Workspace::GetInstance()->IsExecAgents())
+                    {
+                        break;
+                    }
                 }
             }
         }
@@ -444,6 +602,202 @@ namespace behaviac
         m_IsExecuting = false;
 
         this->DelayProcessingAgents();
+
+        this->m_tickingThreadId = 0;
+    }
+
+    void Context::SetBatchExecution(bool bBatch)
+    {
+        if (bBatch)
+        {
+            if (this->m_batchExecutor == 0)
+            {
+                this->m_batchExecutor = BEHAVIAC_NEW BatchExecutor();
+            }
+        }
+        else
+        {
+            BEHAVIAC_DELETE(this->m_batchExecutor);
+            this->m_batchExecutor = 0;
+        }
+    }
+
+    void Context::StartRecording(uint32_t bufferSize, uint32_t keyframeInterval)
+    {
+        this->StopRecording();
+
+        this->m_tickRecorder = BEHAVIAC_NEW TickRecorder(bufferSize, keyframeInterval);
+        this->setTickRecorder_(this->m_tickRecorder);
+    }
+
+    void Context::StopRecording()
+    {
+        if (this->m_tickRecorder != 0)
+        {
+            this->setTickRecorder_(0);
+
+            BEHAVIAC_DELETE(this->m_tickRecorder);
+            this->m_tickRecorder = 0;
+        }
+    }
+
+    void Context::setTickRecorder_(TickRecorder* pRecorder)
+    {
+        for (vector<behaviac::Context::HeapItem_t>::iterator it = this->m_agents.begin(); it != this->m_agents.end(); ++it)
+        {
+            for (Agents_t::iterator ita = it->agents.begin(); ita != it->agents.end(); ++ita)
+            {
+                ita->second->m_tickRecorder = pRecorder;
+            }
+        }
+
+        for (vector<Agent*>::iterator it = this->delayAddedAgents.begin(); it != this->delayAddedAgents.end(); ++it)
+        {
+            (*it)->m_tickRecorder = pRecorder;
+        }
+
+        //the agents removed, e.g. the parked ones, take it again from AddAgent
+    }
+
+    void Context::SetFrameBudget(uint32_t microseconds)
+    {
+        this->m_frameBudget = microseconds;
+
+        if (microseconds == 0)
+        {
+            for (vector<Agent*>::iterator it = this->m_deferredAgents.begin(); it != this->m_deferredAgents.end(); ++it)
+            {
+                (*it)->m_bTickDeferred = false;
+            }
+
+            this->m_deferredAgents.clear();
+        }
+    }
+
+    void Context::SetLODTickInterval(int lod, int tickInterval)
+    {
+        BEHAVIAC_ASSERT(lod >= 0 && tickInterval >= 1);
+
+        if ((int)this->m_lodTickIntervals.size() <= lod)
+        {
+            this->m_lodTickIntervals.resize(lod + 1, 1);
+        }
+
+        this->m_lodTickIntervals[lod] = tickInterval >= 1 ? tickInterval : 1;
+    }
+
+    uint32_t Context::nextLODPhase_(int lod)
+    {
+        if ((int)this->m_lodPhases.size() <= lod)
+        {
+            this->m_lodPhases.resize(lod + 1, 0);
+        }
+
+        //round robin, the agents which come to a level one after another get the frames one after another
+        return this->m_lodPhases[lod]++;
+    }
+
+    bool Context::isTickDue_(const Agent* pAgent) const
+    {
+        int lodInterval = this->GetLODTickInterval(pAgent->m_lod);
+
+        if (lodInterval > 1 && (this->m_frame + pAgent->m_lodPhase) % (uint32_t)lodInterval != 0)
+        {
+            return false;
+        }
+
+        //0 for never ticked
+        return pAgent->m_lastTickFrame == 0 || this->m_frame - pAgent->m_lastTickFrame >= (uint32_t)pAgent->m_tickInterval;
+    }
+
+    void Context::execAgentsScheduled_()
+    {
+        int64_t frameStart = thread::GetMicroseconds();
+        uint32_t tickedCount = 0;
+
+        //the agents carried over from the last frame go first
+        vector<Agent*> deferredAgents;
+        deferredAgents.swap(this->m_deferredAgents);
+
+        for (size_t i = 0; i < deferredAgents.size(); ++i)
+        {
+            Agent* pA = deferredAgents[i];
+
+            // in case IsExecAgents was set to false by an agent's bt, the rest are kept for the next frame
+            if (!Workspace::GetInstance()->IsExecAgents())
+            {
+                this->m_deferredAgents.push_back(pA);
+                continue;
+            }
+
+            pA->m_bTickDeferred = false;
+
+            //it was due when it was carried over
+            if (pA->IsActive())
+            {
+                this->tickScheduled_(pA, frameStart, tickedCount);
+            }
+        }
+
+        for (vector<behaviac::Context::HeapItem_t>::iterator it = this->m_agents.begin(); it != this->m_agents.end(); ++it)
+        {
+            HeapItem_t& pa = *it;
+
+            for (Agents_t::iterator ita = pa.agents.begin(); ita != pa.agents.end(); ++ita)
+            {
+                // in case IsExecAgents was set to false by pA's bt
+                if (!Workspace::GetInstance()->IsExecAgents())
+                {
+                    break;
+                }
+
+                Agent* pA = ita->second;
+
+                //skip the ones carried over again in this frame, the ones ticked in this frame are not due
+                if (pA->IsActive() && !pA->m_bTickDeferred && this->isTickDue_(pA))
+                {
+                    this->tickScheduled_(pA, frameStart, tickedCount);
+                }
+            }
+        }
+
+        int64_t cost = thread::GetMicroseconds() - frameStart;
+        this->m_lastFrameCost = cost > 0 ? (uint32_t)cost : 0;
+    }
+
+    void Context::tickScheduled_(Agent* pAgent, int64_t frameStart, uint32_t& tickedCount)
+    {
+        Agent::TickStats_t& stats = pAgent->m_tickStats;
+
+        int64_t tickStart = thread::GetMicroseconds();
+
+        //at least one agent is ticked every frame, the carried over ones go first so that every agent gets its turn
+        if (tickedCount > 0 && tickStart - frameStart + stats.averageCost > (int64_t)this->m_frameBudget)
+        {
+            pAgent->m_bTickDeferred = true;
+            stats.deferredCount++;
+            this->m_deferredAgents.push_back(pAgent);
+
+            return;
+        }
+
+        pAgent->btexec();
+
+        int64_t cost = thread::GetMicroseconds() - tickStart;
+        uint32_t lastCost = cost > 0 ? (uint32_t)cost : 0;
+
+        stats.lastCost = lastCost;
+        //moving average, the recent ticks weigh more
+        stats.averageCost = stats.tickCount == 0 ? lastCost : (stats.averageCost * 7 + lastCost) / 8;
+
+        if (lastCost > stats.maxCost)
+        {
+            stats.maxCost = lastCost;
+        }
+
+        stats.tickCount++;
+        pAgent->m_lastTickFrame = this->m_frame;
+        tickedCount++;
     }
 
     //void Context::btexec()
@@ -457,6 +811,227 @@ namespace behaviac
     //    }
     //}
 
+    uint32_t Context::RegisterAsync(Agent* pAgent)
+    {
+        ScopedLock lock(ms_asyncMutex);
+
+        if (!ms_asyncAgents)
+        {
+            ms_asyncAgents = BEHAVIAC_NEW AsyncAgents_t;
+        }
+
+        //0 is for no async work
+        if (++ms_asyncSerial == 0)
+        {
+            ++ms_asyncSerial;
+        }
+
+        AsyncWork_t& work = (*ms_asyncAgents)[ms_asyncSerial];
+        work.agent = pAgent;
+        work.status = BT_RUNNING;
+
+        return ms_asyncSerial;
+    }
+
+    void Context::UnregisterAsync(uint32_t token)
+    {
+        ScopedLock lock(ms_asyncMutex);
+
+        if (ms_asyncAgents)
+        {
+            ms_asyncAgents->erase(token);
+        }
+    }
+
+    void Context::UnregisterAsync(Agent* pAgent)
+    {
+        ScopedLock lock(ms_asyncMutex);
+
+        if (ms_asyncAgents)
+        {
+            for (AsyncAgents_t::iterator it = ms_asyncAgents->begin(); it != ms_asyncAgents->end();)
+            {
+                if (it->second.agent == pAgent)
+                {
+                    ms_asyncAgents->erase(it++);
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+        }
+    }
+
+    EBTStatus Context::GetAsyncStatus(uint32_t token)
+    {
+        ScopedLock lock(ms_asyncMutex);
+
+        if (ms_asyncAgents)
+        {
+            AsyncAgents_t::iterator it = ms_asyncAgents->find(token);
+
+            if (it != ms_asyncAgents->end())
+            {
+                return it->second.status;
+            }
+        }
+
+        return BT_INVALID;
+    }
+
+    void Context::ParkAgent(Agent* pAgent)
+    {
+        if (pAgent->m_bParked)
+        {
+            return;
+        }
+
+        pAgent->m_bParked = true;
+        AtomicInc(ms_parkedCount);
+
+        if (IsExecuting())
+        {
+            delayParkedAgents.push_back(pAgent);
+        }
+        else
+        {
+            removeAgent_(pAgent);
+        }
+    }
+
+    void Context::UnparkAgent(Agent* pAgent)
+    {
+        if (!pAgent->m_bParked)
+        {
+            return;
+        }
+
+        pAgent->m_bParked = false;
+        AtomicDec(ms_parkedCount);
+
+        vector<Agent*>::iterator it = std::find(this->delayParkedAgents.begin(), this->delayParkedAgents.end(), pAgent);
+
+        if (it != this->delayParkedAgents.end())
+        {
+            this->delayParkedAgents.erase(it);
+        }
+        else
+        {
+            this->AddAgent(pAgent);
+        }
+    }
+
+    void Context::CompleteAsync(uint32_t token, EBTStatus status)
+    {
+        uint8_t* pData = ms_completions.Reserve(sizeof(uint32_t), token);
+
+        if (pData)
+        {
+            uint32_t value = (uint32_t)status;
+            memcpy(pData, &value, sizeof(value));
+
+            ms_completions.Commit(pData);
+        }
+        else
+        {
+            //the ring is full, it is only drained at the next update
+            Completion_t completion;
+            completion.token = token;
+            completion.status = (uint32_t)status;
+
+            ScopedLock lock(ms_asyncMutex);
+
+            if (!ms_overflowCompletions)
+            {
+                ms_overflowCompletions = BEHAVIAC_NEW behaviac::vector<Completion_t>;
+            }
+
+            ms_overflowCompletions->push_back(completion);
+        }
+    }
+
+    void Context::ResumeCompletedAgents()
+    {
+        behaviac::vector<Completion_t> completions;
+
+        uint32_t readIndex = ms_completions.GetReadIndex();
+
+        while (MPSCRing<kCompletionRingSize>::Record* pRecord = ms_completions.Read(readIndex))
+        {
+            Completion_t completion;
+            completion.token = pRecord->tag;
+            memcpy(&completion.status, pRecord->GetData(), sizeof(completion.status));
+
+            completions.push_back(completion);
+        }
+
+        ms_completions.Release(readIndex);
+
+        ScopedLock lock(ms_asyncMutex);
+
+        if (ms_overflowCompletions)
+        {
+            completions.insert(completions.end(), ms_overflowCompletions->begin(), ms_overflowCompletions->end());
+            ms_overflowCompletions->clear();
+        }
+
+        if (!ms_asyncAgents)
+        {
+            return;
+        }
+
+        for (size_t i = 0; i < completions.size(); ++i)
+        {
+            AsyncAgents_t::iterator it = ms_asyncAgents->find(completions[i].token);
+
+            //a work is only completed once
+            if (it != ms_asyncAgents->end() && it->second.status == BT_RUNNING)
+            {
+                it->second.status = (EBTStatus)completions[i].status;
+
+                //locked, the agent is not destroyed before it is queued, see Agent::destroy_
+                Agent* pAgent = it->second.agent;
+                Context::GetContext(pAgent->GetContextId()).queueResumedAgent_(pAgent);
+            }
+        }
+    }
+
+    void Context::queueResumedAgent_(Agent* pAgent)
+    {
+        ScopedLock lock(this->m_resumedMutex);
+
+        this->m_resumedAgents.push_back(pAgent);
+    }
+
+    void Context::removeResumedAgent_(Agent* pAgent)
+    {
+        ScopedLock lock(this->m_resumedMutex);
+
+        this->m_resumedAgents.erase(std::remove(this->m_resumedAgents.begin(), this->m_resumedAgents.end(), pAgent), this->m_resumedAgents.end());
+    }
+
+    void Context::unparkResumedAgents_()
+    {
+        vector<Agent*> agents;
+
+        {
+            ScopedLock lock(this->m_resumedMutex);
+
+            agents.swap(this->m_resumedAgents);
+        }
+
+        for (size_t i = 0; i < agents.size(); ++i)
+        {
+            this->UnparkAgent(agents[i]);
+        }
+    }
+
+    uint32_t Context::GetParkedAgentCount()
+    {
+        return (uint32_t)Load_Acquire(ms_parkedCount);
+    }
+
     void Context::LogCurrentState()
     {
         // char msg[256] = { 0 };
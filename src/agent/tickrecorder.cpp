@@ -0,0 +1,637 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Tencent is pleased to support the open source community by making behaviac available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except in compliance with
+// the License. You may obtain a copy of the License at http://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and limitations under the License.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "behaviac/agent/tickrecorder.h"
+#include "behaviac/agent/agent.h"
+#include "behaviac/agent/context.h"
+#include "behaviac/behaviortree/behaviortree.h"
+#include "behaviac/common/member.h"
+#include "behaviac/common/randomgenerator/randomgenerator.h"
+#include "behaviac/common/workspace.h"
+
+namespace behaviac
+{
+    static uint32_t AlignRecordSize(uint32_t size)
+    {
+        return (size + 3) & ~3u;
+    }
+
+    TickRecorder::TickRecorder(uint32_t bufferSize, uint32_t keyframeInterval) : m_bufferSize(AlignRecordSize(bufferSize)),
+        m_begin(0), m_end(0), m_wrap(0), m_bWrapped(false), m_count(0), m_keyframeInterval(keyframeInterval), m_frame(0), m_tickingAgent(0)
+    {
+        BEHAVIAC_ASSERT(bufferSize > sizeof(Record_t));
+        this->m_buffer = (uint8_t*)BEHAVIAC_MALLOC(this->m_bufferSize);
+
+        memset(&this->m_stats, 0, sizeof(this->m_stats));
+    }
+
+    TickRecorder::~TickRecorder()
+    {
+        BEHAVIAC_FREE(this->m_buffer);
+    }
+
+    void TickRecorder::evictOldest()
+    {
+        BEHAVIAC_ASSERT(this->m_count > 0);
+
+        const Record_t* pRecord = (const Record_t*)(this->m_buffer + this->m_begin);
+        this->m_begin += pRecord->size;
+        this->m_count--;
+        this->m_stats.overwritten++;
+
+        if (this->m_bWrapped && this->m_begin == this->m_wrap)
+        {
+            this->m_begin = 0;
+            this->m_bWrapped = false;
+        }
+    }
+
+    uint8_t* TickRecorder::reserve(uint8_t type, int32_t agentId, uint32_t payloadSize)
+    {
+        const uint32_t size = AlignRecordSize(sizeof(Record_t) + payloadSize);
+
+        if (size > this->m_bufferSize)
+        {
+            this->m_stats.dropped++;
+            return 0;
+        }
+
+        for (;;)
+        {
+            if (!this->m_bWrapped)
+            {
+                if (this->m_end + size <= this->m_bufferSize)
+                {
+                    break;
+                }
+
+                //the records in [m_begin, m_wrap) are left to be overwritten from the start of the buffer
+                this->m_wrap = this->m_end;
+                this->m_end = 0;
+                this->m_bWrapped = this->m_count > 0;
+
+                if (!this->m_bWrapped)
+                {
+                    this->m_begin = 0;
+                }
+            }
+            else
+            {
+                if (this->m_end + size <= this->m_begin)
+                {
+                    break;
+                }
+
+                this->evictOldest();
+            }
+        }
+
+        Record_t* pRecord = (Record_t*)(this->m_buffer + this->m_end);
+        pRecord->type = type;
+        pRecord->valueType = 0;
+        pRecord->count = 0;
+        pRecord->agentId = agentId;
+        pRecord->size = size;
+
+        this->m_end += size;
+        this->m_count++;
+
+        return (uint8_t*)(pRecord + 1);
+    }
+
+    const TickRecorder::Record_t* TickRecorder::next(const Record_t* pRecord) const
+    {
+        uint32_t offset = (uint32_t)((const uint8_t*)pRecord - this->m_buffer) + pRecord->size;
+
+        if (this->m_bWrapped && offset == this->m_wrap)
+        {
+            offset = 0;
+        }
+
+        if (offset == this->m_end)
+        {
+            return 0;
+        }
+
+        return (const Record_t*)(this->m_buffer + offset);
+    }
+
+    bool TickRecorder::SaveTrace(behaviac::vector<uint8_t>& trace) const
+    {
+        trace.clear();
+
+        if (this->m_count == 0)
+        {
+            return false;
+        }
+
+        const Record_t* pFirst = (const Record_t*)(this->m_buffer + this->m_begin);
+
+        //the replay starts from a keyframe
+        while (pFirst != 0)
+        {
+            if (pFirst->type == TRT_Frame && ((const Frame_t*)(pFirst + 1))->bKeyframe)
+            {
+                break;
+            }
+
+            pFirst = this->next(pFirst);
+        }
+
+        if (pFirst == 0)
+        {
+            return false;
+        }
+
+        TraceHeader header;
+        header.magic = TraceHeader::kMagic;
+        header.version = TraceHeader::kVersion;
+        header.size = sizeof(TraceHeader);
+        header.frameCount = 0;
+
+        for (const Record_t* pRecord = pFirst; pRecord != 0; pRecord = this->next(pRecord))
+        {
+            header.size += pRecord->size;
+
+            if (pRecord->type == TRT_Frame)
+            {
+                header.frameCount++;
+            }
+        }
+
+        trace.resize(header.size);
+        memcpy(&trace[0], &header, sizeof(header));
+        uint32_t offset = sizeof(header);
+
+        for (const Record_t* pRecord = pFirst; pRecord != 0; pRecord = this->next(pRecord))
+        {
+            memcpy(&trace[offset], pRecord, pRecord->size);
+            offset += pRecord->size;
+        }
+
+        return true;
+    }
+
+    void TickRecorder::BeginFrame(Context& context)
+    {
+        const bool bKeyframe = this->m_keyframeInterval > 0 && this->m_frame % this->m_keyframeInterval == 0;
+
+        Frame_t* pFrame = (Frame_t*)this->reserve(TRT_Frame, -1, sizeof(Frame_t));
+
+        if (pFrame != 0)
+        {
+            pFrame->frame = this->m_frame;
+            pFrame->seed = context.GetRandomGenerator()->getSeed();
+            pFrame->bKeyframe = bKeyframe ? 1 : 0;
+
+            Workspace* pWorkspace = Workspace::GetInstance();
+            const double timeSinceStartup = pWorkspace->m_timeSinceStartup >= 0 ? pWorkspace->GetTimeSinceStartup() : -1.0;
+
+            pFrame->frameSinceStartup = pWorkspace->m_frameSinceStartup >= 0 ? pWorkspace->GetFrameSinceStartup() : -1;
+            memcpy(pFrame->timeSinceStartup, &timeSinceStartup, sizeof(timeSinceStartup));
+        }
+
+        this->m_frame++;
+        this->m_stats.frames++;
+
+        if (bKeyframe)
+        {
+            this->recordKeyframe(context);
+        }
+    }
+
+    void TickRecorder::recordKeyframe(Context& context)
+    {
+        this->m_stats.keyframes++;
+
+        for (vector<Context::HeapItem_t>::iterator it = context.m_agents.begin(); it != context.m_agents.end(); ++it)
+        {
+            for (Context::Agents_t::iterator ita = it->agents.begin(); ita != it->agents.end(); ++ita)
+            {
+                Agent* pAgent = ita->second;
+
+                //the type name is followed by the snapshot
+                const char* agentType = pAgent->GetObjectTypeName();
+                const uint32_t typeLength = (uint32_t)strlen(agentType);
+                const uint32_t typeSize = AlignRecordSize(typeLength + 1);
+                const uint32_t snapshotSize = pAgent->btsnapshotsize();
+
+                uint8_t* pData = this->reserve(TRT_Snapshot, pAgent->GetId(), typeSize + snapshotSize);
+
+                if (pData != 0)
+                {
+                    Record_t* pRecord = (Record_t*)pData - 1;
+                    pRecord->count = (uint16_t)typeSize;
+
+                    memset(pData, 0, typeSize);
+                    memcpy(pData, agentType, typeLength);
+                    pAgent->btsavesnapshot(pData + typeSize, snapshotSize);
+                }
+            }
+        }
+    }
+
+    void TickRecorder::BeginTick(Agent* pAgent)
+    {
+        //the ticks of the other agents in the tick are done again by the replay
+        if (this->m_tickingAgent == 0)
+        {
+            this->m_tickingAgent = pAgent;
+            this->reserve(TRT_Tick, pAgent->GetId(), 0);
+        }
+    }
+
+    void TickRecorder::EndTick(Agent* pAgent)
+    {
+        if (this->m_tickingAgent == pAgent)
+        {
+            this->m_tickingAgent = 0;
+        }
+    }
+
+    void TickRecorder::RecordWrite(Agent* pAgent, uint32_t variableId, const TraceValue_t& value)
+    {
+        if (this->m_tickingAgent == 0)
+        {
+            uint8_t* pData = this->reserve(TRT_Write, pAgent->GetId(), sizeof(uint32_t) + sizeof(TraceValue_t));
+
+            if (pData != 0)
+            {
+                memcpy(pData, &variableId, sizeof(uint32_t));
+                memcpy(pData + sizeof(uint32_t), &value, sizeof(TraceValue_t));
+            }
+        }
+    }
+
+    void TickRecorder::RecordEvent(Agent* pAgent, const char* eventName, int paramCount, const TraceValue_t* params)
+    {
+        if (this->m_tickingAgent == 0)
+        {
+            const uint32_t paramsSize = paramCount * sizeof(TraceValue_t);
+            const uint32_t nameLength = (uint32_t)strlen(eventName);
+
+            uint8_t* pData = this->reserve(TRT_Event, pAgent->GetId(), paramsSize + nameLength + 1);
+
+            if (pData != 0)
+            {
+                Record_t* pRecord = (Record_t*)pData - 1;
+                pRecord->count = (uint16_t)paramCount;
+
+                if (paramCount > 0)
+                {
+                    memcpy(pData, params, paramsSize);
+                }
+
+                memcpy(pData + paramsSize, eventName, nameLength + 1);
+            }
+        }
+    }
+
+    TickReplay::TickReplay() : m_trace(0), m_size(0), m_offset(0), m_frameCount(0), m_replayedCount(0), m_divergedCount(0), m_skippedCount(0),
+        m_contextId(0), m_creator(0), m_pUserData(0)
+    {
+    }
+
+    TickReplay::~TickReplay()
+    {
+    }
+
+    bool TickReplay::Open(const void* trace, uint32_t size, int contextId, AgentCreator_t creator, void* pUserData)
+    {
+        const TraceHeader* pHeader = (const TraceHeader*)trace;
+
+        if (size < sizeof(TraceHeader) || pHeader->magic != TraceHeader::kMagic || pHeader->version != TraceHeader::kVersion || pHeader->size > size)
+        {
+            return false;
+        }
+
+        this->m_trace = (const uint8_t*)trace;
+        this->m_size = pHeader->size;
+        this->m_offset = sizeof(TraceHeader);
+        this->m_frameCount = 0;
+        this->m_replayedCount = 0;
+        this->m_divergedCount = 0;
+        this->m_skippedCount = 0;
+        this->m_contextId = contextId;
+        this->m_creator = creator;
+        this->m_pUserData = pUserData;
+        this->m_agents.clear();
+
+        //check all the records before any is replayed
+        for (uint32_t offset = this->m_offset; offset < this->m_size;)
+        {
+            const TickRecorder::Record_t* pRecord = (const TickRecorder::Record_t*)(this->m_trace + offset);
+
+            if (this->m_size - offset < sizeof(TickRecorder::Record_t) || pRecord->size < sizeof(TickRecorder::Record_t) ||
+                pRecord->size > this->m_size - offset || (pRecord->size & 3) != 0)
+            {
+                return false;
+            }
+
+            if (pRecord->type == TickRecorder::TRT_Frame)
+            {
+                this->m_frameCount++;
+            }
+            else if (offset == this->m_offset)
+            {
+                return false;
+            }
+
+            offset += pRecord->size;
+        }
+
+        if (this->m_frameCount == 0)
+        {
+            return false;
+        }
+
+        //the agents of the first keyframe
+        const TickRecorder::Record_t* pFirst = (const TickRecorder::Record_t*)(this->m_trace + this->m_offset);
+
+        for (uint32_t offset = this->m_offset + pFirst->size; offset < this->m_size;)
+        {
+            const TickRecorder::Record_t* pRecord = (const TickRecorder::Record_t*)(this->m_trace + offset);
+
+            if (pRecord->type != TickRecorder::TRT_Snapshot)
+            {
+                break;
+            }
+
+            this->restore(pRecord, false);
+            offset += pRecord->size;
+        }
+
+        return true;
+    }
+
+    bool TickReplay::restore(const TickRecorder::Record_t* pRecord, bool bCreateOnly)
+    {
+        Agents_t::iterator it = this->m_agents.find(pRecord->agentId);
+
+        if (it != this->m_agents.end() && bCreateOnly)
+        {
+            return true;
+        }
+
+        const uint8_t* pData = (const uint8_t*)(pRecord + 1);
+        const uint32_t dataSize = pRecord->size - sizeof(TickRecorder::Record_t);
+
+        if (pRecord->count > dataSize)
+        {
+            this->m_skippedCount++;
+            return false;
+        }
+
+        Agent* pAgent = it != this->m_agents.end() ? it->second : 0;
+
+        if (pAgent == 0)
+        {
+            pAgent = this->m_creator ? this->m_creator((const char*)pData, this->m_contextId, this->m_pUserData) : 0;
+
+            if (pAgent == 0)
+            {
+                this->m_skippedCount++;
+                return false;
+            }
+
+            this->m_agents[pRecord->agentId] = pAgent;
+        }
+
+        if (!pAgent->btloadsnapshot(pData + pRecord->count, dataSize - pRecord->count))
+        {
+            this->m_skippedCount++;
+            return false;
+        }
+
+        return true;
+    }
+
+    Agent* TickReplay::GetAgent(int recordedId) const
+    {
+        Agents_t::const_iterator it = this->m_agents.find(recordedId);
+
+        return it != this->m_agents.end() ? it->second : 0;
+    }
+
+    void TickReplay::GetAgents(behaviac::vector<Agent*>& agents) const
+    {
+        for (Agents_t::const_iterator it = this->m_agents.begin(); it != this->m_agents.end(); ++it)
+        {
+            agents.push_back(it->second);
+        }
+    }
+
+    bool TickReplay::ReplayFrame()
+    {
+        if (this->m_trace == 0 || this->m_offset >= this->m_size)
+        {
+            return false;
+        }
+
+        const TickRecorder::Record_t* pRecord = (const TickRecorder::Record_t*)(this->m_trace + this->m_offset);
+        BEHAVIAC_ASSERT(pRecord->type == TickRecorder::TRT_Frame);
+        const TickRecorder::Frame_t* pFrame = (const TickRecorder::Frame_t*)(pRecord + 1);
+
+        RandomGenerator* pRandomGenerator = Context::GetContext(this->m_contextId).GetRandomGenerator();
+
+        if (this->m_replayedCount > 0 && pRandomGenerator->getSeed() != pFrame->seed)
+        {
+            this->m_divergedCount++;
+        }
+
+        pRandomGenerator->setSeed(pFrame->seed);
+
+        //the ticks may wait for the time or the frames
+        double timeSinceStartup = -1.0;
+        memcpy(&timeSinceStartup, pFrame->timeSinceStartup, sizeof(timeSinceStartup));
+
+        if (timeSinceStartup >= 0)
+        {
+            Workspace::GetInstance()->SetTimeSinceStartup(timeSinceStartup);
+        }
+
+        if (pFrame->frameSinceStartup >= 0)
+        {
+            Workspace::GetInstance()->SetFrameSinceStartup(pFrame->frameSinceStartup);
+        }
+
+        this->m_offset += pRecord->size;
+
+        while (this->m_offset < this->m_size)
+        {
+            pRecord = (const TickRecorder::Record_t*)(this->m_trace + this->m_offset);
+
+            if (pRecord->type == TickRecorder::TRT_Frame)
+            {
+                break;
+            }
+
+            this->m_offset += pRecord->size;
+
+            const uint8_t* pData = (const uint8_t*)(pRecord + 1);
+            const uint32_t dataSize = pRecord->size - sizeof(TickRecorder::Record_t);
+
+            if (pRecord->type == TickRecorder::TRT_Snapshot)
+            {
+                //the agents already replayed are not restored so that their divergence is kept
+                this->restore(pRecord, true);
+                continue;
+            }
+
+            Agent* pAgent = this->GetAgent(pRecord->agentId);
+
+            if (pAgent == 0)
+            {
+                this->m_skippedCount++;
+                continue;
+            }
+
+            switch (pRecord->type)
+            {
+                case TickRecorder::TRT_Tick:
+                    pAgent->btexec();
+                    break;
+
+                case TickRecorder::TRT_Write:
+                    if (dataSize >= sizeof(uint32_t) + sizeof(TraceValue_t))
+                    {
+                        uint32_t variableId = 0;
+                        TraceValue_t value;
+                        memcpy(&variableId, pData, sizeof(uint32_t));
+                        memcpy(&value, pData + sizeof(uint32_t), sizeof(TraceValue_t));
+
+                        this->write(pAgent, variableId, value);
+                    }
+                    else
+                    {
+                        this->m_skippedCount++;
+                    }
+
+                    break;
+
+                case TickRecorder::TRT_Event:
+                    if (pRecord->count <= 3 && dataSize > pRecord->count * sizeof(TraceValue_t))
+                    {
+                        TraceValue_t params[3];
+                        memcpy(params, pData, pRecord->count * sizeof(TraceValue_t));
+
+                        this->fire(pAgent, (const char*)pData + pRecord->count * sizeof(TraceValue_t), pRecord->count, params);
+                    }
+                    else
+                    {
+                        this->m_skippedCount++;
+                    }
+
+                    break;
+
+                default:
+                    this->m_skippedCount++;
+                    break;
+            }
+        }
+
+        this->m_replayedCount++;
+
+        return true;
+    }
+
+    template<typename T>
+    static void WriteTraceValue(Agent* pAgent, uint32_t variableId, const TraceValue_t& value)
+    {
+        T v;
+        memcpy(&v, value.bytes, sizeof(T));
+
+        pAgent->SetVariable("", variableId, v);
+    }
+
+    void TickReplay::write(Agent* pAgent, uint32_t variableId, const TraceValue_t& value)
+    {
+        switch (value.type)
+        {
+            case TVT_Bool:		WriteTraceValue<bool>(pAgent, variableId, value); break;
+            case TVT_Char:		WriteTraceValue<char>(pAgent, variableId, value); break;
+            case TVT_UChar:		WriteTraceValue<unsigned char>(pAgent, variableId, value); break;
+            case TVT_Short:		WriteTraceValue<short>(pAgent, variableId, value); break;
+            case TVT_UShort:	WriteTraceValue<unsigned short>(pAgent, variableId, value); break;
+            case TVT_Int:		WriteTraceValue<int>(pAgent, variableId, value); break;
+            case TVT_UInt:		WriteTraceValue<unsigned int>(pAgent, variableId, value); break;
+            case TVT_Long:		WriteTraceValue<long>(pAgent, variableId, value); break;
+            case TVT_ULong:		WriteTraceValue<unsigned long>(pAgent, variableId, value); break;
+            case TVT_LongLong:	WriteTraceValue<long long>(pAgent, variableId, value); break;
+            case TVT_ULongLong:	WriteTraceValue<unsigned long long>(pAgent, variableId, value); break;
+            case TVT_Float:		WriteTraceValue<float>(pAgent, variableId, value); break;
+            case TVT_Double:	WriteTraceValue<double>(pAgent, variableId, value); break;
+
+            default:
+                this->m_skippedCount++;
+                break;
+        }
+    }
+
+    //the names of the event params, see Agent::FireEvent
+    static const char* const kEventParamNames[] =
+    {
+        BEHAVIAC_LOCAL_TASK_PARAM_PRE "0",
+        BEHAVIAC_LOCAL_TASK_PARAM_PRE "1",
+        BEHAVIAC_LOCAL_TASK_PARAM_PRE "2"
+    };
+
+    template<typename T>
+    static IInstantiatedVariable* CreateTraceParam(int index, const TraceValue_t& value)
+    {
+        T v;
+        memcpy(&v, value.bytes, sizeof(T));
+
+        return BEHAVIAC_NEW CVariable<T>(kEventParamNames[index], v);
+    }
+
+    void TickReplay::fire(Agent* pAgent, const char* eventName, int paramCount, const TraceValue_t* params)
+    {
+        behaviac::map<uint32_t, IInstantiatedVariable*> eventParams;
+
+        for (int i = 0; i < paramCount; ++i)
+        {
+            IInstantiatedVariable* pParam = 0;
+
+            switch (params[i].type)
+            {
+                case TVT_Bool:		pParam = CreateTraceParam<bool>(i, params[i]); break;
+                case TVT_Char:		pParam = CreateTraceParam<char>(i, params[i]); break;
+                case TVT_UChar:		pParam = CreateTraceParam<unsigned char>(i, params[i]); break;
+                case TVT_Short:		pParam = CreateTraceParam<short>(i, params[i]); break;
+                case TVT_UShort:	pParam = CreateTraceParam<unsigned short>(i, params[i]); break;
+                case TVT_Int:		pParam = CreateTraceParam<int>(i, params[i]); break;
+                case TVT_UInt:		pParam = CreateTraceParam<unsigned int>(i, params[i]); break;
+                case TVT_Long:		pParam = CreateTraceParam<long>(i, params[i]); break;
+                case TVT_ULong:		pParam = CreateTraceParam<unsigned long>(i, params[i]); break;
+                case TVT_LongLong:	pParam = CreateTraceParam<long long>(i, params[i]); break;
+                case TVT_ULongLong:	pParam = CreateTraceParam<unsigned long long>(i, params[i]); break;
+                case TVT_Float:		pParam = CreateTraceParam<float>(i, params[i]); break;
+                case TVT_Double:	pParam = CreateTraceParam<double>(i, params[i]); break;
+
+                default:
+                    break;
+            }
+
+            if (pParam == 0)
+            {
+                this->m_skippedCount++;
+                continue;
+            }
+
+            eventParams[MakeVariableId(kEventParamNames[i])] = pParam;
+        }
+
+        pAgent->btonevent(eventName, paramCount > 0 ? &eventParams : NULL);
+    }
+}
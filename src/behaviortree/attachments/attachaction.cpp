@@ -28,9 +28,9 @@ namespace behaviac
     }
 
     AttachAction::ActionConfig::~ActionConfig() {
-        BEHAVIAC_DELETE(m_opl);
-        BEHAVIAC_DELETE(m_opr1);
-        BEHAVIAC_DELETE(m_opr2);
+        AgentMeta::ReleaseSharedProperty(m_opl);
+        AgentMeta::ReleaseSharedProperty(m_opr1);
+        AgentMeta::ReleaseSharedProperty(m_opr2);
     }
 
     bool AttachAction::ActionConfig::load(const properties_t& properties)
@@ -50,7 +50,7 @@ namespace behaviac
 
                     if (pParenthesis == 0)
                     {
-                        this->m_opl = AgentMeta::ParseProperty(p.value);
+                        this->m_opl = AgentMeta::ParseSharedProperty(p.value);
                     }
                     else
                     {
@@ -65,7 +65,7 @@ namespace behaviac
                     const char* pParenthesis = StringUtils::StringFind(p.value, '(');
                     if (pParenthesis == 0)
                     {
-                        this->m_opr1 = AgentMeta::ParseProperty(p.value);
+                        this->m_opr1 = AgentMeta::ParseSharedProperty(p.value);
                     }
                     else
                     {
@@ -87,7 +87,7 @@ namespace behaviac
                     const char* pParenthesis = StringUtils::StringFind(p.value, '(');
                     if (pParenthesis == 0)
                     {
-                        this->m_opr2 = AgentMeta::ParseProperty(p.value);
+                        this->m_opr2 = AgentMeta::ParseSharedProperty(p.value);
                     }
                     else
                     {
@@ -20,7 +20,9 @@
 #include "behaviac/behaviortree/attachments/precondition.h"
 #include "behaviac/behaviortree/attachments/effector.h"
 #include "behaviac/fsm/state.h"
+#include "behaviac/behaviortree/nodes/composites/referencebehavior.h"
 #include "behaviac/common/meta.h"
+#include "behaviac/common/crc.h"
 
 namespace behaviac
 {
@@ -121,10 +123,10 @@ namespace behaviac
         return pBehaviorNode;
     }
 
-    BehaviorNode::BehaviorNode() : m_id(INVALID_NODE_ID),
+    BehaviorNode::BehaviorNode() : m_id(INVALID_NODE_ID), m_signature(0),
 		m_enter_precond(0), m_update_precond(0), m_both_precond(0), 
 		m_success_effectors(0), m_failure_effectors(0), m_both_effectors(0),
-        m_parent(0), m_children(0), m_customCondition(0),
+        m_attachmentProgram(0), m_parent(0), m_children(0), m_customCondition(0),
         m_bHasEvents(false), m_loadAttachment(false)
     {
     }
@@ -155,6 +157,22 @@ namespace behaviac
             BEHAVIAC_DELETE this->m_customCondition;
             this->m_customCondition = 0;
         }
+
+        DeleteAttachments(this->m_preconditions);
+        DeleteAttachments(this->m_effectors);
+        DeleteAttachments(this->m_events);
+
+        this->m_enter_precond = 0;
+        this->m_update_precond = 0;
+        this->m_both_precond = 0;
+        this->m_success_effectors = 0;
+        this->m_failure_effectors = 0;
+        this->m_both_effectors = 0;
+
+        BEHAVIAC_DELETE(this->m_attachmentProgram);
+        this->m_attachmentProgram = 0;
+
+        this->m_signature = 0;
     }
 
     BehaviorTask* BehaviorNode::CreateAndInitTask() const
@@ -166,50 +184,73 @@ namespace behaviac
 
         return pTask;
     }
-    bool BehaviorNode::CheckPreconditions(const Agent* pAgent, bool bIsAlive) const
+    struct BehaviorNode::AttachmentProgram
     {
-        Precondition::EPhase phase = bIsAlive ? Precondition::E_UPDATE : Precondition::E_ENTER;
-
-        //satisfied if there is no preconditions
-        if (this->m_preconditions.size() == 0)
+        struct Precondition_t
         {
-            return true;
-        }
+            Precondition*	precondition;
+            bool			bAnd;
+        };
 
-        if (this->m_both_precond == 0)
+        typedef behaviac::vector<Precondition_t> Preconditions_t;
+        typedef behaviac::vector<Effector*> Effectors_t;
+
+        //a precondition of E_BOTH is in both, an effector of E_BOTH is in both
+        Preconditions_t	enter;
+        Preconditions_t	update;
+
+        Effectors_t		success;
+        Effectors_t		failure;
+
+        BEHAVIAC_DECLARE_MEMORY_OPERATORS(AttachmentProgram);
+
+        //combined from the left as the preconditions are listed, a precondition is not evaluated
+        //if it can't change the result, i.e. an 'and' after a false or an 'or' after a true
+        static bool Evaluate(const Preconditions_t& preconditions, Agent* pAgent)
         {
-            if (phase == Precondition::E_ENTER && this->m_enter_precond == 0)
+            const uint32_t count = (uint32_t)preconditions.size();
+
+            if (count == 0)
             {
                 return true;
             }
 
-            if (phase == Precondition::E_UPDATE && this->m_update_precond == 0)
+            const Precondition_t* steps = &preconditions[0];
+            bool bResult = steps[0].precondition->Evaluate(pAgent);
+
+            for (uint32_t i = 1; i < count; ++i)
             {
-                return true;
+                if (steps[i].bAnd == bResult)
+                {
+                    bResult = steps[i].precondition->Evaluate(pAgent);
+                }
             }
-        }
 
-        bool firstValidPrecond = true;
-        bool lastCombineValue = false;
+            return bResult;
+        }
 
-        for (uint32_t i = 0; i < this->m_preconditions.size(); ++i)
+        static void Apply(const Effectors_t& effectors, Agent* pAgent)
         {
-            Precondition* pPrecond = (Precondition*)this->m_preconditions[i];
+            const uint32_t count = (uint32_t)effectors.size();
 
-            if (pPrecond != NULL)
+            for (uint32_t i = 0; i < count; ++i)
             {
-                Precondition::EPhase ph = pPrecond->GetPhase();
-
-				if (phase == Precondition::E_BOTH || ph == Precondition::E_BOTH || ph == phase)
-                {
-                    bool taskBoolean = pPrecond->Evaluate((Agent*)pAgent);
-
-                    CombineResults(firstValidPrecond, lastCombineValue, pPrecond, taskBoolean);
-                }
+                effectors[i]->Evaluate(pAgent);
             }
         }
+    };
 
-        return lastCombineValue;
+    bool BehaviorNode::CheckPreconditions(const Agent* pAgent, bool bIsAlive) const
+    {
+        //satisfied if there is no preconditions
+        if (this->m_attachmentProgram == 0)
+        {
+            return true;
+        }
+
+        const AttachmentProgram::Preconditions_t& preconditions = bIsAlive ? this->m_attachmentProgram->update : this->m_attachmentProgram->enter;
+
+        return AttachmentProgram::Evaluate(preconditions, (Agent*)pAgent);
     }
 
     void BehaviorNode::CombineResults(bool& firstValidPrecond, bool& lastCombineValue, Precondition* pPrecond, bool taskBoolean)
@@ -235,45 +276,142 @@ namespace behaviac
             }
         }
     }
+
     void BehaviorNode::ApplyEffects(Agent* pAgent, BehaviorNode::EPhase  phase) const
     {
-        if (this->m_effectors.size() == 0)
+        if (this->m_attachmentProgram == 0)
         {
             return;
         }
 
-        if (this->m_both_effectors == 0)
+        if (phase == E_SUCCESS)
         {
-            if (phase == Effector::E_SUCCESS && this->m_success_effectors == 0)
+            AttachmentProgram::Apply(this->m_attachmentProgram->success, pAgent);
+        }
+        else if (phase == E_FAILURE)
+        {
+            AttachmentProgram::Apply(this->m_attachmentProgram->failure, pAgent);
+        }
+        else
+        {
+            for (uint32_t i = 0; i < this->m_effectors.size(); ++i)
             {
-                return;
+                ((Effector*)this->m_effectors[i])->Evaluate(pAgent);
             }
+        }
+    }
+
+    bool BehaviorNode::IsManagingChildrenAsSubTrees() const
+    {
+        return false;
+    }
+
+    bool BehaviorNode::GetInputIds(behaviac::vector<uint32_t>& inputIds) const
+    {
+        BEHAVIAC_UNUSED_VAR(inputIds);
+
+        return false;
+    }
 
-            if (phase == Effector::E_FAILURE && this->m_failure_effectors == 0)
+    bool BehaviorNode::HasAttachments() const
+    {
+        return this->m_preconditions.size() > 0 || this->m_effectors.size() > 0 || this->m_events.size() > 0 || this->m_customCondition != NULL;
+    }
+
+    void BehaviorNode::CombineSignature(uint32_t value)
+    {
+        //FNV-1 style, the order of the values matters
+        this->m_signature = (this->m_signature * 16777619u) ^ value;
+    }
+
+    void BehaviorNode::CombineAttachmentSignature(const BehaviorNode* pAttachment, bool bIsPrecondition, bool bIsEffector, bool bIsTransition)
+    {
+        uint32_t flags = (bIsPrecondition ? 1 : 0) | (bIsEffector ? 2 : 0) | (bIsTransition ? 4 : 0);
+
+        this->CombineSignature(CRC32::CalcCRC(pAttachment->m_className.c_str()));
+        this->CombineSignature((uint16_t)pAttachment->m_id);
+        this->CombineSignature(flags);
+        this->CombineSignature(pAttachment->m_signature);
+    }
+
+    static bool IsSameSubtree(const BehaviorNode* a, const BehaviorNode* b)
+    {
+        if (!a->HasSameContent(b))
+        {
+            return false;
+        }
+
+        for (uint32_t i = 0; i < a->GetChildrenCount(); ++i)
+        {
+            if (!IsSameSubtree(a->GetChild(i), b->GetChild(i)))
             {
-                return;
+                return false;
             }
         }
 
-        for (uint32_t i = 0; i < this->m_effectors.size(); ++i)
+        return true;
+    }
+
+    bool BehaviorNode::HasSameContent(const BehaviorNode* node) const
+    {
+        BEHAVIAC_ASSERT(node);
+
+        if (this->m_id != node->m_id || this->m_signature != node->m_signature ||
+            this->GetChildrenCount() != node->GetChildrenCount() || this->m_className != node->m_className)
         {
-            Effector* pEffector = (Effector*)this->m_effectors[i];
+            return false;
+        }
 
-            if (pEffector != NULL)
+        if (this->m_customCondition != 0 || node->m_customCondition != 0)
+        {
+            if (this->m_customCondition == 0 || node->m_customCondition == 0)
             {
-                Effector::EPhase ph = pEffector->GetPhase();
-
-                if (phase == Effector::E_BOTH || ph == Effector::E_BOTH || ph == phase)
-                {
-                    pEffector->Evaluate((Agent*)pAgent);
-                }
+                return false;
             }
+
+            return IsSameSubtree(this->m_customCondition, node->m_customCondition);
         }
+
+        return true;
     }
 
-    bool BehaviorNode::IsManagingChildrenAsSubTrees() const
+    void BehaviorNode::BuildTickInfoDescriptors(const behaviac::string& treeName)
     {
-        return false;
+#if !BEHAVIAC_RELEASE
+        this->m_tickInfoDescriptor = CStringAtom();
+
+        //filter out intermediate bt, whose class name is empty
+        if (!this->m_className.empty())
+        {
+            char temp[32];
+            string_sprintf(temp, "[%i]", (int)this->m_id);
+
+            //TestBehaviorGroup\scratch.xml->EventetTask[0]
+            behaviac::string descriptor;
+
+            if (!treeName.empty())
+            {
+                descriptor = treeName;
+                descriptor += ".xml->";
+            }
+
+            descriptor += this->m_className.c_str();
+            descriptor += temp;
+
+            this->m_tickInfoDescriptor = CStringAtom(descriptor.c_str());
+        }
+
+        //the tree name of the nodes under a referenced tree depends on the agent
+        if (this->m_children && ReferencedBehavior::DynamicCast(this) == 0)
+        {
+            for (size_t i = 0; i < this->m_children->size(); ++i)
+            {
+                (*this->m_children)[i]->BuildTickInfoDescriptors(treeName);
+            }
+        }
+#else
+        BEHAVIAC_UNUSED_VAR(treeName);
+#endif//#if !BEHAVIAC_RELEASE
     }
 
     void BehaviorNode::Attach(BehaviorNode* pAttachment, bool bIsPrecondition, bool bIsEffector, bool bIsTransition)
@@ -310,6 +448,23 @@ namespace behaviac
             {
                 BEHAVIAC_ASSERT(false);
             }
+
+            if (this->m_attachmentProgram == 0)
+            {
+                this->m_attachmentProgram = BEHAVIAC_NEW AttachmentProgram();
+            }
+
+            AttachmentProgram::Precondition_t step = { predicate, predicate->IsAnd() };
+
+            if (phase != Precondition::E_UPDATE)
+            {
+                this->m_attachmentProgram->enter.push_back(step);
+            }
+
+            if (phase != Precondition::E_ENTER)
+            {
+                this->m_attachmentProgram->update.push_back(step);
+            }
         }
         else if (bIsEffector)
         {
@@ -340,6 +495,21 @@ namespace behaviac
             {
                 BEHAVIAC_ASSERT(false);
             }
+
+            if (this->m_attachmentProgram == 0)
+            {
+                this->m_attachmentProgram = BEHAVIAC_NEW AttachmentProgram();
+            }
+
+            if (phase != Effector::E_FAILURE)
+            {
+                this->m_attachmentProgram->success.push_back(effector);
+            }
+
+            if (phase != Effector::E_SUCCESS)
+            {
+                this->m_attachmentProgram->failure.push_back(effector);
+            }
         }
         else
         {
@@ -430,10 +600,10 @@ namespace behaviac
 
     void BehaviorNode::SetClassNameString(const char* className)
     {
-        this->m_className = className;
+        this->m_className = CStringAtom(className);
     }
 
-    const behaviac::string& BehaviorNode::GetClassNameString() const
+    CStringAtom BehaviorNode::GetClassNameString() const
     {
         return this->m_className;
     }
@@ -454,7 +624,7 @@ namespace behaviac
     {
         BEHAVIAC_UNUSED_VAR(agentType);
 #if !BEHAVIAC_RELEASE
-        this->m_agentType = agentType;
+        this->m_agentType = CStringAtom(agentType.c_str());
 #endif
     }
 
@@ -513,6 +683,12 @@ namespace behaviac
         BEHAVIAC_UNUSED_VAR(agentType);
         BEHAVIAC_UNUSED_VAR(properties);
 
+        for (propertie_const_iterator_t it = properties.begin(); it != properties.end(); ++it)
+        {
+            this->CombineSignature(CRC32::CalcCRC(it->name));
+            this->CombineSignature(CRC32::CalcCRC(it->value));
+        }
+
         {
             const char* nodeType = this->GetObjectTypeName();
             Workspace::GetInstance()->BehaviorNodeLoaded(nodeType, properties);
@@ -522,7 +698,7 @@ namespace behaviac
     void BehaviorNode::load_properties(int version, const char* agentType, rapidxml::xml_node<>* node)
     {
 #if !BEHAVIAC_RELEASE
-        this->m_agentType = agentType;
+        this->m_agentType = CStringAtom(agentType);
 #endif//
 
         properties_t properties;
@@ -636,10 +812,17 @@ namespace behaviac
     BehaviorTree::BehaviorTree() : BehaviorNode()
     {
         this->m_bIsFSM = false;
+
+        this->m_taskRefs = BEHAVIAC_NEW TaskRefs_t;
+        this->m_taskRefs->refs = 1;
     }
 
     BehaviorTree::~BehaviorTree()
     {
+        ReleaseTaskRefs(this->m_taskRefs);
+        this->m_taskRefs = 0;
+
+
         //this->m_descriptorRefs.clear();
         if (this->m_localProps.size() > 0)
         {
@@ -647,6 +830,21 @@ namespace behaviac
     }
     }
 
+    BehaviorTree::TaskRefs_t* BehaviorTree::AcquireTaskRefs(TaskRefs_t* taskRefs)
+    {
+        AtomicInc(taskRefs->refs);
+
+        return taskRefs;
+    }
+
+    void BehaviorTree::ReleaseTaskRefs(TaskRefs_t* taskRefs)
+    {
+        if (taskRefs && AtomicDec(taskRefs->refs) == 0)
+        {
+            BEHAVIAC_DELETE taskRefs;
+        }
+    }
+
     //
     void BehaviorTree::load(int version, const char* agentType, const properties_t& properties)
     {
@@ -881,6 +1079,7 @@ namespace behaviac
             pAttachment->load_properties_pars_attachments_children(false, version, agentType, c);
 
             this->Attach(pAttachment, bIsPrecondition, bIsEffector, bIsTransition);
+            this->CombineAttachmentSignature(pAttachment, bIsPrecondition, bIsEffector, bIsTransition);
 
             bHasEvents |= (Event::DynamicCast(pAttachment) != 0);
         }
@@ -970,7 +1169,7 @@ namespace behaviac
     void BehaviorNode::load_properties(int version, const char* agentType, BsonDeserizer& d)
     {
 #if !BEHAVIAC_RELEASE
-        this->m_agentType = agentType;
+        this->m_agentType = CStringAtom(agentType);
 #endif
         d.OpenDocument();
 
@@ -1138,6 +1337,7 @@ namespace behaviac
                         pAttachment->load_properties_pars_attachments_children(version, agentType, d, bAttachmentIsTransition);
 
                         this->Attach(pAttachment, bIsPrecondition, bIsEffector, bAttachmentIsTransition);
+                        this->CombineAttachmentSignature(pAttachment, bIsPrecondition, bIsEffector, bAttachmentIsTransition);
 
                         this->m_bHasEvents |= (Event::DynamicCast(pAttachment) != 0); //(pAttachment is Event);
                     }
@@ -119,15 +119,64 @@ namespace behaviac
 		return -1;
 	}
 
-    const behaviac::string& BehaviorTask::GetClassNameString() const
+    bool BehaviorTask::patch(const BehaviorNode* node, bool bApply)
+    {
+        //the tasks managing the children override it
+        if (!this->m_node->HasSameContent(node) || node->GetChildrenCount() > 0)
+        {
+            return false;
+        }
+
+        if (bApply)
+        {
+            this->m_node = node;
+        }
+
+        return true;
+    }
+
+    /**
+    return the task to be kept as the child, 'pChild' itself if it can be patched or a new one if it is recreated,
+    0 if it can't be patched as its node is changed while it is running
+    */
+    static BehaviorTask* patchChildTask(BranchTask* parent, BehaviorTask* pChild, const BehaviorNode* childNode, bool bApply)
+    {
+        if (pChild->patch(childNode, false))
+        {
+            if (bApply)
+            {
+                pChild->patch(childNode, true);
+            }
+
+            return pChild;
+        }
+
+        if (pChild->GetStatus() == BT_RUNNING)
+        {
+            return 0;
+        }
+
+        if (!bApply)
+        {
+            return pChild;
+        }
+
+        BehaviorTask* pNewChild = childNode->CreateAndInitTask();
+        pNewChild->SetParent(parent);
+
+        BehaviorTask::DestroyTask(pChild);
+
+        return pNewChild;
+    }
+
+    CStringAtom BehaviorTask::GetClassNameString() const
     {
         if (this->m_node)
         {
             return this->m_node->GetClassNameString();
         }
 
-        static behaviac::string s_subBT("SubBT");
-        return s_subBT;
+        return CStringAtom::FromIndex(StringTable::GetSubBTIndex());
     }
 
 	uint16_t BehaviorTask::GetId() const
@@ -302,9 +351,14 @@ namespace behaviac
         return BehaviorTask::GetTickInfo(pAgent, b->GetNode(), action);
     }
 
-	const behaviac::string GetParentTreeName(const Agent* pAgent, const BehaviorNode* n)
+    uint32_t BehaviorTask::GetTickInfo(const behaviac::Agent* pAgent, const behaviac::BehaviorTask* b, const char* action, char* buffer, uint32_t bufferSize)
+    {
+        return BehaviorTask::GetTickInfo(pAgent, b->GetNode(), action, buffer, bufferSize);
+    }
+
+	const char* GetParentTreeName(const Agent* pAgent, const BehaviorNode* n)
 	{
-		behaviac::string btName;
+		const char* btName = "";
 
 		if (ReferencedBehavior::DynamicCast(n))
 		{
@@ -330,12 +384,17 @@ namespace behaviac
 		if (bIsTree)
 		{
 			const BehaviorTree* bt = BehaviorTree::DynamicCast(n);
-			btName = bt->GetName();
+			btName = bt->GetName().c_str();
 		}
 		else if (bIsRefTree)
 		{
 			const ReferencedBehavior* refTree = ReferencedBehavior::DynamicCast(n);
 			btName = refTree->GetReferencedTree(pAgent);
+
+			if (btName == 0)
+			{
+				btName = "";
+			}
 		}
 		else
 		{
@@ -345,45 +404,82 @@ namespace behaviac
 		return btName;
 	}
 
+    //append 'str' at 'length', it is truncated to leave room for the terminating 0
+    static uint32_t appendTickInfo(char* buffer, uint32_t bufferSize, uint32_t length, const char* str)
+    {
+        while (*str != '\0' && length + 1 < bufferSize)
+        {
+            buffer[length++] = *str++;
+        }
+
+        buffer[length] = '\0';
+
+        return length;
+    }
+
     behaviac::string BehaviorTask::GetTickInfo(const behaviac::Agent* pAgent, const behaviac::BehaviorNode* n, const char* action)
     {
-        if (pAgent && pAgent->IsMasked())
+        char temp[1024];
+        uint32_t length = BehaviorTask::GetTickInfo(pAgent, n, action, temp, sizeof(temp));
+
+        if (length > 0)
         {
-			char temp[1024];
+            return behaviac::string(temp, length);
+        }
 
+        return behaviac::string();
+    }
+
+    uint32_t BehaviorTask::GetTickInfo(const behaviac::Agent* pAgent, const behaviac::BehaviorNode* n, const char* action, char* buffer, uint32_t bufferSize)
+    {
+        BEHAVIAC_ASSERT(buffer != 0 && bufferSize > 0);
+        uint32_t length = 0;
+        buffer[0] = '\0';
+
+        if (pAgent && pAgent->IsMasked())
+        {
             //BEHAVIAC_PROFILE("GetTickInfo", true);
 
-            const behaviac::string& bClassName = n->GetClassNameString();
+            CStringAtom descriptor = n->GetTickInfoDescriptor();
 
-            //filter out intermediate bt, whose class name is empty
-            if (!bClassName.empty())
+            if (!descriptor.empty())
             {
-				const behaviac::string& btName = GetParentTreeName(pAgent, n);
-
-                int nodeId = n->GetId();
-                //TestBehaviorGroup\scratch.xml->EventetTask[0]:enter
-                behaviac::string bpstr;
+                length = appendTickInfo(buffer, bufferSize, length, descriptor.c_str());
+            }
+            else
+            {
+                CStringAtom bClassName = n->GetClassNameString();
 
-				if (!StringUtils::IsNullOrEmpty(btName.c_str()))
+                //filter out intermediate bt, whose class name is empty
+                if (bClassName.empty())
                 {
-					string_sprintf(temp, "%s.xml->", btName.c_str());
-					bpstr = temp;
+                    return 0;
                 }
 
-				string_sprintf(temp, "%s[%i]", bClassName.c_str(), nodeId);
-				bpstr += temp;
+                //TestBehaviorGroup\scratch.xml->EventetTask[0]:enter
+                const char* btName = GetParentTreeName(pAgent, n);
 
-				if (!StringUtils::IsNullOrEmpty(action))
+                if (!StringUtils::IsNullOrEmpty(btName))
                 {
-					string_sprintf(temp, ":%s", action);
-					bpstr += temp;
+                    length = appendTickInfo(buffer, bufferSize, length, btName);
+                    length = appendTickInfo(buffer, bufferSize, length, ".xml->");
                 }
 
-                return bpstr;
+                char temp[32];
+                string_sprintf(temp, "[%i]", (int)n->GetId());
+
+                length = appendTickInfo(buffer, bufferSize, length, bClassName.c_str());
+                length = appendTickInfo(buffer, bufferSize, length, temp);
+            }
+
+            if (!StringUtils::IsNullOrEmpty(action))
+            {
+                length = appendTickInfo(buffer, bufferSize, length, ":");
+                length = appendTickInfo(buffer, bufferSize, length, action);
             }
         }
 
-        return behaviac::string();
+        return length;
     }
 
 #define _MY_BREAKPOINT_BREAK_(pAgent, btMsg, actionResult) \
@@ -394,29 +490,30 @@ namespace behaviac
     //CheckBreakpoint should be after log of onenter/onexit/update, as it needs to flush msg to the client
 	void CHECK_BREAKPOINT(Agent* pAgent, const BehaviorNode* b, const char* action, EActionResult actionResult)
 	{
-		if (Config::IsLoggingOrSocketing())
+		//the agents no client subscribes to are neither formatted nor checked for the breakpoints
+		if (Config::IsLogging() || behaviac::Socket::GetSubscribers(pAgent, MessageKind::MSGKIND_TICK | MessageKind::MSGKIND_BREAKPOINT) != 0)
 		{
-			behaviac::string bpstr = behaviac::BehaviorTask::GetTickInfo(pAgent, b, action);
-			if (!bpstr.empty())
+			char bpstr[1024];
+			if (behaviac::BehaviorTask::GetTickInfo(pAgent, b, action, bpstr, sizeof(bpstr)) > 0)
 			{
-				LogManager::GetInstance()->Log(pAgent, bpstr.c_str(), actionResult, ELM_tick);
+				LogManager::GetInstance()->Log(pAgent, bpstr, actionResult, ELM_tick);
 				if (Workspace::GetInstance()->CheckBreakpoint(pAgent, b, action, actionResult))
 				{
 					//log the current variables, otherwise, its value is not the latest
 					pAgent->LogVariables(false);
-					LogManager::GetInstance()->Log(pAgent, bpstr.c_str(), actionResult, ELM_breaked);
+					LogManager::GetInstance()->Log(pAgent, bpstr, actionResult, ELM_breaked);
 					LogManager::GetInstance()->Flush(pAgent);
 					behaviac::Socket::Flush();
 					BreakpointPromptHandler_fn fn = GetBreakpointPromptHandler();
 					if (fn == 0)
 					{
-						_MY_BREAKPOINT_BREAK_(pAgent, bpstr.c_str(), actionResult);
+						_MY_BREAKPOINT_BREAK_(pAgent, bpstr, actionResult);
 					}
 					else
 					{
-						fn(bpstr.c_str());
+						fn(bpstr);
 					}
-					LogManager::GetInstance()->Log(pAgent, bpstr.c_str(), actionResult, ELM_continue);
+					LogManager::GetInstance()->Log(pAgent, bpstr, actionResult, ELM_continue);
 					LogManager::GetInstance()->Flush(pAgent);
 					behaviac::Socket::Flush();
 				}
@@ -628,14 +725,14 @@ namespace behaviac
         {
 #if !BEHAVIAC_RELEASE
 
-            if (Config::IsLoggingOrSocketing())
+            if (Config::IsLogging() || behaviac::Socket::GetSubscribers(pAgent, MessageKind::MSGKIND_TICK) != 0)
             {
-                string btStr = BehaviorTask::GetTickInfo(pAgent, this, "update");
+                char btStr[1024];
 
                 //empty btStr is for internal BehaviorTreeTask
-                if (!StringUtils::IsNullOrEmpty(btStr.c_str()))
+                if (BehaviorTask::GetTickInfo(pAgent, this, "update", btStr, sizeof(btStr)) > 0)
                 {
-                    LogManager::GetInstance()->Log(pAgent, btStr.c_str(), EAR_none, ELM_tick);
+                    LogManager::GetInstance()->Log(pAgent, btStr, EAR_none, ELM_tick);
                 }
             }
 #endif
@@ -923,7 +1020,7 @@ namespace behaviac
         if (this->m_status != BT_INVALID)
         {
             CIOID  classId("class");
-            node->setAttr(classId, this->GetClassNameString());
+            node->setAttr(classId, behaviac::string(this->GetClassNameString().c_str()));
 
             CIOID  idId("id");
             node->setAttr(idId, this->GetId());
@@ -949,7 +1046,7 @@ namespace behaviac
         {
             CIOID  classId("class");
             node->getAttr(classId, attrStr);
-            BEHAVIAC_ASSERT(attrStr == this->GetClassNameString());
+            BEHAVIAC_ASSERT(attrStr == this->GetClassNameString().c_str());
 
             CIOID  idId("id");
             node->getAttr(idId, attrStr);
@@ -961,6 +1058,35 @@ namespace behaviac
 #endif
     }
 
+    void BehaviorTask::saveSnapshot(SnapshotWriter& writer) const
+    {
+        writer.Write(this->GetId());
+        writer.Write((uint8_t)this->m_status);
+    }
+
+    bool BehaviorTask::loadSnapshot(Agent* pAgent, SnapshotReader& reader)
+    {
+        BEHAVIAC_UNUSED_VAR(pAgent);
+
+        uint16_t id = 0;
+        uint8_t status = 0;
+        reader.Read(id);
+        reader.Read(status);
+
+        if (reader.IsFailed() || id != this->GetId() || status > BT_RUNNING)
+        {
+            reader.SetFailed();
+            return false;
+        }
+
+        if (reader.IsApplying())
+        {
+            this->m_status = (EBTStatus)status;
+        }
+
+        return true;
+    }
+
     void AttachmentTask::copyto(BehaviorTask* target) const
     {
         super::copyto(target);
@@ -1078,6 +1204,53 @@ namespace behaviac
         }
     }
 
+    void BranchTask::saveSnapshot(SnapshotWriter& writer) const
+    {
+        super::saveSnapshot(writer);
+
+        int32_t currentId = this->m_currentTask ? this->m_currentTask->GetId() : -1;
+        writer.Write(currentId);
+        writer.Write((int32_t)this->m_currentNodeId);
+    }
+
+    bool BranchTask::loadSnapshot(Agent* pAgent, SnapshotReader& reader)
+    {
+        if (!super::loadSnapshot(pAgent, reader))
+        {
+            return false;
+        }
+
+        int32_t currentId = -1;
+        int32_t currentNodeId = -1;
+        reader.Read(currentId);
+        reader.Read(currentNodeId);
+
+        BehaviorTask* pCurrentTask = 0;
+
+        if (currentId != -1)
+        {
+            pCurrentTask = (BehaviorTask*)this->GetTaskById(currentId);
+
+            if (!pCurrentTask)
+            {
+                reader.SetFailed();
+            }
+        }
+
+        if (reader.IsFailed())
+        {
+            return false;
+        }
+
+        if (reader.IsApplying())
+        {
+            this->m_currentTask = pCurrentTask;
+            this->m_currentNodeId = currentNodeId;
+        }
+
+        return true;
+    }
+
     EBTStatus BranchTask::execCurrentTask(Agent* pAgent, EBTStatus childStatus)
     {
         BEHAVIAC_ASSERT(this->m_currentTask != 0 && this->m_currentTask->GetStatus() == BT_RUNNING);
@@ -1282,6 +1455,81 @@ namespace behaviac
         this->m_children.clear();
     }
 
+    void CompositeTask::saveSnapshot(SnapshotWriter& writer) const
+    {
+        super::saveSnapshot(writer);
+
+        writer.Write((int32_t)this->m_activeChildIndex);
+        writer.Write((uint32_t)this->m_children.size());
+
+        for (BehaviorTasks_t::size_type i = 0; i < this->m_children.size(); ++i)
+        {
+            this->m_children[i]->saveSnapshot(writer);
+        }
+    }
+
+    bool CompositeTask::loadSnapshot(Agent* pAgent, SnapshotReader& reader)
+    {
+        if (!super::loadSnapshot(pAgent, reader))
+        {
+            return false;
+        }
+
+        int32_t activeChildIndex = InvalidChildIndex;
+        uint32_t count = 0;
+        reader.Read(activeChildIndex);
+        reader.Read(count);
+
+        //the index is one past the last child when the children are all done
+        if (reader.IsFailed() || count != this->m_children.size() || activeChildIndex < InvalidChildIndex || activeChildIndex > (int32_t)count)
+        {
+            reader.SetFailed();
+            return false;
+        }
+
+        if (reader.IsApplying())
+        {
+            this->m_activeChildIndex = activeChildIndex;
+        }
+
+        for (BehaviorTasks_t::size_type i = 0; i < this->m_children.size(); ++i)
+        {
+            if (!this->m_children[i]->loadSnapshot(pAgent, reader))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool CompositeTask::patch(const BehaviorNode* node, bool bApply)
+    {
+        if (!this->m_node->HasSameContent(node) || node->GetChildrenCount() != this->m_children.size())
+        {
+            return false;
+        }
+
+        for (uint32_t i = 0; i < this->m_children.size(); ++i)
+        {
+            BehaviorTask* pChild = patchChildTask(this, this->m_children[i], node->GetChild(i), bApply);
+
+            if (!pChild)
+            {
+                return false;
+            }
+
+            this->m_children[i] = pChild;
+        }
+
+        if (bApply)
+        {
+            this->m_node = node;
+        }
+
+        return true;
+    }
+
 	BehaviorTask* CompositeTask::GetChildById(int nodeId) const
 	{
 		if (this->m_children.size() > 0)
@@ -1395,6 +1643,33 @@ namespace behaviac
 		}
     }
 
+    bool SingeChildTask::patch(const BehaviorNode* node, bool bApply)
+    {
+        if (!this->m_node->HasSameContent(node) || node->GetChildrenCount() != (this->m_root ? 1u : 0u))
+        {
+            return false;
+        }
+
+        if (this->m_root)
+        {
+            BehaviorTask* pRoot = patchChildTask(this, this->m_root, node->GetChild(0), bApply);
+
+            if (!pRoot)
+            {
+                return false;
+            }
+
+            this->m_root = pRoot;
+        }
+
+        if (bApply)
+        {
+            this->m_node = node;
+        }
+
+        return true;
+    }
+
     void SingeChildTask::Init(const BehaviorNode* node)
     {
         super::Init(node);
@@ -1466,6 +1741,42 @@ namespace behaviac
         }
     }
 
+    void SingeChildTask::saveSnapshot(SnapshotWriter& writer) const
+    {
+        super::saveSnapshot(writer);
+
+        writer.Write((uint8_t)(this->m_root ? 1 : 0));
+
+        if (this->m_root)
+        {
+            this->m_root->saveSnapshot(writer);
+        }
+    }
+
+    bool SingeChildTask::loadSnapshot(Agent* pAgent, SnapshotReader& reader)
+    {
+        if (!super::loadSnapshot(pAgent, reader))
+        {
+            return false;
+        }
+
+        uint8_t hasRoot = 0;
+        reader.Read(hasRoot);
+
+        if (hasRoot)
+        {
+            if (!this->m_root)
+            {
+                reader.SetFailed();
+                return false;
+            }
+
+            return this->m_root->loadSnapshot(pAgent, reader);
+        }
+
+        return !reader.IsFailed();
+    }
+
     const BehaviorTask* SingeChildTask::GetTaskById(int id) const
     {
         BEHAVIAC_ASSERT(id != -1);
@@ -1595,7 +1906,7 @@ namespace behaviac
         handler(this, pAgent, user_data);
     }
 
-    BehaviorTreeTask::BehaviorTreeTask() : SingeChildTask()
+    BehaviorTreeTask::BehaviorTreeTask() : SingeChildTask(), m_treeRefs(0)
     {}
 
     void BehaviorTreeTask::Init(const BehaviorNode* node)
@@ -1608,6 +1919,9 @@ namespace behaviac
         {
             BEHAVIAC_ASSERT(BehaviorTree::DynamicCast(this->m_node));
             ((BehaviorTree*)this->m_node)->InstantiatePars(this->m_localVars);
+
+            BehaviorTree::ReleaseTaskRefs(this->m_treeRefs);
+            this->m_treeRefs = BehaviorTree::AcquireTaskRefs(((const BehaviorTree*)this->m_node)->GetTaskRefs());
     }
     }
 
@@ -1629,8 +1943,27 @@ namespace behaviac
         super::load(node);
     }
 
+    void BehaviorTreeTask::saveSnapshot(SnapshotWriter& writer) const
+    {
+        super::saveSnapshot(writer);
+
+        Variables::SaveSnapshot(this->m_localVars, writer);
+    }
+
+    bool BehaviorTreeTask::loadSnapshot(Agent* pAgent, SnapshotReader& reader)
+    {
+        if (!super::loadSnapshot(pAgent, reader))
+        {
+            return false;
+        }
+
+        return Variables::LoadSnapshot(this->m_localVars, reader);
+    }
+
     BehaviorTreeTask::~BehaviorTreeTask()
     {
+        BehaviorTree::ReleaseTaskRefs(this->m_treeRefs);
+
         //if (this->m_root)
         //{
         //	BehaviorTask::DestroyTask(this->m_root);
@@ -1650,6 +1983,42 @@ namespace behaviac
         this->m_root = 0;
 
         this->m_currentTask = 0;
+
+        BehaviorTree::ReleaseTaskRefs(this->m_treeRefs);
+        this->m_treeRefs = 0;
+    }
+
+    bool BehaviorTreeTask::patch(const BehaviorNode* node, bool bApply)
+    {
+        BEHAVIAC_ASSERT(BehaviorTree::DynamicCast(node));
+        const BehaviorTree* tree = (const BehaviorTree*)node;
+
+        //the instantiated local variables are kept, so the tree needs to have the same ones
+        if (tree->m_localProps.size() != this->m_localVars.size())
+        {
+            return false;
+        }
+
+        for (BehaviorTree::Properties_t::const_iterator it = tree->m_localProps.begin(); it != tree->m_localProps.end(); ++it)
+        {
+            if (this->m_localVars.find(it->first) == this->m_localVars.end())
+            {
+                return false;
+            }
+        }
+
+        if (!super::patch(node, bApply))
+        {
+            return false;
+        }
+
+        if (bApply)
+        {
+            BehaviorTree::ReleaseTaskRefs(this->m_treeRefs);
+            this->m_treeRefs = BehaviorTree::AcquireTaskRefs(tree->GetTaskRefs());
+        }
+
+        return true;
     }
 
     void BehaviorTreeTask::AddVariables(behaviac::map<uint32_t, IInstantiatedVariable*>* vars)
@@ -1739,6 +2108,16 @@ namespace behaviac
         this->copyto(target);
     }
 
+    void BehaviorTreeTask::SaveSnapshot(SnapshotWriter& writer) const
+    {
+        this->saveSnapshot(writer);
+    }
+
+    bool BehaviorTreeTask::LoadSnapshot(Agent* pAgent, SnapshotReader& reader)
+    {
+        return this->loadSnapshot(pAgent, reader);
+    }
+
     EBTStatus BehaviorTreeTask::resume(Agent* pAgent, EBTStatus status)
     {
         EBTStatus s = super::resume_branch(pAgent, status);
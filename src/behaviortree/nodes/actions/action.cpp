@@ -17,6 +17,7 @@
 
 #include "behaviac/common/profiler/profiler.h"
 #include "behaviac/common/meta.h"
+#include "behaviac/agent/batchexecutor.h"
 
 namespace behaviac
 {
@@ -272,7 +273,7 @@ namespace behaviac
         return result;
     }
 
-    ActionTask::ActionTask() : LeafTask()
+    ActionTask::ActionTask() : LeafTask(), m_asyncToken(0)
     {
     }
 
@@ -283,28 +284,108 @@ namespace behaviac
     void ActionTask::copyto(BehaviorTask* target) const
     {
         super::copyto(target);
+
+        BEHAVIAC_ASSERT(ActionTask::DynamicCast(target));
+        ActionTask* ttask = (ActionTask*)target;
+
+        //the async work is owned by this task only
+        ttask->m_resumeState = this->m_resumeState;
     }
 
     void ActionTask::save(IIONode* node) const
     {
         super::save(node);
+
+        if (this->m_status != BT_INVALID)
+        {
+            CIOID  pointId("resume");
+            node->setAttr(pointId, this->m_resumeState.point);
+
+            char intId[16];
+            char floatId[16];
+
+            for (int i = 0; i < ResumeState_t::kSlotCount; ++i)
+            {
+                string_sprintf(intId, "int%d", i);
+                node->setAttr(CIOID(intId), this->m_resumeState.ints[i]);
+
+                string_sprintf(floatId, "float%d", i);
+                node->setAttr(CIOID(floatId), this->m_resumeState.floats[i]);
+            }
+        }
     }
 
     void ActionTask::load(IIONode* node)
     {
         super::load(node);
+
+        if (this->m_status != BT_INVALID)
+        {
+            CIOID  pointId("resume");
+            behaviac::string attrStr;
+            node->getAttr(pointId, attrStr);
+            StringUtils::ParseString(attrStr.c_str(), this->m_resumeState.point);
+
+            char intId[16];
+            char floatId[16];
+
+            for (int i = 0; i < ResumeState_t::kSlotCount; ++i)
+            {
+                string_sprintf(intId, "int%d", i);
+                node->getAttr(CIOID(intId), attrStr);
+                StringUtils::ParseString(attrStr.c_str(), this->m_resumeState.ints[i]);
+
+                string_sprintf(floatId, "float%d", i);
+                node->getAttr(CIOID(floatId), attrStr);
+                StringUtils::ParseString(attrStr.c_str(), this->m_resumeState.floats[i]);
+            }
+        }
+    }
+
+    void ActionTask::saveSnapshot(SnapshotWriter& writer) const
+    {
+        super::saveSnapshot(writer);
+
+        writer.Write(this->m_resumeState);
+    }
+
+    bool ActionTask::loadSnapshot(Agent* pAgent, SnapshotReader& reader)
+    {
+        if (!super::loadSnapshot(pAgent, reader))
+        {
+            return false;
+        }
+
+        reader.Load(this->m_resumeState);
+
+        return !reader.IsFailed();
     }
 
     bool ActionTask::onenter(Agent* pAgent)
     {
         BEHAVIAC_UNUSED_VAR(pAgent);
+
+        //a resumable method starts from the beginning each time the action is entered
+        this->m_resumeState.Reset();
+
         return true;
     }
 
     void ActionTask::onexit(Agent* pAgent, EBTStatus s)
     {
-        BEHAVIAC_UNUSED_VAR(pAgent);
         BEHAVIAC_UNUSED_VAR(s);
+
+        //aborted while waiting for its async work, the other works of the agent are kept
+        if (this->m_asyncToken != 0)
+        {
+            Context::UnregisterAsync(this->m_asyncToken);
+            this->m_asyncToken = 0;
+
+            if (pAgent->IsParked())
+            {
+                pAgent->GetContext().UnparkAgent(pAgent);
+            }
+        }
     }
 
     EBTStatus ActionTask::update(Agent* pAgent, EBTStatus childStatus)
@@ -315,8 +396,68 @@ namespace behaviac
         BEHAVIAC_ASSERT(Action::DynamicCast(this->GetNode()));
         Action* pActionNode = (Action*)(this->GetNode());
 
+        if (this->m_asyncToken != 0)
+        {
+            EBTStatus asyncStatus = Context::GetAsyncStatus(this->m_asyncToken);
+
+            //still waiting, the agent may be resumed by the completion of another action's work
+            if (asyncStatus == BT_RUNNING)
+            {
+                pAgent->GetContext().ParkAgent(pAgent);
+
+                return BT_RUNNING;
+            }
+
+            Context::UnregisterAsync(this->m_asyncToken);
+            this->m_asyncToken = 0;
+
+            //completed, it ends with the status injected by Context::ResumeCompletedAgents
+            if (asyncStatus != BT_INVALID)
+            {
+                this->m_resumeState.Reset();
+
+                return asyncStatus;
+            }
+
+            //the work is cancelled, the method is executed again
+        }
+
+        //the method may execute the actions of the other trees of the same agent
+        ResumeState_t* pResumeState = pAgent->m_resumeState;
+        pAgent->m_resumeState = &this->m_resumeState;
+
+        uint32_t asyncToken = pAgent->m_asyncToken;
+        pAgent->m_asyncToken = 0;
+
         EBTStatus result = pActionNode->Execute(pAgent, childStatus);
 
+        pAgent->m_resumeState = pResumeState;
+
+        uint32_t beganToken = pAgent->m_asyncToken;
+        pAgent->m_asyncToken = asyncToken;
+
+        //the method may have changed the members directly
+        BatchExecutor::MarkChanged(pAgent);
+
+        if (beganToken != 0)
+        {
+            if (result == BT_RUNNING)
+            {
+                //not ticked any more until the work is completed
+                this->m_asyncToken = beganToken;
+                pAgent->GetContext().ParkAgent(pAgent);
+
+                return result;
+            }
+
+            Context::UnregisterAsync(beganToken);
+        }
+
+        if (result != BT_RUNNING)
+        {
+            this->m_resumeState.Reset();
+        }
+
         return result;
     }
 }
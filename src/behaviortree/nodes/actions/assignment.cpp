@@ -29,8 +29,8 @@ namespace behaviac
 
     Assignment::~Assignment()
     {
-        BEHAVIAC_DELETE(m_opl);
-        BEHAVIAC_DELETE(m_opr);
+        AgentMeta::ReleaseSharedProperty(m_opl);
+        AgentMeta::ReleaseSharedProperty(m_opr);
     }
 
     //behaviac::CMethodBase* LoadMethod(const char* value);
@@ -57,7 +57,7 @@ namespace behaviac
             else if (strcmp(p.name, "Opl") == 0)
             {
                 //this->m_opl = Condition::LoadLeft(p.value, propertyName);
-                this->m_opl = AgentMeta::ParseProperty(p.value);
+                this->m_opl = AgentMeta::ParseSharedProperty(p.value);
             }
             else if (strcmp(p.name, "Opr") == 0)
             {
@@ -67,7 +67,7 @@ namespace behaviac
                 {
                     behaviac::string typeName;
                     //this->m_opr = Condition::LoadRight(p.value, typeName);
-                    this->m_opr = AgentMeta::ParseProperty(p.value);
+                    this->m_opr = AgentMeta::ParseSharedProperty(p.value);
                 }
                 else
                 {
@@ -70,9 +70,9 @@ namespace behaviac
 
     Compute::~Compute()
     {
-        BEHAVIAC_DELETE(m_opl);
-        BEHAVIAC_DELETE(m_opr1);
-        BEHAVIAC_DELETE(m_opr2);
+        AgentMeta::ReleaseSharedProperty(m_opl);
+        AgentMeta::ReleaseSharedProperty(m_opr1);
+        AgentMeta::ReleaseSharedProperty(m_opr2);
     }
 
     ////behaviac::CMethodBase* LoadMethod(const char* value);
@@ -93,7 +93,7 @@ namespace behaviac
             if (strcmp(p.name, "Opl") == 0)
             {
                 //this->m_opl = Condition::LoadLeft(p.value, typeName);
-                this->m_opl = AgentMeta::ParseProperty(p.value);
+                this->m_opl = AgentMeta::ParseSharedProperty(p.value);
             }
             else if (strcmp(p.name, "Operator") == 0)
             {
@@ -112,7 +112,7 @@ namespace behaviac
                 if (pParenthesis == 0)
                 {
                     //this->m_opr1 = Condition::LoadRight(p.value, typeName);
-                    this->m_opr1 = AgentMeta::ParseProperty(p.value);
+                    this->m_opr1 = AgentMeta::ParseSharedProperty(p.value);
                 }
                 else
                 {
@@ -127,7 +127,7 @@ namespace behaviac
 
                 if (pParenthesis == 0)
                 {
-                    this->m_opr2 = AgentMeta::ParseProperty(p.value);
+                    this->m_opr2 = AgentMeta::ParseSharedProperty(p.value);
                     //this->m_opr2 = Condition::LoadRight(p.value, typeName);
                 }
                 else
@@ -143,7 +143,7 @@ namespace behaviac
             }
         }
 
-        this->m_typeName = typeName;
+        this->m_typeName = CStringAtom(typeName.c_str());
     }
 
     bool Compute::IsValid(Agent* pAgent, BehaviorTask* pTask) const
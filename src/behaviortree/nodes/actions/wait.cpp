@@ -25,7 +25,7 @@ namespace behaviac
 
     Wait::~Wait()
     {
-        BEHAVIAC_DELETE(m_time);
+        AgentMeta::ReleaseSharedProperty(m_time);
     }
 
     void Wait::load(int version, const char* agentType, const properties_t& properties)
@@ -46,7 +46,7 @@ namespace behaviac
                     {
                         behaviac::string typeName;
                         //this->m_time_var = Condition::LoadRight(p.value, typeName);
-                        this->m_time = AgentMeta::ParseProperty(p.value);
+                        this->m_time = AgentMeta::ParseSharedProperty(p.value);
                     }
                     else
                     {
@@ -143,6 +143,27 @@ namespace behaviac
         }
     }
 
+    void WaitTask::saveSnapshot(SnapshotWriter& writer) const
+    {
+        super::saveSnapshot(writer);
+
+        writer.Write(this->m_start);
+        writer.Write(this->m_time);
+    }
+
+    bool WaitTask::loadSnapshot(Agent* pAgent, SnapshotReader& reader)
+    {
+        if (!super::loadSnapshot(pAgent, reader))
+        {
+            return false;
+        }
+
+        reader.Load(this->m_start);
+        reader.Load(this->m_time);
+
+        return !reader.IsFailed();
+    }
+
     WaitTask::~WaitTask()
     {
     }
@@ -91,6 +91,25 @@ namespace behaviac
         }
     }
 
+    void WaitforSignalTask::saveSnapshot(SnapshotWriter& writer) const
+    {
+        super::saveSnapshot(writer);
+
+        writer.Write(this->m_bTriggered);
+    }
+
+    bool WaitforSignalTask::loadSnapshot(Agent* pAgent, SnapshotReader& reader)
+    {
+        if (!super::loadSnapshot(pAgent, reader))
+        {
+            return false;
+        }
+
+        reader.Load(this->m_bTriggered);
+
+        return !reader.IsFailed();
+    }
+
     bool WaitforSignalTask::onenter(Agent* pAgent)
     {
         BEHAVIAC_UNUSED_VAR(pAgent);
@@ -26,7 +26,7 @@ namespace behaviac
 
     WaitFrames::~WaitFrames()
     {
-        BEHAVIAC_DELETE(this->m_frames);
+        AgentMeta::ReleaseSharedProperty(this->m_frames);
     }
 
     //Property* LoadRight(const char* value, const behaviac::string& propertyName, behaviac::string& typeName);
@@ -49,7 +49,7 @@ namespace behaviac
                     behaviac::string typeName;
                     behaviac::string propertyName;
                     //this->m_frames_var = Condition::LoadRight(p.value, typeName);
-                    this->m_frames = AgentMeta::ParseProperty(p.value);
+                    this->m_frames = AgentMeta::ParseSharedProperty(p.value);
 
                 }
                 else
@@ -126,6 +126,27 @@ namespace behaviac
         }
     }
 
+    void WaitFramesTask::saveSnapshot(SnapshotWriter& writer) const
+    {
+        super::saveSnapshot(writer);
+
+        writer.Write(this->m_start);
+        writer.Write(this->m_frames);
+    }
+
+    bool WaitFramesTask::loadSnapshot(Agent* pAgent, SnapshotReader& reader)
+    {
+        if (!super::loadSnapshot(pAgent, reader))
+        {
+            return false;
+        }
+
+        reader.Load(this->m_start);
+        reader.Load(this->m_frames);
+
+        return !reader.IsFailed();
+    }
+
     WaitFramesTask::~WaitFramesTask()
     {
     }
@@ -17,6 +17,7 @@
 
 
 #include "behaviac/agent/agent.h"
+#include "behaviac/agent/context.h"
 #include "behaviac/behaviortree/nodes/actions/action.h"
 #include "behaviac/common/meta.h"
 #include "behaviac/common/member.h"
@@ -85,7 +86,8 @@ namespace behaviac
         }
         else
         {
-            RandomGenerator* pRandomGenerator = RandomGenerator::GetInstance();
+            //each context has its own generator so that the contexts can be ticked in parallel
+            RandomGenerator* pRandomGenerator = pAgent ? pAgent->GetContext().GetRandomGenerator() : RandomGenerator::GetInstance();
 
             value = (*pRandomGenerator)();
         }
@@ -162,6 +164,58 @@ namespace behaviac
         }
     }
 
+    void CompositeStochasticTask::saveSnapshot(SnapshotWriter& writer) const
+    {
+        super::saveSnapshot(writer);
+
+        writer.Write((uint32_t)this->m_set.size());
+
+        for (uint32_t i = 0; i < (uint32_t)this->m_set.size(); ++i)
+        {
+            writer.Write(this->m_set[i]);
+        }
+    }
+
+    bool CompositeStochasticTask::loadSnapshot(Agent* pAgent, SnapshotReader& reader)
+    {
+        if (!super::loadSnapshot(pAgent, reader))
+        {
+            return false;
+        }
+
+        uint32_t count = 0;
+        reader.Read(count);
+
+        if (reader.IsFailed() || count > this->m_children.size())
+        {
+            reader.SetFailed();
+            return false;
+        }
+
+        if (reader.IsApplying())
+        {
+            this->m_set.resize(count);
+        }
+
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            uint32_t index = 0;
+
+            if (!reader.Read(index) || index >= this->m_children.size())
+            {
+                reader.SetFailed();
+                return false;
+            }
+
+            if (reader.IsApplying())
+            {
+                this->m_set[i] = index;
+            }
+        }
+
+        return !reader.IsFailed();
+    }
+
     bool CompositeStochasticTask::onenter(Agent* pAgent)
     {
         BEHAVIAC_UNUSED_VAR(pAgent);
@@ -32,9 +32,14 @@ namespace behaviac
 
     ReferencedBehavior::~ReferencedBehavior()
     {
-        BEHAVIAC_DELETE(m_referencedBehaviorPath);
+        AgentMeta::ReleaseSharedProperty(m_referencedBehaviorPath);
         BEHAVIAC_DELETE(m_taskMethod);
-        BEHAVIAC_DELETE this->m_transitions;
+
+        if (this->m_transitions)
+        {
+            DeleteAttachments(*this->m_transitions);
+            BEHAVIAC_DELETE this->m_transitions;
+        }
     }
 
     void ReferencedBehavior::load(int version, const char* agentType, const properties_t& properties)
@@ -54,7 +59,7 @@ namespace behaviac
                     if (pParenthesis == 0)
                     {
                         behaviac::string typeName;
-                        this->m_referencedBehaviorPath = AgentMeta::ParseProperty(p.value);
+                        this->m_referencedBehaviorPath = AgentMeta::ParseSharedProperty(p.value);
                     }
                     else
                     {
@@ -138,6 +143,12 @@ namespace behaviac
                 planner->LogPlanReferenceTreeExit(planner->GetAgent(), taskSubTree);
                 BEHAVIAC_ASSERT(true);
             }
+
+            //it is owned by the PlannerTaskReference when it succeeds
+            if (!bOk)
+            {
+                Workspace::GetInstance()->DestroyBehaviorTreeTask(subTreeTask, pAgent);
+            }
         }
 
         BEHAVIAC_ASSERT(planner->GetAgent()->GetVariables()->Depth() == depth2);
@@ -251,6 +262,123 @@ namespace behaviac
         super::load(node);
     }
 
+    void ReferencedBehaviorTask::saveSnapshot(SnapshotWriter& writer) const
+    {
+        super::saveSnapshot(writer);
+
+        writer.Write((int32_t)this->m_nextStateId);
+
+        //the subtree only exists while it is running, its path is written as the referenced tree can be a variable
+        uint32_t length = this->m_subTree ? (uint32_t)this->m_subTree->GetName().size() : 0;
+        writer.Write(length);
+
+        if (this->m_subTree)
+        {
+            writer.WriteBytes(this->m_subTree->GetName().c_str(), length);
+            this->m_subTree->SaveSnapshot(writer);
+        }
+    }
+
+    bool ReferencedBehaviorTask::loadSnapshot(Agent* pAgent, SnapshotReader& reader)
+    {
+        if (!super::loadSnapshot(pAgent, reader))
+        {
+            return false;
+        }
+
+        int32_t nextStateId = -1;
+        uint32_t length = 0;
+        reader.Read(nextStateId);
+        reader.Read(length);
+        const char* szTreePath = (const char*)reader.Skip(length);
+
+        if (reader.IsFailed())
+        {
+            return false;
+        }
+
+        if (!reader.IsApplying())
+        {
+            return this->validateSubTreeSnapshot(pAgent, szTreePath, length, reader);
+        }
+
+        this->m_nextStateId = nextStateId;
+
+        if (this->m_subTree)
+        {
+            const behaviac::string& name = this->m_subTree->GetName();
+
+            if (name.size() != length || memcmp(name.c_str(), szTreePath, length) != 0)
+            {
+                //not the subtree in the snapshot, it is released as in onexit
+#if BEHAVIAC_USE_HTN
+                BEHAVIAC_ASSERT(this->m_currentState != NULL);
+                this->m_currentState->Pop();
+                this->m_currentState = NULL;
+#endif//
+                Workspace::GetInstance()->DestroyBehaviorTreeTask(this->m_subTree, pAgent);
+                this->m_subTree = 0;
+            }
+        }
+
+        if (length > 0)
+        {
+            if (!this->m_subTree)
+            {
+                behaviac::string treePath(szTreePath, length);
+                this->m_subTree = Workspace::GetInstance()->CreateBehaviorTreeTask(treePath.c_str());
+
+                if (!this->m_subTree)
+                {
+                    reader.SetFailed();
+                    return false;
+                }
+
+#if BEHAVIAC_USE_HTN
+                this->m_currentState = pAgent->GetVariables()->Push(false);
+#endif//
+            }
+
+            return this->m_subTree->LoadSnapshot(pAgent, reader);
+        }
+
+        return true;
+    }
+
+    bool ReferencedBehaviorTask::validateSubTreeSnapshot(Agent* pAgent, const char* szTreePath, uint32_t length, SnapshotReader& reader)
+    {
+        if (length == 0)
+        {
+            return true;
+        }
+
+        if (this->m_subTree)
+        {
+            const behaviac::string& name = this->m_subTree->GetName();
+
+            if (name.size() == length && memcmp(name.c_str(), szTreePath, length) == 0)
+            {
+                return this->m_subTree->LoadSnapshot(pAgent, reader);
+            }
+        }
+
+        //the subtree is validated against a task of the tree in the snapshot which is dropped afterwards
+        behaviac::string treePath(szTreePath, length);
+        BehaviorTreeTask* pSubTree = Workspace::GetInstance()->CreateBehaviorTreeTask(treePath.c_str());
+
+        if (!pSubTree)
+        {
+            reader.SetFailed();
+            return false;
+        }
+
+        bool bOk = pSubTree->LoadSnapshot(pAgent, reader);
+
+        Workspace::GetInstance()->DestroyBehaviorTreeTask(pSubTree, pAgent);
+
+        return bOk;
+    }
+
     void ReferencedBehaviorTask::Init(const BehaviorNode* node)
     {
         super::Init(node);
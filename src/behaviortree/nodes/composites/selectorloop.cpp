@@ -14,10 +14,11 @@
 #include "behaviac/common/base.h"
 #include "behaviac/behaviortree/nodes/composites/selectorloop.h"
 #include "behaviac/behaviortree/nodes/composites/withprecondition.h"
+#include "behaviac/agent/agent.h"
 
 namespace behaviac
 {
-    SelectorLoop::SelectorLoop()// : m_preconditions(0), m_actions(0)
+    SelectorLoop::SelectorLoop() : m_bReevaluateOnChange(false)// : m_preconditions(0), m_actions(0)
     {}
 
     SelectorLoop::~SelectorLoop()
@@ -31,6 +32,26 @@ namespace behaviac
     void SelectorLoop::load(int version, const char* agentType, const properties_t& properties)
     {
         super::load(version, agentType, properties);
+
+        for (propertie_const_iterator_t it = properties.begin(); it != properties.end(); ++it)
+        {
+            const property_t& p = (*it);
+
+            if (strcmp(p.name, "ReevaluateOnChange") == 0)
+            {
+                this->m_bReevaluateOnChange = (strcmp(p.value, "true") == 0);
+            }
+        }
+    }
+
+    void SelectorLoop::SetReevaluateOnChange(bool bReevaluateOnChange)
+    {
+        this->m_bReevaluateOnChange = bReevaluateOnChange;
+    }
+
+    bool SelectorLoop::IsReevaluateOnChange() const
+    {
+        return this->m_bReevaluateOnChange;
     }
 
     bool SelectorLoop::IsValid(Agent* pAgent, BehaviorTask* pTask) const
@@ -67,6 +88,7 @@ namespace behaviac
         SelectorLoopTask* ttask = (SelectorLoopTask*)target;
 
         ttask->m_activeChildIndex = this->m_activeChildIndex;
+        ttask->m_failedStamps = this->m_failedStamps;
     }
 
     void SelectorLoopTask::save(IIONode* node) const
@@ -77,6 +99,22 @@ namespace behaviac
     void SelectorLoopTask::load(IIONode* node)
     {
         super::load(node);
+
+        //the stamps are not saved, the preconditions are all executed again
+        this->m_failedStamps.assign(this->m_failedStamps.size(), 0);
+    }
+
+    bool SelectorLoopTask::loadSnapshot(Agent* pAgent, SnapshotReader& reader)
+    {
+        bool bOk = super::loadSnapshot(pAgent, reader);
+
+        //the stamps are the agent's change stamps in the process which saved it, they are meaningless here
+        if (reader.IsApplying())
+        {
+            this->m_failedStamps.assign(this->m_failedStamps.size(), 0);
+        }
+
+        return bOk;
     }
 
     SelectorLoopTask::~SelectorLoopTask()
@@ -98,6 +136,19 @@ namespace behaviac
         this->m_activeChildIndex = CompositeTask::InvalidChildIndex;
         BEHAVIAC_ASSERT(this->m_activeChildIndex == CompositeTask::InvalidChildIndex);
 
+        const SelectorLoop* pNode = (const SelectorLoop*)this->GetNode();
+        BEHAVIAC_ASSERT(SelectorLoop::DynamicCast(pNode));
+
+        if (pNode->IsReevaluateOnChange())
+        {
+            pAgent->EnableChangeTracking();
+            this->m_failedStamps.assign(this->m_children.size(), 0);
+        }
+        else
+        {
+            this->m_failedStamps.clear();
+        }
+
         return super::onenter(pAgent);
     }
 
@@ -144,11 +195,7 @@ namespace behaviac
 
         for (uint32_t i = (idx + 1); i < this->m_children.size(); ++i)
         {
-            WithPreconditionTask* pSubTree = (WithPreconditionTask*)this->m_children[i];
-            BEHAVIAC_ASSERT(WithPreconditionTask::DynamicCast(pSubTree));
-			BehaviorTask* pre = pSubTree->PreconditionNode();
-
-			EBTStatus status = pre->exec(pAgent);
+            EBTStatus status = this->execPrecondition(pAgent, i);
 
             if (status == BT_SUCCESS)
             {
@@ -177,8 +224,7 @@ namespace behaviac
 
                 if (i > index)
                 {
-					BehaviorTask* pre = pSubTree->PreconditionNode();
-					EBTStatus status = pre->exec(pAgent);
+					EBTStatus status = this->execPrecondition(pAgent, i);
 
                     //to search for the first one whose precondition is success
                     if (status != BT_SUCCESS)
@@ -215,4 +261,39 @@ namespace behaviac
 
         return BT_FAILURE;
     }
+
+    EBTStatus SelectorLoopTask::execPrecondition(Agent* pAgent, uint32_t index)
+    {
+        WithPreconditionTask* pSubTree = (WithPreconditionTask*)this->m_children[index];
+        BEHAVIAC_ASSERT(WithPreconditionTask::DynamicCast(pSubTree));
+        BehaviorTask* pre = pSubTree->PreconditionNode();
+
+        if (this->m_failedStamps.size() == 0)
+        {
+            return pre->exec(pAgent);
+        }
+
+        const WithPrecondition* pNode = (const WithPrecondition*)pSubTree->GetNode();
+        BEHAVIAC_ASSERT(WithPrecondition::DynamicCast(pNode));
+
+        uint64_t failedStamp = this->m_failedStamps[index];
+
+        if (failedStamp != 0 && !pNode->IsInputChangedSince(pAgent, failedStamp))
+        {
+            return BT_FAILURE;
+        }
+
+        EBTStatus status = pre->exec(pAgent);
+
+        if (status == BT_FAILURE && pNode->IsInputKnown())
+        {
+            this->m_failedStamps[index] = pAgent->GetChangeStamp();
+        }
+        else
+        {
+            this->m_failedStamps[index] = 0;
+        }
+
+        return status;
+    }
 }
@@ -27,7 +27,7 @@ namespace behaviac
 
     SelectorProbability::~SelectorProbability()
     {
-        BEHAVIAC_DELETE(m_method);
+        AgentMeta::ReleaseSharedProperty(m_method);
     }
 
     //behaviac::CMethodBase* LoadMethod(const char* value);
@@ -44,7 +44,7 @@ namespace behaviac
             {
                 if (p.value[0] != '\0')
                 {
-                    this->m_method = AgentMeta::ParseProperty(p.value);
+                    this->m_method = AgentMeta::ParseSharedProperty(p.value);
                 }//if (p.value[0] != '\0')
 
             }
@@ -14,10 +14,16 @@
 #include "behaviac/common/base.h"
 #include "behaviac/behaviortree/nodes/composites/withprecondition.h"
 #include "behaviac/behaviortree/nodes/composites/selectorloop.h"
+#include "behaviac/agent/agent.h"
+#include "behaviac/common/thread/mutex_lock.h"
+#include "behaviac/common/thread/wrapper.h"
 
 namespace behaviac
 {
-    WithPrecondition::WithPrecondition()
+    //the trees are shared by the contexts ticked on their own threads
+    static Mutex gs_inferMutex;
+
+    WithPrecondition::WithPrecondition() : m_bInputInferred(false), m_bInputResolved(0), m_bInputDeclared(false)
     {}
 
     WithPrecondition::~WithPrecondition()
@@ -38,6 +44,61 @@ namespace behaviac
         return super::IsValid(pAgent, pTask);
     }
 
+    void WithPrecondition::inferInput_() const
+    {
+        if (Load_Acquire(this->m_bInputResolved) != 0)
+        {
+            return;
+        }
+
+        ScopedLock lock(gs_inferMutex);
+
+        if (this->m_bInputResolved == 0)
+        {
+            //the first child is the precondition
+            if (this->GetChildrenCount() > 0)
+            {
+                this->m_bInputInferred = this->GetChild(0)->GetInputIds(this->m_inputIds);
+            }
+
+            Store_Release(this->m_bInputResolved, (Atomic32)1);
+        }
+    }
+
+    void WithPrecondition::DeclareInput(const char* name)
+    {
+        this->m_inputIds.push_back(MakeVariableId(name));
+        this->m_bInputDeclared = true;
+    }
+
+    bool WithPrecondition::IsInputKnown() const
+    {
+        this->inferInput_();
+
+        return this->m_bInputInferred || this->m_bInputDeclared;
+    }
+
+    bool WithPrecondition::IsInputChangedSince(const Agent* pAgent, uint64_t stamp) const
+    {
+        this->inferInput_();
+
+        //constants only
+        if (this->m_inputIds.size() == 0)
+        {
+            return pAgent->GetVariableChangeStamp(0) > stamp;
+        }
+
+        for (uint32_t i = 0; i < this->m_inputIds.size(); ++i)
+        {
+            if (pAgent->GetVariableChangeStamp(this->m_inputIds[i]) > stamp)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
     BehaviorTask* WithPrecondition::createTask() const
     {
         WithPreconditionTask* pTask = BEHAVIAC_NEW WithPreconditionTask();
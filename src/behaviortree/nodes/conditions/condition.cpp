@@ -17,6 +17,7 @@
 #include "behaviac/common/profiler/profiler.h"
 #include "behaviac/behaviortree/nodes/actions/action.h"
 #include "behaviac/common/meta.h"
+#include "behaviac/agent/batchexecutor.h"
 
 namespace behaviac
 {
@@ -26,8 +27,8 @@ namespace behaviac
 
     Condition::~Condition()
     {
-        BEHAVIAC_DELETE(m_opl);
-        BEHAVIAC_DELETE(m_opr);
+        AgentMeta::ReleaseSharedProperty(m_opl);
+        AgentMeta::ReleaseSharedProperty(m_opr);
     }
 
     void Condition::load(int version, const char* agentType, const properties_t& properties)
@@ -50,7 +51,7 @@ namespace behaviac
 
                 if (pParenthesis == 0)
                 {
-                    this->m_opl = AgentMeta::ParseProperty(p.value);
+                    this->m_opl = AgentMeta::ParseSharedProperty(p.value);
                 }
                 else
                 {
@@ -63,7 +64,7 @@ namespace behaviac
 
                 if (pParenthesis == 0)
                 {
-                    this->m_opr = AgentMeta::ParseProperty(p.value);
+                    this->m_opr = AgentMeta::ParseSharedProperty(p.value);
                 }
                 else
                 {
@@ -92,6 +93,13 @@ namespace behaviac
     {
         if (this->m_opl != NULL && this->m_opr != NULL)
         {
+            bool bResult = false;
+
+            if (BatchExecutor::GetResult(pAgent, this, bResult))
+            {
+                return bResult;
+            }
+
             return this->m_opl->Compare(pAgent, this->m_opr, this->m_operator);
         }
         else
@@ -102,6 +110,31 @@ namespace behaviac
         }
     }
 
+    void Condition::EvaluateBatch(Agent* const* agents, int count, bool* results)
+    {
+        if (this->m_opl != NULL && this->m_opr != NULL)
+        {
+            this->m_opl->CompareBatch(agents, count, this->m_opr, this->m_operator, results);
+        }
+        else
+        {
+            for (int i = 0; i < count; ++i)
+            {
+                results[i] = this->Evaluate(agents[i]);
+            }
+        }
+    }
+
+    bool Condition::GetInputIds(behaviac::vector<uint32_t>& inputIds) const
+    {
+        if (this->HasAttachments() || this->m_opl == NULL || this->m_opr == NULL)
+        {
+            return false;
+        }
+
+        return this->m_opl->GetInputIds(inputIds) && this->m_opr->GetInputIds(inputIds);
+    }
+
     BehaviorTask* Condition::createTask() const
     {
         ConditionTask* pTask = BEHAVIAC_NEW ConditionTask();
@@ -37,6 +37,13 @@ namespace behaviac
         return super::IsValid(pAgent, pTask);
     }
 
+    bool False::GetInputIds(behaviac::vector<uint32_t>& inputIds) const
+    {
+        BEHAVIAC_UNUSED_VAR(inputIds);
+
+        return !this->HasAttachments();
+    }
+
     BehaviorTask* False::createTask() const
     {
         FalseTask* pTask = BEHAVIAC_NEW FalseTask();
@@ -53,6 +53,25 @@ namespace behaviac
 
         return ret;
     }
+    bool Or::GetInputIds(behaviac::vector<uint32_t>& inputIds) const
+    {
+        //no children yet, it is not loaded completely
+        if (this->HasAttachments() || this->GetChildrenCount() == 0)
+        {
+            return false;
+        }
+
+        for (uint32_t i = 0; i < this->GetChildrenCount(); ++i)
+        {
+            if (!this->GetChild(i)->GetInputIds(inputIds))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
     BehaviorTask* Or::createTask() const
     {
         OrTask* pTask = BEHAVIAC_NEW OrTask();
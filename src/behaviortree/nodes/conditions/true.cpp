@@ -37,6 +37,13 @@ namespace behaviac
         return super::IsValid(pAgent, pTask);
     }
 
+    bool True::GetInputIds(behaviac::vector<uint32_t>& inputIds) const
+    {
+        BEHAVIAC_UNUSED_VAR(inputIds);
+
+        return !this->HasAttachments();
+    }
+
     BehaviorTask* True::createTask() const
     {
         TrueTask* pTask = BEHAVIAC_NEW TrueTask();
@@ -23,6 +23,7 @@ namespace behaviac
 
     DecoratorCount::~DecoratorCount()
     {
+        AgentMeta::ReleaseSharedProperty(m_count);
     }
 
     //Property* LoadRight(const char* value, const behaviac::string& propertyName, behaviac::string& typeName);
@@ -40,7 +41,7 @@ namespace behaviac
                 behaviac::string typeName;
                 behaviac::string  propertyName;
                 //this->m_count = Condition::LoadRight(p.value, typeName);
-                this->m_count = AgentMeta::ParseProperty(p.value);
+                this->m_count = AgentMeta::ParseSharedProperty(p.value);
             }
         }
     }
@@ -105,6 +106,25 @@ namespace behaviac
         }
     }
 
+    void DecoratorCountTask::saveSnapshot(SnapshotWriter& writer) const
+    {
+        super::saveSnapshot(writer);
+
+        writer.Write(this->m_n);
+    }
+
+    bool DecoratorCountTask::loadSnapshot(Agent* pAgent, SnapshotReader& reader)
+    {
+        if (!super::loadSnapshot(pAgent, reader))
+        {
+            return false;
+        }
+
+        reader.Load(this->m_n);
+
+        return !reader.IsFailed();
+    }
+
     bool DecoratorCountTask::onenter(Agent* pAgent)
     {
         super::onenter(pAgent);
@@ -26,7 +26,7 @@ namespace behaviac
 
     DecoratorFrames::~DecoratorFrames()
     {
-        BEHAVIAC_DELETE(this->m_frames);
+        AgentMeta::ReleaseSharedProperty(this->m_frames);
     }
 
     void DecoratorFrames::load(int version, const char* agentType, const properties_t& properties)
@@ -46,7 +46,7 @@ namespace behaviac
                     behaviac::string typeName;
                     behaviac::string propertyName;
                     //this->m_frames = Condition::LoadRight(p.value, typeName);
-                    this->m_frames = AgentMeta::ParseProperty(p.value);
+                    this->m_frames = AgentMeta::ParseSharedProperty(p.value);
                 }
                 else
                 {
@@ -136,6 +136,27 @@ namespace behaviac
         }
     }
 
+    void DecoratorFramesTask::saveSnapshot(SnapshotWriter& writer) const
+    {
+        super::saveSnapshot(writer);
+
+        writer.Write(this->m_start);
+        writer.Write(this->m_frames);
+    }
+
+    bool DecoratorFramesTask::loadSnapshot(Agent* pAgent, SnapshotReader& reader)
+    {
+        if (!super::loadSnapshot(pAgent, reader))
+        {
+            return false;
+        }
+
+        reader.Load(this->m_start);
+        reader.Load(this->m_frames);
+
+        return !reader.IsFailed();
+    }
+
     bool DecoratorFramesTask::onenter(Agent* pAgent)
     {
         super::onenter(pAgent);
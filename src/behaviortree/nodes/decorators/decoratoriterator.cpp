@@ -28,8 +28,8 @@ namespace behaviac
     }
     DecoratorIterator::~DecoratorIterator()
     {
-        BEHAVIAC_DELETE(m_opl);
-        BEHAVIAC_DELETE(m_opr);
+        AgentMeta::ReleaseSharedProperty(m_opl);
+        AgentMeta::ReleaseSharedProperty(m_opr);
     }
 
     void DecoratorIterator::load(int version, const char*  agentType, const properties_t& properties)
@@ -49,7 +49,7 @@ namespace behaviac
                 if (pParenthesis == (size_t)-1)
                 {
                     //this->m_opl = Condition::LoadLeft(p->value, typeName);
-                    this->m_opl = AgentMeta::ParseProperty(p->value);
+                    this->m_opl = AgentMeta::ParseSharedProperty(p->value);
                 }
                 else
                 {
@@ -64,7 +64,7 @@ namespace behaviac
                 if (pParenthesis == (size_t)-1)
                 {
                     //this->m_opr = Condition::LoadRight(p->value, typeName);
-                    this->m_opr = AgentMeta::ParseProperty(p->value);
+                    this->m_opr = AgentMeta::ParseSharedProperty(p->value);
                 }
                 else
                 {
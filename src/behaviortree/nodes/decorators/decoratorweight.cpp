@@ -22,7 +22,7 @@ namespace behaviac
 
     DecoratorWeight::~DecoratorWeight()
     {
-        BEHAVIAC_DELETE(m_weight);
+        AgentMeta::ReleaseSharedProperty(m_weight);
     }
 
     //Property* LoadRight(const char* value, const behaviac::string& propertyName, behaviac::string& typeName);
@@ -37,7 +37,7 @@ namespace behaviac
 
             if (strcmp(p.name, "Weight") == 0)
             {
-                this->m_weight = AgentMeta::ParseProperty(p.value);
+                this->m_weight = AgentMeta::ParseSharedProperty(p.value);
             }
         }
     }
@@ -22,6 +22,7 @@
 #include "behaviac/common/file/filemanager.h"
 #include "behaviac/common/file/file.h"
 #include "behaviac/common/meta.h"
+#include "behaviac/common/string/stringatom.h"
 
 namespace behaviac
 {
@@ -102,6 +103,9 @@ namespace behaviac
             Condition::Cleanup();
             //Compute::Cleanup();
             CStringCRC::Cleanup();
+
+            //after the trees are unloaded as their nodes keep the interned strings
+            StringTable::Cleanup();
 			LogManager::Cleanup();
 
             CFileManager::Cleanup();
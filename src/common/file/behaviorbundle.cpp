@@ -0,0 +1,320 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Tencent is pleased to support the open source community by making behaviac available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except in compliance with
+// the License. You may obtain a copy of the License at http://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and limitations under the License.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "behaviac/common/file/behaviorbundle.h"
+#include "behaviac/common/file/filemanager.h"
+#include "behaviac/common/file/file.h"
+#include "behaviac/common/crc.h"
+#include "behaviac/common/logger/logger.h"
+
+#include <algorithm>
+
+namespace behaviac
+{
+	static uint32_t AlignBundleOffset(uint32_t offset)
+	{
+		return (offset + CBehaviorBundle::kAlignment - 1) & ~(CBehaviorBundle::kAlignment - 1);
+	}
+
+	struct BundleEntryLess
+	{
+		bool operator()(const CBehaviorBundle::Entry_t& entry, uint32_t hash) const
+		{
+			return entry.hash < hash;
+		}
+	};
+
+	CBehaviorBundle::CBehaviorBundle() : m_pData(0), m_size(0), m_bMapped(false), m_entries(0), m_paths(0), m_entryCount(0), m_pathsSize(0)
+	{
+	}
+
+	CBehaviorBundle::~CBehaviorBundle()
+	{
+		this->Close();
+	}
+
+	bool CBehaviorBundle::Open(const char* fullPath)
+	{
+		this->Close();
+
+		this->m_pData = (const char*)CFileSystem::MapFile(fullPath, this->m_size);
+
+		if (this->m_pData)
+		{
+			this->m_bMapped = true;
+		}
+		else
+		{
+			IFile* fp = CFileManager::GetInstance()->FileOpen(fullPath, CFileSystem::EOpenAccess_Read);
+
+			if (!fp)
+			{
+				return false;
+			}
+
+			uint32_t fileSize = (uint32_t)fp->GetSize();
+
+			if (fileSize > 0)
+			{
+				char* pData = (char*)BEHAVIAC_MALLOC(fileSize);
+
+				if (fp->Read(pData, fileSize) == fileSize)
+				{
+					this->m_pData = pData;
+					this->m_size = fileSize;
+				}
+				else
+				{
+					BEHAVIAC_FREE(pData);
+				}
+			}
+
+			CFileManager::GetInstance()->FileClose(fp);
+
+			if (!this->m_pData)
+			{
+				return false;
+			}
+		}
+
+		this->m_fullPath = fullPath;
+
+		if (this->m_size >= sizeof(Header_t))
+		{
+			const Header_t* pHeader = (const Header_t*)this->m_pData;
+
+			this->m_entryCount = pHeader->entryCount;
+			this->m_pathsSize = pHeader->pathsSize;
+			this->m_entries = (const Entry_t*)(this->m_pData + sizeof(Header_t));
+			this->m_paths = (const char*)(this->m_entries + this->m_entryCount);
+		}
+
+		if (!this->Validate())
+		{
+			BEHAVIAC_LOGWARNING("'%s' is not a valid bundle!\n", fullPath);
+			this->Close();
+
+			return false;
+		}
+
+		return true;
+	}
+
+	bool CBehaviorBundle::Validate() const
+	{
+		if (this->m_size < sizeof(Header_t))
+		{
+			return false;
+		}
+
+		const Header_t* pHeader = (const Header_t*)this->m_pData;
+
+		if (pHeader->magic != kMagic || pHeader->version != kVersion)
+		{
+			return false;
+		}
+
+		uint64_t indexSize = sizeof(Header_t) + (uint64_t)this->m_entryCount * sizeof(Entry_t) + this->m_pathsSize;
+
+		if (indexSize > this->m_size || (this->m_pathsSize > 0 && this->m_paths[this->m_pathsSize - 1] != '\0'))
+		{
+			return false;
+		}
+
+		for (uint32_t i = 0; i < this->m_entryCount; ++i)
+		{
+			const Entry_t& entry = this->m_entries[i];
+
+			if (entry.pathOffset >= this->m_pathsSize || (uint64_t)entry.offset + entry.size > this->m_size)
+			{
+				return false;
+			}
+
+			if (i > 0 && this->m_entries[i - 1].hash > entry.hash)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	void CBehaviorBundle::Close()
+	{
+		if (this->m_pData)
+		{
+			if (this->m_bMapped)
+			{
+				CFileSystem::UnmapFile(this->m_pData, this->m_size);
+			}
+			else
+			{
+				BEHAVIAC_FREE((void*)this->m_pData);
+			}
+		}
+
+		this->m_fullPath.clear();
+		this->m_pData = 0;
+		this->m_size = 0;
+		this->m_bMapped = false;
+		this->m_entries = 0;
+		this->m_paths = 0;
+		this->m_entryCount = 0;
+		this->m_pathsSize = 0;
+	}
+
+	bool CBehaviorBundle::IsOpen() const
+	{
+		return this->m_pData != 0;
+	}
+
+	const char* CBehaviorBundle::GetFullPath() const
+	{
+		return this->m_fullPath.c_str();
+	}
+
+	uint32_t CBehaviorBundle::GetEntryCount() const
+	{
+		return this->m_entryCount;
+	}
+
+	const CBehaviorBundle::Entry_t& CBehaviorBundle::GetEntry(uint32_t index) const
+	{
+		BEHAVIAC_ASSERT(index < this->m_entryCount);
+
+		return this->m_entries[index];
+	}
+
+	const CBehaviorBundle::Entry_t* CBehaviorBundle::Find(const char* relativePath, uint32_t formats) const
+	{
+		if (this->m_entryCount == 0)
+		{
+			return 0;
+		}
+
+		uint32_t hash = CRC32::CalcCRC(relativePath);
+
+		const Entry_t* end = this->m_entries + this->m_entryCount;
+
+		//the entries of the same hash are sorted by the format, the xml is the first
+		for (const Entry_t* it = std::lower_bound(this->m_entries, end, hash, BundleEntryLess()); it != end && it->hash == hash; ++it)
+		{
+			if ((it->format & formats) != 0 && strcmp(this->GetPath(*it), relativePath) == 0)
+			{
+				return it;
+			}
+		}
+
+		return 0;
+	}
+
+	const char* CBehaviorBundle::GetPath(const Entry_t& entry) const
+	{
+		return this->m_paths + entry.pathOffset;
+	}
+
+	const char* CBehaviorBundle::GetData(const Entry_t& entry) const
+	{
+		return this->m_pData + entry.offset;
+	}
+
+	struct BundleItemLess
+	{
+		explicit BundleItemLess(const behaviac::vector<CBehaviorBundle::Entry_t>& entries) : m_entries(entries)
+		{
+		}
+
+		bool operator()(uint32_t left, uint32_t right) const
+		{
+			const CBehaviorBundle::Entry_t& l = this->m_entries[left];
+			const CBehaviorBundle::Entry_t& r = this->m_entries[right];
+
+			return l.hash < r.hash || (l.hash == r.hash && l.format < r.format);
+		}
+
+		const behaviac::vector<CBehaviorBundle::Entry_t>& m_entries;
+	};
+
+	bool CBehaviorBundle::Write(const char* fullPath, const behaviac::vector<Item_t>& items)
+	{
+		uint32_t itemCount = (uint32_t)items.size();
+
+		behaviac::vector<Entry_t> entries(itemCount);
+		behaviac::vector<uint32_t> order(itemCount);
+		behaviac::string paths;
+
+		for (uint32_t i = 0; i < itemCount; ++i)
+		{
+			Entry_t& entry = entries[i];
+
+			entry.hash = CRC32::CalcCRC(items[i].relativePath.c_str());
+			entry.format = items[i].format;
+			entry.pathOffset = (uint32_t)paths.size();
+			entry.offset = 0;
+			entry.size = (uint32_t)items[i].data.size();
+
+			paths.append(items[i].relativePath.c_str(), items[i].relativePath.size() + 1);
+			order[i] = i;
+		}
+
+		std::sort(order.begin(), order.end(), BundleItemLess(entries));
+
+		Header_t header;
+		header.magic = kMagic;
+		header.version = kVersion;
+		header.entryCount = itemCount;
+		header.pathsSize = (uint32_t)paths.size();
+
+		uint32_t offset = AlignBundleOffset(sizeof(Header_t) + itemCount * sizeof(Entry_t) + header.pathsSize);
+		behaviac::vector<Entry_t> sorted(itemCount);
+
+		for (uint32_t i = 0; i < itemCount; ++i)
+		{
+			sorted[i] = entries[order[i]];
+			sorted[i].offset = offset;
+
+			offset = AlignBundleOffset(offset + sorted[i].size);
+		}
+
+		IFile* fp = CFileManager::GetInstance()->FileOpen(fullPath, CFileSystem::EOpenAccess_Write);
+
+		if (!fp)
+		{
+			return false;
+		}
+
+		const char kPadding[kAlignment] = { 0 };
+		uint32_t written = fp->Write(header);
+
+		if (itemCount > 0)
+		{
+			written += fp->Write(&sorted[0], itemCount * sizeof(Entry_t));
+		}
+
+		written += fp->Write(paths.c_str(), header.pathsSize);
+
+		for (uint32_t i = 0; i < itemCount; ++i)
+		{
+			const Entry_t& entry = sorted[i];
+
+			written += fp->Write(kPadding, entry.offset - written);
+			written += fp->Write(items[order[i]].data.c_str(), entry.size);
+		}
+
+		written += fp->Write(kPadding, offset - written);
+
+		CFileManager::GetInstance()->FileClose(fp);
+
+		return written == offset;
+	}
+}//namespace behaviac
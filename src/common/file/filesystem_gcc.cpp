@@ -38,6 +38,10 @@
 #if BEHAVIAC_CCDEFINE_ANDROID && (BEHAVIAC_CCDEFINE_ANDROID_VER > 8)
 #include <android/asset_manager.h>
 #else
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+
 static const char* openMode[] =
 {
 	"invalid",
@@ -226,6 +230,54 @@ namespace behaviac
 #endif
 	}
 
+	const void* CFileSystem::MapFile(const char* szFullPath, uint64_t& fileSize)
+	{
+#if BEHAVIAC_CCDEFINE_ANDROID && (BEHAVIAC_CCDEFINE_ANDROID_VER > 8)
+		//the assets are read by the asset manager
+		BEHAVIAC_UNUSED_VAR(szFullPath);
+		BEHAVIAC_UNUSED_VAR(fileSize);
+
+		return 0;
+#else
+		int fd = open(szFullPath, O_RDONLY);
+
+		if (fd < 0)
+		{
+			return 0;
+		}
+
+		void* pData = MAP_FAILED;
+		struct stat buf;
+
+		if (fstat(fd, &buf) == 0 && buf.st_size > 0)
+		{
+			pData = mmap(0, (size_t)buf.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		}
+
+		//the mapping keeps the file
+		close(fd);
+
+		if (pData == MAP_FAILED)
+		{
+			return 0;
+		}
+
+		fileSize = buf.st_size;
+
+		return pData;
+#endif
+	}
+
+	void CFileSystem::UnmapFile(const void* pData, uint64_t fileSize)
+	{
+#if BEHAVIAC_CCDEFINE_ANDROID && (BEHAVIAC_CCDEFINE_ANDROID_VER > 8)
+		BEHAVIAC_UNUSED_VAR(pData);
+		BEHAVIAC_UNUSED_VAR(fileSize);
+#else
+		munmap((void*)pData, (size_t)fileSize);
+#endif
+	}
+
 	bool CFileSystem::Move(const char* srcFullPath, const char* destFullPath)
 	{
 		BEHAVIAC_UNUSED_VAR(srcFullPath);
@@ -592,13 +644,86 @@ namespace behaviac
 	static bool s_bThreadFinish = true;
 	static pthread_t s_tid;
 	static behaviac::Mutex			s_mutex;
-	static behaviac::vector<behaviac::string> s_ModifiedFiles;
+	static behaviac::vector<CFileSystem::SModifiedFile> s_ModifiedFiles;
+
+	//the bigger files are not prefetched, they are read when they are reloaded
+	static const long kMaxPrefetchSize = 4 * 1024 * 1024;
+
+	static void PrefetchFile(const char* dir, CFileSystem::SModifiedFile& file)
+	{
+		std::string fullPath = dir;
+		fullPath += file.path.c_str();
+
+		FILE* fp = fopen(fullPath.c_str(), "rb");
+
+		if (fp == NULL)
+		{
+			return;
+		}
+
+		fseek(fp, 0, SEEK_END);
+		long size = ftell(fp);
+		fseek(fp, 0, SEEK_SET);
+
+		if (size > 0 && size <= kMaxPrefetchSize)
+		{
+			file.content.resize(size);
+
+			if (fread(&file.content[0], 1, size, fp) != (size_t)size)
+			{
+				file.content.clear();
+			}
+		}
+
+		fclose(fp);
+	}
+
+	//the files are read after a burst of events is over, so that the main thread doesn't need to read them
+	static void PublishModifiedFiles(const char* dir, behaviac::vector<behaviac::string>& pendingFiles)
+	{
+		std::sort(pendingFiles.begin(), pendingFiles.end());
+		pendingFiles.erase(std::unique(pendingFiles.begin(), pendingFiles.end()), pendingFiles.end());
+
+		behaviac::vector<CFileSystem::SModifiedFile> files(pendingFiles.size());
+
+		for (size_t i = 0; i < pendingFiles.size(); ++i)
+		{
+			files[i].path = pendingFiles[i];
+			PrefetchFile(dir, files[i]);
+		}
+
+		behaviac::ScopedLock lock(s_mutex);
+
+		for (size_t i = 0; i < files.size(); ++i)
+		{
+			bool bFound = false;
+
+			//the newer content replaces the one not taken yet
+			for (size_t j = 0; j < s_ModifiedFiles.size(); ++j)
+			{
+				if (s_ModifiedFiles[j].path == files[i].path)
+				{
+					s_ModifiedFiles[j].content.swap(files[i].content);
+					bFound = true;
+					break;
+				}
+			}
+
+			if (!bFound)
+			{
+				s_ModifiedFiles.push_back(CFileSystem::SModifiedFile());
+				s_ModifiedFiles.back().path.swap(files[i].path);
+				s_ModifiedFiles.back().content.swap(files[i].content);
+			}
+		}
+	}
+
 	static void* ThreadFunc(void* arg)
 	{
-		bool isLock = false;
 		const char* path = (char*)arg;
 		InotifyDir inotify;
 		InotifyDir::Event ev;
+		behaviac::vector<behaviac::string> pendingFiles;
 
 		inotify.init();
 		inotify.Watch(path);
@@ -607,35 +732,23 @@ namespace behaviac
 		{
 			if (!inotify.EventPoll(ev))
 			{
-				if (isLock)
+				if (!pendingFiles.empty())
 				{
-					isLock = false;
-					s_mutex.Unlock();
+					PublishModifiedFiles(path, pendingFiles);
+					pendingFiles.clear();
 				}
 
 				usleep(100);
 				continue;
 			}
 
-			if (!isLock)
-			{
-				isLock = true;
-				s_mutex.Lock();
-			}
-
 			if (ev.type == InotifyDir::MODIFY || ev.type == InotifyDir::ADD)
 			{
 				ev.name.erase(0, strlen(path));
-				s_ModifiedFiles.push_back(ev.name.c_str());
+				pendingFiles.push_back(ev.name.c_str());
 			}
 		}
 
-		if (isLock)
-		{
-			isLock = false;
-			s_mutex.Unlock();
-		}
-
 		return NULL;
 	}
 #endif
@@ -696,18 +809,31 @@ namespace behaviac
 		}
 
 		behaviac::ScopedLock lock(s_mutex);
-		std::sort(s_ModifiedFiles.begin(), s_ModifiedFiles.end());
-		s_ModifiedFiles.erase(std::unique(s_ModifiedFiles.begin(), s_ModifiedFiles.end()), s_ModifiedFiles.end());
 
-		s_ModifiedFiles.swap(modifiedFiles);
-		//for (behaviac::vector<behaviac::string>::iterator it = s_ModifiedFiles.begin(); it != s_ModifiedFiles.end(); ++it)
-		//{
-		//	behaviac::string& s = *it;
+		for (behaviac::vector<SModifiedFile>::iterator it = s_ModifiedFiles.begin(); it != s_ModifiedFiles.end(); ++it)
+		{
+			modifiedFiles.push_back(it->path);
+		}
+
+		s_ModifiedFiles.clear();
 
-		//	modifiedFiles.push_back(s);
-		//}    
+		std::sort(modifiedFiles.begin(), modifiedFiles.end());
+#endif
+	}
 
-		//s_ModifiedFiles.clear();
+	void CFileSystem::GetModifiedFiles(behaviac::vector<SModifiedFile>& modifiedFiles)
+	{
+		BEHAVIAC_UNUSED_VAR(modifiedFiles);
+#if BEHAVIAC_CCDEFINE_GCC_LINUX
+		modifiedFiles.clear();
+
+		if (s_ModifiedFiles.empty())
+		{
+			return;
+		}
+
+		behaviac::ScopedLock lock(s_mutex);
+		s_ModifiedFiles.swap(modifiedFiles);
 #endif
 	}
 
@@ -193,6 +193,48 @@ namespace behaviac
 		return sizeOfFile.QuadPart;
 	}
 
+	const void* CFileSystem::MapFile(const char* szFullPath, uint64_t& fileSize)
+	{
+		HANDLE hFile = ::CreateFileW(STRING2WSTRING(szFullPath).c_str(), GENERIC_READ, FILE_SHARE_READ, 0, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, 0);
+
+		if (hFile == INVALID_HANDLE_VALUE)
+		{
+			return 0;
+		}
+
+		const void* pData = 0;
+		LARGE_INTEGER sizeOfFile;
+		sizeOfFile.QuadPart = 0ll;
+
+		if (::GetFileSizeEx(hFile, &sizeOfFile) && sizeOfFile.QuadPart > 0)
+		{
+			HANDLE hMapping = ::CreateFileMappingW(hFile, 0, PAGE_READONLY, 0, 0, 0);
+
+			if (hMapping)
+			{
+				//the view keeps the mapping
+				pData = ::MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, 0);
+				::CloseHandle(hMapping);
+			}
+		}
+
+		::CloseHandle(hFile);
+
+		if (pData)
+		{
+			fileSize = sizeOfFile.QuadPart;
+		}
+
+		return pData;
+	}
+
+	void CFileSystem::UnmapFile(const void* pData, uint64_t fileSize)
+	{
+		BEHAVIAC_UNUSED_VAR(fileSize);
+
+		::UnmapViewOfFile(pData);
+	}
+
 	bool CFileSystem::Move(const char* srcFullPath, const char* destFullPath)
 	{
 		return !!::MoveFileW(STRING2WSTRING(srcFullPath).c_str(), STRING2WSTRING(destFullPath).c_str());
@@ -884,6 +926,21 @@ namespace behaviac
 			s_ModifiedFiles.clear();
 		}
 	}
+
+	void CFileSystem::GetModifiedFiles(behaviac::vector<SModifiedFile>& modifiedFiles)
+	{
+		//the content is not prefetched, it is read when the file is reloaded
+		behaviac::vector<behaviac::string> files;
+		GetModifiedFiles(files);
+
+		modifiedFiles.resize(files.size());
+
+		for (size_t i = 0; i < files.size(); ++i)
+		{
+			modifiedFiles[i].path.swap(files[i]);
+			modifiedFiles[i].content.clear();
+		}
+	}
 #endif //BEHAVIAC_ENABLE_HOTRELOAD
 }//namespace behaviac
 
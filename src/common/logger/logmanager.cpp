@@ -17,6 +17,7 @@
 #include "behaviac/property/property_t.h"
 #include "behaviac/common/socket/socketconnect.h"
 #include "behaviac/common/thread/mutex_lock.h"
+#include "behaviac/common/container/mpscring.h"
 
 #include "behaviac/common/profiler/profiler.h"
 
@@ -26,22 +27,51 @@
 
 namespace behaviac
 {
+    //the messages queued, the threads logging only wait for each other when it is full
+    static const uint32_t kLogRingSize = 1024 * 256;
+
+    class LogRing : public MPSCRing<kLogRingSize>
+    {
+    };
+
+    //a longer message is written at once instead of being queued, it might not find its place in the ring
+    static const uint32_t kMaxQueuedSize = kLogRingSize / 4;
+
+    //how often the background thread writes the messages queued
+    static const long kFlushInterval = 10;
+
+    //the files are written in large blocks
+    static const size_t kFileBufferSize = 1024 * 64;
+
     LogManager* LogManager::ms_instance = 0;
 
-    LogManager::LogManager() : m_logFilePath(0)
+    LogManager::LogManager() : m_shardCount(0), m_segmentSize(0), m_logFilePath(0), m_ring(0), m_flushThread(0), m_terminating(0), m_lastTime(-1)
     {
         BEHAVIAC_ASSERT(ms_instance == NULL);
         ms_instance = this;
+
+        m_timeStr[0] = '\0';
     }
 
     LogManager::~LogManager()
     {
-        for (Logs_t::iterator it = this->m_logs.begin(); it != this->m_logs.end(); ++it)
+        if (this->m_flushThread)
+        {
+            AtomicInc(this->m_terminating);
+            thread::StopThread(this->m_flushThread);
+            this->m_flushThread = 0;
+        }
+
+        if (this->m_ring)
         {
-            FILE* fp = it->second;
-            fclose(fp);
+            this->WriteRecords(true);
         }
 
+        this->CloseFiles();
+
+        BEHAVIAC_DELETE(this->m_ring);
+        this->m_ring = 0;
+
         ms_instance = 0;
     }
 
@@ -65,91 +95,244 @@ namespace behaviac
 
     void LogManager::SetLogFilePath(const char* logFilePath)
     {
+        behaviac::ScopedLock lock(this->m_mutex);
+
         m_logFilePath = logFilePath;
     }
 
-    FILE* LogManager::GetFile(const behaviac::Agent* pAgent)
+    void LogManager::SetLogShards(int shardCount, uint32_t segmentSize)
     {
-        if (Config::IsLogging())
+        BEHAVIAC_ASSERT(shardCount >= 0);
+
+        //the messages queued are written as they are logged
+        if (this->m_ring)
+        {
+            this->WriteRecords(true);
+        }
+
+        behaviac::ScopedLock lock(this->m_mutex);
+
+        this->CloseFiles();
+
+        this->m_shardCount = shardCount;
+        this->m_segmentSize = segmentSize;
+    }
+
+    FILE* LogManager::GetFile(int shard)
+    {
+        if (this->m_shards.size() == 0)
         {
-            BEHAVIAC_UNUSED_VAR(pAgent);
+            Shard_t s = { 0, 0, 0 };
+            this->m_shards.resize(this->m_shardCount > 0 ? this->m_shardCount : 1, s);
+        }
 
-            FILE* fp = 0;
-            //int agentId = pAgent->GetId();
-            int agentId = -1;
+        Shard_t& s = this->m_shards[shard];
 
-            Logs_t::iterator it = this->m_logs.find(agentId);
+        if (s.fp == 0)
+        {
+            const char* pLogFile = (m_logFilePath != 0) ? m_logFilePath : "_behaviac_$_.log";
 
-            if (it == this->m_logs.end())
+            if (this->m_shardCount == 0)
+            {
+                s.fp = fopen(pLogFile, "wt");
+            }
+            else
             {
-                const char* pLogFile = 0;
-                char buffer[64];
+                char fileName[1024];
+                string_snprintf(fileName, sizeof(fileName), "%s.%d.%03u", pLogFile, shard, s.segment);
 
-                if (m_logFilePath == 0)
-                {
-                    if (agentId == -1)
-                    {
-                        string_snprintf(buffer, 64, "_behaviac_$_.log");
-                    }
-                    else
-                    {
-                        string_sprintf(buffer, "Agent_$_%03d.log", agentId);
-                    }
+                s.fp = fopen(fileName, "wb");
 
-                    pLogFile = buffer;
-                }
-                else
+                if (s.fp)
                 {
-                    pLogFile = m_logFilePath;
+                    LogSegmentHeader header = { LogSegmentHeader::kMagic, LogSegmentHeader::kVersion, (uint32_t)shard, s.segment };
+                    fwrite(&header, sizeof(header), 1, s.fp);
+                    s.size = sizeof(header);
                 }
+            }
 
-                fp = fopen(pLogFile, "wt");
-                this->m_logs[agentId] = fp;
+            if (s.fp)
+            {
+                setvbuf(s.fp, 0, _IOFBF, kFileBufferSize);
             }
-            else
+        }
+
+        return s.fp;
+    }
+
+    void LogManager::CloseFiles()
+    {
+        for (unsigned int i = 0; i < this->m_shards.size(); ++i)
+        {
+            if (this->m_shards[i].fp)
             {
-                fp = it->second;
+                fclose(this->m_shards[i].fp);
             }
+        }
+
+        this->m_shards.clear();
+    }
+
+    unsigned int BEHAVIAC_STDCALL LogManager::FlushThread(void* arg)
+    {
+        LogManager* pLogManager = (LogManager*)arg;
+
+        while (Load_Acquire(pLogManager->m_terminating) == 0)
+        {
+            behaviac::thread::Sleep(kFlushInterval);
 
-            return fp;
+            pLogManager->WriteRecords(Config::IsLoggingFlush());
         }
 
         return 0;
     }
 
-    void LogManager::Output(const behaviac::Agent* pAgent, const char* msg)
+    LogRing* LogManager::StartFlushThread()
     {
-        if (Config::IsLogging())
+        behaviac::ScopedLock lock(this->m_mutex);
+
+        if (this->m_ring == 0)
         {
-            FILE* fp = this->GetFile(pAgent);
+            //it is read by Output without locking, it is only published once it is constructed
+            Store_Release(this->m_ring, BEHAVIAC_NEW LogRing);
+            this->m_flushThread = thread::CreateAndStartThread(&LogManager::FlushThread, this, 16 * 1024);
+        }
+
+        return this->m_ring;
+    }
+
+    void LogManager::WriteRecords(bool bFlush)
+    {
+        behaviac::ScopedLock lock(this->m_mutex);
 
-            char szTime[64];
+        this->WriteQueuedRecords();
 
-            time_t tTime = time(NULL);
+        if (bFlush)
+        {
+            for (unsigned int i = 0; i < this->m_shards.size(); ++i)
+            {
+                if (this->m_shards[i].fp)
+                {
+                    fflush(this->m_shards[i].fp);
+                }
+            }
+        }
+    }
+
+    void LogManager::WriteQueuedRecords()
+    {
+        uint32_t readIndex = this->m_ring->GetReadIndex();
+
+        while (LogRing::Record* pRecord = this->m_ring->Read(readIndex))
+        {
+            const uint8_t* pData = pRecord->GetData();
+            int64_t loggedTime = 0;
+            memcpy(&loggedTime, pData, sizeof(loggedTime));
+
+            this->WriteRecord((int32_t)pRecord->tag, loggedTime, (const char*)pData + sizeof(loggedTime), pRecord->dataSize - sizeof(loggedTime));
+        }
+
+        this->m_ring->Release(readIndex);
+    }
+
+    void LogManager::WriteRecord(int agentId, int64_t loggedTime, const char* text, uint32_t length)
+    {
+        if (loggedTime != this->m_lastTime)
+        {
+            time_t tTime = (time_t)loggedTime;
             tm* ptmCurrent = localtime(&tTime);
 
-            string_snprintf(szTime, sizeof(szTime) - 1,
-                "%.2d:%.2d:%.2d",
+            string_snprintf(this->m_timeStr, sizeof(this->m_timeStr) - 1,
+                "[%.2d:%.2d:%.2d]",
                 ptmCurrent->tm_hour, ptmCurrent->tm_min, ptmCurrent->tm_sec);
 
-            //behaviac::string buffer = string_sprintf("[%s]%s\n", szTime, msg);
-            char buffer[1024];
-            string_sprintf(buffer, "[%s]%s", szTime, msg);
+            this->m_lastTime = loggedTime;
+        }
+
+        const uint32_t timeLength = (uint32_t)strlen(this->m_timeStr);
 
-            //printf(buffer.c_str());
+        if (this->m_shardCount == 0)
+        {
+            FILE* fp = this->GetFile(0);
 
             if (fp)
             {
-                behaviac::Mutex cs;
-                behaviac::ScopedLock lock(cs);
+                fwrite(this->m_timeStr, 1, timeLength, fp);
+                fwrite(text, 1, length, fp);
+            }
+        }
+        else
+        {
+            //the records not logged by an agent are in a shard as well
+            const int shard = (int)((uint32_t)agentId % (uint32_t)this->m_shardCount);
+            LogRecordHeader header = { agentId, timeLength + length };
+            const uint32_t bytes = sizeof(header) + header.size;
 
-                fwrite(buffer, 1, strlen(buffer), fp);
+            if (this->m_shards.size() > 0)
+            {
+                Shard_t& s = this->m_shards[shard];
 
-                if (behaviac::Config::IsLoggingFlush())
+                if (s.fp && this->m_segmentSize > 0 && s.size + bytes > this->m_segmentSize && s.size > sizeof(LogSegmentHeader))
                 {
-                    fflush(fp);
+                    fclose(s.fp);
+                    s.fp = 0;
+                    s.segment++;
                 }
             }
+
+            FILE* fp = this->GetFile(shard);
+
+            if (fp)
+            {
+                fwrite(&header, sizeof(header), 1, fp);
+                fwrite(this->m_timeStr, 1, timeLength, fp);
+                fwrite(text, 1, length, fp);
+
+                this->m_shards[shard].size += bytes;
+            }
+        }
+    }
+
+    void LogManager::Output(const behaviac::Agent* pAgent, const char* msg)
+    {
+        if (Config::IsLogging())
+        {
+            LogRing* pRing = Load_Acquire(this->m_ring);
+
+            if (pRing == 0)
+            {
+                pRing = this->StartFlushThread();
+            }
+
+            const int agentId = pAgent ? pAgent->GetId() : -1;
+            const int64_t now = (int64_t)time(NULL);
+            const uint32_t length = (uint32_t)strlen(msg);
+
+            if (sizeof(now) + length > kMaxQueuedSize)
+            {
+                //after the messages queued before it
+                behaviac::ScopedLock lock(this->m_mutex);
+
+                this->WriteQueuedRecords();
+                this->WriteRecord(agentId, now, msg, length);
+
+                return;
+            }
+
+            uint8_t* pData = pRing->Reserve(sizeof(now) + length, (uint32_t)agentId);
+
+            //it is full, the messages queued are written by this thread then
+            while (pData == 0)
+            {
+                this->WriteRecords(false);
+
+                pData = pRing->Reserve(sizeof(now) + length, (uint32_t)agentId);
+            }
+
+            memcpy(pData, &now, sizeof(now));
+            memcpy(pData + sizeof(now), msg, length);
+
+            pRing->Commit(pData);
         }
     }
 
@@ -167,7 +350,10 @@ namespace behaviac
 
             if (pAgent && pAgent->IsMasked())
             {
-                if (btMsg)
+                const uint32_t kind = (mode == behaviac::ELM_breaked || mode == behaviac::ELM_continue) ? MessageKind::MSGKIND_BREAKPOINT : MessageKind::MSGKIND_TICK;
+                const uint32_t clients = Socket::GetSubscribers(pAgent, kind);
+
+                if (btMsg && (clients != 0 || Config::IsLogging()))
                 {
                     const char* agentClassName = pAgent->GetObjectTypeName();
                     behaviac::string agentName(agentClassName);
@@ -209,7 +395,7 @@ namespace behaviac
                         string_sprintf(buffer, "[continue]%s %s [%s] [%d]\n", agentName.c_str(), btMsg, actionResultStr, count);
 
                         this->Output(pAgent, buffer);
-                        Socket::SendText(buffer);
+                        Socket::SendText(buffer, clients);
                     }
                     else if (mode == behaviac::ELM_breaked)
                     {
@@ -220,7 +406,7 @@ namespace behaviac
                         string_sprintf(buffer, "[breaked]%s %s [%s] [%d]\n", agentName.c_str(), btMsg, actionResultStr, count);
 
                         this->Output(pAgent, buffer);
-                        Socket::SendText(buffer);
+                        Socket::SendText(buffer, clients);
                     }
                     else if (mode == behaviac::ELM_tick)
                     {
@@ -234,7 +420,7 @@ namespace behaviac
                         string_sprintf(buffer, "[tick]%s %s [%s] [%d]\n", agentName.c_str(), btMsg, actionResultStr, count);
 
                         this->Output(pAgent, buffer);
-                        Socket::SendText(buffer);
+                        Socket::SendText(buffer, clients);
                     }
                     else if (mode == behaviac::ELM_jump)
                     {
@@ -242,7 +428,7 @@ namespace behaviac
                         string_sprintf(buffer, "[jump]%s %s\n", agentName.c_str(), btMsg);
 
                         this->Output(pAgent, buffer);
-                        Socket::SendText(buffer);
+                        Socket::SendText(buffer, clients);
                     }
                     else if (mode == behaviac::ELM_return)
                     {
@@ -250,7 +436,7 @@ namespace behaviac
                         string_sprintf(buffer, "[return]%s %s\n", agentName.c_str(), btMsg);
 
                         this->Output(pAgent, buffer);
-                        Socket::SendText(buffer);
+                        Socket::SendText(buffer, clients);
                     }
                     else
                     {
@@ -272,7 +458,9 @@ namespace behaviac
         {
             //BEHAVIAC_PROFILE("LogManager::LogVar");
 
-            if (pAgent && pAgent->IsMasked())
+            const uint32_t clients = Socket::GetSubscribers(pAgent, MessageKind::MSGKIND_PROPERTY);
+
+            if (pAgent && pAgent->IsMasked() && (clients != 0 || Config::IsLogging()))
             {
                 const char* agentClassName = pAgent->GetObjectTypeName();
                 const behaviac::string agentInstanceName = pAgent->GetName();
@@ -326,7 +514,7 @@ namespace behaviac
                 {
                     this->Output(pAgent, buffer);
                 }
-                Socket::SendText(buffer);
+                Socket::SendText(buffer, clients);
             }
         }
     }
@@ -371,7 +559,9 @@ namespace behaviac
 
     void LogManager::Log(behaviac::LogMode mode, const char* filterString, const char* format, ...)
     {
-        if (Config::IsLoggingOrSocketing())
+        const uint32_t clients = Socket::GetSubscribers(0, MessageKind::MSGKIND_LOG);
+
+        if (clients != 0 || Config::IsLogging())
         {
             //BEHAVIAC_PROFILE("LogManager::LogMode");
 
@@ -414,7 +604,7 @@ namespace behaviac
             }
 
             this->Output(0, target);
-            Socket::SendText(target);
+            Socket::SendText(target, clients);
         }
     }
 
@@ -426,7 +616,9 @@ namespace behaviac
             {
                 //BEHAVIAC_PROFILE("LogManager::LogProfiler");
 
-                if (pAgent && pAgent->IsMasked())
+                const uint32_t clients = Socket::GetSubscribers(pAgent, MessageKind::MSGKIND_PROFILER);
+
+                if (pAgent && pAgent->IsMasked() && (clients != 0 || Config::IsLogging()))
                 {
                     //const char* agentClassName = pAgent->GetObjectTypeName();
                     //const behaviac::string agentInstanceName = pAgent->GetName();
@@ -451,7 +643,7 @@ namespace behaviac
                     string_sprintf(buffer, "[profiler]%s.xml->%s %ld\n", btName.c_str(), btMsg, time);
 
                     this->Output(pAgent, buffer);
-                    Socket::SendText(buffer);
+                    Socket::SendText(buffer, clients);
                 }
             }
         }
@@ -477,17 +669,11 @@ namespace behaviac
 
     void LogManager::Flush(const behaviac::Agent* pAgent)
     {
-        if (Config::IsLogging())
-        {
-            FILE* fp = this->GetFile(pAgent);
-
-            if (fp)
-            {
-                behaviac::Mutex cs;
-                behaviac::ScopedLock lock(cs);
+        BEHAVIAC_UNUSED_VAR(pAgent);
 
-                fflush(fp);
-            }
+        if (Config::IsLogging() && this->m_ring)
+        {
+            this->WriteRecords(true);
         }
     }
 
@@ -0,0 +1,935 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Tencent is pleased to support the open source community by making behaviac available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except in compliance with
+// the License. You may obtain a copy of the License at http://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and limitations under the License.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "behaviac/common/config.h"
+#include "behaviac/common/memory/slaballocator.h"
+#include "behaviac/common/thread/wrapper.h"
+
+#include <string.h>
+
+#if BEHAVIAC_CCDEFINE_MSVC
+#include <windows.h>
+#define BEHAVIAC_SLAB_THREAD_LOCAL	__declspec(thread)
+#else
+#include <sys/mman.h>
+#include <pthread.h>
+#define BEHAVIAC_SLAB_THREAD_LOCAL	__thread
+#endif//BEHAVIAC_CCDEFINE_MSVC
+
+namespace behaviac
+{
+	// every block is preceded by a header of kAlignment bytes:
+	// the magic and the size class in the first word, for the large ones the offset to the start of the system block and the size
+	struct SlabBlockHeader
+	{
+		uint32_t	tag;
+		uint32_t	offset;
+		uint64_t	size;
+	};
+
+	static const uint32_t kSlabHeaderMagic = 0x5AB00000;
+	static const uint32_t kSlabHeaderMagicMask = 0xFFFF0000;
+	static const uint32_t kSlabLargeClass = 0x0000FFFF;
+	static const uint32_t kSlabHeaderSize = sizeof(SlabBlockHeader);
+
+	BEHAVIAC_STATIC_ASSERT(sizeof(SlabBlockHeader) == MemSlabAllocator::kAlignment);
+
+	// the address space reserved for the slabs, it is only committed slab by slab
+	static const size_t kSlabArenaSize = sizeof(void*) == 8 ? (size_t)1024 * 1024 * 1024 : (size_t)64 * 1024 * 1024;
+
+	// the payload sizes, multiples of kAlignment. BehaviorTask/LeafTask/map nodes are 48 bytes, CVariable<T> 32-56,
+	// CompositeTask 88, AgentState 96, BehaviorTreeTask 112 and the nodes themselves ~200 on 64 bits
+	static const uint32_t kSlabClassSizes[MemSlabAllocator::kSizeClassCount] =
+	{
+		16, 32, 48, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320, 384, 448, 512
+	};
+
+	class SlabSizeClassLookup
+	{
+		uint8_t m_classes[MemSlabAllocator::kMaxSmallSize / MemSlabAllocator::kAlignment + 1];
+
+	public:
+		SlabSizeClassLookup()
+		{
+			uint32_t sizeClass = 0;
+
+			for (uint32_t i = 0; i < sizeof(m_classes); ++i)
+			{
+				while (kSlabClassSizes[sizeClass] < i * MemSlabAllocator::kAlignment)
+				{
+					sizeClass++;
+				}
+
+				m_classes[i] = (uint8_t)sizeClass;
+			}
+		}
+
+		uint32_t GetSizeClass(size_t size) const
+		{
+			BEHAVIAC_ASSERT(size <= MemSlabAllocator::kMaxSmallSize);
+
+			return m_classes[(size + MemSlabAllocator::kAlignment - 1) / MemSlabAllocator::kAlignment];
+		}
+	};
+
+	static const SlabSizeClassLookup gs_slabSizeClassLookup;
+
+	struct MemSlabAllocator::Depot
+	{
+		Mutex		lock;
+		void*		freeList;
+		uint32_t	slabCount;
+		uint32_t	stride;
+
+		Depot() : freeList(0), slabCount(0), stride(0)
+		{}
+	};
+
+	struct MemSlabAllocator::Counters
+	{
+		uint64_t		allocCount[kSizeClassCount];
+		uint64_t		freeCount[kSizeClassCount];
+		uint64_t		largeAllocCount;
+		uint64_t		largeFreeCount;
+		uint64_t		largeAllocatedBytes;
+		uint64_t		largeFreedBytes;
+
+		void Add(const Counters& other)
+		{
+			for (uint32_t i = 0; i < kSizeClassCount; ++i)
+			{
+				allocCount[i] += other.allocCount[i];
+				freeCount[i] += other.freeCount[i];
+			}
+
+			largeAllocCount += other.largeAllocCount;
+			largeFreeCount += other.largeFreeCount;
+			largeAllocatedBytes += other.largeAllocatedBytes;
+			largeFreedBytes += other.largeFreedBytes;
+		}
+	};
+
+	struct MemSlabAllocator::ThreadCache
+	{
+		ThreadCache*		next;
+		MemSlabAllocator*	owner;
+		uint32_t			counts[kSizeClassCount];
+		void*				blocks[kSizeClassCount][kMagazineSize];
+
+		Counters			counters;
+	};
+
+	// the large blocks by their addresses in an open addressing table, a pointer not in it comes from the system heap
+	struct MemSlabAllocator::LargeBlocks
+	{
+		void**		slots;
+		uint32_t	capacity;
+		uint32_t	count;
+
+		LargeBlocks() : slots(0), capacity(0), count(0)
+		{}
+
+		~LargeBlocks()
+		{
+			free(slots);
+		}
+
+		static uint32_t Hash(const void* pData)
+		{
+			uint64_t v = (uint64_t)(size_t)pData >> 4;
+
+			return (uint32_t)((v ^ (v >> 29)) * 0x9E3779B97F4A7C15ULL >> 32);
+		}
+
+		bool Add(void* pData)
+		{
+			if ((count + 1) * 2 > capacity)
+			{
+				uint32_t newCapacity = capacity ? capacity * 2 : 64;
+				void** newSlots = (void**)calloc(newCapacity, sizeof(void*));
+
+				if (!newSlots)
+				{
+					return false;
+				}
+
+				void** oldSlots = slots;
+				uint32_t oldCapacity = capacity;
+
+				slots = newSlots;
+				capacity = newCapacity;
+				count = 0;
+
+				for (uint32_t i = 0; i < oldCapacity; ++i)
+				{
+					if (oldSlots[i])
+					{
+						this->Add(oldSlots[i]);
+					}
+				}
+
+				free(oldSlots);
+			}
+
+			const uint32_t mask = capacity - 1;
+			uint32_t i = Hash(pData) & mask;
+
+			while (slots[i])
+			{
+				i = (i + 1) & mask;
+			}
+
+			slots[i] = pData;
+			count++;
+
+			return true;
+		}
+
+		bool Remove(const void* pData)
+		{
+			if (count == 0)
+			{
+				return false;
+			}
+
+			const uint32_t mask = capacity - 1;
+			uint32_t i = Hash(pData) & mask;
+
+			while (slots[i] != pData)
+			{
+				if (!slots[i])
+				{
+					return false;
+				}
+
+				i = (i + 1) & mask;
+			}
+
+			slots[i] = 0;
+			count--;
+
+			// move the following ones back so that the probe sequences stay unbroken
+			for (uint32_t j = (i + 1) & mask; slots[j]; j = (j + 1) & mask)
+			{
+				uint32_t home = Hash(slots[j]) & mask;
+
+				// the slot stays if its home is cyclically in (i, j]
+				bool bStays = i <= j ? (home > i && home <= j) : (home > i || home <= j);
+
+				if (!bStays)
+				{
+					slots[i] = slots[j];
+					slots[j] = 0;
+					i = j;
+				}
+			}
+
+			return true;
+		}
+	};
+
+	static BEHAVIAC_SLAB_THREAD_LOCAL MemSlabAllocator::ThreadCache*	t_slabThreadCache;
+	static BEHAVIAC_SLAB_THREAD_LOCAL uint32_t						t_slabThreadCacheOwner;
+
+	static volatile Atomic32 gs_slabAllocatorIds;
+
+	static BEHAVIAC_FORCEINLINE SlabBlockHeader* GetSlabBlockHeader(const void* pData)
+	{
+		return (SlabBlockHeader*)((char*)pData - kSlabHeaderSize);
+	}
+
+#if BEHAVIAC_CCDEFINE_MSVC
+	static void WINAPI OnSlabThreadExit(void* pData)
+#else
+	static void OnSlabThreadExit(void* pData)
+#endif//BEHAVIAC_CCDEFINE_MSVC
+	{
+		if (pData)
+		{
+			MemSlabAllocator::ThreadCache* pCache = (MemSlabAllocator::ThreadCache*)pData;
+			pCache->owner->ReleaseThreadCache(pCache);
+		}
+	}
+
+	MemSlabAllocator::MemSlabAllocator() : m_id(0), m_depots(0), m_threadCaches(0), m_retiredCounters(0), m_threadExitKey(0),
+		m_arena(0), m_arenaSize(0), m_arenaCommitted(0), m_largeBlocks(0)
+	{
+		m_id = (uint32_t)AtomicInc(gs_slabAllocatorIds);
+
+		m_depots = new Depot[kSizeClassCount];
+
+		for (uint32_t i = 0; i < kSizeClassCount; ++i)
+		{
+			m_depots[i].stride = kSlabClassSizes[i] + kSlabHeaderSize;
+		}
+
+		m_retiredCounters = (Counters*)calloc(1, sizeof(Counters));
+		m_largeBlocks = new LargeBlocks;
+
+#if BEHAVIAC_CCDEFINE_MSVC
+		m_threadExitKey = FlsAlloc(&OnSlabThreadExit);
+
+		void* pArena = VirtualAlloc(0, kSlabArenaSize, MEM_RESERVE, PAGE_NOACCESS);
+
+		if (pArena)
+		{
+			m_arena = (char*)pArena;
+			m_arenaSize = kSlabArenaSize;
+		}
+
+#else
+		pthread_key_t key;
+
+		if (pthread_key_create(&key, &OnSlabThreadExit) == 0)
+		{
+			m_threadExitKey = (size_t)key + 1;
+		}
+
+		void* pArena = mmap(0, kSlabArenaSize, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+		if (pArena != MAP_FAILED)
+		{
+			m_arena = (char*)pArena;
+			m_arenaSize = kSlabArenaSize;
+		}
+
+#endif//BEHAVIAC_CCDEFINE_MSVC
+	}
+
+	MemSlabAllocator::~MemSlabAllocator()
+	{
+		// the callbacks of the threads still running are not called any more
+#if BEHAVIAC_CCDEFINE_MSVC
+
+		if (m_threadExitKey != FLS_OUT_OF_INDEXES)
+		{
+			if (t_slabThreadCacheOwner == m_id)
+			{
+				FlsSetValue((DWORD)m_threadExitKey, 0);
+			}
+
+			FlsFree((DWORD)m_threadExitKey);
+		}
+
+		if (m_arena)
+		{
+			VirtualFree(m_arena, 0, MEM_RELEASE);
+		}
+
+#else
+
+		if (m_threadExitKey != 0)
+		{
+			pthread_key_delete((pthread_key_t)(m_threadExitKey - 1));
+		}
+
+		if (m_arena)
+		{
+			munmap(m_arena, m_arenaSize);
+		}
+
+#endif//BEHAVIAC_CCDEFINE_MSVC
+
+		m_arena = 0;
+		m_arenaSize = 0;
+
+		for (uint32_t i = 0; i < m_largeBlocks->capacity; ++i)
+		{
+			void* pData = m_largeBlocks->slots[i];
+
+			if (pData)
+			{
+				free((char*)pData - GetSlabBlockHeader(pData)->offset);
+			}
+		}
+
+		delete m_largeBlocks;
+		m_largeBlocks = 0;
+
+		delete[] m_depots;
+		m_depots = 0;
+
+		ThreadCache* pCache = m_threadCaches;
+
+		while (pCache)
+		{
+			ThreadCache* pNext = pCache->next;
+			free(pCache);
+			pCache = pNext;
+		}
+
+		m_threadCaches = 0;
+
+		free(m_retiredCounters);
+		m_retiredCounters = 0;
+
+		if (t_slabThreadCacheOwner == m_id)
+		{
+			t_slabThreadCache = 0;
+			t_slabThreadCacheOwner = 0;
+		}
+	}
+
+	size_t MemSlabAllocator::GetMaxAllocationSize(void) const
+	{
+		return size_t(-1);
+	}
+
+	size_t MemSlabAllocator::GetAllocatedSize() const
+	{
+		Stats stats;
+		this->GetStats(stats);
+
+		return stats.allocatedBytes;
+	}
+
+	MemSlabAllocator::ThreadCache* MemSlabAllocator::GetThreadCache()
+	{
+		if (t_slabThreadCacheOwner == m_id)
+		{
+			return t_slabThreadCache;
+		}
+
+		return this->CreateThreadCache();
+	}
+
+	MemSlabAllocator::ThreadCache* MemSlabAllocator::CreateThreadCache()
+	{
+		ThreadCache* pCache = (ThreadCache*)malloc(sizeof(ThreadCache));
+		BEHAVIAC_ASSERT(pCache);
+
+		if (!pCache)
+		{
+			return 0;
+		}
+
+		memset(pCache, 0, sizeof(ThreadCache));
+		pCache->owner = this;
+
+		{
+			ScopedLock lock(m_threadCachesLock);
+
+			pCache->next = m_threadCaches;
+			m_threadCaches = pCache;
+		}
+
+		t_slabThreadCache = pCache;
+		t_slabThreadCacheOwner = m_id;
+
+		// to be released when the thread exits
+#if BEHAVIAC_CCDEFINE_MSVC
+
+		if (m_threadExitKey != FLS_OUT_OF_INDEXES)
+		{
+			FlsSetValue((DWORD)m_threadExitKey, pCache);
+		}
+
+#else
+
+		if (m_threadExitKey != 0)
+		{
+			pthread_setspecific((pthread_key_t)(m_threadExitKey - 1), pCache);
+		}
+
+#endif//BEHAVIAC_CCDEFINE_MSVC
+
+		return pCache;
+	}
+
+	void MemSlabAllocator::ReleaseThreadCache(ThreadCache* pCache)
+	{
+		for (uint32_t i = 0; i < kSizeClassCount; ++i)
+		{
+			this->Flush(pCache, i, pCache->counts[i]);
+		}
+
+		{
+			ScopedLock lock(m_threadCachesLock);
+
+			for (ThreadCache** ppCache = &m_threadCaches; *ppCache; ppCache = &(*ppCache)->next)
+			{
+				if (*ppCache == pCache)
+				{
+					*ppCache = pCache->next;
+					break;
+				}
+			}
+
+			m_retiredCounters->Add(pCache->counters);
+		}
+
+		// the destructors of the other thread locals might still allocate, they get a new cache
+		if (t_slabThreadCache == pCache)
+		{
+			t_slabThreadCache = 0;
+			t_slabThreadCacheOwner = 0;
+		}
+
+		free(pCache);
+	}
+
+	char* MemSlabAllocator::CommitSlab()
+	{
+		ScopedLock lock(m_arenaLock);
+
+		if (m_arenaCommitted + kSlabSize > m_arenaSize)
+		{
+			return 0;
+		}
+
+		char* pSlab = m_arena + m_arenaCommitted;
+
+#if BEHAVIAC_CCDEFINE_MSVC
+
+		if (!VirtualAlloc(pSlab, kSlabSize, MEM_COMMIT, PAGE_READWRITE))
+		{
+			return 0;
+		}
+
+#else
+
+		if (mprotect(pSlab, kSlabSize, PROT_READ | PROT_WRITE) != 0)
+		{
+			return 0;
+		}
+
+#endif//BEHAVIAC_CCDEFINE_MSVC
+
+		m_arenaCommitted += kSlabSize;
+
+		return pSlab;
+	}
+
+	void MemSlabAllocator::Refill(ThreadCache* pCache, uint32_t sizeClass)
+	{
+		Depot& depot = m_depots[sizeClass];
+		void** pMagazine = pCache->blocks[sizeClass];
+		uint32_t& count = pCache->counts[sizeClass];
+
+		ScopedLock lock(depot.lock);
+
+		while (depot.freeList && count < kMagazineSize / 2)
+		{
+			void* pBlock = depot.freeList;
+			depot.freeList = *(void**)pBlock;
+			pMagazine[count++] = pBlock;
+		}
+
+		if (count > 0)
+		{
+			return;
+		}
+
+		char* pSlab = this->CommitSlab();
+
+		if (!pSlab)
+		{
+			return;
+		}
+
+		depot.slabCount++;
+
+		const uint32_t blockCount = kSlabSize / depot.stride;
+		const uint32_t header = kSlabHeaderMagic | sizeClass;
+
+		// push the blocks backwards so that the magazine hands out the lowest addresses first
+		for (uint32_t i = blockCount; i > 0; --i)
+		{
+			SlabBlockHeader* pHeader = (SlabBlockHeader*)(pSlab + (i - 1) * depot.stride);
+			pHeader->tag = header;
+			pHeader->offset = 0;
+			pHeader->size = kSlabClassSizes[sizeClass];
+
+			void* pBlock = pHeader + 1;
+
+			if (i <= kMagazineSize / 2)
+			{
+				pMagazine[count++] = pBlock;
+			}
+			else
+			{
+				*(void**)pBlock = depot.freeList;
+				depot.freeList = pBlock;
+			}
+		}
+	}
+
+	void MemSlabAllocator::Flush(ThreadCache* pCache, uint32_t sizeClass, uint32_t count)
+	{
+		Depot& depot = m_depots[sizeClass];
+		void** pMagazine = pCache->blocks[sizeClass];
+		uint32_t& magazineCount = pCache->counts[sizeClass];
+
+		BEHAVIAC_ASSERT(count <= magazineCount);
+
+		ScopedLock lock(depot.lock);
+
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			void* pBlock = pMagazine[--magazineCount];
+			*(void**)pBlock = depot.freeList;
+			depot.freeList = pBlock;
+		}
+	}
+
+	void MemSlabAllocator::FlushThreadCache()
+	{
+		if (t_slabThreadCacheOwner != m_id)
+		{
+			return;
+		}
+
+		ThreadCache* pCache = t_slabThreadCache;
+
+		for (uint32_t i = 0; i < kSizeClassCount; ++i)
+		{
+			this->Flush(pCache, i, pCache->counts[i]);
+		}
+	}
+
+	void* MemSlabAllocator::AllocSmall(uint32_t sizeClass)
+	{
+		ThreadCache* pCache = this->GetThreadCache();
+
+		if (!pCache)
+		{
+			return 0;
+		}
+
+		if (pCache->counts[sizeClass] == 0)
+		{
+			this->Refill(pCache, sizeClass);
+
+			if (pCache->counts[sizeClass] == 0)
+			{
+				return 0;
+			}
+		}
+
+		pCache->counters.allocCount[sizeClass]++;
+
+		return pCache->blocks[sizeClass][--pCache->counts[sizeClass]];
+	}
+
+	void MemSlabAllocator::FreeSmall(void* pBlock, uint32_t sizeClass)
+	{
+		ThreadCache* pCache = this->GetThreadCache();
+		BEHAVIAC_ASSERT(pCache);
+
+		if (pCache->counts[sizeClass] == kMagazineSize)
+		{
+			this->Flush(pCache, sizeClass, kMagazineSize / 2);
+		}
+
+		pCache->counters.freeCount[sizeClass]++;
+		pCache->blocks[sizeClass][pCache->counts[sizeClass]++] = pBlock;
+	}
+
+	void* MemSlabAllocator::AllocLarge(size_t size, size_t alignment)
+	{
+		if (alignment < kAlignment)
+		{
+			alignment = kAlignment;
+		}
+
+		size_t totalSize = size + kSlabHeaderSize + (alignment > kAlignment ? alignment : 0);
+		char* pRaw = (char*)malloc(totalSize);
+
+		if (!pRaw)
+		{
+			return 0;
+		}
+
+		char* pData = (char*)BEHAVIAC_ROUND(pRaw + kSlabHeaderSize, alignment);
+		SlabBlockHeader* pHeader = GetSlabBlockHeader(pData);
+		pHeader->tag = kSlabHeaderMagic | kSlabLargeClass;
+		pHeader->offset = (uint32_t)(pData - pRaw);
+		pHeader->size = size;
+
+		{
+			ScopedLock lock(m_largeBlocksLock);
+
+			if (!m_largeBlocks->Add(pData))
+			{
+				free(pRaw);
+				return 0;
+			}
+		}
+
+		ThreadCache* pCache = this->GetThreadCache();
+
+		if (pCache)
+		{
+			pCache->counters.largeAllocCount++;
+			pCache->counters.largeAllocatedBytes += size;
+		}
+
+		return pData;
+	}
+
+	bool MemSlabAllocator::FreeLarge(void* pData)
+	{
+		{
+			ScopedLock lock(m_largeBlocksLock);
+
+			if (!m_largeBlocks->Remove(pData))
+			{
+				return false;
+			}
+		}
+
+		SlabBlockHeader* pHeader = GetSlabBlockHeader(pData);
+		char* pRaw = (char*)pData - pHeader->offset;
+
+		ThreadCache* pCache = this->GetThreadCache();
+
+		if (pCache)
+		{
+			pCache->counters.largeFreeCount++;
+			pCache->counters.largeFreedBytes += pHeader->size;
+		}
+
+		free(pRaw);
+
+		return true;
+	}
+
+	bool MemSlabAllocator::IsLargeBlock(const void* pData) const
+	{
+		ScopedLock lock(m_largeBlocksLock);
+
+		if (m_largeBlocks->count == 0)
+		{
+			return false;
+		}
+
+		const uint32_t mask = m_largeBlocks->capacity - 1;
+
+		for (uint32_t i = LargeBlocks::Hash(pData) & mask; m_largeBlocks->slots[i]; i = (i + 1) & mask)
+		{
+			if (m_largeBlocks->slots[i] == pData)
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	size_t MemSlabAllocator::GetUsableSize(const void* pData) const
+	{
+		return (size_t)GetSlabBlockHeader(pData)->size;
+	}
+
+	void* MemSlabAllocator::Alloc(size_t size, const char* tag, const char* pFile, unsigned int Line)
+	{
+		BEHAVIAC_UNUSED_VAR(tag);
+		BEHAVIAC_UNUSED_VAR(pFile);
+		BEHAVIAC_UNUSED_VAR(Line);
+
+		if (size <= kMaxSmallSize)
+		{
+			void* pData = this->AllocSmall(gs_slabSizeClassLookup.GetSizeClass(size > 0 ? size : 1));
+
+			// the reserved range is used up
+			if (pData)
+			{
+				return pData;
+			}
+		}
+
+		return this->AllocLarge(size, kAlignment);
+	}
+
+	void* MemSlabAllocator::Realloc(void* pOldPtr, size_t size, const char* tag, const char* pFile, unsigned int Line)
+	{
+		return this->ReallocAligned(pOldPtr, size, BEHAVIAC_DEFAULT_ALIGN, tag, pFile, Line);
+	}
+
+	void MemSlabAllocator::Free(void* pData, const char* tag, const char* pFile, unsigned int Line)
+	{
+		BEHAVIAC_UNUSED_VAR(tag);
+		BEHAVIAC_UNUSED_VAR(pFile);
+		BEHAVIAC_UNUSED_VAR(Line);
+
+		if (!pData)
+		{
+			return;
+		}
+
+		if (this->IsSlabBlock(pData))
+		{
+			uint32_t sizeClass = GetSlabBlockHeader(pData)->tag & ~kSlabHeaderMagicMask;
+			BEHAVIAC_ASSERT((GetSlabBlockHeader(pData)->tag & kSlabHeaderMagicMask) == kSlabHeaderMagic && sizeClass < kSizeClassCount);
+
+			this->FreeSmall(pData, sizeClass);
+		}
+		else if (!this->FreeLarge(pData))
+		{
+			// from the system heap
+			free(pData);
+		}
+	}
+
+	void* MemSlabAllocator::AllocAligned(size_t size, size_t alignment, const char* tag, const char* pFile, unsigned int Line)
+	{
+		if (alignment <= kAlignment)
+		{
+			return this->Alloc(size, tag, pFile, Line);
+		}
+
+		return this->AllocLarge(size, alignment);
+	}
+
+	void* MemSlabAllocator::ReallocAligned(void* pOldPtr, size_t size, size_t alignment, const char* tag, const char* pFile, unsigned int Line)
+	{
+		if (!pOldPtr)
+		{
+			return this->AllocAligned(size, alignment, tag, pFile, Line);
+		}
+
+		if (size == 0)
+		{
+			this->FreeAligned(pOldPtr, alignment, tag, pFile, Line);
+			return 0;
+		}
+
+		if (!this->IsSlabBlock(pOldPtr) && !this->IsLargeBlock(pOldPtr))
+		{
+#if BEHAVIAC_CCDEFINE_MSVC
+
+			if (alignment > BEHAVIAC_DEFAULT_ALIGN)
+			{
+				return _aligned_realloc(pOldPtr, size, alignment);
+			}
+
+#endif//BEHAVIAC_CCDEFINE_MSVC
+			return realloc(pOldPtr, size);
+		}
+
+		size_t oldSize = this->GetUsableSize(pOldPtr);
+
+		// shrinking a small block is done in place as long as it stays in the same size class
+		if (size <= oldSize && (oldSize > kMaxSmallSize || gs_slabSizeClassLookup.GetSizeClass(size) == gs_slabSizeClassLookup.GetSizeClass(oldSize)))
+		{
+			return pOldPtr;
+		}
+
+		void* pNewPtr = this->AllocAligned(size, alignment, tag, pFile, Line);
+
+		if (pNewPtr)
+		{
+			memcpy(pNewPtr, pOldPtr, size < oldSize ? size : oldSize);
+			this->FreeAligned(pOldPtr, alignment, tag, pFile, Line);
+		}
+
+		return pNewPtr;
+	}
+
+	void MemSlabAllocator::FreeAligned(void* pData, size_t alignment, const char* tag, const char* pFile, unsigned int Line)
+	{
+		BEHAVIAC_UNUSED_VAR(alignment);
+
+#if BEHAVIAC_CCDEFINE_MSVC
+
+		if (pData && alignment > BEHAVIAC_DEFAULT_ALIGN && !this->IsSlabBlock(pData) && !this->IsLargeBlock(pData))
+		{
+			_aligned_free(pData);
+			return;
+		}
+
+#endif//BEHAVIAC_CCDEFINE_MSVC
+		this->Free(pData, tag, pFile, Line);
+	}
+
+	const char* MemSlabAllocator::GetName(void) const
+	{
+		return "MemSlabAllocator";
+	}
+
+	void MemSlabAllocator::GetStats(Stats& stats) const
+	{
+		memset(&stats, 0, sizeof(stats));
+
+		uint64_t allocatedBytes = 0;
+		uint64_t largeBytes = 0;
+
+		for (uint32_t i = 0; i < kSizeClassCount; ++i)
+		{
+			SizeClassStats& classStats = stats.sizeClasses[i];
+			classStats.blockSize = m_depots[i].stride;
+
+			{
+				ScopedLock lock(m_depots[i].lock);
+				classStats.slabCount = m_depots[i].slabCount;
+			}
+
+			stats.reservedBytes += (size_t)classStats.slabCount * kSlabSize;
+		}
+
+		{
+			ScopedLock lock(m_threadCachesLock);
+
+			Counters counters = *m_retiredCounters;
+
+			for (const ThreadCache* pCache = m_threadCaches; pCache; pCache = pCache->next)
+			{
+				counters.Add(pCache->counters);
+				stats.threadCacheCount++;
+			}
+
+			for (uint32_t i = 0; i < kSizeClassCount; ++i)
+			{
+				stats.sizeClasses[i].allocCount = counters.allocCount[i];
+				stats.sizeClasses[i].freeCount = counters.freeCount[i];
+			}
+
+			stats.largeAllocCount = counters.largeAllocCount;
+			stats.largeFreeCount = counters.largeFreeCount;
+			largeBytes = counters.largeAllocatedBytes - counters.largeFreedBytes;
+		}
+
+		for (uint32_t i = 0; i < kSizeClassCount; ++i)
+		{
+			const SizeClassStats& classStats = stats.sizeClasses[i];
+			allocatedBytes += (classStats.allocCount - classStats.freeCount) * classStats.blockSize;
+		}
+
+		stats.allocatedBytes = (size_t)(allocatedBytes + largeBytes);
+		stats.reservedBytes += (size_t)largeBytes;
+	}
+
+	static MemSlabAllocator* gs_MemSlabAllocator = 0;
+
+	MemSlabAllocator& GetSlabMemoryAllocator()
+	{
+		if (!gs_MemSlabAllocator)
+		{
+			gs_MemSlabAllocator = new MemSlabAllocator;
+		}
+
+		BEHAVIAC_ASSERT(gs_MemSlabAllocator);
+		return *gs_MemSlabAllocator;
+	}
+
+	void CleanupSlabMemoryAllocator()
+	{
+		if (gs_MemSlabAllocator && &GetMemoryAllocator() == gs_MemSlabAllocator)
+		{
+			SetMemoryAllocator(GetDefaultMemoryAllocator());
+		}
+
+		delete gs_MemSlabAllocator;
+		gs_MemSlabAllocator = 0;
+	}
+}
@@ -12,10 +12,12 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 #include "behaviac/common/meta.h"
 #include "behaviac/common/member.h"
+#include "behaviac/common/thread/mutex_lock.h"
 
 namespace behaviac
 {
     behaviac::map<uint32_t, AgentMeta*>             AgentMeta::_agentMetas;
+    uint32_t                                        AgentMeta::ms_version = 0;
     behaviac::map<behaviac::string, TypeCreator*>   AgentMeta::_Creators;
     CppBehaviorLoader*                              AgentMeta::ms_cppBehaviorLoader = NULL;
 	unsigned int									AgentMeta::ms_totalSignature = 0;
@@ -40,7 +42,7 @@ namespace behaviac
     }
 
 	AgentMeta::AgentMeta(unsigned int signature)
-		: m_signature(signature)
+		: _memberCount(0), m_signature(signature)
 	{
 	}
 
@@ -79,6 +81,8 @@ namespace behaviac
         _customizedStaticProperties.clear();
         _customizedStaticVars.clear();
         _methods.clear();
+        _members.clear();
+        _memberCount = 0;
     }
 
 	void AgentMeta::SetTotalSignature(unsigned int value)
@@ -128,14 +132,17 @@ namespace behaviac
             BEHAVIAC_DELETE p;
         }
         _agentMetas.clear();
+        ms_version++;
 
         _Creators.clear();
     }
 
     AgentMeta* AgentMeta::GetMeta(uint32_t classId)
     {
-        if (_agentMetas.find(classId) != _agentMetas.end())
-            return _agentMetas[classId];
+        behaviac::map<uint32_t, AgentMeta*>::const_iterator it = _agentMetas.find(classId);
+
+        if (it != _agentMetas.end())
+            return it->second;
 
         return NULL;
     }
@@ -175,9 +182,80 @@ namespace behaviac
         return vars;
     }
 
+    //the ids are CRCs, their low bits are good enough for the slots
+    AgentMeta::Member_t& AgentMeta::addMember(uint32_t id)
+    {
+        BEHAVIAC_ASSERT(id != 0);
+
+        //at most half full
+        if ((_memberCount + 1) * 2 > _members.size())
+        {
+            behaviac::vector<Member_t> members;
+            members.swap(_members);
+
+            Member_t empty = { 0, NULL, NULL, NULL };
+            _members.resize(members.empty() ? 16 : members.size() * 2, empty);
+            _memberCount = 0;
+
+            for (uint32_t i = 0; i < members.size(); ++i)
+            {
+                if (members[i].id != 0)
+                {
+                    addMember(members[i].id) = members[i];
+                }
+            }
+        }
+
+        const uint32_t mask = (uint32_t)_members.size() - 1;
+
+        for (uint32_t i = id & mask;; i = (i + 1) & mask)
+        {
+            Member_t& member = _members[i];
+
+            if (member.id == id)
+            {
+                return member;
+            }
+
+            if (member.id == 0)
+            {
+                member.id = id;
+                _memberCount++;
+
+                return member;
+            }
+        }
+    }
+
+    const AgentMeta::Member_t* AgentMeta::findMember(uint32_t id) const
+    {
+        if (_members.empty())
+        {
+            return NULL;
+        }
+
+        const uint32_t mask = (uint32_t)_members.size() - 1;
+
+        for (uint32_t i = id & mask;; i = (i + 1) & mask)
+        {
+            const Member_t& member = _members[i];
+
+            if (member.id == id)
+            {
+                return id != 0 ? &member : NULL;
+            }
+
+            if (member.id == 0)
+            {
+                return NULL;
+            }
+        }
+    }
+
     void AgentMeta::RegisterMemberProperty(uint32_t propId, IProperty* property)
     {
         _memberProperties[propId] = property;
+        addMember(propId).memberProperty = property;
     }
 
 	void AgentMeta::DestroyCustomizedProperty(uint32_t propId)
@@ -203,54 +281,57 @@ namespace behaviac
     {
 		DestroyCustomizedProperty(propId);
 
+        //the slot of the variable in the agents, it only needs to be different from the others of this meta
+        property->SetSlot((uint32_t)(_customizedProperties.size() + _customizedStaticProperties.size()));
         _customizedProperties[propId] = property;
+        addMember(propId).property = property;
     }
 
     void AgentMeta::RegisterStaticCustomizedProperty(uint32_t propId, IProperty* property)
     {
 		DestroyCustomizedProperty(propId);
 
+        property->SetSlot((uint32_t)(_customizedProperties.size() + _customizedStaticProperties.size()));
 		_customizedStaticProperties[propId] = property;
+        addMember(propId).property = property;
     }
 
     void AgentMeta::RegisterMethod(uint32_t methodId, IInstanceMember* method)
     {
         _methods[methodId] = method;
+        addMember(methodId).method = method;
     }
 
     IProperty* AgentMeta::GetProperty(uint32_t propId)
     {
-        if (_customizedStaticProperties.find(propId) != _customizedStaticProperties.end())
-            return _customizedStaticProperties[propId];
-
-        if (_customizedProperties.find(propId) != _customizedProperties.end())
-            return _customizedProperties[propId];
+        const Member_t* member = findMember(propId);
 
-        if (_memberProperties.find(propId) != _memberProperties.end())
-            return _memberProperties[propId];
+        if (member != NULL)
+        {
+            //the customized ones hide the members of the same names
+            return member->property != NULL ? member->property : member->memberProperty;
+        }
 
         return NULL;
     }
 
     IProperty* AgentMeta::GetMemberProperty(uint32_t propId)
     {
-        if (_memberProperties.find(propId) != _memberProperties.end())
-            return _memberProperties[propId];
+        const Member_t* member = findMember(propId);
 
-        return NULL;
+        return member != NULL ? member->memberProperty : NULL;
     }
 
-    behaviac::map<uint32_t, IProperty*> AgentMeta::GetMemberProperties()
+    const behaviac::map<uint32_t, IProperty*>& AgentMeta::GetMemberProperties() const
     {
         return _memberProperties;
     }
 
     IInstanceMember* AgentMeta::GetMethod(uint32_t methodId)
     {
-        if (_methods.find(methodId) != _methods.end())
-            return _methods[methodId];
+        const Member_t* member = findMember(methodId);
 
-        return NULL;
+        return member != NULL ? member->method : NULL;
     };
 
 	IProperty* AgentMeta::CreateProperty(const behaviac::string& typeName, uint32_t propId, const char* propName, const char* valueStr)
@@ -562,6 +643,96 @@ namespace behaviac
         return NULL;
     }
 
+    struct SharedProperty_t
+    {
+        IInstanceMember*	pMember;
+        uint32_t			refs;
+    };
+
+    typedef behaviac::map<behaviac::string, SharedProperty_t> SharedProperties_t;
+    typedef behaviac::map<const IInstanceMember*, SharedProperties_t::iterator> SharedPropertyValues_t;
+
+    static SharedProperties_t				gs_sharedProperties;
+    static SharedPropertyValues_t			gs_sharedPropertyValues;
+    static AgentMeta::SharedPropertyStats	gs_sharedPropertyStats = { 0, 0, 0 };
+
+    //the trees can be loaded by different threads
+    static behaviac::Mutex					gs_sharedPropertiesMutex;
+
+    IInstanceMember* AgentMeta::ParseSharedProperty(const char* value)
+    {
+        if (StringUtils::IsNullOrEmpty(value))
+        {
+            return NULL;
+        }
+
+        behaviac::ScopedLock lock(gs_sharedPropertiesMutex);
+
+        gs_sharedPropertyStats.requests++;
+
+        SharedProperties_t::iterator it = gs_sharedProperties.find(value);
+
+        if (it != gs_sharedProperties.end())
+        {
+            gs_sharedPropertyStats.hits++;
+            it->second.refs++;
+
+            return it->second.pMember;
+        }
+
+        IInstanceMember* pMember = ParseProperty(value);
+
+        if (pMember != NULL)
+        {
+            SharedProperty_t sharedProperty = { pMember, 1 };
+            it = gs_sharedProperties.insert(std::make_pair(behaviac::string(value), sharedProperty)).first;
+            gs_sharedPropertyValues[pMember] = it;
+
+            gs_sharedPropertyStats.operands++;
+        }
+
+        return pMember;
+    }
+
+    void AgentMeta::ReleaseSharedProperty(IInstanceMember* pMember)
+    {
+        if (pMember == NULL)
+        {
+            return;
+        }
+
+        {
+            behaviac::ScopedLock lock(gs_sharedPropertiesMutex);
+
+            SharedPropertyValues_t::iterator it = gs_sharedPropertyValues.find(pMember);
+
+            if (it != gs_sharedPropertyValues.end())
+            {
+                SharedProperty_t& sharedProperty = it->second->second;
+                BEHAVIAC_ASSERT(sharedProperty.refs > 0);
+
+                if (--sharedProperty.refs > 0)
+                {
+                    return;
+                }
+
+                gs_sharedProperties.erase(it->second);
+                gs_sharedPropertyValues.erase(it);
+
+                gs_sharedPropertyStats.operands--;
+            }
+        }
+
+        BEHAVIAC_DELETE(pMember);
+    }
+
+    AgentMeta::SharedPropertyStats AgentMeta::GetSharedPropertyStats()
+    {
+        behaviac::ScopedLock lock(gs_sharedPropertiesMutex);
+
+        return gs_sharedPropertyStats;
+    }
+
     IInstanceMember* AgentMeta::ParseMethod(const char* valueStr, char* methodName)
     {
         //Self.test_ns::AgentActionTest::Action2(0)
@@ -728,6 +899,19 @@ namespace behaviac
 		Workspace::EFileFormat f = Workspace::GetInstance()->GetFileFormat();
 		string ext = "";
 
+		//in the bundle if there is one
+		uint32_t bundledSize = 0;
+		char* pBundled = Workspace::GetInstance()->ReadBundledFile(relativePath.c_str(), f, bundledSize);
+
+		if (pBundled != NULL)
+		{
+			bLoadResult = (f == Workspace::EFF_bson) ? load_bson(pBundled) : load_xml(pBundled);
+
+			Workspace::GetInstance()->PopFileFromBuffer(fullPath.c_str(), ext.c_str(), pBundled, bundledSize);
+
+			return bLoadResult;
+		}
+
 		Workspace::GetInstance()->HandleFileFormat(fullPath, ext, f);
 
 		switch (f)
@@ -22,14 +22,6 @@
 
 #if BEHAVIAC_ENABLE_PROFILING
 
-#if BEHAVIAC_CCDEFINE_MSVC
-#include <windows.h>
-
-#pragma comment(lib, "winmm.lib")
-#else
-#include <sys/time.h>
-#endif//#if BEHAVIAC_CCDEFINE_MSVC
-
 namespace behaviac
 {
     Profiler* Profiler::ms_instance = 0;
@@ -79,25 +71,9 @@ namespace behaviac
         /// Reset the timer.
         void Reset();
 
-        /// Return if high-resolution timer is supported.
-        static bool IsSupported()
-        {
-            return supported;
-        }
-        /// Return high-resolution timer frequency if supported.
-        static long long GetFrequency()
-        {
-            return frequency;
-        }
-
     private:
-        /// Starting clock value in CPU ticks.
+        /// Starting clock value in microseconds.
         long long startTime_;
-
-        /// High-resolution timer support flag.
-        static bool supported;
-        /// High-resolution timer frequency.
-        static long long frequency;
     };
 
     /// Profiling data for one block in the profiling tree.
@@ -274,9 +250,6 @@ namespace behaviac
         ProfilerBlock& operator=(const ProfilerBlock& c);
     };
 
-    bool HiresTimer::supported(false);
-	long long HiresTimer::frequency(1000LL);
-
     HiresTimer::HiresTimer()
     {
         Reset();
@@ -284,82 +257,24 @@ namespace behaviac
 
     long long HiresTimer::GetUSec(bool reset)
     {
-        long long currentTime;
-
-#ifdef BEHAVIAC_CCDEFINE_MSVC
-        if (supported)
-        {
-            LARGE_INTEGER counter;
-            QueryPerformanceCounter(&counter);
-            currentTime = counter.QuadPart;
-        }
-        else
-        {
-            currentTime = timeGetTime();
-        }
-#else
-        struct timeval time;
-        gettimeofday(&time, NULL);
-        currentTime = time.tv_sec * 1000000LL + time.tv_usec;
-#endif
-
+        long long currentTime = thread::GetMicroseconds();
         long long elapsedTime = currentTime - startTime_;
 
-        // Correct for possible weirdness with changing internal frequency
-        if (elapsedTime < 0)
-        {
-            elapsedTime = 0;
-        }
-
         if (reset)
         {
             startTime_ = currentTime;
         }
 
-        return (elapsedTime * 1000000LL) / frequency;
+        return elapsedTime;
     }
 
     void HiresTimer::Reset()
     {
-#ifdef BEHAVIAC_CCDEFINE_MSVC
-
-        if (supported)
-        {
-            LARGE_INTEGER counter;
-            QueryPerformanceCounter(&counter);
-            startTime_ = counter.QuadPart;
-        }
-        else
-        {
-            startTime_ = timeGetTime();
-        }
-#else
-        struct timeval time;
-        gettimeofday(&time, NULL);
-        startTime_ = time.tv_sec * 1000000LL + time.tv_usec;
-#endif
+        startTime_ = thread::GetMicroseconds();
     }
 
     Profiler::Profiler() : threads_(0), frameStarted_(0), outputDebugBlock_(false), m_bHierarchy(true), intervalFrames_(0), totalFrames_(0)
     {
-#ifdef BEHAVIAC_CCDEFINE_MSVC
-        LARGE_INTEGER frequency;
-
-        if (QueryPerformanceFrequency(&frequency))
-        {
-            HiresTimer::frequency = frequency.QuadPart;
-            HiresTimer::supported = true;
-        }
-		else
-		{
-			//timeGetTime returns milliseconds
-			HiresTimer::frequency = 1000LL;
-		}
-#else
-        HiresTimer::frequency = 1000000;
-        HiresTimer::supported = true;
-#endif
-
         for (int i = 0; i < kMaxThreads; ++i)
         {
             current_[i].clear();
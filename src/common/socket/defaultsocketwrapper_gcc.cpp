@@ -21,12 +21,21 @@
 #include <pthread.h>		// beginthreadex
 #include <sys/types.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <sys/ioctl.h>
 #include <unistd.h>
 #include <fcntl.h>
+#include <time.h>
 #include <netdb.h>
 #include <netinet/in.h>
 
+#if BEHAVIAC_CCDEFINE_GCC_LINUX || BEHAVIAC_CCDEFINE_ANDROID
+#include <sys/epoll.h>
+#define BEHAVIAC_SOCKET_EPOLL 1
+#else
+#define BEHAVIAC_SOCKET_EPOLL 0
+#endif
+
 typedef int SOCKET;
 
 namespace
@@ -207,7 +216,52 @@ namespace behaviac
             return outBytesWritten != 0;
         }
 
-        size_t Read(Handle& h, const void* buffer, size_t bytesMax)
+        bool WriteV(Handle& h, const Buffer* buffers, int count, size_t& outBytesWritten)
+        {
+            outBytesWritten = 0;
+
+            if (count == 0 || !h)
+            {
+                return count == 0;
+            }
+
+            BEHAVIAC_ASSERT(count <= kMaxWriteBuffers);
+
+            iovec vecs[kMaxWriteBuffers];
+
+            for (int i = 0; i < count; ++i)
+            {
+                vecs[i].iov_base = (void*)buffers[i].data;
+                vecs[i].iov_len = buffers[i].bytes;
+            }
+
+            //sendmsg rather than writev, so that a closed connection doesn't raise SIGPIPE
+            msghdr msg;
+            memset(&msg, 0, sizeof(msg));
+            msg.msg_iov = vecs;
+            msg.msg_iovlen = count;
+
+#if BEHAVIAC_CCDEFINE_APPLE
+            const int flags = 0;
+#else
+            const int flags = MSG_NOSIGNAL;
+#endif
+            ssize_t res = ::sendmsg(::AsSocket(h), &msg, flags);
+
+            if (res < 0)
+            {
+                Close(h);
+            }
+            else
+            {
+                outBytesWritten = res;
+                gs_packetsSent++;
+            }
+
+            return outBytesWritten != 0;
+        }
+
+        size_t Read(Handle& h, void* buffer, size_t bytesMax)
         {
             size_t bytesRead = 0;
 
@@ -261,6 +315,113 @@ namespace behaviac
             return 0;
         }
 
+        Poller::Poller() : m_count(0), m_epoll(-1)
+        {
+#if BEHAVIAC_SOCKET_EPOLL
+            m_epoll = epoll_create(kMaxHandles);
+
+            if (m_epoll < 0)
+            {
+                BEHAVIAC_LOGERROR("epoll_create failed\n");
+            }
+#endif
+        }
+
+        Poller::~Poller()
+        {
+#if BEHAVIAC_SOCKET_EPOLL
+            if (m_epoll >= 0)
+            {
+                close(m_epoll);
+            }
+#endif
+        }
+
+        bool Poller::Add(Handle h)
+        {
+            if (m_count >= kMaxHandles)
+            {
+                return false;
+            }
+
+#if BEHAVIAC_SOCKET_EPOLL
+            epoll_event ev;
+            memset(&ev, 0, sizeof(ev));
+            ev.events = EPOLLIN;
+            ev.data.fd = ::AsSocket(h);
+
+            if (m_epoll < 0 || epoll_ctl(m_epoll, EPOLL_CTL_ADD, ::AsSocket(h), &ev) < 0)
+            {
+                return false;
+            }
+#endif
+            m_handles[m_count++] = h;
+
+            return true;
+        }
+
+        void Poller::Remove(Handle h)
+        {
+            for (int i = 0; i < m_count; ++i)
+            {
+                if (m_handles[i] == h)
+                {
+                    m_handles[i] = m_handles[--m_count];
+
+#if BEHAVIAC_SOCKET_EPOLL
+                    //it might have been closed, which has removed it already
+                    epoll_event ev;
+                    epoll_ctl(m_epoll, EPOLL_CTL_DEL, ::AsSocket(h), &ev);
+#endif
+                    break;
+                }
+            }
+        }
+
+        int Poller::Wait(Handle* ready, int maxReady, int timeoutMs)
+        {
+            int count = 0;
+
+#if BEHAVIAC_SOCKET_EPOLL
+            epoll_event events[kMaxHandles];
+            int res = epoll_wait(m_epoll, events, maxReady < kMaxHandles ? maxReady : kMaxHandles, timeoutMs);
+
+            for (int i = 0; i < res; ++i)
+            {
+                ready[count++] = Handle(events[i].data.fd);
+            }
+#else
+            fd_set readSet;
+            FD_ZERO(&readSet);
+            int maxfd = 0;
+
+            for (int i = 0; i < m_count; ++i)
+            {
+                FD_SET(::AsSocket(m_handles[i]), &readSet);
+
+                if (m_handles[i] > maxfd)
+                {
+                    maxfd = m_handles[i];
+                }
+            }
+
+            timeval timeout;
+            timeout.tv_sec = timeoutMs / 1000;
+            timeout.tv_usec = (timeoutMs % 1000) * 1000;
+            int res = ::select(maxfd + 1, &readSet, 0, 0, &timeout);
+
+            for (int i = 0; i < m_count && res > 0 && count < maxReady; ++i)
+            {
+                if (FD_ISSET(::AsSocket(m_handles[i]), &readSet))
+                {
+                    ready[count++] = m_handles[i];
+                }
+            }
+#endif
+
+            return count;
+        }
+
         size_t GetPacketsSent()
         {
             return gs_packetsSent;
@@ -310,13 +471,17 @@ namespace behaviac
         }
 
 		void Sleep(long millis) {
-			//sleep(millis);
-			//printf("sleep %ld\n", millis);
-			clock_t goal = millis + clock();
-
-			while (goal > clock());
+			usleep((useconds_t)millis * 1000);
 		}
 
+        int64_t GetMicroseconds()
+        {
+            struct timespec time;
+            clock_gettime(CLOCK_MONOTONIC, &time);
+
+            return time.tv_sec * 1000000LL + time.tv_nsec / 1000;
+        }
+
     }//namespace thread
 } // namespace behaviac
 #endif//#if !BEHAVIAC_CCDEFINE_MSVC
@@ -19,6 +19,7 @@
 
 #if BEHAVIAC_CCDEFINE_MSVC
 #include <process.h>		// beginthreadex
+#include <winsock2.h>		// WSASend
 #include <windows.h>
 
 #pragma comment(lib, "Ws2_32.lib")
@@ -176,7 +177,47 @@ namespace behaviac
             return outBytesWritten != 0;
         }
 
-        size_t Read(Handle& h, const void* buffer, size_t bytesMax)
+        bool WriteV(Handle& h, const Buffer* buffers, int count, size_t& outBytesWritten)
+        {
+            outBytesWritten = 0;
+
+            if (count == 0 || !h)
+            {
+                return count == 0;
+            }
+
+            BEHAVIAC_ASSERT(count <= kMaxWriteBuffers);
+
+            WSABUF vecs[kMaxWriteBuffers];
+
+            for (int i = 0; i < count; ++i)
+            {
+                vecs[i].buf = (CHAR*)buffers[i].data;
+                vecs[i].len = (ULONG)buffers[i].bytes;
+            }
+
+            DWORD bytesSent = 0;
+            int res = ::WSASend(::AsWinSocket(h), vecs, (DWORD)count, &bytesSent, 0, NULL, NULL);
+
+            if (res == SOCKET_ERROR)
+            {
+                int err = WSAGetLastError();
+
+                if (err == WSAECONNRESET || err == WSAECONNABORTED)
+                {
+                    Close(h);
+                }
+            }
+            else
+            {
+                outBytesWritten = bytesSent;
+                gs_packetsSent++;
+            }
+
+            return outBytesWritten != 0;
+        }
+
+        size_t Read(Handle& h, void* buffer, size_t bytesMax)
         {
             size_t bytesRead = 0;
 
@@ -229,6 +270,73 @@ namespace behaviac
             return 0;
         }
 
+        Poller::Poller() : m_count(0), m_epoll(-1)
+        {
+        }
+
+        Poller::~Poller()
+        {
+        }
+
+        bool Poller::Add(Handle h)
+        {
+            if (m_count >= kMaxHandles)
+            {
+                return false;
+            }
+
+            m_handles[m_count++] = h;
+
+            return true;
+        }
+
+        void Poller::Remove(Handle h)
+        {
+            for (int i = 0; i < m_count; ++i)
+            {
+                if (m_handles[i] == h)
+                {
+                    m_handles[i] = m_handles[--m_count];
+                    break;
+                }
+            }
+        }
+
+        int Poller::Wait(Handle* ready, int maxReady, int timeoutMs)
+        {
+            int count = 0;
+
+            if (m_count == 0)
+            {
+                //select fails on an empty set
+                behaviac::thread::Sleep(timeoutMs);
+                return count;
+            }
+
+            fd_set readSet;
+            FD_ZERO(&readSet);
+
+            for (int i = 0; i < m_count; ++i)
+            {
+                FD_SET(::AsWinSocket(m_handles[i]), &readSet);
+            }
+
+            timeval timeout;
+            timeout.tv_sec = timeoutMs / 1000;
+            timeout.tv_usec = (timeoutMs % 1000) * 1000;
+            int res = ::select(0, &readSet, 0, 0, &timeout);
+
+            for (int i = 0; i < m_count && res > 0 && count < maxReady; ++i)
+            {
+                if (FD_ISSET(::AsWinSocket(m_handles[i]), &readSet))
+                {
+                    ready[count++] = m_handles[i];
+                }
+            }
+
+            return count;
+        }
+
         size_t GetPacketsSent()
         {
             return gs_packetsSent;
@@ -276,6 +384,21 @@ namespace behaviac
 			::Sleep(ms);
 		}
 
+        int64_t GetMicroseconds()
+        {
+            static LARGE_INTEGER s_frequency = { 0 };
+
+            if (s_frequency.QuadPart == 0)
+            {
+                QueryPerformanceFrequency(&s_frequency);
+            }
+
+            LARGE_INTEGER counter;
+            QueryPerformanceCounter(&counter);
+
+            return (counter.QuadPart / s_frequency.QuadPart) * 1000000LL + (counter.QuadPart % s_frequency.QuadPart) * 1000000LL / s_frequency.QuadPart;
+        }
+
     }//namespace thread
 } // namespace behaviac
 #endif//#if BEHAVIAC_CCDEFINE_MSVC
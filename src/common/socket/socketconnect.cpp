@@ -24,6 +24,7 @@
 #include "behaviac/behaviortree/behaviortree.h"
 #include "behaviac/behaviortree/behaviortree_task.h"
 #include "behaviac/common/logger/logmanager.h"
+#include "behaviac/agent/agent.h"
 #include "behaviac/agent/context.h"
 #if BEHAVIAC_CCDEFINE_MSVC
 #include <windows.h>
@@ -135,7 +136,7 @@ namespace behaviac
         const size_t bytesToSend = initialPacket.PrepareToSend();
         size_t bytesWritten(0);
 
-        if (!behaviac::Socket::Write(m_writeSocket, &initialPacket, bytesToSend, bytesWritten) ||
+        if (!behaviac::Socket::Write(this->GetConnectingSocket(), &initialPacket, bytesToSend, bytesWritten) ||
             bytesWritten != bytesToSend)
         {
             Log("behaviac: Couldn't send initial settings.\n");
@@ -150,6 +151,8 @@ namespace behaviac
 
         this->SendInitialSettings();
 
+        //every client is sent the workspace when it is connected
+        this->SetWorkspaceSent(false);
         Socket::SendWorkspaceSettings();
 
         this->SendInitialProperties();
@@ -169,7 +172,7 @@ namespace behaviac
         //the breakpoints checking might be wrong.
         bool bLoop = true;
 
-        while (bLoop && !m_isDisconnected && this->m_writeSocket)
+        while (bLoop && !m_isDisconnected && this->GetConnectingSocket())
         {
             //sending packets if any
             if (m_packetsCount > 0)
@@ -210,9 +213,7 @@ namespace behaviac
             {
                 if (!s_tracer.IsInited())
                 {
-                    const int		kMaxThreads = 128;
-
-                    if (!s_tracer.Init(kMaxThreads, port, bBlocking))
+                    if (!s_tracer.Init(port, bBlocking))
                     {
                         return false;
                     }
@@ -254,6 +255,31 @@ namespace behaviac
             }
         }
 
+        uint32_t GetSubscribers(const Agent* pAgent, uint32_t kindMask)
+        {
+            if (Config::IsSocketing() && s_tracer.IsConnected())
+            {
+                if (pAgent)
+                {
+                    const BehaviorTreeTask* bt = pAgent->btgetcurrent();
+
+                    return s_tracer.GetSubscribers(kindMask, pAgent->GetId(), bt ? bt->GetName().c_str() : 0);
+                }
+
+                return s_tracer.GetSubscribers(kindMask, -1, 0);
+            }
+
+            return 0;
+        }
+
+        void SendText(const char* text, uint32_t clients)
+        {
+            if (Config::IsSocketing() && clients != 0)
+            {
+                s_tracer.SendText(text, CommandId::CMDID_TEXT, clients);
+            }
+        }
+
         void SendWorkspace(const char* text)
         {
             if (Config::IsSocketing())
@@ -328,16 +354,6 @@ namespace behaviac
             return 0;
         }
 
-        size_t GetNumTrackedThreads()
-        {
-            if (Config::IsSocketing())
-            {
-                return s_tracer.GetNumTrackedThreads();
-            }
-
-            return false;
-        }
-
         void UpdatePacketsStats()
         {
             if (Config::IsSocketing())
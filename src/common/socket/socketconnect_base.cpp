@@ -21,10 +21,13 @@
 #include "behaviac/common/thread/mutex_lock.h"
 
 #include "behaviac/common/thread/wrapper.h"
-#include "behaviac/common/container/spscqueue.h"
+#include "behaviac/common/container/mpscring.h"
 #include "behaviac/common/memory/memory.h"
+#include "behaviac/common/crc.h"
 
 #include <cstring>	// string_ncpy
+#include <cstdio>
+#include <cstdlib>
 
 #if BEHAVIAC_CCDEFINE_MSVC
 #include <windows.h>
@@ -40,192 +43,187 @@ namespace behaviac
 		return s_seq;
 	}
 
-	// Local queue size must be power of two.
-	BEHAVIAC_STATIC_ASSERT((kLocalQueueSize & (kLocalQueueSize - 1)) == 0);
+	class PacketRing : public MPSCRing<kPacketRingSize>
+	{
+	};
 
-#if USING_BEHAVIAC_SEQUENTIAL
-	class PacketCollection
+	void SubscriptionFilter::Clear()
 	{
-	public:
-		PacketCollection()
-			: m_packets(0),
-			m_packetsEnd(0),
-			m_packetsCapacityEnd(0)
-		{
-		}
-		~PacketCollection()
-		{
-			Close();
-		}
+		this->kinds = 0;
+		this->agentCount = 0;
+		this->treeCount = 0;
+	}
 
-		void Init(size_t capacity)
-		{
-			BEHAVIAC_ASSERT(m_packets == 0);
-			m_packets = BEHAVIAC_NEW_ARRAY Packet[capacity];
-			m_packetsEnd = m_packets;
-			m_packetsCapacityEnd = m_packets + capacity;
-		}
-		void Close()
+	bool SubscriptionFilter::AddAgent(int agentId)
+	{
+		for (int i = 0; i < this->agentCount; ++i)
 		{
-			if (m_packets)
+			if (this->agents[i] == agentId)
 			{
-				BEHAVIAC_DELETE_ARRAY m_packets;
+				return true;
 			}
-
-			m_packets = 0;
 		}
 
-		Packet* Begin()
+		if (this->agentCount < kMaxAgents)
 		{
-			return m_packets;
-		}
-		Packet* End()
-		{
-			return m_packetsEnd;
-		}
-		size_t GetMemoryOverhead() const
-		{
-			return (m_packetsCapacityEnd - m_packets) * sizeof(Packet);
+			this->agents[this->agentCount] = agentId;
+			this->agentCount++;
+
+			return true;
 		}
 
-		// False if not enough space, packet not added.
-		bool Add(const Packet& packet)
+		return false;
+	}
+
+	bool SubscriptionFilter::AddTree(const char* treeName)
+	{
+		uint32_t treeId = CRC32::CalcCRC(treeName);
+
+		for (int i = 0; i < this->treeCount; ++i)
 		{
-			if (m_packetsEnd == m_packetsCapacityEnd)
+			if (this->trees[i] == treeId)
 			{
-				BEHAVIAC_LOGWARNING("buffer overflow...\n");
-				return false;
+				return true;
 			}
+		}
+
+		if (this->treeCount < kMaxTrees)
+		{
+			this->trees[this->treeCount] = treeId;
+			this->treeCount++;
 
-			*m_packetsEnd++ = packet;
 			return true;
 		}
 
-		void Reset()
+		return false;
+	}
+
+	void SubscriptionFilter::AddKinds(uint32_t kindMask)
+	{
+		this->kinds |= kindMask;
+	}
+
+	bool SubscriptionFilter::Parse(const char* line)
+	{
+		const char* kSubscribe = "[subscribe]";
+		const char* kUnsubscribe = "[unsubscribe]";
+
+		if (strncmp(line, kUnsubscribe, strlen(kUnsubscribe)) == 0)
 		{
-			m_packetsEnd = m_packets;
+			this->Clear();
+			return true;
 		}
-		void Sort()
+
+		if (strncmp(line, kSubscribe, strlen(kSubscribe)) != 0)
 		{
-			qsort(m_packets, m_packetsEnd - m_packets, sizeof(m_packets[0]), PacketCompare);
+			return false;
 		}
 
-	private:
-		Packet*	m_packets;
-		Packet*	m_packetsEnd;
-		Packet*	m_packetsCapacityEnd;
-	};
-#else
-	struct PacketCollection
-	{
-		void Init(size_t) {}
-		void Close() {}
-		size_t GetMemoryOverhead() const
+		char category[16] = "";
+		char value[256] = "";
+
+		if (sscanf(line + strlen(kSubscribe), "%15s %255s", category, value) != 2)
 		{
-			return 0;
+			BEHAVIAC_LOGWARNING("invalid subscription: %s\n", line);
+			return true;
 		}
-	};
-#endif // #if USING_BEHAVIAC_SEQUENTIAL
 
-	class PacketBuffer
-	{
-	public:
-		PacketBuffer(ConnectorInterface* c)
-			: m_connector(c), m_free(true)
+		bool bAdded = true;
+
+		if (strcmp(category, "agent") == 0)
 		{
+			bAdded = this->AddAgent(atoi(value));
 		}
-
-		void AddPacket(const Packet& packet);
-#if USING_BEHAVIAC_SEQUENTIAL
-		bool CollectPackets(PacketCollection& coll)
+		else if (strcmp(category, "tree") == 0)
 		{
-			Packet* packet = m_packetQueue.Peek();
+			bAdded = this->AddTree(value);
+		}
+		else if (strcmp(category, "kind") == 0)
+		{
+			static const char* kKindNames[] = { "tick", "breakpoint", "property", "profiler", "log" };
+			static const uint32_t kKinds[] = { MessageKind::MSGKIND_TICK, MessageKind::MSGKIND_BREAKPOINT, MessageKind::MSGKIND_PROPERTY,
+											   MessageKind::MSGKIND_PROFILER, MessageKind::MSGKIND_LOG };
 
-			while (packet)
-			{
-				if (coll.Add(*packet))
-				{
-					m_packetQueue.Pop();
-					packet = m_packetQueue.Peek();
+			bAdded = false;
 
-				}
-				else
+			for (size_t i = 0; i < sizeof(kKinds) / sizeof(kKinds[0]); ++i)
+			{
+				if (strcmp(value, kKindNames[i]) == 0)
 				{
-					return false;
+					this->AddKinds(kKinds[i]);
+					bAdded = true;
+					break;
 				}
 			}
-
-			return true;
 		}
-#endif
-		void SendPackets(behaviac::Socket::Handle& h)
+		else
 		{
-			Packet* packet = m_packetQueue.Peek();
+			bAdded = false;
+		}
 
-			while (packet)
-			{
-				const size_t bytesToSend = packet->PrepareToSend();
-				size_t bytesWritten(0);
-				const bool success = behaviac::Socket::Write(h, packet, bytesToSend, bytesWritten);
+		if (!bAdded)
+		{
+			BEHAVIAC_LOGWARNING("subscription not added: %s\n", line);
+		}
 
-				// Failed to send data. Most probably sending too much, break and
-				// hope for the best next time
-				if (!success || bytesWritten != bytesToSend)
-				{
-					BEHAVIAC_ASSERT(0);
-					BEHAVIAC_LOGWARNING("A packet is not correctly sent...\n");
-					break;
-				}
+		return true;
+	}
 
-				m_packetQueue.Pop();	// 'Commit' pop if data sent.
-				packet = m_packetQueue.Peek();
-			}
+	bool SubscriptionFilter::Match(uint32_t kindMask, int agentId, uint32_t treeId) const
+	{
+		if (this->kinds != 0 && (this->kinds & kindMask) == 0)
+		{
+			return false;
 		}
 
-		ConnectorInterface* m_connector;
-		bool				m_free;
+		//the messages not about an agent are only filtered by the kinds
+		if (agentId < 0)
+		{
+			return true;
+		}
 
-		void Clear()
+		if (this->agentCount > 0)
 		{
-			Packet* packet = m_packetQueue.Peek();
+			bool bFound = false;
+
+			for (int i = 0; i < this->agentCount && !bFound; ++i)
+			{
+				bFound = (this->agents[i] == agentId);
+			}
 
-			while (packet)
+			if (!bFound)
 			{
-				m_packetQueue.Pop();	// 'Commit' pop if data sent.
-				packet = m_packetQueue.Peek();
+				return false;
 			}
 		}
-	private:
-		enum { MAX_PACKETS_IN_BUFFER = kLocalQueueSize };
 
-		behaviac::SPSCQueue<Packet, MAX_PACKETS_IN_BUFFER>	m_packetQueue;
-	};
+		if (this->treeCount > 0)
+		{
+			bool bFound = false;
 
-	class CustomObjectPool : public ObjectPool<Packet>
-	{
-	public:
-		CustomObjectPool(uint32_t objectCountPerSegment) : ObjectPool<Packet>(objectCountPerSegment)
-		{}
+			for (int i = 0; i < this->treeCount && !bFound; ++i)
+			{
+				bFound = (this->trees[i] == treeId);
+			}
 
-		virtual ~CustomObjectPool()
-		{}
-	};
+			if (!bFound)
+			{
+				return false;
+			}
+		}
 
-#if BEHAVIAC_CCDEFINE_MSVC
-	static int32_t t_packetBufferIndex = TLS_OUT_OF_INDEXES;
-#elif BEHAVIAC_CCDEFINE_APPLE || BEHAVIAC_CCDEFINE_ANDROID
-	static __thread int32_t t_packetBufferIndex = (int32_t)-1;
-#else
-	static __thread int32_t t_packetBufferIndex = (int32_t)-1;
-#endif
+		return true;
+	}
 
 	ConnectorInterface::ConnectorInterface() :
 		m_port(0),
-		m_writeSocket(0),
-		m_packetBuffers(0),
-		m_packetCollection(0),
-		m_packetPool(0),
-		m_maxTracedThreads(0),
+		m_serverSocket(0),
+		m_poller(0),
+		m_connectingClient(-1),
+		m_socketThreadId(0),
+		m_bAccepting(false),
+		m_packetRing(0),
+		m_recordedRing(0),
 		m_isInited(0),
 		m_isConnected(0),
 		m_isDisconnected(0),
@@ -243,25 +241,13 @@ namespace behaviac
 		this->Close();
 	}
 
-	bool ConnectorInterface::Init(int maxTracedThreads, unsigned short port, bool bBlocking)
+	bool ConnectorInterface::Init(unsigned short port, bool bBlocking)
 	{
 		this->Clear();
-#if BEHAVIAC_CCDEFINE_MSVC
-		t_packetBufferIndex = TlsAlloc();
-		//initially 0
-		//TlsSetValue(t_packetBufferIndex, 0);
-#else
-		//t_packetBufferIndex = 0;
-		//printf("Init t_packetBufferIndex = %d\n", t_packetBufferIndex);
-#endif//BEHAVIAC_CCDEFINE_MSVC
 		m_port = (unsigned short)-1;
 
-		m_packetPool = BEHAVIAC_NEW CustomObjectPool(4096);
-		m_packetCollection = BEHAVIAC_NEW PacketCollection;
-		m_packetBuffers = BEHAVIAC_G_NEW_ARRAY(PacketBuffer*, maxTracedThreads);
-		memset(m_packetBuffers, 0, sizeof(PacketBuffer*) * maxTracedThreads);
-		m_maxTracedThreads = maxTracedThreads;
-		m_packetCollection->Init(kGlobalQueueSize);
+		m_packetRing = BEHAVIAC_NEW PacketRing;
+		m_recordedRing = BEHAVIAC_NEW PacketRing;
 
 		if (!behaviac::Socket::InitSockets())
 		{
@@ -273,7 +259,6 @@ namespace behaviac
 			BEHAVIAC_ASSERT(gs_threadFlag.value() == 0);
 			BEHAVIAC_LOGINFO("behaviac: ConnectorInterface::Init Enter\n");
 			BEHAVIAC_LOGINFO("behaviac: listing at port %d\n", port);
-			this->ReserveThreadPacketBuffer();
 			this->SetConnectPort(port);
 
 			BEHAVIAC_ASSERT(gs_threadFlag.value() == 0);
@@ -317,7 +302,7 @@ namespace behaviac
 
 		AtomicInc(m_isInited);
 
-		return m_packetBuffers != 0;
+		return true;
 	}
 
 	void ConnectorInterface::Close()
@@ -337,18 +322,6 @@ namespace behaviac
 				}
 			}
 
-			{
-				ScopedLock lock(m_packetBuffersLock);
-
-				for (int i = 0; i < this->m_maxTracedThreads; ++i)
-				{
-					BEHAVIAC_DELETE(m_packetBuffers[i]);
-				}
-
-				BEHAVIAC_G_DELETE_ARRAY(m_packetBuffers);
-				m_packetBuffers = 0;
-			}
-
 			if (!thread::IsThreadTerminated(s_tracerThread))
 			{
 				thread::StopThread(s_tracerThread);
@@ -357,26 +330,12 @@ namespace behaviac
 			s_tracerThread = 0;
 		}
 
-		if (m_packetCollection)
-		{
-			m_packetCollection->Close();
-			BEHAVIAC_DELETE(m_packetCollection);
-			m_packetCollection = 0;
-		}
-
-		BEHAVIAC_DELETE(m_packetPool);
-		m_packetPool = 0;
-#if BEHAVIAC_CCDEFINE_MSVC
+		BEHAVIAC_DELETE(m_packetRing);
+		m_packetRing = 0;
 
-		if (t_packetBufferIndex != TLS_OUT_OF_INDEXES)
-		{
-			TlsFree(t_packetBufferIndex);
-			t_packetBufferIndex = TLS_OUT_OF_INDEXES;
-		}
+		BEHAVIAC_DELETE(m_recordedRing);
+		m_recordedRing = 0;
 
-#else
-		t_packetBufferIndex = 0;
-#endif
 		behaviac::Socket::ShutdownSockets();
 
 		AtomicDec(m_isInited);
@@ -396,7 +355,7 @@ namespace behaviac
 
 	bool ConnectorInterface::IsConnected() const
 	{
-		return m_isConnected != 0 && this->m_writeSocket;
+		return m_isConnected != 0;
 	}
 
 	bool ConnectorInterface::IsDisconnected() const
@@ -419,209 +378,387 @@ namespace behaviac
 		this->m_port = port;
 	}
 
-	int ConnectorInterface::GetBufferIndex(bool bReserve)
+	uint8_t* ConnectorInterface::ReservePacket(uint32_t dataSize, uint32_t clients)
 	{
-#if BEHAVIAC_CCDEFINE_MSVC
-		BEHAVIAC_ASSERT(t_packetBufferIndex != TLS_OUT_OF_INDEXES);
-		int32_t bufferIndex = (int32_t)(uint64_t)TlsGetValue(t_packetBufferIndex);
-#else
-		//BEHAVIAC_ASSERT(t_packetBufferIndex != (unsigned int) - 1);
-		int32_t bufferIndex = t_packetBufferIndex;
-#endif
-		//BEHAVIAC_LOGINFO("GetBufferIndex %d %d\n", bufferIndex, bReserve ? 1 : 0);
+		if (!this->IsConnected() || !m_packetRing)
+		{
+			return 0;
+		}
 
-		//WHEN bReserve is false, it is unsafe to allocate memory as other threads might be allocating
-		//you can avoid the following assert to malloc a block of memory in your thread at the very beginning
+		uint32_t released = m_packetsReleased.GetCount();
+		uint8_t* pData = m_packetRing->Reserve(dataSize, clients);
 
-		if (bufferIndex <= 0 && bReserve)
+		// Wait until there is a place for new packet.
+		// If this happens to often, it means we are producing packets
+		// quicker than consuming them, increasing kPacketRingSize could help.
+		while (!pData)
 		{
-			bufferIndex = ReserveThreadPacketBuffer();
+			if (behaviac::GetTID() == m_socketThreadId)
+			{
+				//the socket thread is the one to make the place
+				this->SendAllPackets();
+			}
+			else
+			{
+				//it wakes up now and then to find out the disconnection
+				m_packetsReleased.Wait(released, 100);
+			}
+
+			if (!this->IsConnected())
+			{
+				Log("ReservePacket error: disconnected\n");
+				return 0;
+			}
+
+			released = m_packetsReleased.GetCount();
+			pData = m_packetRing->Reserve(dataSize, clients);
 		}
 
-		return (int)bufferIndex;
+		return pData;
+	}
+
+	void ConnectorInterface::CommitPacket(uint8_t* pData)
+	{
+		m_packetRing->Commit(pData);
+
+		AtomicInc(this->m_packetsCount);
 	}
 
-	void ConnectorInterface::AddPacket(const Packet& packet, bool bReserve)
+	void ConnectorInterface::AddPacket(const Packet& packet)
 	{
-		if (this->IsConnected() && this->m_writeSocket != 0)
+		//the packet is sent from its 'messageSize' to the end of its message
+		const uint32_t messageSize = packet.CalcPacketSize();
+		BEHAVIAC_ASSERT(messageSize < kMaxPacketSize);
+
+		uint8_t* pData = this->ReservePacket(messageSize + 1, packet.clients);
+
+		if (pData)
 		{
-			int bufferIndex = this->GetBufferIndex(bReserve);
+			pData[0] = (uint8_t)messageSize;
+			memcpy(pData + 1, &packet.command, messageSize);
 
-			if (bufferIndex > 0)
-			{
-				m_packetBuffers[bufferIndex]->AddPacket(packet);
+			this->CommitPacket(pData);
+		}
+	}
 
-				this->m_packetsCount++;
-			}
-			else
+	void ConnectorInterface::RecordText(const char* text)
+	{
+		if (this->m_recordedRing)
+		{
+			const uint32_t length = (uint32_t)strnlen(text, kMaxTextLength);
+
+			//if it is out of memory here, please check 'SetupConnection'
+			uint8_t* pData = this->m_recordedRing->Reserve(length + 2, kAllClients);
+
+			if (pData)
 			{
-				Log("AddPacket error: bufferIndex < 0\n");
+				pData[0] = (uint8_t)(length + 1);
+				pData[1] = CommandId::CMDID_TEXT;
+				memcpy(pData + 2, text, length);
+
+				this->m_recordedRing->Commit(pData);
 			}
 		}
 	}
 
-	void ConnectorInterface::RecordText(const char* text)
+	/**
+	write all of 'buffers', a partial write is resumed from where it stopped.
+
+	return false if it can't be written, the connection is then dropped as the rest of a packet can't follow another one
+	*/
+	static bool WriteBuffers(behaviac::Socket::Handle& h, behaviac::Socket::Buffer* buffers, int count)
 	{
-		if (this->m_packetPool)
+		while (count > 0)
 		{
-			//if it is out of memory here, please check 'SetupConnection'
-			Packet* pP = this->m_packetPool->Allocate();
+			size_t bytesWritten(0);
+
+			if (!behaviac::Socket::WriteV(h, buffers, count, bytesWritten))
+			{
+				BEHAVIAC_LOGWARNING("packets are not correctly sent, the connection is dropped...\n");
+
+				if (h)
+				{
+					behaviac::Socket::Close(h);
+				}
+
+				return false;
+			}
 
-			if (pP)
+			while (count > 0 && bytesWritten >= buffers->bytes)
 			{
-				pP->Init(CommandId::CMDID_TEXT, s_seq.Next());
+				bytesWritten -= buffers->bytes;
+				buffers++;
+				count--;
+			}
 
-				Text* pT = (Text*)pP->data;
-				string_ncpy(pT->buffer, text, kMaxTextLength);
-				pT->buffer[kMaxTextLength] = '\0';
+			if (count > 0)
+			{
+				buffers->data = (const uint8_t*)buffers->data + bytesWritten;
+				buffers->bytes -= bytesWritten;
 			}
 		}
+
+		return true;
 	}
 
-	void ConnectorInterface::SendAllPackets()
+	/**
+	send the records between 'readIndex' and 'endIndex' of the clients of 'clientMask' to 'h' with as few writes as it takes
+
+	return the number of the records sent
+	*/
+	static int SendRecords(behaviac::Socket::Handle& h, PacketRing& ring, uint32_t readIndex, uint32_t endIndex, uint32_t clientMask)
 	{
-		for (int i = 0; i < m_maxTracedThreads; ++i)
+		behaviac::Socket::Buffer buffers[behaviac::Socket::kMaxWriteBuffers];
+		int count = 0;
+		int sent = 0;
+
+		while (readIndex != endIndex && h)
 		{
-			if (m_packetBuffers[i] && !m_packetBuffers[i]->m_free)
+			PacketRing::Record* pRecord = ring.Read(readIndex);
+
+			if (!pRecord)
+			{
+				break;
+			}
+
+			if (pRecord->tag & clientMask)
 			{
-#if USING_BEHAVIAC_SEQUENTIAL
+				buffers[count].data = pRecord->GetData();
+				buffers[count].bytes = pRecord->dataSize;
+				count++;
+			}
 
-				if (!m_packetBuffers[i]->CollectPackets(*m_packetCollection))
+			if (count == behaviac::Socket::kMaxWriteBuffers || (count > 0 && readIndex == endIndex))
+			{
+				if (!WriteBuffers(h, buffers, count))
 				{
 					break;
 				}
 
-#else
-				m_packetBuffers[i].SendPackets(m_writeSocket);
-#endif
+				sent += count;
+				count = 0;
 			}
 		}
 
-#if USING_BEHAVIAC_SEQUENTIAL
-		// TODO: Deal with Socket::Write failures.
-		// (right now packet is lost).
-		m_packetCollection->Sort();
+		return sent;
+	}
+
+	void ConnectorInterface::SendAllPackets()
+	{
+		if (!m_packetRing)
+		{
+			return;
+		}
+
+		//the records are in the order they are reserved in, the threads' packets need no sorting
+		const uint32_t readIndex = m_packetRing->GetReadIndex();
+		uint32_t endIndex = readIndex;
+		int count = 0;
 
-		for (Packet* p = m_packetCollection->Begin(); p != m_packetCollection->End() && this->m_writeSocket; ++p)
+		while (m_packetRing->Read(endIndex))
 		{
-			const size_t bytesToSend = p->PrepareToSend();
-			size_t bytesWritten(0);
-			behaviac::Socket::Write(m_writeSocket, p, bytesToSend, bytesWritten);
+			count++;
 		}
 
-		m_packetCollection->Reset();
-#endif
-		this->m_packetsCount = 0;
+		if (count == 0)
+		{
+			return;
+		}
+
+		for (int i = 0; i < kMaxClients; ++i)
+		{
+			Client& client = this->m_clients[i];
+
+			if (client.socket)
+			{
+				SendRecords(client.socket, *m_packetRing, readIndex, endIndex, 1 << i);
+			}
+		}
+
+		m_packetRing->Release(endIndex);
+
+		AtomicAdd(this->m_packetsCount, -count);
+
+		m_packetsReleased.NotifyAll();
 	}
 
-	int ConnectorInterface::ReserveThreadPacketBuffer()
+	bool ConnectorInterface::ReceivePackets(const char* msgCheck)
 	{
-#if BEHAVIAC_CCDEFINE_MSVC
-		int32_t bufferIndex = (int32_t)(uint64_t)TlsGetValue(t_packetBufferIndex);
-#else
-		int32_t bufferIndex = t_packetBufferIndex;
-#endif
-		//THREAD_ID_TYPE id = behaviac::GetTID();
-		//BEHAVIAC_LOGINFO("ReserveThreadPacketBuffer 1:%d thread %p\n", bufferIndex, id);
+		bool found = false;
 
-		//bufferIndex initially is 0
-		if (bufferIndex <= 0)
+		if (this->m_poller)
 		{
-			int retIndex(-2);
-
-			ScopedLock lock(m_packetBuffersLock);
+			behaviac::Socket::Handle ready[behaviac::Socket::Poller::kMaxHandles];
+			int count = this->m_poller->Wait(ready, behaviac::Socket::Poller::kMaxHandles, 1);
 
-			// NOTE: This is quite naive attempt to make sure that main thread queue
-			// is the last one (rely on the fact that it's most likely to be the first
-			// one trying to send message). This means EndFrame event should be sent after
-			// memory operations from that frame.
-			// (doesn't matter in SEQUENTIAL mode).
-			for (int i = m_maxTracedThreads - 1; i >= 0; --i)
+			for (int i = 0; i < count; ++i)
 			{
-				if (!m_packetBuffers[i])
+				if (ready[i] == this->m_serverSocket)
 				{
-					ScopedInt_t scopedInt(&gs_threadFlag);
-					m_packetBuffers[i] = BEHAVIAC_NEW PacketBuffer(this);
+					//accepted by ThreadFunc, not in the middle of OnConnection
+					this->m_bAccepting = true;
+					continue;
 				}
 
-				if (m_packetBuffers[i])
+				for (int c = 0; c < kMaxClients; ++c)
 				{
-					if (m_packetBuffers[i]->m_free)
+					if (this->m_clients[c].socket == ready[i])
 					{
-						m_packetBuffers[i]->m_free = false;
-						retIndex = i;
+						if (this->ReceiveFrom(c, msgCheck))
+						{
+							found = true;
+						}
+
 						break;
 					}
 				}
 			}
+		}
 
-			//BEHAVIAC_LOGINFO("ReserveThreadPacketBuffer 3:%d thread %p\n", retIndex, id);
+		if (this->m_bHandleMessage)
+		{
+			behaviac::string msgs;
 
-			if (retIndex > 0)
-			{
-#if BEHAVIAC_CCDEFINE_MSVC
-				TlsSetValue(t_packetBufferIndex, (PVOID)(uint64_t)retIndex);
-#else
-				t_packetBufferIndex = retIndex;
-#endif
-			}
-			else
+			if (this->ReadText(msgs))
 			{
-				Log("behaviac: Couldn't reserve packet buffer, too many active threads.\n");
-				BEHAVIAC_ASSERT(false);
-			}
-
-			bufferIndex = retIndex;
+				this->OnRecieveMessages(msgs);
 
-			//BEHAVIAC_LOGINFO("ReserveThreadPacketBuffer 2:%d thread %p\n", bufferIndex, id);
+				return true;
+			}
 		}
 
-		return bufferIndex;
+		return found;
 	}
 
-	bool ConnectorInterface::ReceivePackets(const char* msgCheck)
+	bool ConnectorInterface::ReceiveFrom(int clientIndex, const char* msgCheck)
 	{
 		const int kBufferLen = 2048;
-		char buffer[kBufferLen];
+		char buffer[kBufferLen] = "";
 
-		bool found = false;
+		Client& client = this->m_clients[clientIndex];
 
-		while (size_t reads = behaviac::Socket::Read(m_writeSocket, buffer, kBufferLen))
-		{
-			buffer[reads] = '\0';
-			//printf("ReceivePackets %s\n", buffer);
+		size_t reads = behaviac::Socket::Read(client.socket, buffer, kBufferLen - 1);
 
+		if (reads == 0)
+		{
+			//it is readable but nothing is read, the client has closed the connection
+			if (client.socket)
 			{
-				ScopedLock lock(ms_cs);
-
-				ms_texts += buffer;
+				behaviac::Socket::Close(client.socket);
 			}
 
-			if (msgCheck && strstr(buffer, msgCheck))
+			return false;
+		}
+
+		buffer[reads] = '\0';
+		//printf("ReceivePackets %s\n", buffer);
+
+		bool found = msgCheck && strstr(buffer, msgCheck) &&
+					 (this->m_connectingClient < 0 || this->m_connectingClient == clientIndex);
+
+		client.received += buffer;
+
+		//the subscriptions are handled here, the other complete lines are left to ReadText
+		behaviac::string texts;
+		size_t lineStart = 0;
+		SubscriptionFilter filter = client.filter;
+		bool bFilterChanged = false;
+
+		for (size_t lineEnd = client.received.find('\n'); lineEnd != behaviac::string::npos; lineEnd = client.received.find('\n', lineStart))
+		{
+			behaviac::string line = client.received.substr(lineStart, lineEnd + 1 - lineStart);
+
+			if (filter.Parse(line.c_str()))
 			{
-				//printf("ReceivePackets found\n");
-				found = true;
+				bFilterChanged = true;
 			}
-
-			if (this->m_writeSocket == 0)
+			else
 			{
-				break;
+				texts += line;
 			}
+
+			lineStart = lineEnd + 1;
 		}
 
-		if (this->m_bHandleMessage)
+		client.received.erase(0, lineStart);
+
+		if (bFilterChanged)
 		{
-			behaviac::string msgs;
+			this->PublishFilter(client, filter, client.bSubscribing);
+		}
 
-			if (this->ReadText(msgs))
+		if (!texts.empty())
+		{
+			ScopedLock lock(ms_cs);
+
+			ms_texts += texts;
+		}
+
+		return found;
+	}
+
+	void ConnectorInterface::PublishFilter(Client& client, const SubscriptionFilter& filter, bool bSubscribing)
+	{
+		//odd while it is written
+		AtomicInc(client.filterSeq);
+
+		client.filter = filter;
+		client.bSubscribing = bSubscribing;
+
+		AtomicInc(client.filterSeq);
+	}
+
+	uint32_t ConnectorInterface::GetSubscribers(uint32_t kindMask, int agentId, const char* treeName) const
+	{
+		uint32_t clients = 0;
+		uint32_t treeId = 0;
+		bool bTreeId = false;
+
+		for (int i = 0; i < kMaxClients; ++i)
+		{
+			const Client& client = this->m_clients[i];
+			bool bMatched = false;
+
+			//read again if the socket thread changed it meanwhile
+			for (;;)
 			{
-				this->OnRecieveMessages(msgs);
+				Atomic32 seq = Load_Acquire(client.filterSeq);
 
-				return true;
+				if (seq & 1)
+				{
+					thread::Sleep(0);
+					continue;
+				}
+
+				bMatched = false;
+
+				if (client.bSubscribing)
+				{
+					//the crc is only calculated when any client subscribes to trees
+					if (client.filter.treeCount > 0 && !bTreeId)
+					{
+						treeId = treeName ? CRC32::CalcCRC(treeName) : 0;
+						bTreeId = true;
+					}
+
+					bMatched = client.filter.Match(kindMask, agentId, treeId);
+				}
+
+				MemoryReadBarrier();
+
+				if (client.filterSeq == seq)
+				{
+					break;
+				}
+			}
+
+			if (bMatched)
+			{
+				clients |= (1 << i);
 			}
 		}
 
-		return found;
+		return clients;
 	}
 
 	void ConnectorInterface::OnRecieveMessages(const behaviac::string& msgs)
@@ -638,21 +775,15 @@ namespace behaviac
 		{
 			ScopedInt_t scopedInt(&gs_threadFlag);
 			Log("behaviac: Socket Thread Starting\n");
-#if BEHAVIAC_CCDEFINE_MSVC
-			BEHAVIAC_ASSERT(t_packetBufferIndex != TLS_OUT_OF_INDEXES);
-#else
-			//printf("ThreadFunc t_packetBufferIndex = %d\n", t_packetBufferIndex);
-			//BEHAVIAC_ASSERT(t_packetBufferIndex != (unsigned int)-1);
-#endif//
 		}
 		namespace Socket = behaviac::Socket;
 		const bool blockingSocket = true;
-		behaviac::Socket::Handle	serverSocket = 0;
+		Socket::Poller poller;
 		{
 			ScopedInt_t scopedInt(&gs_threadFlag);
-			serverSocket = Socket::Create(blockingSocket);
+			m_serverSocket = Socket::Create(blockingSocket);
 
-			if (!serverSocket)
+			if (!m_serverSocket)
 			{
 				Log("behaviac: Couldn't create server socket.\n");
 				return;
@@ -662,11 +793,10 @@ namespace behaviac
 			string_sprintf(bufferTemp, "behaviac: Listening at port %d...\n", m_port);
 			Log(bufferTemp);
 
-			// max connections: 1, don't allow multiple clients?
-			if (!Socket::Listen(serverSocket, m_port, 1))
+			if (!Socket::Listen(m_serverSocket, m_port, kMaxClients) || !poller.Add(m_serverSocket))
 			{
 				Log("behaviac: Couldn't configure server socket.\n");
-				Socket::Close(serverSocket);
+				Socket::Close(m_serverSocket);
 				return;
 			}
 		}
@@ -674,128 +804,169 @@ namespace behaviac
 		BEHAVIAC_ASSERT(gs_threadFlag.value() == 0);
 #endif
 
-		this->ReserveThreadPacketBuffer();
+		//the packets added on this thread are the ones of OnConnection, they are only for the client being connected
+		m_socketThreadId = behaviac::GetTID();
+		m_poller = &poller;
 
 		while (!m_terminating)
 		{
-#if BEHAVIAC_CCDEFINE_MSVC
+			SendAllPackets();
 
-			//wait for connecting
-			while (!m_terminating)
+			//it waits at most 1ms for the clients or the connecting
+			ReceivePackets();
+
+			this->RemoveClosedClients();
+
+			if (m_bAccepting && !m_terminating)
 			{
-				//Log("Socket::TestConnection.\n");
-				if (Socket::TestConnection(serverSocket))
-				{
-					break;
-				}
+				m_bAccepting = false;
 
-				behaviac::thread::Sleep(100);
+				this->AcceptClient();
 			}
+		}//while (!m_terminating)
 
-#endif
+		BEHAVIAC_ASSERT(gs_threadFlag.value() == 0);
+
+		// One last time, to send any outstanding packets out there.
+		if (this->IsConnected())
+		{
+			SendAllPackets();
+		}
 
-			if (!m_terminating)
+		for (int i = 0; i < kMaxClients; ++i)
+		{
+			if (m_clients[i].socket)
 			{
-				BEHAVIAC_ASSERT(gs_threadFlag.value() == 0);
-				Log("behaviac: accepting...\n");
-				{
-					ScopedInt_t scopedInt(&gs_threadFlag);
-					m_writeSocket = Socket::Accept(serverSocket, kSocketBufferSize);
+				Socket::Close(m_clients[i].socket);
+			}
+		}
 
-					if (!m_writeSocket)
-					{
-						Log("behaviac: Couldn't create write socket.\n");
-						Socket::Close(serverSocket);
-						return;
-					}
+		this->RemoveClosedClients();
 
-					Log("behaviac: connection accepted\n");
-				}
+		m_poller = 0;
+		Socket::Close(m_serverSocket);
 
-				BEHAVIAC_ASSERT(gs_threadFlag.value() == 0);
+		this->Clear();
 
-				{
-					ScopedInt_t scopedInt(&gs_threadFlag);
+		BEHAVIAC_ASSERT(gs_threadFlag.value() == 0);
 
-					AtomicInc(m_isConnected);
-					behaviac::thread::Sleep(1);
+		Log("behaviac: ThreadFunc exited. \n");
+	}
 
-					OnConnection();
+	void ConnectorInterface::AcceptClient()
+	{
+		namespace Socket = behaviac::Socket;
 
-					AtomicInc(m_isConnectedFinished);
-					behaviac::thread::Sleep(1);
+		BEHAVIAC_ASSERT(gs_threadFlag.value() == 0);
+		Log("behaviac: accepting...\n");
 
-					//this->OnConnectionFinished();
+		Socket::Handle h = 0;
+		{
+			ScopedInt_t scopedInt(&gs_threadFlag);
+			h = Socket::Accept(m_serverSocket, kSocketBufferSize);
+		}
 
-					Log("behaviac: after Connected.\n");
-				}
+		if (!h)
+		{
+			Log("behaviac: Couldn't create write socket.\n");
+			return;
+		}
 
-				BEHAVIAC_ASSERT(gs_threadFlag.value() == 0);
+		int clientIndex = -1;
 
-				while (!m_terminating && this->m_writeSocket)
-				{
-					behaviac::thread::Sleep(1);
-					SendAllPackets();
+		for (int i = 0; i < kMaxClients; ++i)
+		{
+			if (!m_clients[i].accepted)
+			{
+				clientIndex = i;
+				break;
+			}
+		}
 
-					ReceivePackets();
-				}
+		if (clientIndex < 0 || !m_poller->Add(h))
+		{
+			Log("behaviac: too many clients, the connection is refused.\n");
+			Socket::Close(h);
+			return;
+		}
 
-				BEHAVIAC_ASSERT(gs_threadFlag.value() == 0);
+		{
+			ScopedInt_t scopedInt(&gs_threadFlag);
 
-				// One last time, to send any outstanding packets out there.
-				if (this->m_writeSocket)
-				{
-					SendAllPackets();
+			Client& client = m_clients[clientIndex];
+			client.received.clear();
+			client.accepted = h;
+			client.socket = h;
 
-					Socket::Close(m_writeSocket);
-				}
+			this->PublishFilter(client, SubscriptionFilter(), true);
 
-				this->Clear();
+			Log("behaviac: connection accepted\n");
 
-				Log("behaviac: disconnected. \n");
-			}
-		}//while (!m_terminating)
+			m_connectingClient = clientIndex;
+			AtomicInc(m_isConnected);
+			behaviac::thread::Sleep(1);
 
-		Socket::Close(serverSocket);
+			OnConnection();
 
-		this->Clear();
+			m_connectingClient = -1;
 
-		BEHAVIAC_ASSERT(gs_threadFlag.value() == 0);
+			if (!m_isConnectedFinished)
+			{
+				AtomicInc(m_isConnectedFinished);
+			}
 
-		Log("behaviac: ThreadFunc exited. \n");
-	}
+			behaviac::thread::Sleep(1);
 
-	size_t ConnectorInterface::GetMemoryOverhead() const
-	{
-		size_t threads = GetNumTrackedThreads();
-		size_t bufferSize = sizeof(PacketBuffer) * threads;
-		size_t packetCollectionSize = m_packetCollection ? m_packetCollection->GetMemoryOverhead() : 0;
-		size_t packetPoolSize = m_packetPool ? m_packetPool->GetMemoryUsage() : 0;
-		return bufferSize + packetCollectionSize + packetPoolSize;
+			Log("behaviac: after Connected.\n");
+		}
+
+		BEHAVIAC_ASSERT(gs_threadFlag.value() == 0);
 	}
 
-	size_t ConnectorInterface::GetNumTrackedThreads() const
+	void ConnectorInterface::RemoveClosedClients()
 	{
-		size_t numTrackedThreads(0);
-
-		if (m_packetBuffers)
+		for (int i = 0; i < kMaxClients; ++i)
 		{
-			for (int i = 0; i < m_maxTracedThreads; ++i)
+			Client& client = m_clients[i];
+
+			if (client.accepted && !client.socket)
 			{
-				if (m_packetBuffers[i] && !m_packetBuffers[i]->m_free)
+				this->PublishFilter(client, SubscriptionFilter(), false);
+
+				m_poller->Remove(client.accepted);
+				client.accepted = 0;
+
+				AtomicDec(m_isConnected);
+
+				Log("behaviac: disconnected. \n");
+
+				//the last one is gone, the next one starts from the beginning
+				if (!m_isConnected && !m_terminating)
 				{
-					++numTrackedThreads;
+					this->Clear();
 				}
 			}
 		}
+	}
+
+	behaviac::Socket::Handle& ConnectorInterface::GetConnectingSocket()
+	{
+		BEHAVIAC_ASSERT(m_connectingClient >= 0);
 
-		return numTrackedThreads;
+		return m_clients[m_connectingClient].socket;
+	}
+
+	size_t ConnectorInterface::GetMemoryOverhead() const
+	{
+		size_t packetRingSize = m_packetRing ? sizeof(PacketRing) : 0;
+		size_t recordedRingSize = m_recordedRing ? sizeof(PacketRing) : 0;
+		return packetRingSize + recordedRingSize;
 	}
 
 	int ConnectorInterface::GetPacketsCount() const
 	{
-		//not thread safe
-		return m_packetsCount;
+		//the packets committed and not sent yet
+		return (int)m_packetsCount;
 	}
 
 	void ConnectorInterface::Log(const char* msg)
@@ -812,77 +983,60 @@ namespace behaviac
 		this->m_isConnectedFinished = 0;
 		this->m_terminating = 0;
 
-		if (this->m_packetBuffers)
-		{
-			int bufferIndex = this->GetBufferIndex(false);
-
-			if (bufferIndex > 0)
-			{
-				this->m_packetBuffers[bufferIndex]->Clear();
-			}
-		}
-
-		if (this->m_packetPool)
+		//it is on the socket thread, the only one reading the rings
+		if (this->m_packetRing)
 		{
-			this->m_packetPool->Free();
+			this->m_packetRing->Drop();
 		}
 
-		if (this->m_packetCollection)
+		if (this->m_recordedRing)
 		{
-			this->m_packetCollection->Reset();
+			this->m_recordedRing->Drop();
 		}
 
 		this->m_packetsCount = 0;
 	}
 
-	struct PrepareSender
+	void ConnectorInterface::SendExistingPackets()
 	{
-		behaviac::Socket::Handle	writeSocket;
-
-		int packetsCount;
+		const uint32_t readIndex = this->m_recordedRing->GetReadIndex();
+		uint32_t endIndex = readIndex;
 
-		PrepareSender(behaviac::Socket::Handle s) : writeSocket(s), packetsCount(0)
+		while (this->m_recordedRing->Read(endIndex))
 		{
-
 		}
-	};
 
-	static void prepareSend(void* p, void* pData)
-	{
-		Packet* pPacket = (Packet*)p;
-		PrepareSender* pSender = (PrepareSender*)pData;
-
-		const size_t bytesToSend = pPacket->PrepareToSend();
-		size_t bytesWritten(0);
-		behaviac::Socket::Write(pSender->writeSocket, pPacket, bytesToSend, bytesWritten);
-
-		pSender->packetsCount++;
-	}
-
-	void ConnectorInterface::SendExistingPackets()
-	{
-		PrepareSender sender(m_writeSocket);
-		this->m_packetPool->ForEach(prepareSend, &sender);
+		SendRecords(this->GetConnectingSocket(), *this->m_recordedRing, readIndex, endIndex, kAllClients);
 
 		//wait for the finish
 		behaviac::thread::Sleep(1000);
 
-		this->m_packetPool->Free();
+		this->m_recordedRing->Release(endIndex);
 	}
 
-	void ConnectorInterface::SendText(const char* text, uint8_t commandId)
+	void ConnectorInterface::SendText(const char* text, uint8_t commandId, uint32_t clients)
 	{
 		if (this->IsConnected())
 		{
-			Packet packet(commandId, s_seq.Next());
+			if (m_connectingClient >= 0 && behaviac::GetTID() == m_socketThreadId)
+			{
+				//the initial messages of OnConnection are only for the client being connected
+				clients &= (1 << m_connectingClient);
+			}
+
+			//the text is written into the ring as it is sent, 'messageSize', 'command' and the text without '\0'
+			const uint32_t length = (uint32_t)strnlen(text, kMaxTextLength);
+			uint8_t* pData = this->ReservePacket(length + 2, clients);
 
-			char* pT = (char*)packet.data;
-			BEHAVIAC_ASSERT(kMaxTextLength < kMaxPacketDataSize);
+			if (pData)
+			{
+				pData[0] = (uint8_t)(length + sizeof(commandId));
+				pData[1] = commandId;
+				memcpy(pData + 2, text, length);
 
-			string_ncpy(pT, text, kMaxTextLength);
-			pT[kMaxTextLength] = '\0';
-			this->AddPacket(packet, true);
-			gs_packetsStats.texts++;
+				this->CommitPacket(pData);
+				gs_packetsStats.texts++;
+			}
 		}
 	}
 
@@ -900,24 +1054,4 @@ namespace behaviac
 
 		return false;
 	}
-
-	void PacketBuffer::AddPacket(const Packet& packet)
-	{
-		// Spin loop until there is a place for new packet.
-		// If this happens to often, it means we are producing packets
-		// quicker than consuming them, increasing max # of packets in buffer
-		// could help.
-		while (m_packetQueue.IsFull())
-		{
-			//BEHAVIAC_LOGINFO("packet buffer is full... buffer size: %d\n", MAX_PACKETS_IN_BUFFER);
-			behaviac::thread::Sleep(1);
-
-			if (!this->m_connector->GetWriteSocket())
-			{
-				break;
-			}
-		}
-
-		m_packetQueue.Push(packet);
-	}
 }
\ No newline at end of file
@@ -0,0 +1,257 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Tencent is pleased to support the open source community by making behaviac available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except in compliance with
+// the License. You may obtain a copy of the License at http://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and limitations under the License.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "behaviac/common/base.h"
+#include "behaviac/common/string/stringatom.h"
+#include "behaviac/common/crc.h"
+#include "behaviac/common/thread/mutex_lock.h"
+#include "behaviac/common/thread/wrapper.h"
+
+#include <string.h>
+
+namespace behaviac
+{
+	static const uint32_t kBlockBits = 10;
+	static const uint32_t kBlockSize = 1 << kBlockBits;
+	static const uint32_t kMaxBlocks = 1024;
+	static const uint32_t kChunkSize = 4096;
+
+	struct StringEntry
+	{
+		const char*	str;
+
+		/// the index of the next string of the same hash, 0 if it is the last
+		uint32_t	next;
+	};
+
+	//the entries are in blocks which are never moved, so that GetString doesn't need to lock
+	static StringEntry* gs_blocks[kMaxBlocks];
+
+	//the hash of a string to the index of the first string of that hash
+	typedef behaviac::map<uint32_t, uint32_t> Buckets_t;
+	static Buckets_t* gs_buckets = 0;
+
+	//the characters are copied into chunks, each of which starts with the pointer to the previous one
+	static char* gs_chunk = 0;
+	static uint32_t gs_chunkUsed = kChunkSize;
+
+	static const StringTable::Stats kEmptyStats = { 1, 1, 0, 0, 0 };
+	static StringTable::Stats gs_stats = kEmptyStats;
+
+	static behaviac::Mutex gs_stringTableMutex;
+
+	//set once the predefined strings are interned, it is read without locking by GetSubBTIndex
+	static Atomic32 gs_bCreated = 0;
+
+	static char* AllocChunk(uint32_t size)
+	{
+		char* chunk = (char*)BEHAVIAC_MALLOC(sizeof(char*) + size);
+		gs_stats.allocated += (uint32_t)(sizeof(char*) + size);
+
+		return chunk;
+	}
+
+	static const char* CopyString(const char* str, uint32_t length)
+	{
+		char* copy = 0;
+
+		//a long string has a chunk of its own, the current chunk is kept for the short ones
+		if (length > kChunkSize / 4)
+		{
+			char* chunk = AllocChunk(length);
+
+			if (gs_chunk != 0)
+			{
+				*(char**)chunk = *(char**)gs_chunk;
+				*(char**)gs_chunk = chunk;
+			}
+			else
+			{
+				*(char**)chunk = 0;
+				gs_chunk = chunk;
+				gs_chunkUsed = kChunkSize;
+			}
+
+			copy = chunk + sizeof(char*);
+		}
+		else
+		{
+			if (gs_chunkUsed + length > kChunkSize)
+			{
+				char* chunk = AllocChunk(kChunkSize);
+				*(char**)chunk = gs_chunk;
+
+				gs_chunk = chunk;
+				gs_chunkUsed = 0;
+			}
+
+			copy = gs_chunk + sizeof(char*) + gs_chunkUsed;
+			gs_chunkUsed += length;
+		}
+
+		memcpy(copy, str, length);
+
+		return copy;
+	}
+
+	static StringEntry& GetEntry(uint32_t index)
+	{
+		return gs_blocks[index >> kBlockBits][index & (kBlockSize - 1)];
+	}
+
+	static uint32_t AddString(const char* str);
+
+	//the lock is held
+	static void CreateTable()
+	{
+		if (gs_bCreated == 0)
+		{
+			gs_buckets = BEHAVIAC_NEW Buckets_t();
+
+			uint32_t subBT = AddString("SubBT");
+			BEHAVIAC_ASSERT(subBT == StringTable::kSubBTIndex);
+			BEHAVIAC_UNUSED_VAR(subBT);
+
+			Store_Release(gs_bCreated, (Atomic32)1);
+		}
+	}
+
+	uint32_t StringTable::Intern(const char* str)
+	{
+		if (str == 0 || *str == '\0')
+		{
+			return 0;
+		}
+
+		behaviac::ScopedLock lock(gs_stringTableMutex);
+
+		CreateTable();
+
+		return AddString(str);
+	}
+
+	//the lock is held
+	static uint32_t AddString(const char* str)
+	{
+		const uint32_t length = (uint32_t)strlen(str) + 1;
+		const uint32_t hash = CRC32::CalcCRC(str);
+
+		gs_stats.requests++;
+		gs_stats.requestedBytes += length;
+
+		Buckets_t::iterator it = gs_buckets->find(hash);
+		uint32_t next = 0;
+
+		if (it != gs_buckets->end())
+		{
+			for (uint32_t i = it->second; i != 0; i = GetEntry(i).next)
+			{
+				if (strcmp(GetEntry(i).str, str) == 0)
+				{
+					return i;
+				}
+			}
+
+			next = it->second;
+		}
+
+		const uint32_t index = gs_stats.strings;
+		const uint32_t block = index >> kBlockBits;
+
+		if (block >= kMaxBlocks)
+		{
+			BEHAVIAC_ASSERT(false, "the string table is full");
+			return 0;
+		}
+
+		if (gs_blocks[block] == 0)
+		{
+			gs_blocks[block] = (StringEntry*)BEHAVIAC_MALLOC(sizeof(StringEntry) * kBlockSize);
+			gs_stats.allocated += sizeof(StringEntry) * kBlockSize;
+		}
+
+		StringEntry& entry = GetEntry(index);
+		entry.str = CopyString(str, length);
+		entry.next = next;
+
+		if (next == 0)
+		{
+			//about the size of a node of the map
+			gs_stats.allocated += sizeof(Buckets_t::value_type) + 4 * sizeof(void*);
+		}
+
+		(*gs_buckets)[hash] = index;
+
+		gs_stats.strings++;
+		gs_stats.bytes += length;
+
+		return index;
+	}
+
+	const char* StringTable::GetString(uint32_t index)
+	{
+		if (index == 0)
+		{
+			return "";
+		}
+
+		BEHAVIAC_ASSERT(index < gs_stats.strings);
+
+		return GetEntry(index).str;
+	}
+
+	StringTable::Stats StringTable::GetStats()
+	{
+		behaviac::ScopedLock lock(gs_stringTableMutex);
+
+		return gs_stats;
+	}
+
+	uint32_t StringTable::GetSubBTIndex()
+	{
+		if (Load_Acquire(gs_bCreated) == 0)
+		{
+			behaviac::ScopedLock lock(gs_stringTableMutex);
+
+			CreateTable();
+		}
+
+		return kSubBTIndex;
+	}
+
+	void StringTable::Cleanup()
+	{
+		behaviac::ScopedLock lock(gs_stringTableMutex);
+
+		while (gs_chunk != 0)
+		{
+			char* prev = *(char**)gs_chunk;
+			BEHAVIAC_FREE(gs_chunk);
+			gs_chunk = prev;
+		}
+
+		gs_chunkUsed = kChunkSize;
+
+		for (uint32_t i = 0; i < kMaxBlocks && gs_blocks[i] != 0; ++i)
+		{
+			BEHAVIAC_FREE(gs_blocks[i]);
+			gs_blocks[i] = 0;
+		}
+
+		BEHAVIAC_DELETE(gs_buckets);
+		gs_buckets = 0;
+
+		gs_stats = kEmptyStats;
+		gs_bCreated = 0;
+	}
+}//namespace behaviac
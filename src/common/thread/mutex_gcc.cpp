@@ -18,6 +18,7 @@
 #if !BEHAVIAC_CCDEFINE_MSVC
 #include <pthread.h>
 #include <errno.h>
+#include <time.h>
 
 namespace behaviac
 {
@@ -85,6 +86,81 @@ namespace behaviac
     }
 
 #endif//BEHAVIAC_CCDEFINE_APPLE
+
+    struct ConditionVariable::ConditionVariableImpl
+    {
+        pthread_mutex_t _mutex;
+        pthread_cond_t  _cond;
+        uint32_t        _count;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////
+    ConditionVariable::ConditionVariable() : _impl(0)
+    {
+        BEHAVIAC_ASSERT(sizeof(m_Shadow) >= sizeof(ConditionVariableImpl));
+
+        _impl = (ConditionVariableImpl*)m_Shadow;
+
+        pthread_mutex_init(&_impl->_mutex, 0);
+        pthread_cond_init(&_impl->_cond, 0);
+        _impl->_count = 0;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    ConditionVariable::~ConditionVariable()
+    {
+        pthread_cond_destroy(&_impl->_cond);
+        pthread_mutex_destroy(&_impl->_mutex);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    uint32_t ConditionVariable::GetCount()
+    {
+        pthread_mutex_lock(&_impl->_mutex);
+        uint32_t count = _impl->_count;
+        pthread_mutex_unlock(&_impl->_mutex);
+
+        return count;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    bool ConditionVariable::Wait(uint32_t count, long timeoutMs)
+    {
+        //the deadline is in the realtime clock of pthread_cond_timedwait
+        timespec deadline;
+        clock_gettime(CLOCK_REALTIME, &deadline);
+        deadline.tv_sec += timeoutMs / 1000;
+        deadline.tv_nsec += (timeoutMs % 1000) * 1000000;
+
+        if (deadline.tv_nsec >= 1000000000)
+        {
+            deadline.tv_sec++;
+            deadline.tv_nsec -= 1000000000;
+        }
+
+        pthread_mutex_lock(&_impl->_mutex);
+
+        int rval = 0;
+
+        while (_impl->_count == count && rval != ETIMEDOUT)
+        {
+            rval = pthread_cond_timedwait(&_impl->_cond, &_impl->_mutex, &deadline);
+        }
+
+        bool bNotified = _impl->_count != count;
+        pthread_mutex_unlock(&_impl->_mutex);
+
+        return bNotified;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    void ConditionVariable::NotifyAll()
+    {
+        pthread_mutex_lock(&_impl->_mutex);
+        _impl->_count++;
+        pthread_cond_broadcast(&_impl->_cond);
+        pthread_mutex_unlock(&_impl->_mutex);
+    }
 }//namespace behaviac
 
 #endif//#if !BEHAVIAC_CCDEFINE_MSVC
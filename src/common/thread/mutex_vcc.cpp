@@ -53,6 +53,74 @@ namespace behaviac
         LeaveCriticalSection(&_impl->_criticalSection);
     }
 
+    struct ConditionVariable::ConditionVariableImpl
+    {
+        CRITICAL_SECTION    _criticalSection;
+        CONDITION_VARIABLE  _cond;
+        uint32_t            _count;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////
+    ConditionVariable::ConditionVariable()
+    {
+        BEHAVIAC_ASSERT(sizeof(m_Shadow) >= sizeof(ConditionVariableImpl));
+
+        _impl = (ConditionVariableImpl*)m_Shadow;
+
+        InitializeCriticalSection(&_impl->_criticalSection);
+        InitializeConditionVariable(&_impl->_cond);
+        _impl->_count = 0;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    ConditionVariable::~ConditionVariable()
+    {
+        DeleteCriticalSection(&_impl->_criticalSection);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    uint32_t ConditionVariable::GetCount()
+    {
+        EnterCriticalSection(&_impl->_criticalSection);
+        uint32_t count = _impl->_count;
+        LeaveCriticalSection(&_impl->_criticalSection);
+
+        return count;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    bool ConditionVariable::Wait(uint32_t count, long timeoutMs)
+    {
+        const ULONGLONG deadline = GetTickCount64() + timeoutMs;
+
+        EnterCriticalSection(&_impl->_criticalSection);
+
+        while (_impl->_count == count)
+        {
+            const ULONGLONG now = GetTickCount64();
+
+            if (now >= deadline || !SleepConditionVariableCS(&_impl->_cond, &_impl->_criticalSection, (DWORD)(deadline - now)))
+            {
+                break;
+            }
+        }
+
+        bool bNotified = _impl->_count != count;
+        LeaveCriticalSection(&_impl->_criticalSection);
+
+        return bNotified;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    void ConditionVariable::NotifyAll()
+    {
+        EnterCriticalSection(&_impl->_criticalSection);
+        _impl->_count++;
+        LeaveCriticalSection(&_impl->_criticalSection);
+
+        WakeAllConditionVariable(&_impl->_cond);
+    }
+
 }//namespace behaviac
 
 #endif//BEHAVIAC_CCDEFINE_MSVC
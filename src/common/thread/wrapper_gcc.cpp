@@ -33,6 +33,16 @@ namespace behaviac
         return i;
     }
 
+    Atomic32 AtomicAdd(volatile Atomic32& i, Atomic32 value)
+    {
+        return __sync_add_and_fetch(&i, value);
+    }
+
+    Atomic32 AtomicCompareExchange(volatile Atomic32& i, Atomic32 exchange, Atomic32 comparand)
+    {
+        return __sync_val_compare_and_swap(&i, comparand, exchange);
+    }
+
     void ThreadInt::Init()
     {
         if (!m_inited)
@@ -29,5 +29,15 @@ namespace behaviac
     {
         return InterlockedDecrement(reinterpret_cast<volatile long*>(&i));
     }
+
+    Atomic32 AtomicAdd(volatile Atomic32& i, Atomic32 value)
+    {
+        return InterlockedExchangeAdd(reinterpret_cast<volatile long*>(&i), value) + value;
+    }
+
+    Atomic32 AtomicCompareExchange(volatile Atomic32& i, Atomic32 exchange, Atomic32 comparand)
+    {
+        return InterlockedCompareExchange(reinterpret_cast<volatile long*>(&i), exchange, comparand);
+    }
 }
 #endif//#if BEHAVIAC_CCDEFINE_MSVC
@@ -191,7 +191,7 @@ namespace behaviac
     Workspace* Workspace::ms_instance = 0;
 
     Workspace::Workspace() : m_bInited(false), m_bExecAgents(true), m_fileFormat(Workspace::EFF_xml),
-		m_pBehaviorNodeLoader(0), m_behaviortreeCreators(0), 
+		m_pBehaviorNodeLoader(0), m_behaviortreeCreators(0), m_bundle(0),
 		m_frame(0), m_timeSinceStartup(-1), m_frameSinceStartup(-1)
     {
 #if BEHAVIAC_ENABLE_HOTRELOAD
@@ -206,6 +206,8 @@ namespace behaviac
 
     Workspace::~Workspace()
     {
+        this->CloseBundle();
+
         ms_instance = 0;
     }
 
@@ -478,6 +480,7 @@ namespace behaviac
         this->UnRegisterBasicNodes();
 
         Workspace::FreeFileBuffer();
+        this->CloseBundle();
         BaseStop();
 
         this->m_bInited = false;
@@ -553,6 +556,18 @@ namespace behaviac
 
 		bufferSize = fileSize + 1;
 
+		char* pBuffer = this->AllocFileBuffer(bufferSize);
+
+        fp->Read(pBuffer, sizeof(char) * fileSize);
+        pBuffer[fileSize] = 0;
+
+        behaviac::CFileManager::GetInstance()->FileClose(fp);
+
+        return pBuffer;
+    }
+
+	char* Workspace::AllocFileBuffer(uint32_t bufferSize)
+	{
 		char* pBuffer = 0;
 
 		for (int i = 0; i < kFileBuffers; ++i) {
@@ -590,13 +605,8 @@ namespace behaviac
 
 		BEHAVIAC_ASSERT(pBuffer);
 
-        fp->Read(pBuffer, sizeof(char) * fileSize);
-        pBuffer[fileSize] = 0;
-
-        behaviac::CFileManager::GetInstance()->FileClose(fp);
-
-        return pBuffer;
-    }
+		return pBuffer;
+	}
 
 	void Workspace::PopFileFromBuffer(char* pBuffer, uint32_t bufferSize) {
 		for (int i = 0; i < kFileBuffers; ++i) {
@@ -646,6 +656,9 @@ namespace behaviac
 
 	void Workspace::Update()
     {
+        //the agents whose async work is completed are ticked in this update
+        Context::ResumeCompletedAgents();
+
 		this->DebugUpdate();
 
         if (this->m_bExecAgents)
@@ -710,51 +723,66 @@ namespace behaviac
 
         Workspace::EFileFormat f = this->GetFileFormat();
 
-        switch (f)
+        //the trees in the bundle need neither probing nor their own files
+        const CBehaviorBundle::Entry_t* pBundled = 0;
+
+        if (this->m_bundle)
         {
-            case EFF_default:
-            {
-                // try to load the behavior in xml
-                behaviac::string path = fullPath + ".xml";
+            pBundled = this->m_bundle->Find(relativePath, f);
+        }
 
-                if (behaviac::CFileManager::GetInstance()->FileExists(path.c_str()))
-                {
-                    f = EFF_xml;
-                    fullPath = path;
-                }
-                else
+        if (pBundled)
+        {
+            f = (Workspace::EFileFormat)pBundled->format;
+        }
+        else
+        {
+            switch (f)
+            {
+                case EFF_default:
                 {
-                    // try to load the behavior in bson
-                    path = fullPath + ".bson.bytes";
+                    // try to load the behavior in xml
+                    behaviac::string path = fullPath + ".xml";
 
                     if (behaviac::CFileManager::GetInstance()->FileExists(path.c_str()))
                     {
-                        f = EFF_bson;
+                        f = EFF_xml;
                         fullPath = path;
                     }
-                    // try to load the behavior in cpp
                     else
                     {
-                        f = EFF_cpp;
+                        // try to load the behavior in bson
+                        path = fullPath + ".bson.bytes";
+
+                        if (behaviac::CFileManager::GetInstance()->FileExists(path.c_str()))
+                        {
+                            f = EFF_bson;
+                            fullPath = path;
+                        }
+                        // try to load the behavior in cpp
+                        else
+                        {
+                            f = EFF_cpp;
+                        }
                     }
                 }
-            }
-            break;
-
-            case EFF_xml:
-                fullPath += ".xml";
                 break;
 
-            case EFF_bson:
-                fullPath += ".bson.bytes";
-                break;
+                case EFF_xml:
+                    fullPath += ".xml";
+                    break;
 
-            case EFF_cpp:
-                break;
+                case EFF_bson:
+                    fullPath += ".bson.bytes";
+                    break;
 
-            default:
-                BEHAVIAC_ASSERT(0);
-                break;
+                case EFF_cpp:
+                    break;
+
+                default:
+                    BEHAVIAC_ASSERT(0);
+                    break;
+            }
         }
 
         bool bLoadResult = false;
@@ -772,7 +800,17 @@ namespace behaviac
 
         bool bCleared = false;
 
-        if (f == EFF_xml || f == EFF_bson)
+        if (pBundled)
+        {
+            if (!bNewly)
+            {
+                bCleared = true;
+                pBT->Clear();
+            }
+
+            bLoadResult = this->LoadBundledTree(pBT, *pBundled);
+        }
+        else if (f == EFF_xml || f == EFF_bson)
         {
 			uint32_t bufferSize = 0;
 			char* pBuffer = this->ReadFileToBuffer(fullPath.c_str(), bufferSize);
@@ -831,6 +869,8 @@ namespace behaviac
         {
             BEHAVIAC_ASSERT(pBT->GetName() == relativePath);
 
+            pBT->BuildTickInfoDescriptors(pBT->GetName());
+
             if (!bNewly)
             {
                 BEHAVIAC_ASSERT(m_behaviortrees[pBT->GetName()] == pBT);
@@ -857,6 +897,87 @@ namespace behaviac
         return bLoadResult;
     }
 
+    bool Workspace::LoadBundledTree(BehaviorTree* pBT, const CBehaviorBundle::Entry_t& entry)
+    {
+        const char* pData = this->m_bundle->GetData(entry);
+
+        if (entry.format == EFF_bson)
+        {
+            //read in place from the mapped bundle
+            return pBT->load_bson(pData);
+        }
+
+        //the xml is parsed in place, it is copied to be zero terminated and written
+        uint32_t bufferSize = 0;
+        char* pBuffer = this->ReadBundledFile(entry, bufferSize);
+
+        bool bLoadResult = pBT->load_xml(pBuffer);
+
+        this->PopFileFromBuffer(pBuffer, bufferSize);
+
+        return bLoadResult;
+    }
+
+    char* Workspace::ReadBundledFile(const CBehaviorBundle::Entry_t& entry, uint32_t& bufferSize)
+    {
+        bufferSize = entry.size + 1;
+        char* pBuffer = this->AllocFileBuffer(bufferSize);
+
+        memcpy(pBuffer, this->m_bundle->GetData(entry), entry.size);
+        pBuffer[entry.size] = 0;
+
+        return pBuffer;
+    }
+
+    char* Workspace::ReadBundledFile(const char* relativePath, EFileFormat& f, uint32_t& bufferSize)
+    {
+        const CBehaviorBundle::Entry_t* pEntry = this->m_bundle ? this->m_bundle->Find(relativePath, f) : 0;
+
+        if (pEntry == 0)
+        {
+            return 0;
+        }
+
+        f = (EFileFormat)pEntry->format;
+
+        return this->ReadBundledFile(*pEntry, bufferSize);
+    }
+
+    bool Workspace::OpenBundle(const char* bundlePath)
+    {
+        if (this->m_bundle == 0)
+        {
+            this->m_bundle = BEHAVIAC_NEW CBehaviorBundle();
+        }
+
+        behaviac::string fullPath = bundlePath;
+
+        if (bundlePath[0] != '/' && !CFileSystem::isFullPath(bundlePath))
+        {
+            fullPath = StringUtils::CombineDir(this->GetFilePath(), bundlePath);
+        }
+
+        if (!this->m_bundle->Open(fullPath.c_str()))
+        {
+            this->CloseBundle();
+
+            return false;
+        }
+
+        return true;
+    }
+
+    void Workspace::CloseBundle()
+    {
+        BEHAVIAC_DELETE(this->m_bundle);
+        this->m_bundle = 0;
+    }
+
+    const CBehaviorBundle* Workspace::GetBundle() const
+    {
+        return this->m_bundle;
+    }
+
     BehaviorTree* Workspace::LoadBehaviorTree(const char* relativePath)
     {
         behaviac::string strRelativePath(relativePath);
@@ -915,6 +1036,8 @@ namespace behaviac
 #if BEHAVIAC_ENABLE_HOTRELOAD
 			if (behaviac::Config::IsHotReload())
 			{
+				behaviac::ScopedLock lock(m_behaviorTreeTasksMutex);
+
 				if (!m_allBehaviorTreeTasks)
 				{
 					m_allBehaviorTreeTasks = BEHAVIAC_NEW AllBehaviorTreeTasks_t;
@@ -962,6 +1085,8 @@ namespace behaviac
 #if BEHAVIAC_ENABLE_HOTRELOAD
 			if (behaviac::Config::IsHotReload())
 			{
+				behaviac::ScopedLock lock(m_behaviorTreeTasksMutex);
+
 				if (m_allBehaviorTreeTasks)
 				{
 					const char* relativePath = behaviorTreeTask->GetName().c_str();
@@ -1011,6 +1136,8 @@ namespace behaviac
 #if BEHAVIAC_ENABLE_HOTRELOAD
 		if (behaviac::Config::IsHotReload())
 		{
+			behaviac::ScopedLock lock(m_behaviorTreeTasksMutex);
+
 			if (!m_allBehaviorTreeTasks)
 			{
 				m_allBehaviorTreeTasks = BEHAVIAC_NEW AllBehaviorTreeTasks_t;
@@ -1071,6 +1198,15 @@ namespace behaviac
 
         m_behaviortrees.clear();
 
+#if BEHAVIAC_ENABLE_HOTRELOAD
+        for (behaviac::vector<BehaviorTree*>::iterator it = m_retiredBehaviorTrees.begin(); it != m_retiredBehaviorTrees.end(); ++it)
+        {
+            BehaviorTree* bt = *it;
+            BEHAVIAC_DELETE(bt);
+        }
+
+        m_retiredBehaviorTrees.clear();
+#endif//BEHAVIAC_ENABLE_HOTRELOAD
     }
 
     void Workspace::HotReload()
@@ -1078,12 +1214,14 @@ namespace behaviac
 #if BEHAVIAC_ENABLE_HOTRELOAD
 		if (behaviac::Config::IsHotReload())
 		{
+			this->FreeRetiredBehaviorTrees();
+
 			if (!m_allBehaviorTreeTasks)
 			{
 				return;
 			}
 
-			behaviac::vector<behaviac::string> modifiedFiles;
+			behaviac::vector<CFileSystem::SModifiedFile> modifiedFiles;
 			CFileSystem::GetModifiedFiles(modifiedFiles);
 			size_t fileCount = modifiedFiles.size();
 
@@ -1093,13 +1231,15 @@ namespace behaviac
 
 				for (size_t i = 0; i < fileCount; ++i)
 				{
-					behaviac::string relativePath = modifiedFiles[i];
+					behaviac::string relativePath = modifiedFiles[i].path;
 
 					const char* format = behaviac::StringUtils::FindFullExtension(relativePath.c_str());
 
 					if (format != 0 && (((f & EFF_xml) == EFF_xml && 0 == strcmp(format, "xml")) ||
 						((f & EFF_bson) == EFF_bson && 0 == strcmp(format, "bson.bytes"))))
 					{
+						Workspace::EFileFormat fileFormat = (0 == strcmp(format, "xml")) ? EFF_xml : EFF_bson;
+
 						behaviac::StringUtils::StripFullFileExtension(relativePath);
 						behaviac::StringUtils::UnifySeparator(relativePath);
 
@@ -1107,37 +1247,11 @@ namespace behaviac
 
 						if (it != m_allBehaviorTreeTasks->end())
 						{
-							if (Workspace::Load(relativePath.c_str(), true))
-							{
-								//BEHAVIAC_LOGWARNING("HotReload 1:%s\n", relativePath.c_str());
+							BehaviorTree* behaviorTree = this->ReloadBehaviorTree(relativePath.c_str(), fileFormat, modifiedFiles[i].content);
 
-								BTItem_t& btItems = (*m_allBehaviorTreeTasks)[relativePath];
-								BehaviorTree* behaviorTree = m_behaviortrees[relativePath];
-
-								size_t taskCount = btItems.bts.size();
-
-								if (taskCount > 0)
-								{
-									for (size_t j = 0; j < taskCount; ++j)
-									{
-										BehaviorTreeTask* behaviorTreeTask = btItems.bts[j];
-										BEHAVIAC_ASSERT(behaviorTreeTask);
-
-										//BEHAVIAC_LOGWARNING("HotReload 2:%s\n", behaviorTreeTask->GetName().c_str());
-
-										behaviorTreeTask->reset(0);
-										behaviorTreeTask->Clear();
-										behaviorTreeTask->Init(behaviorTree);
-									}
-								}
-
-								for (behaviac::vector<Agent*>::iterator it1 = btItems.agents.begin(); it1 != btItems.agents.end(); ++it1)
-								{
-									Agent* agent = (*it1);
-
-									//BEHAVIAC_LOGWARNING("HotReload 3:%s\n", agent->GetName().c_str());
-									agent->bthotreloaded(behaviorTree);
-								}
+							if (behaviorTree)
+							{
+								this->PatchBehaviorTreeTasks(relativePath.c_str(), it->second, behaviorTree);
 							}
 						}
 					}
@@ -1147,6 +1261,135 @@ namespace behaviac
 #endif//BEHAVIAC_ENABLE_HOTRELOAD
     }
 
+#if BEHAVIAC_ENABLE_HOTRELOAD
+    /**
+    the retired trees are freed at the frame boundary once no task uses them
+    */
+    void Workspace::FreeRetiredBehaviorTrees()
+    {
+        for (uint32_t i = 0; i < m_retiredBehaviorTrees.size();)
+        {
+            BehaviorTree* bt = m_retiredBehaviorTrees[i];
+
+            if (bt->HasTasks())
+            {
+                ++i;
+            }
+            else
+            {
+                BEHAVIAC_DELETE(bt);
+
+                m_retiredBehaviorTrees[i] = m_retiredBehaviorTrees.back();
+                m_retiredBehaviorTrees.pop_back();
+            }
+        }
+    }
+
+    /**
+    load the modified behavior into a new tree, the loaded one is kept if it fails to load
+
+    'content' is the file prefetched by the monitoring thread, the file is read if it is empty
+    */
+    BehaviorTree* Workspace::ReloadBehaviorTree(const char* relativePath, EFileFormat f, behaviac::string& content)
+    {
+        uint32_t bufferSize = 0;
+        char* pBuffer = 0;
+
+        if (content.empty())
+        {
+            behaviac::string fullPath = StringUtils::CombineDir(this->GetFilePath(), relativePath);
+            pBuffer = this->ReadFileToBuffer(fullPath.c_str(), f == EFF_xml ? ".xml" : ".bson.bytes", bufferSize);
+
+            if (!pBuffer)
+            {
+                BEHAVIAC_LOGWARNING("'%s' can't be read!\n", fullPath.c_str());
+                return 0;
+            }
+        }
+        else
+        {
+            pBuffer = &content[0];
+        }
+
+        BehaviorTree* pBT = BEHAVIAC_NEW BehaviorTree();
+        bool bLoadResult = false;
+
+        if (f == EFF_xml)
+        {
+            bLoadResult = pBT->load_xml(pBuffer);
+        }
+        else
+        {
+            bLoadResult = pBT->load_bson(pBuffer);
+        }
+
+        if (bufferSize > 0)
+        {
+            this->PopFileFromBuffer(pBuffer, bufferSize);
+        }
+
+        if (!bLoadResult)
+        {
+            BEHAVIAC_LOGWARNING("'%s' is not reloaded!\n", relativePath);
+            BEHAVIAC_DELETE(pBT);
+
+            return 0;
+        }
+
+        BEHAVIAC_ASSERT(pBT->GetName() == relativePath);
+
+        pBT->BuildTickInfoDescriptors(pBT->GetName());
+
+        return pBT;
+    }
+
+    /**
+    the running tasks are patched to the reloaded tree so that the states of the unchanged nodes are kept,
+    a task is reinitialized only if the node of one of its running tasks is changed.
+    */
+    void Workspace::PatchBehaviorTreeTasks(const char* relativePath, BTItem_t& btItems, BehaviorTree* behaviorTree)
+    {
+        BehaviorTree* pOld = 0;
+        BehaviorTrees_t::iterator it = m_behaviortrees.find(relativePath);
+
+        if (it != m_behaviortrees.end())
+        {
+            pOld = it->second;
+        }
+
+        for (size_t j = 0; j < btItems.bts.size(); ++j)
+        {
+            BehaviorTreeTask* behaviorTreeTask = btItems.bts[j];
+            BEHAVIAC_ASSERT(behaviorTreeTask);
+
+            if (behaviorTreeTask->patch(behaviorTree, false))
+            {
+                behaviorTreeTask->patch(behaviorTree, true);
+            }
+            else
+            {
+                behaviorTreeTask->reset(0);
+                behaviorTreeTask->Clear();
+                behaviorTreeTask->Init(behaviorTree);
+            }
+        }
+
+        m_behaviortrees[relativePath] = behaviorTree;
+
+        if (pOld)
+        {
+            m_retiredBehaviorTrees.push_back(pOld);
+        }
+
+        for (behaviac::vector<Agent*>::iterator it1 = btItems.agents.begin(); it1 != btItems.agents.end(); ++it1)
+        {
+            Agent* agent = (*it1);
+
+            agent->bthotreloaded(behaviorTree);
+        }
+    }
+#endif//BEHAVIAC_ENABLE_HOTRELOAD
+
     //[breakpoint] add TestBehaviorGroup\btunittest.xml->Sequence[3]:enter all Hit=1
     //[breakpoint] add TestBehaviorGroup\btunittest.xml->Sequence[3]:exit all Hit=1
     //[breakpoint] add TestBehaviorGroup\btunittest.xml->Sequence[3]:exit success Hit=1
@@ -1405,9 +1648,10 @@ namespace behaviac
 #if BEHAVIAC_ENABLE_PROFILING
             BEHAVIAC_PROFILE("Workspace::CheckBreakpoint");
 #endif
-            behaviac::string bpStr = BehaviorTask::GetTickInfo(pAgent, b, action);
+            char bpStr[1024];
+            BehaviorTask::GetTickInfo(pAgent, b, action, bpStr, sizeof(bpStr));
 
-            uint32_t bpid = MakeVariableId(bpStr.c_str());
+            uint32_t bpid = MakeVariableId(bpStr);
 
             BreakpointInfos_t::const_iterator it = m_breakpoints.find(bpid);
 
@@ -1417,7 +1661,7 @@ namespace behaviac
 
                 if (bp.action_result & actionResult)
                 {
-                    int count = GetActionCount(bpStr.c_str());
+                    int count = GetActionCount(bpStr);
                     BEHAVIAC_ASSERT(count > 0);
 
                     if (bp.hit_config == 0 || bp.hit_config == count)
@@ -110,7 +110,7 @@ namespace behaviac
 	}
 
 #if !BEHAVIAC_RELEASE
-	const behaviac::string GetParentTreeName(const Agent* pAgent, const BehaviorNode* n);
+	const char* GetParentTreeName(const Agent* pAgent, const BehaviorNode* n);
 #endif
 
 	EBTStatus FSMTask::UpdateFSM(Agent* pAgent, EBTStatus childStatus)
@@ -154,8 +154,8 @@ namespace behaviac
 #if !BEHAVIAC_RELEASE
 				state_update_count[this->m_currentNodeId]++;
 				if (state_update_count[this->m_currentNodeId] > kMaxCount) {
-					behaviac::string treeName = GetParentTreeName(pAgent, this->GetNode());
-					BEHAVIAC_LOGERROR("%s might be updating an FSM('%s') endlessly, possibly a dead loop, please redesign it!", pAgent->GetName().c_str(), treeName.c_str());
+					const char* treeName = GetParentTreeName(pAgent, this->GetNode());
+					BEHAVIAC_LOGERROR("%s might be updating an FSM('%s') endlessly, possibly a dead loop, please redesign it!", pAgent->GetName().c_str(), treeName);
 					BEHAVIAC_ASSERT(false);
 				}
 #endif
@@ -14,6 +14,7 @@ namespace behaviac
 	State::~State()
 	{
         BEHAVIAC_DELETE(m_method);
+        DeleteAttachments(this->m_transitions);
 	}
 
 	void State::load(int version, const char* agentType, const properties_t& properties)
@@ -195,6 +196,10 @@ namespace behaviac
 	void StateTask::copyto(BehaviorTask* target) const
 	{
 		super::copyto(target);
+
+		StateTask* ttask = (StateTask*)target;
+
+		ttask->m_resumeState = this->m_resumeState;
 	}
 
 	void StateTask::save(IIONode* node) const
@@ -225,6 +230,10 @@ namespace behaviac
 	{
 		BEHAVIAC_UNUSED_VAR(pAgent);
 		this->m_nextStateId = -1;
+
+		//a resumable method starts from the beginning each time the state is entered
+		this->m_resumeState.Reset();
+
 		return true;
 	}
 
@@ -242,8 +251,19 @@ namespace behaviac
 
 		State* pStateNode = (State*)(this->GetNode());
 
+		ResumeState_t* pResumeState = pAgent->m_resumeState;
+		pAgent->m_resumeState = &this->m_resumeState;
+
 		EBTStatus result = pStateNode->Update(pAgent, this->m_nextStateId);
 
+		pAgent->m_resumeState = pResumeState;
+
+		//ended or transitioned to another state
+		if (result != BT_RUNNING)
+		{
+			this->m_resumeState.Reset();
+		}
+
 		return result;
 	}
 }
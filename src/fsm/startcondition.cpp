@@ -17,6 +17,12 @@ namespace behaviac
 {
 	StartCondition::~StartCondition()
 	{
+        for (unsigned int i = 0; i < this->m_effectors.size(); ++i)
+        {
+            BEHAVIAC_DELETE(this->m_effectors[i]);
+        }
+
+        this->m_effectors.clear();
 	}
 
     bool StartCondition::IsValid(Agent* pAgent, BehaviorTask* pTask) const
@@ -38,6 +44,10 @@ namespace behaviac
             {
                 this->m_effectors.push_back(effectorConfig);
             }
+            else
+            {
+                BEHAVIAC_DELETE(effectorConfig);
+            }
 
             return;
         }
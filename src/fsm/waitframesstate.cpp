@@ -14,7 +14,7 @@ namespace behaviac
 
 	WaitFramesState::~WaitFramesState()
 	{
-        BEHAVIAC_DELETE(this->m_frames);
+        AgentMeta::ReleaseSharedProperty(this->m_frames);
 	}
 
 	void WaitFramesState::load(int version, const char* agentType, const properties_t& properties)
@@ -34,7 +34,7 @@ namespace behaviac
 					behaviac::string typeName;
 					behaviac::string propertyName;
                     //this->m_frames_var = Condition::LoadRight(p.value, typeName);
-                    this->m_frames = AgentMeta::ParseProperty(p.value);
+                    this->m_frames = AgentMeta::ParseSharedProperty(p.value);
 				}
 				else
 				{
@@ -123,6 +123,27 @@ namespace behaviac
 		}
 	}
 
+	void WaitFramesStateTask::saveSnapshot(SnapshotWriter& writer) const
+	{
+		super::saveSnapshot(writer);
+
+		writer.Write(this->m_start);
+		writer.Write(this->m_frames);
+	}
+
+	bool WaitFramesStateTask::loadSnapshot(Agent* pAgent, SnapshotReader& reader)
+	{
+		if (!super::loadSnapshot(pAgent, reader))
+		{
+			return false;
+		}
+
+		reader.Load(this->m_start);
+		reader.Load(this->m_frames);
+
+		return !reader.IsFailed();
+	}
+
 	int WaitFramesStateTask::GetFrames(Agent* pAgent) const
 	{
 		BEHAVIAC_ASSERT(WaitFramesState::DynamicCast(this->GetNode()));
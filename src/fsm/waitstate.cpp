@@ -14,7 +14,7 @@ namespace behaviac
 
 	WaitState::~WaitState()
 	{
-		BEHAVIAC_DELETE(this->m_time);
+		AgentMeta::ReleaseSharedProperty(this->m_time);
 	}
 
 	void WaitState::load(int version, const char* agentType, const properties_t& properties)
@@ -34,7 +34,7 @@ namespace behaviac
 					{
 						behaviac::string typeName;
                         //this->m_time_var = Condition::LoadRight(p.value, typeName);
-                        this->m_time = AgentMeta::ParseProperty(p.value);
+                        this->m_time = AgentMeta::ParseSharedProperty(p.value);
 					}
 					else
 					{
@@ -141,6 +141,27 @@ namespace behaviac
 		}
 	}
 
+	void WaitStateTask::saveSnapshot(SnapshotWriter& writer) const
+	{
+		super::saveSnapshot(writer);
+
+		writer.Write(this->m_start);
+		writer.Write(this->m_time);
+	}
+
+	bool WaitStateTask::loadSnapshot(Agent* pAgent, SnapshotReader& reader)
+	{
+		if (!super::loadSnapshot(pAgent, reader))
+		{
+			return false;
+		}
+
+		reader.Load(this->m_start);
+		reader.Load(this->m_time);
+
+		return !reader.IsFailed();
+	}
+
 	double WaitStateTask::GetTime(Agent* pAgent) const
 	{
 		const WaitState* pWaitNode = WaitState::DynamicCast(this->GetNode());
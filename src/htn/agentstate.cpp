@@ -2,20 +2,52 @@
 #include "behaviac/agent/agentstate.h"
 #include "behaviac/common/member.h"
 
+#if BEHAVIAC_CCDEFINE_MSVC
+#define BEHAVIAC_AGENTSTATE_THREAD_LOCAL	__declspec(thread)
+#else
+#define BEHAVIAC_AGENTSTATE_THREAD_LOCAL	__thread
+#endif//BEHAVIAC_CCDEFINE_MSVC
+
 namespace behaviac
 {
 
-    behaviac::Mutex					AgentState::ms_mutex;
-    behaviac::vector<AgentState*>	AgentState::pool;
+    AgentState::Pool_t				AgentState::ms_pools[AgentState::kPoolCount];
+
+    //1 based, 0 for not assigned yet
+    static BEHAVIAC_AGENTSTATE_THREAD_LOCAL uint32_t t_poolIndex;
+    static uint32_t gs_nextPoolIndex;
+
+    AgentState::Pool_t& AgentState::GetPool()
+    {
+        if (t_poolIndex == 0)
+        {
+            //the threads are assigned to the pools in turn
+            behaviac::ScopedLock lock(ms_pools[0].mutex);
+
+            t_poolIndex = gs_nextPoolIndex % kPoolCount + 1;
+            gs_nextPoolIndex++;
+        }
+
+        return ms_pools[t_poolIndex - 1];
+    }
 
     AgentState::AgentState() : parent(NULL), m_forced(false), m_pushed(0)
     {
+#if BEHAVIAC_USE_HTN
+        m_readIds = NULL;
+        m_bUntrackedRead = false;
+#endif
     }
 
     AgentState::AgentState(AgentState* parent) : parent(NULL)
     {
         this->parent = parent;
 
+#if BEHAVIAC_USE_HTN
+        m_readIds = NULL;
+        m_bUntrackedRead = false;
+#endif
+
 #if BEHAVIAC_ENABLE_PUSH_OPT
 		m_forced = false;
 		m_pushed = 0;
@@ -24,6 +56,11 @@ namespace behaviac
 
 	AgentState::AgentState(behaviac::map<uint32_t, IInstantiatedVariable*> vars) : Variables(vars), parent(0)
     {
+#if BEHAVIAC_USE_HTN
+        m_readIds = NULL;
+        m_bUntrackedRead = false;
+#endif
+
 #if BEHAVIAC_ENABLE_PUSH_OPT
 		m_forced = false;
 		m_pushed = 0;
@@ -89,13 +126,14 @@ namespace behaviac
         AgentState* newly = NULL;
 
         {
-            behaviac::ScopedLock lock(ms_mutex);
+            Pool_t& pool = GetPool();
+            behaviac::ScopedLock lock(pool.mutex);
 
-            if (pool.size() > 0)
+            if (pool.states.size() > 0)
             {
                 //last one
-                newly = pool[pool.size() - 1];
-                pool.pop_back();
+                newly = pool.states[pool.states.size() - 1];
+                pool.states.pop_back();
                 //set the parent
                 newly->parent = this;
             }
@@ -134,8 +172,23 @@ namespace behaviac
             Variables::AddVariable(varId, pVar, -1);
         }
     }
+#if BEHAVIAC_USE_HTN
+    void AgentState::SetReadIds(behaviac::vector<uint32_t>* readIds)
+    {
+        this->m_readIds = readIds;
+        this->m_bUntrackedRead = false;
+    }
+#endif
+
     IInstantiatedVariable* AgentState::GetVariable(uint32_t varId) const
     {
+#if BEHAVIAC_USE_HTN
+        if (this->m_readIds)
+        {
+            this->m_readIds->push_back(varId);
+        }
+#endif
+
         if (this->state_stack.size() > 0)
         {
             for (int i = this->state_stack.size() - 1; i >= 0; --i)
@@ -195,9 +248,10 @@ namespace behaviac
         this->parent = NULL;
 
         {
-            behaviac::ScopedLock lock(ms_mutex);
+            Pool_t& pool = GetPool();
+            behaviac::ScopedLock lock(pool.mutex);
             //BEHAVIAC_ASSERT(!pool.Contains(this));
-            pool.push_back(this);
+            pool.states.push_back(this);
         }
     }
 
@@ -21,11 +21,79 @@
 #include "behaviac/behaviortree/nodes/composites/parallel.h"
 #include "behaviac/behaviortree/nodes/decorators/decoratorloop.h"
 #include "behaviac/behaviortree/nodes/decorators/decoratoriterator.h"
+#include "behaviac/agent/agentstate.h"
+#include "behaviac/common/member.h"
+
+#include <algorithm>
 
 namespace behaviac
 {
 #if BEHAVIAC_USE_HTN
 
+    uint32_t Planner::ms_planCacheCapacity = 0;
+    bool Planner::ms_partialReplanning = false;
+
+    //the planners of the agents ticked by different threads count into the same stats without a lock
+    struct ReplanCounters_t
+    {
+        volatile Atomic32	plans;
+        volatile Atomic32	planCacheHits;
+        volatile Atomic32	replans;
+        volatile Atomic32	failedReplans;
+        volatile Atomic32	tasksKept;
+        volatile Atomic32	tasksDecomposed;
+    };
+
+    static ReplanCounters_t gs_replanCounters;
+
+    Planner::~Planner()
+    {
+        this->ClearPlanCache();
+    }
+
+    void Planner::SetPlanCacheCapacity(uint32_t capacity)
+    {
+        ms_planCacheCapacity = capacity;
+    }
+
+    uint32_t Planner::GetPlanCacheCapacity()
+    {
+        return ms_planCacheCapacity;
+    }
+
+    void Planner::SetPartialReplanning(bool bEnabled)
+    {
+        ms_partialReplanning = bEnabled;
+    }
+
+    bool Planner::IsPartialReplanning()
+    {
+        return ms_partialReplanning;
+    }
+
+    Planner::ReplanStats Planner::GetReplanStats()
+    {
+        ReplanStats stats;
+        stats.plans = (uint32_t)Load_Acquire(gs_replanCounters.plans);
+        stats.planCacheHits = (uint32_t)Load_Acquire(gs_replanCounters.planCacheHits);
+        stats.replans = (uint32_t)Load_Acquire(gs_replanCounters.replans);
+        stats.failedReplans = (uint32_t)Load_Acquire(gs_replanCounters.failedReplans);
+        stats.tasksKept = (uint32_t)Load_Acquire(gs_replanCounters.tasksKept);
+        stats.tasksDecomposed = (uint32_t)Load_Acquire(gs_replanCounters.tasksDecomposed);
+
+        return stats;
+    }
+
+    void Planner::ResetReplanStats()
+    {
+        gs_replanCounters.plans = 0;
+        gs_replanCounters.planCacheHits = 0;
+        gs_replanCounters.replans = 0;
+        gs_replanCounters.failedReplans = 0;
+        gs_replanCounters.tasksKept = 0;
+        gs_replanCounters.tasksDecomposed = 0;
+    }
+
     void Planner::Init(Agent* pAgent, Task* rootTask)
     {
         this->agent = pAgent;
@@ -44,13 +112,164 @@ namespace behaviac
             if (this->m_rootTask->GetStatus() == BT_RUNNING)
             {
                 this->m_rootTask->abort(this->agent);
-                BehaviorTask::DestroyTask(this->m_rootTask);
+
+                if (!this->IsCached(this->m_rootTask))
+                {
+                    BehaviorTask::DestroyTask(this->m_rootTask);
+                }
             }
 
             this->m_rootTask = NULL;
         }
     }
 
+    bool Planner::SaveValues(const behaviac::vector<uint32_t>& readIds)
+    {
+        //a longer value, i.e. a long string, is not kept
+        const uint32_t kMaxValueSize = 256;
+        uint8_t buffer[kMaxValueSize];
+
+        this->m_values.clear();
+
+        for (size_t i = 0; i < readIds.size(); ++i)
+        {
+            SnapshotWriter writer(buffer, kMaxValueSize);
+
+            //the same order as Agent::GetVariable, the instantiated variables and then the properties
+            IInstantiatedVariable* pVar = this->agent->GetVariables()->GetVariable(readIds[i]);
+
+            if (pVar != NULL)
+            {
+                if (pVar->GetSnapshotTypeId() == 0)
+                {
+                    return false;
+                }
+
+                pVar->SaveSnapshot(writer);
+            }
+            else
+            {
+                IProperty* pProperty = this->agent->GetProperty(readIds[i]);
+
+                if (pProperty == NULL || !pProperty->SaveSnapshotValue(this->agent, writer))
+                {
+                    return false;
+                }
+            }
+
+            if (writer.IsOverflowed())
+            {
+                return false;
+            }
+
+            this->m_values.insert(this->m_values.end(), buffer, buffer + writer.GetSize());
+        }
+
+        return true;
+    }
+
+    PlannerTask* Planner::FindCachedPlan(Task* root)
+    {
+        //the capacity might be lowered
+        while (this->m_planCache.size() > ms_planCacheCapacity)
+        {
+            this->RemoveCachedPlan(0);
+        }
+
+        for (int i = (int)this->m_planCache.size() - 1; i >= 0; --i)
+        {
+            CachedPlan& cached = this->m_planCache[i];
+
+            if (cached.root != root || !this->SaveValues(cached.readIds))
+            {
+                continue;
+            }
+
+            if (this->m_values == cached.values)
+            {
+                PlannerTask* plan = cached.plan;
+
+                AtomicInc(gs_replanCounters.planCacheHits);
+
+                //move it to the end as the most recently used
+                for (uint32_t j = (uint32_t)i; j + 1 < this->m_planCache.size(); ++j)
+                {
+                    std::swap(this->m_planCache[j], this->m_planCache[j + 1]);
+                }
+
+                return plan;
+            }
+        }
+
+        return NULL;
+    }
+
+    void Planner::AddCachedPlan(Task* root, behaviac::vector<uint32_t>& readIds, PlannerTask* plan)
+    {
+        if (ms_planCacheCapacity == 0)
+        {
+            return;
+        }
+
+        std::sort(readIds.begin(), readIds.end());
+        readIds.erase(std::unique(readIds.begin(), readIds.end()), readIds.end());
+
+        if (!this->SaveValues(readIds))
+        {
+            return;
+        }
+
+        while (this->m_planCache.size() >= ms_planCacheCapacity)
+        {
+            this->RemoveCachedPlan(0);
+        }
+
+        this->m_planCache.push_back(CachedPlan());
+        CachedPlan& cached = this->m_planCache.back();
+
+        cached.root = root;
+        cached.readIds.swap(readIds);
+        cached.values.swap(this->m_values);
+        cached.plan = plan;
+    }
+
+    bool Planner::IsCached(const PlannerTask* plan) const
+    {
+        for (size_t i = 0; i < this->m_planCache.size(); ++i)
+        {
+            if (this->m_planCache[i].plan == plan)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void Planner::RemoveCachedPlan(uint32_t index)
+    {
+        BEHAVIAC_ASSERT(index < this->m_planCache.size());
+        PlannerTask* plan = this->m_planCache[index].plan;
+
+        this->m_planCache.erase(this->m_planCache.begin() + index);
+
+        //the current plan is destroyed when it is replaced
+        if (plan != this->m_rootTask)
+        {
+            BehaviorTask::DestroyTask(plan);
+        }
+    }
+
+    void Planner::ClearPlanCache()
+    {
+        for (size_t i = 0; i < this->m_planCache.size(); ++i)
+        {
+            BehaviorTask::DestroyTask(this->m_planCache[i].plan);
+        }
+
+        this->m_planCache.clear();
+    }
+
     EBTStatus Planner::Update()
     {
         if (this->agent == NULL)
@@ -92,7 +311,12 @@ namespace behaviac
             return NULL;
         }
 
-        PlannerTask* newPlan = this->BuildPlan(this->m_rootTaskNode);
+        PlannerTask* newPlan = this->FindCachedPlan(this->m_rootTaskNode);
+
+        if (newPlan == NULL)
+        {
+            newPlan = this->BuildPlan(this->m_rootTaskNode);
+        }
 
         if (newPlan == NULL)
         {
@@ -142,7 +366,8 @@ namespace behaviac
         {
             PlannerTask* newPlan = this->GeneratePlan();
 
-            if (newPlan != NULL)
+            //the cached plan might be the current one, it is run again
+            if (newPlan != NULL && newPlan != this->m_rootTask)
             {
                 if (this->m_rootTask != NULL)
                 {
@@ -151,7 +376,10 @@ namespace behaviac
                         this->m_rootTask->abort(this->agent);
                     }
 
-                    BehaviorTask::DestroyTask(this->m_rootTask);
+                    if (!this->IsCached(this->m_rootTask))
+                    {
+                        BehaviorTask::DestroyTask(this->m_rootTask);
+                    }
                 }
 
                 this->m_rootTask = newPlan;
@@ -167,13 +395,11 @@ namespace behaviac
 
         if (Config::IsLoggingOrSocketing())
         {
-			behaviac::string agentClassName(a->GetObjectTypeName());
-            behaviac::string agentInstanceName(a->GetName());
-
-            behaviac::string ni = BehaviorTask::GetTickInfo(a, root, "plan");
-            int count = Workspace::GetInstance()->GetActionCount(ni.c_str()) + 1;
+            char ni[1024];
+            BehaviorTask::GetTickInfo(a, root, "plan", ni, sizeof(ni));
+            int count = Workspace::GetInstance()->GetActionCount(ni) + 1;
 			char temp[1024];
-			string_sprintf(temp, "[plan_begin]%s#%s %s %d\n", agentClassName.c_str(), agentInstanceName.c_str(), ni.c_str(), count);
+			string_sprintf(temp, "[plan_begin]%s#%s %s %d\n", a->GetObjectTypeName(), a->GetName().c_str(), ni, count);
 
 			LogManager::GetInstance()->Log(temp);
 
@@ -191,12 +417,10 @@ namespace behaviac
 
         if (Config::IsLoggingOrSocketing())
         {
-            behaviac::string agentClassName(a->GetObjectTypeName());
-            behaviac::string agentInstanceName(a->GetName());
-
-            behaviac::string ni = BehaviorTask::GetTickInfo(a, root, NULL);
+            char ni[1024];
+            BehaviorTask::GetTickInfo(a, root, NULL, ni, sizeof(ni));
 			char temp[1024];
-			string_sprintf(temp, "[plan_end]%s#%s %s\n", agentClassName.c_str(), agentInstanceName.c_str(), ni.c_str());
+			string_sprintf(temp, "[plan_end]%s#%s %s\n", a->GetObjectTypeName(), a->GetName().c_str(), ni);
 
 			LogManager::GetInstance()->Log(temp);
         }
@@ -212,9 +436,10 @@ namespace behaviac
 
         if (Config::IsLoggingOrSocketing())
         {
-            behaviac::string ni = BehaviorTask::GetTickInfo(a, n, NULL);
+            char ni[1024];
+            BehaviorTask::GetTickInfo(a, n, NULL, ni, sizeof(ni));
 
-            LogManager::GetInstance()->Log("[plan_node_begin]%s\n", ni.c_str());
+            LogManager::GetInstance()->Log("[plan_node_begin]%s\n", ni);
             a->m_variables->Log(a, true);
         }
 
@@ -229,9 +454,10 @@ namespace behaviac
 
         if (Config::IsLoggingOrSocketing())
         {
-            behaviac::string ni = BehaviorTask::GetTickInfo(a, n, NULL);
+            char ni[1024];
+            BehaviorTask::GetTickInfo(a, n, NULL, ni, sizeof(ni));
 
-            LogManager::GetInstance()->Log("[plan_node_pre_failed]%s\n", ni.c_str());
+            LogManager::GetInstance()->Log("[plan_node_pre_failed]%s\n", ni);
         }
 
 #endif
@@ -246,9 +472,10 @@ namespace behaviac
 
         if (Config::IsLoggingOrSocketing())
         {
-            behaviac::string ni = BehaviorTask::GetTickInfo(a, n, NULL);
+            char ni[1024];
+            BehaviorTask::GetTickInfo(a, n, NULL, ni, sizeof(ni));
 
-            LogManager::GetInstance()->Log("[plan_node_end]%s %s\n", ni.c_str(), result.c_str());
+            LogManager::GetInstance()->Log("[plan_node_end]%s %s\n", ni, result.c_str());
         }
 
 #endif
@@ -262,9 +489,10 @@ namespace behaviac
 
         if (Config::IsLoggingOrSocketing())
         {
-            behaviac::string ni = BehaviorTask::GetTickInfo(a, referencedNode, NULL);
+            char ni[1024];
+            BehaviorTask::GetTickInfo(a, referencedNode, NULL, ni, sizeof(ni));
             const char* refTreeStr = referencedNode->GetReferencedTree(a);
-            LogManager::GetInstance()->Log("[plan_referencetree_enter]%s %s.xml\n", ni.c_str(), refTreeStr);
+            LogManager::GetInstance()->Log("[plan_referencetree_enter]%s %s.xml\n", ni, refTreeStr);
         }
 
 #endif
@@ -278,10 +506,11 @@ namespace behaviac
 
         if (Config::IsLoggingOrSocketing())
         {
-            behaviac::string ni = BehaviorTask::GetTickInfo(a, referencedNode, NULL);
+            char ni[1024];
+            BehaviorTask::GetTickInfo(a, referencedNode, NULL, ni, sizeof(ni));
             const char* refTreeStr = referencedNode->GetReferencedTree(a);
 
-            LogManager::GetInstance()->Log("[plan_referencetree_exit]%s %s.xml\n", ni.c_str(), refTreeStr);
+            LogManager::GetInstance()->Log("[plan_referencetree_exit]%s %s.xml\n", ni, refTreeStr);
         }
 
 #endif
@@ -295,8 +524,9 @@ namespace behaviac
 
         if (Config::IsLoggingOrSocketing())
         {
-            behaviac::string ni = BehaviorTask::GetTickInfo(a, m, NULL);
-            LogManager::GetInstance()->Log("[plan_method_begin]%s\n", ni.c_str());
+            char ni[1024];
+            BehaviorTask::GetTickInfo(a, m, NULL, ni, sizeof(ni));
+            LogManager::GetInstance()->Log("[plan_method_begin]%s\n", ni);
 
             a->m_variables->Log(a, true);
         }
@@ -314,9 +544,10 @@ namespace behaviac
 
         if (Config::IsLoggingOrSocketing())
         {
-            behaviac::string ni = BehaviorTask::GetTickInfo(a, m, NULL);
+            char ni[1024];
+            BehaviorTask::GetTickInfo(a, m, NULL, ni, sizeof(ni));
 
-            LogManager::GetInstance()->Log("[plan_method_end]%s %s\n", ni.c_str(), result.c_str());
+            LogManager::GetInstance()->Log("[plan_method_end]%s %s\n", ni, result.c_str());
         }
 
 #endif
@@ -332,8 +563,9 @@ namespace behaviac
 
         if (Config::IsLoggingOrSocketing())
         {
-            behaviac::string ni = BehaviorTask::GetTickInfo(a, pForEach, NULL);
-            LogManager::GetInstance()->Log("[plan_foreach_begin]%s %d %d\n", ni.c_str(), index, count);
+            char ni[1024];
+            BehaviorTask::GetTickInfo(a, pForEach, NULL, ni, sizeof(ni));
+            LogManager::GetInstance()->Log("[plan_foreach_begin]%s %d %d\n", ni, index, count);
             a->m_variables->Log(a, true);
         }
 
@@ -351,8 +583,9 @@ namespace behaviac
 
         if (Config::IsLoggingOrSocketing())
         {
-            behaviac::string ni = BehaviorTask::GetTickInfo(a, pForEach, NULL);
-            LogManager::GetInstance()->Log("[plan_foreach_end]%s %d %d %s\n", ni.c_str(), index, count, result.c_str());
+            char ni[1024];
+            BehaviorTask::GetTickInfo(a, pForEach, NULL, ni, sizeof(ni));
+            LogManager::GetInstance()->Log("[plan_foreach_end]%s %d %d %s\n", ni, index, count, result.c_str());
         }
 
 #endif
@@ -367,6 +600,15 @@ namespace behaviac
 
         PlannerTask* rootTask = NULL;
 
+        //the variables read are recorded for the plan cache
+        behaviac::vector<uint32_t> readIds;
+        bool bCaching = ms_planCacheCapacity > 0;
+
+        if (bCaching)
+        {
+            this->agent->GetVariables()->SetReadIds(&readIds);
+        }
+
         {
             AgentState::AgentStateScope scopedState(this->agent->GetVariables()->Push(true));
 
@@ -386,11 +628,79 @@ namespace behaviac
             this->agent->m_planningTop = -1;
         }
 
+        if (bCaching)
+        {
+            //what is read from the other agents or the static properties is not recorded
+            bool bUntracked = this->agent->GetVariables()->HasUntrackedRead();
+            this->agent->GetVariables()->SetReadIds(NULL);
+
+            if (rootTask != NULL && !bUntracked)
+            {
+                this->AddCachedPlan(root, readIds, rootTask);
+            }
+        }
+
         BEHAVIAC_ASSERT(this->agent->GetVariables()->Depth() == depth);
 
+        if (rootTask != NULL)
+        {
+            AtomicInc(gs_replanCounters.plans);
+        }
+
         return rootTask;
     }
 
+    PlannerTask* Planner::ReplanTask(Task* task, int depth, const PlannerTask* failedTask)
+    {
+        BEHAVIAC_ASSERT(this->m_rootTask != NULL);
+
+        //the plan is changed, it is no longer the one built for the cached values
+        for (uint32_t i = 0; i < this->m_planCache.size(); ++i)
+        {
+            if (this->m_planCache[i].plan == this->m_rootTask)
+            {
+                this->RemoveCachedPlan(i);
+                break;
+            }
+        }
+
+        int stateDepth = this->agent->GetVariables()->Depth();
+        BEHAVIAC_UNUSED_VAR(stateDepth);
+
+        //the plan is running, its state is restored when the planning ends
+        int planningTop = this->agent->m_planningTop;
+        PlannerTask* methodTask = NULL;
+
+        {
+            AgentState::AgentStateScope scopedState(this->agent->GetVariables()->Push(true));
+
+            this->agent->m_planningTop = this->agent->GetVariables()->Top();
+
+            LogPlanBegin(this->agent, task);
+
+            methodTask = this->decomposeTask(task, depth);
+
+            LogPlanEnd(this->agent, task);
+
+            this->agent->m_planningTop = planningTop;
+        }
+
+        BEHAVIAC_ASSERT(this->agent->GetVariables()->Depth() == stateDepth);
+
+        if (methodTask != NULL)
+        {
+            AtomicInc(gs_replanCounters.replans);
+            AtomicAdd(gs_replanCounters.tasksKept, (Atomic32)(this->m_rootTask->GetPlanSize() - failedTask->GetPlanSize()));
+            AtomicAdd(gs_replanCounters.tasksDecomposed, (Atomic32)methodTask->GetPlanSize());
+        }
+        else
+        {
+            AtomicInc(gs_replanCounters.failedReplans);
+        }
+
+        return methodTask;
+    }
+
     PlannerTask* Planner::decomposeNode(BehaviorNode* node, int depth)
     {
         // Ensure that the planner does not get stuck in an infinite loop
@@ -13,6 +13,7 @@
 #include "behaviac/agent/agent.h"
 
 #include "behaviac/htn/plannertask.h"
+#include "behaviac/htn/planner.h"
 
 #include "behaviac/behaviortree/nodes/actions/action.h"
 #include "behaviac/behaviortree/nodes/composites/sequence.h"
@@ -125,6 +126,11 @@ namespace behaviac
         BEHAVIAC_UNUSED_VAR(other);
         return true;
     }
+
+    uint32_t PlannerTask::GetPlanSize() const
+    {
+        return 1;
+    }
     void PlannerTask::traverse(bool childFirst, NodeHandler_t handler, Agent* pAgent, void* user_data)
     {
         BEHAVIAC_UNUSED_VAR(handler);
@@ -172,6 +178,10 @@ namespace behaviac
     {
         BEHAVIAC_UNUSED_VAR(pAgent);
         //BEHAVIAC_ASSERT(true);
+
+        //a resumable method starts from the beginning each time the action is entered
+        this->m_resumeState.Reset();
+
         return true;
     }
 
@@ -193,9 +203,19 @@ namespace behaviac
 
         Action* action = (Action*)this->m_node;
 
+        ResumeState_t* pResumeState = pAgent->m_resumeState;
+        pAgent->m_resumeState = &this->m_resumeState;
+
         //this->m_status = action.Execute(pAgent, this->ParamsValue);
         this->m_status = action->Execute(pAgent, childStatus);
 
+        pAgent->m_resumeState = pResumeState;
+
+        if (this->m_status != BT_RUNNING)
+        {
+            this->m_resumeState.Reset();
+        }
+
         return this->m_status;
     }
 
@@ -223,15 +243,27 @@ namespace behaviac
     {
     }
 
-    //~PlannerTaskComplex()
-    //{
-    //    foreach (BehaviorTask t in this->m_children)
-    //    {
-    //        BehaviorTask.DestroyTask(t);
-    //    }
+    PlannerTaskComplex::~PlannerTaskComplex()
+    {
+        for (uint32_t i = 0; i < this->m_children.size(); ++i)
+        {
+            BehaviorTask::DestroyTask(this->m_children[i]);
+        }
+
+        this->m_children.clear();
+    }
 
-    //    this->m_children.Clear();
-    //}
+    uint32_t PlannerTaskComplex::GetPlanSize() const
+    {
+        uint32_t size = 1;
+
+        for (uint32_t i = 0; i < this->m_children.size(); ++i)
+        {
+            size += ((PlannerTask*)this->m_children[i])->GetPlanSize();
+        }
+
+        return size;
+    }
 
     bool PlannerTaskComplex::onenter(Agent* pAgent)
     {
@@ -419,6 +451,11 @@ namespace behaviac
 #endif
     }
 
+    PlannerTaskReference::~PlannerTaskReference()
+    {
+        Workspace::GetInstance()->DestroyBehaviorTreeTask(this->m_subTree, NULL);
+    }
+
     bool PlannerTaskReference::CheckPreconditions(const Agent* pAgent, bool bIsAlive) const
     {
         PlannerTaskReference* pThis = const_cast<PlannerTaskReference*>(this);
@@ -472,8 +509,7 @@ namespace behaviac
 
         BEHAVIAC_ASSERT(pNode != NULL);
 
-		this->m_subTree = 0;
-
+        //m_subTree is kept as the plan might be run again from the plan cache
         pAgent->m_excutingTreeTask = this->m_oldTreeTask;
 
 #if !BEHAVIAC_RELEASE
@@ -527,8 +563,14 @@ namespace behaviac
     }
 
     PlannerTaskTask::PlannerTaskTask(BehaviorNode* node, Agent* pAgent)
-        : PlannerTaskComplex(node, pAgent)
+        : PlannerTaskComplex(node, pAgent), m_planner(0), m_depth(0)
+    {
+    }
+
+    void PlannerTaskTask::SetPlanner(Planner* planner, int depth)
     {
+        this->m_planner = planner;
+        this->m_depth = depth;
     }
 
     bool PlannerTaskTask::onenter(Agent* pAgent)
@@ -554,6 +596,23 @@ namespace behaviac
 
         EBTStatus s = c->exec(pAgent);
 
+        if (s == BT_FAILURE && this->m_planner != NULL && Planner::IsPartialReplanning())
+        {
+            BEHAVIAC_ASSERT(Task::DynamicCast(this->m_node) != 0);
+            PlannerTask* methodTask = this->m_planner->ReplanTask((Task*)this->m_node, this->m_depth, (PlannerTask*)c);
+
+            if (methodTask != NULL)
+            {
+                BehaviorTask::DestroyTask(c);
+
+                this->m_children[0] = methodTask;
+                methodTask->Parent = this;
+
+                //it is run at once, if it fails again the failure goes up to the task above
+                s = methodTask->exec(pAgent);
+            }
+        }
+
         return s;
     }
 
@@ -68,6 +68,8 @@ namespace behaviac
 
         if (childTask != NULL)
         {
+            //the task of a Task node is always a PlannerTaskTask
+            ((PlannerTaskTask*)seqTask)->SetPlanner(planner, depth);
             seqTask->AddChild(childTask);
             bOk = true;
         }
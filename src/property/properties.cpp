@@ -20,11 +20,11 @@
 
 namespace behaviac
 {
-    Variables::Variables()
+    Variables::Variables() : m_version(1)
     {
         BEHAVIAC_ASSERT(this->m_variables.size() == 0);
     }
-    Variables::Variables(behaviac::map<uint32_t, IInstantiatedVariable*>vars)
+    Variables::Variables(behaviac::map<uint32_t, IInstantiatedVariable*>vars) : m_version(1)
     {
         this->m_variables = vars;
     }
@@ -36,6 +36,8 @@ namespace behaviac
 
     void Variables::Clear(bool bFull)
     {
+        this->m_version++;
+
         if (bFull) {
             for (Variables_t::iterator it = this->m_variables.begin();
                 it != this->m_variables.end(); ++it)
@@ -100,6 +102,7 @@ namespace behaviac
         }
 
         target.m_variables.clear();
+        target.m_version++;
 
         for (Variables_t::const_iterator it = this->m_variables.begin();
             it != this->m_variables.end(); ++it)
@@ -199,6 +202,73 @@ namespace behaviac
         //}
     }
 
+    void Variables::SaveSnapshot(const behaviac::map<uint32_t, IInstantiatedVariable*>& vars, SnapshotWriter& writer)
+    {
+        uint32_t countOffset = writer.GetSize();
+        uint32_t count = 0;
+        writer.Write(count);
+
+        for (Variables_t::const_iterator it = vars.begin(); it != vars.end(); ++it)
+        {
+            const IInstantiatedVariable* pVar = it->second;
+            uint32_t typeId = pVar->GetSnapshotTypeId();
+
+            if (typeId != 0)
+            {
+                writer.Write(it->first);
+                writer.Write(typeId);
+
+                uint32_t sizeOffset = writer.GetSize();
+                uint32_t size = 0;
+                writer.Write(size);
+
+                pVar->SaveSnapshot(writer);
+
+                size = writer.GetSize() - sizeOffset - sizeof(uint32_t);
+                writer.WriteAt(sizeOffset, size);
+
+                count++;
+            }
+        }
+
+        writer.WriteAt(countOffset, count);
+    }
+
+    bool Variables::LoadSnapshot(behaviac::map<uint32_t, IInstantiatedVariable*>& vars, SnapshotReader& reader)
+    {
+        uint32_t count = 0;
+        reader.Read(count);
+
+        for (uint32_t i = 0; i < count && !reader.IsFailed(); ++i)
+        {
+            uint32_t varId = 0;
+            uint32_t typeId = 0;
+            uint32_t size = 0;
+            reader.Read(varId);
+            reader.Read(typeId);
+            reader.Read(size);
+
+            const void* pValue = reader.Skip(size);
+
+            if (pValue)
+            {
+                Variables_t::iterator it = vars.find(varId);
+
+                if (it != vars.end() && it->second->GetSnapshotTypeId() == typeId)
+                {
+                    SnapshotReader valueReader(pValue, size, reader.IsApplying());
+
+                    if (!it->second->LoadSnapshot(valueReader))
+                    {
+                        reader.SetFailed();
+                    }
+                }
+            }
+        }
+
+        return !reader.IsFailed();
+    }
+
     IInstantiatedVariable* Variables::GetVariable(uint32_t varId) const
     {
         Variables_t::iterator it = ((Variables*)this)->m_variables.find(varId);
@@ -215,10 +285,13 @@ namespace behaviac
         BEHAVIAC_ASSERT(this->m_variables.find(varId) == this->m_variables.end());
 
         this->m_variables[varId] = pVar;
+        this->m_version++;
     }
 
     void Variables::Unload()
     {
+        this->m_version++;
+
         for (Variables_t::iterator it = this->m_variables.begin();
             it != this->m_variables.end();)
         {
@@ -240,6 +313,7 @@ namespace behaviac
         if (this->m_variables.find(varId) != this->m_variables.end())
         {
             this->m_variables.erase(varId);
+            this->m_version++;
         }
     }
 
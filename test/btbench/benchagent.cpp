@@ -0,0 +1,188 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Tencent is pleased to support the open source community by making behaviac available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except in compliance with
+// the License. You may obtain a copy of the License at http://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and limitations under the License.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "btbench.h"
+#include "btloadtestsuite.h"
+
+using namespace bench;
+
+//keeps the results of the reads from being optimized away
+static volatile int s_sink = 0;
+
+static AgentNodeTest* CreateNodeAgent(const char* treePath)
+{
+    behaviac::Workspace::GetInstance()->Load(treePath);
+
+    AgentNodeTest* pAgent = behaviac::Agent::Create<AgentNodeTest>();
+    pAgent->resetProperties();
+    pAgent->btsetcurrent(treePath);
+
+    return pAgent;
+}
+
+BENCH(variable_get_name, "variable/get_by_name", ES_None)
+{
+    AgentNodeTest* pAgent = CreateNodeAgent("node_test/action_ut_0");
+
+    int sum = 0;
+    Timer timer;
+
+    for (int i = 0; i < config.operations; ++i)
+    {
+        sum += pAgent->GetVariable<int>("testVar_0");
+    }
+
+    result.microseconds = timer.Elapsed();
+    result.operations = config.operations;
+    s_sink = sum;
+
+    behaviac::Agent::Destroy(pAgent);
+
+    return true;
+}
+
+BENCH(variable_get_id, "variable/get_by_id", ES_None)
+{
+    AgentNodeTest* pAgent = CreateNodeAgent("node_test/action_ut_0");
+    const uint32_t variableId = behaviac::MakeVariableId("testVar_0");
+
+    int sum = 0;
+    Timer timer;
+
+    for (int i = 0; i < config.operations; ++i)
+    {
+        sum += pAgent->GetVariable<int>(variableId);
+    }
+
+    result.microseconds = timer.Elapsed();
+    result.operations = config.operations;
+    s_sink = sum;
+
+    behaviac::Agent::Destroy(pAgent);
+
+    return true;
+}
+
+BENCH(variable_set_name, "variable/set_by_name", ES_None)
+{
+    AgentNodeTest* pAgent = CreateNodeAgent("node_test/action_ut_0");
+
+    Timer timer;
+
+    for (int i = 0; i < config.operations; ++i)
+    {
+        pAgent->SetVariable("testVar_0", i);
+    }
+
+    result.microseconds = timer.Elapsed();
+    result.operations = config.operations;
+
+    behaviac::Agent::Destroy(pAgent);
+
+    return true;
+}
+
+BENCH(variable_set_id, "variable/set_by_id", ES_None)
+{
+    AgentNodeTest* pAgent = CreateNodeAgent("node_test/action_ut_0");
+    const uint32_t variableId = behaviac::MakeVariableId("testVar_0");
+
+    Timer timer;
+
+    for (int i = 0; i < config.operations; ++i)
+    {
+        pAgent->SetVariable("testVar_0", variableId, i);
+    }
+
+    result.microseconds = timer.Elapsed();
+    result.operations = config.operations;
+
+    behaviac::Agent::Destroy(pAgent);
+
+    return true;
+}
+
+//the event is handled by the running tree, which keeps running
+BENCH(event_fire, "event/fire", ES_None)
+{
+    AgentNodeTest* pAgent = CreateNodeAgent("node_test/event_ut_0");
+    pAgent->btexec();
+
+    Timer timer;
+
+    for (int i = 0; i < config.operations; ++i)
+    {
+        pAgent->FireEvent("event_test_void");
+    }
+
+    result.microseconds = timer.Elapsed();
+    result.operations = config.operations;
+
+    behaviac::Agent::Destroy(pAgent);
+
+    return true;
+}
+
+BENCH(event_fire_params, "event/fire_params", ES_None)
+{
+    AgentNodeTest* pAgent = CreateNodeAgent("node_test/event_ut_0");
+    pAgent->btexec();
+
+    Timer timer;
+
+    for (int i = 0; i < config.operations; ++i)
+    {
+        pAgent->FireEvent("event_test_int_bool_float", i, true, 1.5f);
+    }
+
+    result.microseconds = timer.Elapsed();
+    result.operations = config.operations;
+
+    behaviac::Agent::Destroy(pAgent);
+
+    return true;
+}
+
+//an agent is created, set its tree, ticked once and destroyed
+BENCH(agent_spawn, "agent/spawn_destroy", ES_Agents)
+{
+    const char* treePath = "node_test/sequence_ut_0";
+    behaviac::Workspace::GetInstance()->Load(treePath);
+
+    std::vector<AgentNodeTest*> agents(config.agents);
+    const int rounds = GetFrames(config);
+
+    Timer timer;
+
+    for (int r = 0; r < rounds; ++r)
+    {
+        for (int i = 0; i < config.agents; ++i)
+        {
+            agents[i] = behaviac::Agent::Create<AgentNodeTest>();
+            agents[i]->btsetcurrent(treePath);
+            agents[i]->btexec();
+        }
+
+        for (int i = 0; i < config.agents; ++i)
+        {
+            behaviac::Agent::Destroy(agents[i]);
+        }
+    }
+
+    result.microseconds = timer.Elapsed();
+    result.operations = (int64_t)rounds * config.agents;
+
+    behaviac::Context::Cleanup(0);
+
+    return true;
+}
@@ -0,0 +1,130 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Tencent is pleased to support the open source community by making behaviac available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except in compliance with
+// the License. You may obtain a copy of the License at http://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and limitations under the License.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "btbench.h"
+#include "btloadtestsuite.h"
+#include "behaviac/common/file/filemanager.h"
+#include "behaviac/common/file/file.h"
+
+using namespace bench;
+
+//a load is about a hundred times heavier than the other operations
+static const int kLoadsPerOperation = 100;
+
+static const char* kLoadTreePath = "node_test/action_ut_0";
+
+static bool LoadTree(const Config& config, Result& result, behaviac::Workspace::EFileFormat format)
+{
+    const char* treePath = kLoadTreePath;
+    int loads = config.operations / kLoadsPerOperation;
+
+    if (loads < 1)
+    {
+        loads = 1;
+    }
+
+    behaviac::Workspace::GetInstance()->SetFileFormat(format);
+
+    bool bLoaded = true;
+    Timer timer;
+
+    for (int i = 0; i < loads && bLoaded; ++i)
+    {
+        //forced, otherwise the loaded tree is just returned
+        bLoaded = behaviac::Workspace::GetInstance()->Load(treePath, true);
+    }
+
+    result.microseconds = timer.Elapsed();
+    result.operations = loads;
+
+    //the other scenarios run the trees loaded from xml
+    behaviac::Workspace::GetInstance()->SetFileFormat(behaviac::Workspace::EFF_xml);
+    behaviac::Workspace::GetInstance()->Load(treePath, true);
+
+    return bLoaded;
+}
+
+BENCH(load_xml, "load/xml", ES_None)
+{
+    return LoadTree(config, result, behaviac::Workspace::EFF_xml);
+}
+
+BENCH(load_bson, "load/bson", ES_None)
+{
+    return LoadTree(config, result, behaviac::Workspace::EFF_bson);
+}
+
+BENCH(load_cpp, "load/cpp", ES_None)
+{
+    return LoadTree(config, result, behaviac::Workspace::EFF_cpp);
+}
+
+static bool AddBundleItem(const char* extension, behaviac::Workspace::EFileFormat format, behaviac::vector<behaviac::CBehaviorBundle::Item_t>& items)
+{
+    behaviac::string path = behaviac::StringUtils::CombineDir(behaviac::Workspace::GetInstance()->GetFilePath(), kLoadTreePath);
+    path += extension;
+
+    behaviac::IFile* fp = behaviac::CFileManager::GetInstance()->FileOpen(path.c_str(), behaviac::CFileSystem::EOpenAccess_Read);
+
+    if (!fp)
+    {
+        return false;
+    }
+
+    behaviac::CBehaviorBundle::Item_t item;
+    item.relativePath = kLoadTreePath;
+    item.format = format;
+    item.data.resize((size_t)fp->GetSize());
+    fp->Read(&item.data[0], (uint32_t)item.data.size());
+
+    behaviac::CFileManager::GetInstance()->FileClose(fp);
+
+    items.push_back(item);
+
+    return true;
+}
+
+//the tree is in a bundle of both the formats, the format picks one
+static bool LoadBundledTree(const Config& config, Result& result, behaviac::Workspace::EFileFormat format)
+{
+    //next to the exported trees, where OpenBundle looks for the relative paths
+    const char* kBundleName = "btbench.bundle";
+    behaviac::string bundlePath = behaviac::StringUtils::CombineDir(behaviac::Workspace::GetInstance()->GetFilePath(), kBundleName);
+
+    behaviac::vector<behaviac::CBehaviorBundle::Item_t> items;
+
+    if (!AddBundleItem(".xml", behaviac::Workspace::EFF_xml, items) ||
+        !AddBundleItem(".bson.bytes", behaviac::Workspace::EFF_bson, items) ||
+        !behaviac::CBehaviorBundle::Write(bundlePath.c_str(), items) ||
+        !behaviac::Workspace::GetInstance()->OpenBundle(kBundleName))
+    {
+        return false;
+    }
+
+    bool bLoaded = LoadTree(config, result, format);
+
+    behaviac::Workspace::GetInstance()->CloseBundle();
+    remove(bundlePath.c_str());
+
+    return bLoaded;
+}
+
+BENCH(load_bundle_xml, "load/bundle_xml", ES_None)
+{
+    return LoadBundledTree(config, result, behaviac::Workspace::EFF_xml);
+}
+
+BENCH(load_bundle_bson, "load/bundle_bson", ES_None)
+{
+    return LoadBundledTree(config, result, behaviac::Workspace::EFF_bson);
+}
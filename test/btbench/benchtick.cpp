@@ -0,0 +1,243 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Tencent is pleased to support the open source community by making behaviac available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except in compliance with
+// the License. You may obtain a copy of the License at http://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and limitations under the License.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "btbench.h"
+#include "btloadtestsuite.h"
+#include "behaviac/agent/batchexecutor.h"
+
+using namespace bench;
+
+//the cost of a tick of the agents running 'treePath', the trees restart when they end
+template<typename AgentType>
+static bool TickTree(const Config& config, Result& result, const char* treePath)
+{
+    std::vector<AgentType*> agents;
+    CreateAgents(config, treePath, agents);
+
+    //the tasks are created at the first tick
+    ExecContexts(config, 1);
+
+    const int frames = GetFrames(config);
+    result.microseconds = ExecContexts(config, frames);
+    result.operations = (int64_t)frames * config.agents;
+
+    DestroyAgents(config, agents);
+
+    return true;
+}
+
+BENCH(tick_action, "tick/action", ES_Agents | ES_Threads)
+{
+    return TickTree<AgentNodeTest>(config, result, "node_test/action_ut_2");
+}
+
+BENCH(tick_condition, "tick/condition", ES_Agents | ES_Threads)
+{
+    return TickTree<AgentNodeTest>(config, result, "node_test/condition_ut_0");
+}
+
+//the agents are grouped by their node and their conditions are compared in batches
+BENCH(tick_conditionbatch, "tick/condition_batch", ES_Agents | ES_Threads)
+{
+    for (int c = 0; c < config.threads; ++c)
+    {
+        behaviac::Context::GetContext(c).SetBatchExecution(true);
+    }
+
+    bool bRun = TickTree<AgentNodeTest>(config, result, "node_test/action_ut_waitforsignal_0");
+
+    for (int c = 0; c < config.threads; ++c)
+    {
+        behaviac::Context::GetContext(c).SetBatchExecution(false);
+    }
+
+    return bRun;
+}
+
+BENCH(tick_waitforsignal, "tick/wait_for_signal", ES_Agents | ES_Threads)
+{
+    return TickTree<AgentNodeTest>(config, result, "node_test/action_ut_waitforsignal_0");
+}
+
+//the same ticks recorded into a ring which keeps a few frames
+BENCH(tick_recording, "tick/wait_for_signal_recording", ES_Agents | ES_Threads)
+{
+    for (int c = 0; c < config.threads; ++c)
+    {
+        behaviac::Context::GetContext(c).StartRecording(1024 * 1024);
+    }
+
+    bool bRun = TickTree<AgentNodeTest>(config, result, "node_test/action_ut_waitforsignal_0");
+
+    for (int c = 0; c < config.threads; ++c)
+    {
+        behaviac::Context::GetContext(c).StopRecording();
+    }
+
+    return bRun;
+}
+
+BENCH(tick_sequence, "tick/sequence", ES_Agents | ES_Threads)
+{
+    return TickTree<AgentNodeTest>(config, result, "node_test/sequence_ut_0");
+}
+
+BENCH(tick_selector, "tick/selector", ES_Agents | ES_Threads)
+{
+    return TickTree<AgentNodeTest>(config, result, "node_test/selector_ut_0");
+}
+
+BENCH(tick_selectorloop, "tick/selector_loop", ES_Agents | ES_Threads)
+{
+    return TickTree<AgentNodeTest>(config, result, "node_test/selector_loop_ut_0");
+}
+
+BENCH(tick_selectorprobability, "tick/selector_probability", ES_Agents | ES_Threads)
+{
+    return TickTree<AgentNodeTest>(config, result, "node_test/selector_probability_ut_0");
+}
+
+BENCH(tick_sequencestochastic, "tick/sequence_stochastic", ES_Agents | ES_Threads)
+{
+    return TickTree<AgentNodeTest>(config, result, "node_test/sequence_stochastic_ut_0");
+}
+
+BENCH(tick_parallel, "tick/parallel", ES_Agents | ES_Threads)
+{
+    return TickTree<AgentNodeTest>(config, result, "node_test/parallel_ut_0");
+}
+
+BENCH(tick_ifelse, "tick/if_else", ES_Agents | ES_Threads)
+{
+    return TickTree<AgentNodeTest>(config, result, "node_test/if_else_ut_0");
+}
+
+BENCH(tick_decoratornot, "tick/decorator_not", ES_Agents | ES_Threads)
+{
+    return TickTree<AgentNodeTest>(config, result, "node_test/decoration_not_ut_0");
+}
+
+BENCH(tick_decoratorloop, "tick/decorator_loop", ES_Agents | ES_Threads)
+{
+    return TickTree<AgentNodeTest>(config, result, "node_test/decoration_loop_ut_0");
+}
+
+BENCH(tick_decoratorcountlimit, "tick/decorator_countlimit", ES_Agents | ES_Threads)
+{
+    return TickTree<AgentNodeTest>(config, result, "node_test/decoration_countlimit_ut_0");
+}
+
+BENCH(tick_enterexitaction, "tick/enter_exit_action", ES_Agents | ES_Threads)
+{
+    return TickTree<AgentNodeTest>(config, result, "node_test/enter_exit_action_ut_0");
+}
+
+BENCH(tick_predicate, "tick/predicate", ES_Agents | ES_Threads)
+{
+    return TickTree<AgentNodeTest>(config, result, "node_test/predicate_sequence_ut_0");
+}
+
+//ReferencedBehavior enters and exits its subtree at every tick
+BENCH(tick_reference, "tick/reference", ES_Agents | ES_Threads)
+{
+    return TickTree<AgentNodeTest>(config, result, "node_test/reference_ut_0");
+}
+
+BENCH(tick_preconditioneffector, "tick/precondition_effector", ES_Agents | ES_Threads)
+{
+    return TickTree<PreconEffectorAgent>(config, result, "node_test/PreconditionEffectorTest/PreconditionEffectorTest_0");
+}
+
+BENCH(tick_logging, "tick/sequence_logging", ES_Agents)
+{
+    behaviac::Config::SetLogging(true);
+
+    bool bRun = TickTree<AgentNodeTest>(config, result, "node_test/sequence_ut_0");
+
+    behaviac::Config::SetLogging(false);
+
+    return bRun;
+}
+
+//every tick of an agent makes a transition, Begin->Active, Pause->Pause, End->Inactive
+BENCH(fsm_transition, "fsm/transition", ES_Agents)
+{
+    const char* treePath = "node_test/fsm/fsm_ut_1";
+    const FSMAgentTest::EMessage kMessages[] = { FSMAgentTest::Begin, FSMAgentTest::Pause, FSMAgentTest::End };
+    const int kMessageCount = sizeof(kMessages) / sizeof(kMessages[0]);
+
+    Config singleContext = config;
+    singleContext.threads = 1;
+
+    std::vector<FSMAgentTest*> agents;
+    CreateAgents(singleContext, treePath, agents);
+
+    for (int i = 0; i < config.agents; ++i)
+    {
+        agents[i]->Message = FSMAgentTest::Invalid;
+        agents[i]->btexec();
+    }
+
+    const int frames = GetFrames(config);
+
+    Timer timer;
+
+    for (int f = 0; f < frames; ++f)
+    {
+        const FSMAgentTest::EMessage message = kMessages[f % kMessageCount];
+
+        for (int i = 0; i < config.agents; ++i)
+        {
+            agents[i]->Message = message;
+            agents[i]->btexec();
+        }
+    }
+
+    result.microseconds = timer.Elapsed();
+    result.operations = (int64_t)frames * config.agents;
+
+    DestroyAgents(singleContext, agents);
+
+    return true;
+}
+
+#if BEHAVIAC_USE_HTN
+//the travel domain plans at every tick once the previous plan ends
+BENCH(htn_plan, "htn/plan", ES_Agents)
+{
+    Config singleContext = config;
+    singleContext.threads = 1;
+
+    std::vector<HTNAgentTravel*> agents;
+    CreateAgents(singleContext, "node_test/htn/travel/root", agents);
+
+    const int frames = GetFrames(config);
+
+    Timer timer;
+
+    for (int f = 0; f < frames; ++f)
+    {
+        for (int i = 0; i < config.agents; ++i)
+        {
+            agents[i]->btexec();
+        }
+    }
+
+    result.microseconds = timer.Elapsed();
+    result.operations = (int64_t)frames * config.agents;
+
+    DestroyAgents(singleContext, agents);
+
+    return true;
+}
+#endif//BEHAVIAC_USE_HTN
@@ -0,0 +1,422 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Tencent is pleased to support the open source community by making behaviac available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except in compliance with
+// the License. You may obtain a copy of the License at http://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and limitations under the License.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "btbench.h"
+#include "behaviac/common/profiler/profiler.h"
+#include "behaviac/common/thread/thread.h"
+#include "behaviac/common/memory/slaballocator.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+void registerAllTypes();
+void unregisterAllTypes();
+
+namespace bench
+{
+    struct ExecThreadArg
+    {
+        int contextId;
+        int frames;
+    };
+
+    static unsigned int BEHAVIAC_STDCALL ExecContextThread(void* arg)
+    {
+        ExecThreadArg* pArg = (ExecThreadArg*)arg;
+
+        for (int i = 0; i < pArg->frames; ++i)
+        {
+            behaviac::Context::execAgents(pArg->contextId);
+        }
+
+        return 0;
+    }
+
+    int64_t ExecContexts(const Config& config, int frames)
+    {
+        Timer timer;
+
+        if (config.threads <= 1)
+        {
+            for (int i = 0; i < frames; ++i)
+            {
+                behaviac::Context::execAgents(0);
+            }
+
+            return timer.Elapsed();
+        }
+
+        std::vector<ExecThreadArg> args(config.threads);
+        std::vector<behaviac::thread::ThreadHandle> threads(config.threads);
+
+        for (int c = 0; c < config.threads; ++c)
+        {
+            args[c].contextId = c;
+            args[c].frames = frames;
+            threads[c] = behaviac::thread::CreateAndStartThread(&ExecContextThread, &args[c], 64 * 1024);
+        }
+
+        for (int c = 0; c < config.threads; ++c)
+        {
+            while (!behaviac::thread::IsThreadTerminated(threads[c]))
+            {
+                behaviac::thread::Sleep(1);
+            }
+
+            behaviac::thread::StopThread(threads[c]);
+        }
+
+        return timer.Elapsed();
+    }
+}
+
+using namespace bench;
+
+class CommandLineParameterParser
+{
+    int				m_argc;
+    const char**	m_argv;
+public:
+    CommandLineParameterParser(int argc, char** argv) : m_argc(argc), m_argv((const char**)argv)
+    {
+    }
+
+    bool ParameterExist(const char* szParam)
+    {
+        for (int i = 0; i < m_argc; ++i)
+        {
+            if (strcmp(m_argv[i], szParam) == 0)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    //return the value of '-name=value', 'defaultValue' if it is not specified
+    const char* ParameterValue(const char* szParam, const char* defaultValue)
+    {
+        size_t len = strlen(szParam);
+
+        for (int i = 0; i < m_argc; ++i)
+        {
+            if (strncmp(m_argv[i], szParam, len) == 0)
+            {
+                return m_argv[i] + len;
+            }
+        }
+
+        return defaultValue;
+    }
+};
+
+//"1,10,100" -> [1, 10, 100]
+static void ParseCounts(const char* str, std::vector<int>& counts)
+{
+    while (str && *str)
+    {
+        int count = atoi(str);
+
+        if (count > 0)
+        {
+            counts.push_back(count);
+        }
+
+        str = strchr(str, ',');
+
+        if (str)
+        {
+            str++;
+        }
+    }
+
+    if (counts.empty())
+    {
+        counts.push_back(1);
+    }
+}
+
+struct BenchRecord
+{
+    std::string	name;
+    int			agents;
+    int			threads;
+    int64_t		operations;
+    int64_t		microseconds;
+    double		nsPerOp;
+};
+
+static void WriteJson(FILE* fp, const std::vector<BenchRecord>& records)
+{
+    fprintf(fp, "{\n  \"benchmarks\": [\n");
+
+    for (size_t i = 0; i < records.size(); ++i)
+    {
+        const BenchRecord& r = records[i];
+
+        //one record per line, LoadBaseline relies on it
+        fprintf(fp, "    {\"name\": \"%s\", \"agents\": %d, \"threads\": %d, \"operations\": %lld, \"microseconds\": %lld, \"ns_per_op\": %.3f}%s\n",
+                r.name.c_str(), r.agents, r.threads, (long long)r.operations, (long long)r.microseconds, r.nsPerOp,
+                (i + 1 < records.size()) ? "," : "");
+    }
+
+    fprintf(fp, "  ]\n}\n");
+}
+
+//reads the records of a file written by WriteJson
+static bool LoadBaseline(const char* path, std::vector<BenchRecord>& records)
+{
+    FILE* fp = fopen(path, "r");
+
+    if (!fp)
+    {
+        return false;
+    }
+
+    char line[1024];
+
+    while (fgets(line, sizeof(line), fp))
+    {
+        char name[256];
+        BenchRecord r;
+        long long operations = 0;
+        long long microseconds = 0;
+
+        if (sscanf(line, " {\"name\": \"%255[^\"]\", \"agents\": %d, \"threads\": %d, \"operations\": %lld, \"microseconds\": %lld, \"ns_per_op\": %lf",
+                   name, &r.agents, &r.threads, &operations, &microseconds, &r.nsPerOp) == 6)
+        {
+            r.name = name;
+            r.operations = operations;
+            r.microseconds = microseconds;
+            records.push_back(r);
+        }
+    }
+
+    fclose(fp);
+
+    return true;
+}
+
+static const BenchRecord* FindRecord(const std::vector<BenchRecord>& records, const BenchRecord& r)
+{
+    for (size_t i = 0; i < records.size(); ++i)
+    {
+        if (records[i].name == r.name && records[i].agents == r.agents && records[i].threads == r.threads)
+        {
+            return &records[i];
+        }
+    }
+
+    return 0;
+}
+
+static void PrintUsage()
+{
+    printf("btbench [options]\n"
+           "  -list                 list the scenarios\n"
+           "  -filter=<text>        only run the scenarios whose name contains the text\n"
+           "  -agents=1,100,1000    the agent counts of the scenarios scaling with agents\n"
+           "  -threads=1,2,4        the thread counts of the scenarios scaling with threads\n"
+           "  -operations=<n>       about how many operations a run does, 10000 by default\n"
+           "  -repeat=<n>           the best of n runs is taken, 3 by default\n"
+           "  -json=<file>          write the results as json\n"
+           "  -baseline=<file>      compare with the json of a previous run\n"
+           "  -threshold=<percent>  the slowdown against the baseline taken as a regression, 10 by default\n"
+           "  -slab                 use the slab allocator\n");
+}
+
+int main(int argc, char** argv)
+{
+    CommandLineParameterParser CLPP(argc, argv);
+
+    if (CLPP.ParameterExist("-help") || CLPP.ParameterExist("-h"))
+    {
+        PrintUsage();
+        return 0;
+    }
+
+    //the allocator needs to be selected before anything is allocated
+    if (CLPP.ParameterExist("-slab"))
+    {
+        behaviac::SetMemoryAllocator(behaviac::GetSlabMemoryAllocator());
+    }
+
+    const std::vector<BenchSuite::RegisteredBench>& benches = BenchSuite::getInstance().getBenches();
+
+    if (CLPP.ParameterExist("-list"))
+    {
+        for (size_t i = 0; i < benches.size(); ++i)
+        {
+            printf("%s\n", benches[i].name);
+        }
+
+        return 0;
+    }
+
+    const char* filter = CLPP.ParameterValue("-filter=", "");
+    const char* jsonPath = CLPP.ParameterValue("-json=", 0);
+    const char* baselinePath = CLPP.ParameterValue("-baseline=", 0);
+    const double threshold = atof(CLPP.ParameterValue("-threshold=", "10"));
+    int repeat = atoi(CLPP.ParameterValue("-repeat=", "3"));
+
+    if (repeat < 1)
+    {
+        repeat = 1;
+    }
+
+    std::vector<int> agentCounts;
+    ParseCounts(CLPP.ParameterValue("-agents=", "1,100,1000"), agentCounts);
+
+    std::vector<int> threadCounts;
+    ParseCounts(CLPP.ParameterValue("-threads=", "1"), threadCounts);
+
+    Config baseConfig;
+    baseConfig.operations = atoi(CLPP.ParameterValue("-operations=", "10000"));
+
+    if (baseConfig.operations < 1)
+    {
+        baseConfig.operations = 1;
+    }
+
+    behaviac::Profiler::CreateInstance();
+    behaviac::Config::SetSocketing(false);
+    behaviac::Config::SetLogging(false);
+    behaviac::Config::SetProfiling(false);
+    behaviac::Config::SetHotReload(false);
+
+    behaviac::Workspace::GetInstance()->SetFilePath("../test/btunittest/BehaviacData/exported");
+    behaviac::Workspace::GetInstance()->SetFileFormat(behaviac::Workspace::EFF_xml);
+
+    //the benches don't advance the time, the waits of the trees never end
+    behaviac::Workspace::GetInstance()->SetTimeSinceStartup(0.0);
+    behaviac::Workspace::GetInstance()->SetFrameSinceStartup(0);
+
+    registerAllTypes();
+
+    //the workspace only registers the generated trees when it starts with EFF_cpp, they are needed by 'load/cpp'
+    behaviac::GenerationManager::RegisterBehaviors();
+
+    std::vector<BenchRecord> records;
+
+    printf("%-32s %8s %8s %14s %14s\n", "scenario", "agents", "threads", "operations", "ns/op");
+
+    for (size_t i = 0; i < benches.size(); ++i)
+    {
+        const BenchSuite::RegisteredBench& bench = benches[i];
+
+        if (*filter && !strstr(bench.name, filter))
+        {
+            continue;
+        }
+
+        const std::vector<int> noScaling(1, 1);
+        const std::vector<int>& agentsList = (bench.scaling & ES_Agents) ? agentCounts : noScaling;
+        const std::vector<int>& threadsList = (bench.scaling & ES_Threads) ? threadCounts : noScaling;
+
+        for (size_t a = 0; a < agentsList.size(); ++a)
+        {
+            for (size_t t = 0; t < threadsList.size(); ++t)
+            {
+                Config config = baseConfig;
+                config.agents = agentsList[a];
+                config.threads = threadsList[t];
+
+                BenchRecord record;
+                record.name = bench.name;
+                record.agents = config.agents;
+                record.threads = config.threads;
+                record.operations = 0;
+                record.microseconds = 0;
+                record.nsPerOp = 0.0;
+
+                bool bRun = true;
+
+                for (int r = 0; r < repeat && bRun; ++r)
+                {
+                    Result result;
+                    bRun = bench.scenario(config, result);
+
+                    if (bRun && result.operations > 0)
+                    {
+                        double nsPerOp = (double)result.microseconds * 1000.0 / (double)result.operations;
+
+                        if (record.operations == 0 || nsPerOp < record.nsPerOp)
+                        {
+                            record.operations = result.operations;
+                            record.microseconds = result.microseconds;
+                            record.nsPerOp = nsPerOp;
+                        }
+                    }
+                }
+
+                if (record.operations > 0)
+                {
+                    printf("%-32s %8d %8d %14lld %14.1f\n", record.name.c_str(), record.agents, record.threads,
+                           (long long)record.operations, record.nsPerOp);
+                    fflush(stdout);
+
+                    records.push_back(record);
+                }
+            }
+        }
+    }
+
+    unregisterAllTypes();
+    behaviac::Profiler::DestroyInstance();
+
+    if (jsonPath)
+    {
+        FILE* fp = fopen(jsonPath, "w");
+
+        if (!fp)
+        {
+            printf("can't write %s\n", jsonPath);
+            return 2;
+        }
+
+        WriteJson(fp, records);
+        fclose(fp);
+    }
+
+    int regressions = 0;
+
+    if (baselinePath)
+    {
+        std::vector<BenchRecord> baseline;
+
+        if (!LoadBaseline(baselinePath, baseline))
+        {
+            printf("can't read the baseline %s\n", baselinePath);
+            return 2;
+        }
+
+        for (size_t i = 0; i < records.size(); ++i)
+        {
+            const BenchRecord& r = records[i];
+            const BenchRecord* pBase = FindRecord(baseline, r);
+
+            if (pBase && pBase->nsPerOp > 0.0 && r.nsPerOp > pBase->nsPerOp * (1.0 + threshold / 100.0))
+            {
+                printf("REGRESSION %s agents %d threads %d: %.1f ns/op, the baseline is %.1f ns/op\n",
+                       r.name.c_str(), r.agents, r.threads, r.nsPerOp, pBase->nsPerOp);
+                regressions++;
+            }
+        }
+
+        printf("\n%d regression(s) over %.1f%%\n", regressions, threshold);
+    }
+
+    return regressions > 0 ? 1 : 0;
+}
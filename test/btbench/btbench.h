@@ -0,0 +1,184 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Tencent is pleased to support the open source community by making behaviac available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except in compliance with
+// the License. You may obtain a copy of the License at http://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and limitations under the License.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _BTBENCH_H_
+#define _BTBENCH_H_
+
+#include "behaviac/behaviac.h"
+#include "behaviac/agent/context.h"
+#include "behaviac/common/thread/thread.h"
+
+#include <string>
+#include <vector>
+
+namespace bench
+{
+    /// the parameters a scenario is run with
+    struct Config
+    {
+        Config() : agents(1), threads(1), operations(10000)
+        {
+        }
+
+        int		agents;
+        int		threads;
+
+        /// about how many operations a run does, the scenarios scale their loops to it
+        int		operations;
+    };
+
+    /// what a run of a scenario measured
+    struct Result
+    {
+        Result() : operations(0), microseconds(0)
+        {
+        }
+
+        int64_t	operations;
+        int64_t	microseconds;
+    };
+
+    /// return false if the scenario can't be run with the config
+    typedef bool(*Scenario)(const Config& config, Result& result);
+
+    enum EScaling
+    {
+        ES_None = 0,
+
+        /// run for each agent count
+        ES_Agents = 1,
+
+        /// run for each thread count, the agents are ticked in one context per thread
+        ES_Threads = 2
+    };
+
+    class BenchSuite
+    {
+    public:
+        struct RegisteredBench
+        {
+            const char*	name;
+            Scenario	scenario;
+            int			scaling;
+        };
+
+        void registerBench(const char* name, Scenario scenario, int scaling)
+        {
+            RegisteredBench bench = { name, scenario, scaling };
+            m_benches.push_back(bench);
+        }
+
+        const std::vector<RegisteredBench>& getBenches() const
+        {
+            return m_benches;
+        }
+
+        static BenchSuite& getInstance()
+        {
+            static BenchSuite instance;
+            return instance;
+        }
+
+    private:
+        std::vector<RegisteredBench> m_benches;
+    };
+
+    class AutoBenchRegister
+    {
+    public:
+        AutoBenchRegister(const char* name, Scenario scenario, int scaling)
+        {
+            BenchSuite::getInstance().registerBench(name, scenario, scaling);
+        }
+    };
+
+    class Timer
+    {
+    public:
+        Timer() : m_start(behaviac::thread::GetMicroseconds())
+        {
+        }
+
+        /// in microseconds
+        int64_t Elapsed() const
+        {
+            return behaviac::thread::GetMicroseconds() - m_start;
+        }
+
+    private:
+        int64_t m_start;
+    };
+
+    /// the contexts the agents are spread over, one per thread
+    inline int GetContextId(const Config& config, int agentIndex)
+    {
+        return agentIndex % config.threads;
+    }
+
+    /**
+    creates config.agents agents of 'treePath' spread over the contexts of GetContextId.
+    the tree is loaded before, so that the contexts can be ticked on their own threads
+    */
+    template<typename AgentType>
+    void CreateAgents(const Config& config, const char* treePath, std::vector<AgentType*>& agents)
+    {
+        behaviac::Workspace::GetInstance()->Load(treePath);
+
+        for (int i = 0; i < config.agents; ++i)
+        {
+            AgentType* pAgent = behaviac::Agent::Create<AgentType>(0, GetContextId(config, i), 0);
+            pAgent->resetProperties();
+            pAgent->btsetcurrent(treePath);
+
+            agents.push_back(pAgent);
+        }
+    }
+
+    template<typename AgentType>
+    void DestroyAgents(const Config& config, std::vector<AgentType*>& agents)
+    {
+        for (size_t i = 0; i < agents.size(); ++i)
+        {
+            behaviac::Agent::Destroy(agents[i]);
+        }
+
+        agents.clear();
+
+        for (int c = 0; c < config.threads; ++c)
+        {
+            behaviac::Context::Cleanup(c);
+        }
+    }
+
+    /**
+    ticks every context 'frames' times, each one on its own thread when there are more than one.
+
+    @return the microseconds it takes
+    */
+    int64_t ExecContexts(const Config& config, int frames);
+
+    /// the number of the frames so that all the agents are ticked about config.operations times
+    inline int GetFrames(const Config& config)
+    {
+        int frames = config.operations / config.agents;
+
+        return frames > 0 ? frames : 1;
+    }
+}
+
+#define BENCH(NAME, BENCHNAME, SCALING)                                                             \
+    static bool bench_##NAME(const bench::Config& config, bench::Result& result);                 \
+    static bench::AutoBenchRegister autoBenchRegister_##NAME(BENCHNAME, bench_##NAME, SCALING);     \
+    static bool bench_##NAME(const bench::Config& config, bench::Result& result)
+
+#endif//_BTBENCH_H_
@@ -41,7 +41,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			float& opl = ((CPerformanceAgent*)pAgent)->DistanceToEnemy;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par_SmallDisance") == 4142645218u);
+			BEHAVIAC_ASSERT_VARID("par_SmallDisance", 4142645218u);
 			float& opr = (float&)pAgent->GetVariable<float >(4142645218u);
 			bool op = PrivateDetails::LessEqual(opl, opr);
 			return op ? BT_SUCCESS : BT_FAILURE;
@@ -61,7 +61,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			float& opl = ((CPerformanceAgent*)pAgent)->HP;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par_HealthThreshold") == 1146605254u);
+			BEHAVIAC_ASSERT_VARID("par_HealthThreshold", 1146605254u);
 			float& opr = (float&)pAgent->GetVariable<float >(1146605254u);
 			bool op = PrivateDetails::LessEqual(opl, opr);
 			return op ? BT_SUCCESS : BT_FAILURE;
@@ -99,7 +99,7 @@ namespace behaviac
 		{
 			EBTStatus result = BT_SUCCESS;
 			float& opl = ((CPerformanceAgent*)pAgent)->DistanceToEnemy;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par_BigDistance") == 1778440178u);
+			BEHAVIAC_ASSERT_VARID("par_BigDistance", 1778440178u);
 			float& opr2 = (float&)pAgent->GetVariable<float >(1778440178u);
 			bool op = PrivateDetails::Greater(opl, opr2);
 			if (!op)
@@ -152,7 +152,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			float& opl = ((CPerformanceAgent*)pAgent)->DistanceToEnemy;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par_SmallDisance") == 4142645218u);
+			BEHAVIAC_ASSERT_VARID("par_SmallDisance", 4142645218u);
 			float& opr = (float&)pAgent->GetVariable<float >(4142645218u);
 			bool op = PrivateDetails::Greater(opl, opr);
 			return op ? BT_SUCCESS : BT_FAILURE;
@@ -172,7 +172,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			float& opl = ((CPerformanceAgent*)pAgent)->Hungry;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par_HungryThreshold") == 825091127u);
+			BEHAVIAC_ASSERT_VARID("par_HungryThreshold", 825091127u);
 			float& opr = (float&)pAgent->GetVariable<float >(825091127u);
 			bool op = PrivateDetails::GreaterEqual(opl, opr);
 			return op ? BT_SUCCESS : BT_FAILURE;
@@ -259,7 +259,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			float& opl = ((CPerformanceAgent*)pAgent)->DistanceToEnemy;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par_SmallDisance") == 4142645218u);
+			BEHAVIAC_ASSERT_VARID("par_SmallDisance", 4142645218u);
 			float& opr = (float&)pAgent->GetVariable<float >(4142645218u);
 			bool op = PrivateDetails::Greater(opl, opr);
 			return op ? BT_SUCCESS : BT_FAILURE;
@@ -16,6 +16,7 @@
 #include "behaviac/common/profiler/profiler.h"
 #include "behaviac/agent/agent.h"
 #include "behaviac/agent/registermacros.h"
+#include "behaviac/common/memory/slaballocator.h"
 #include "BehaviacWorkspace.h"
 #include "btperformance.h"
 
@@ -199,6 +200,7 @@ void RegisterTypes();
 void UnRegisterTypes();
 
 void btagenttick(behaviac::Workspace::EFileFormat format, int countAgents);
+void btslabstats();
 
 static void SetExePath()
 {
@@ -225,6 +227,14 @@ int main(int argc, char** argv)
     SetExePath();
 
     CommandLineParameterParser CLPP(argc, argv);
+
+    //the allocator needs to be selected before anything is allocated
+    bool bSlab = CLPP.ParameterExist("-slab");
+
+    if (bSlab) {
+        behaviac::SetMemoryAllocator(behaviac::GetSlabMemoryAllocator());
+    }
+
     //if to wait for the key to end
     bool bWait = CLPP.ParameterExist("-wait");
 
@@ -254,6 +264,10 @@ int main(int argc, char** argv)
 
     btagenttick(format, countAgents);
 
+    if (bSlab) {
+        btslabstats();
+    }
+
     //behaviac::Socket::ShutdownConnection();
 
     if (bWait) {
@@ -313,8 +327,10 @@ void btagenttick(behaviac::Workspace::EFileFormat format, int countAgents)
         strFormat = "bson";
     }
 
-    printf("\nAgents %d Format %s\n", countAgents, strFormat);
-    BEHAVIAC_LOGINFO("\nAgents %d Format %s\n", countAgents, strFormat);
+    const char* strAllocator = behaviac::GetMemoryAllocator().GetName();
+
+    printf("\nAgents %d Format %s Allocator %s\n", countAgents, strFormat, strAllocator);
+    BEHAVIAC_LOGINFO("\nAgents %d Format %s Allocator %s\n", countAgents, strFormat, strAllocator);
 
 	behaviac::Workspace::GetInstance()->SetFilePath("../integration/unity_performance/Assets/Resources/behaviac/exported");
 	behaviac::Workspace::GetInstance()->SetFileFormat(format);
@@ -324,7 +340,7 @@ void btagenttick(behaviac::Workspace::EFileFormat format, int countAgents)
     behaviac::Config::SetSocketing(false);
     behaviac::Config::SetProfiling(false);
 
-    AgentItem_t* agents = BEHAVIAC_NEW AgentItem_t[countAgents];
+    AgentItem_t* agents = BEHAVIAC_NEW_ARRAY AgentItem_t[countAgents];
 
     behaviac::Agent::SetIdMask(0xffffffff);
 
@@ -352,7 +368,11 @@ void btagenttick(behaviac::Workspace::EFileFormat format, int countAgents)
 
     behaviac::Profiler::GetInstance()->BeginFrame();
 
-    MyMethod(countAgents, agents);
+    {
+        BEHAVIAC_PROFILE("btagenttick");
+
+        MyMethod(countAgents, agents);
+    }
 
     behaviac::Profiler::GetInstance()->EndFrame();
 
@@ -367,7 +387,27 @@ void btagenttick(behaviac::Workspace::EFileFormat format, int countAgents)
 
     behaviac::LogManager::GetInstance()->Flush(0);
 
-    BEHAVIAC_DELETE(agents);
+    BEHAVIAC_DELETE_ARRAY(agents);
 
     printf("\ndone\n");
 }
+
+void btslabstats()
+{
+    behaviac::MemSlabAllocator::Stats stats;
+    behaviac::GetSlabMemoryAllocator().GetStats(stats);
+
+    printf("\nSlab allocator: reserved %u bytes, allocated %u bytes, %u thread caches\n",
+           (unsigned)stats.reservedBytes, (unsigned)stats.allocatedBytes, stats.threadCacheCount);
+
+    for (int i = 0; i < behaviac::MemSlabAllocator::kSizeClassCount; ++i) {
+        const behaviac::MemSlabAllocator::SizeClassStats& classStats = stats.sizeClasses[i];
+
+        if (classStats.allocCount > 0) {
+            printf("  block %4u: slabs %3u allocs %10llu frees %10llu\n", classStats.blockSize, classStats.slabCount,
+                   (unsigned long long)classStats.allocCount, (unsigned long long)classStats.freeCount);
+        }
+    }
+
+    printf("  large: allocs %10llu frees %10llu\n", (unsigned long long)stats.largeAllocCount, (unsigned long long)stats.largeFreeCount);
+}
@@ -13,7 +13,7 @@
 
 #include "HTNAgentHouse.h"
 
-HTNAgentHouse::HTNAgentHouse()
+HTNAgentHouse::HTNAgentHouse() : InteriorCost(0)
 {
 }
 
@@ -66,8 +66,16 @@ public:
 
     void BuildInterior()
     {
+        if (this->InteriorCost != 0)
+        {
+            int money = this->GetVariable<int>("Money");
+            this->SetVariable("Money", money - this->InteriorCost);
+        }
     }
 
+    /// not known by the planner, it makes the plan fail when the builder is to be paid
+    int InteriorCost;
+
     void CutLogs()
     {
     }
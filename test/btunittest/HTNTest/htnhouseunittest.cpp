@@ -13,6 +13,7 @@
 
 #include "../btloadtestsuite.h"
 #include "behaviac/common/profiler/profiler.h"
+#include "behaviac/htn/planner.h"
 
 #if BEHAVIAC_USE_HTN
 
@@ -78,4 +79,97 @@ LOAD_TEST(btunittest, test_build_house)
     finlTestEnvHTNHouse(testAgent);
 }
 
+static void ResetHouse(HTNAgentHouse* testAgent, int money)
+{
+    testAgent->SetVariable("Money", money);
+    testAgent->SetVariable("Land", false);
+    testAgent->SetVariable("GoodCredit", true);
+    testAgent->SetVariable("Contract", false);
+    testAgent->SetVariable("Permit", false);
+    testAgent->SetVariable("HouseBuilt", false);
+    testAgent->SetVariable("Mortgage", false);
+    testAgent->SetVariable("House", false);
+}
+
+/**
+the plans are kept and run again while the variables the preconditions read are not changed
+*/
+LOAD_TEST(btunittest, test_build_house_plan_cache)
+{
+    behaviac::Planner::SetPlanCacheCapacity(2);
+    behaviac::Planner::ResetReplanStats();
+
+    HTNAgentHouse* testAgent = initTestEnvHTNHouse("node_test/htn/house/root", format);
+
+    for (int i = 0; i < 3; ++i)
+    {
+        //the same plan, built at first and then found in the cache
+        ResetHouse(testAgent, 200);
+        testAgent->btexec();
+
+        CHECK_EQUAL(100, testAgent->GetVariable<int>("Money"));
+        CHECK_EQUAL(true, testAgent->GetVariable<bool>("Land"));
+        CHECK_EQUAL(true, testAgent->GetVariable<bool>("Mortgage"));
+        CHECK_EQUAL(true, testAgent->GetVariable<bool>("Permit"));
+        CHECK_EQUAL(true, testAgent->GetVariable<bool>("House"));
+
+        //no land can be bought, there is no plan
+        ResetHouse(testAgent, 50);
+        testAgent->btexec();
+
+        CHECK_EQUAL(50, testAgent->GetVariable<int>("Money"));
+        CHECK_EQUAL(false, testAgent->GetVariable<bool>("Land"));
+        CHECK_EQUAL(false, testAgent->GetVariable<bool>("House"));
+    }
+
+    //the plan is only built the first time
+    behaviac::Planner::ReplanStats stats = behaviac::Planner::GetReplanStats();
+    CHECK_EQUAL(1u, stats.plans);
+    CHECK_EQUAL(2u, stats.planCacheHits);
+
+    finlTestEnvHTNHouse(testAgent);
+
+    behaviac::Planner::SetPlanCacheCapacity(0);
+}
+
+/**
+the builder can't be paid after the interior, only build_house is decomposed again and its other method is used
+*/
+LOAD_TEST(btunittest, test_build_house_partial_replan)
+{
+    HTNAgentHouse* testAgent = initTestEnvHTNHouse("node_test/htn/house/root", format);
+    testAgent->InteriorCost = 120;
+
+    //the whole plan fails
+    ResetHouse(testAgent, 200);
+    testAgent->btexec();
+
+    CHECK_EQUAL(30, testAgent->GetVariable<int>("Money"));
+    CHECK_EQUAL(true, testAgent->GetVariable<bool>("HouseBuilt"));
+    CHECK_EQUAL(false, testAgent->GetVariable<bool>("House"));
+
+    behaviac::Planner::SetPartialReplanning(true);
+    behaviac::Planner::ResetReplanStats();
+
+    //land is bought once, the house is built again with the friend
+    ResetHouse(testAgent, 200);
+    testAgent->btexec();
+
+    CHECK_EQUAL(-90, testAgent->GetVariable<int>("Money"));
+    CHECK_EQUAL(true, testAgent->GetVariable<bool>("Land"));
+    CHECK_EQUAL(true, testAgent->GetVariable<bool>("Mortgage"));
+    CHECK_EQUAL(true, testAgent->GetVariable<bool>("House"));
+
+    behaviac::Planner::ReplanStats stats = behaviac::Planner::GetReplanStats();
+    CHECK_EQUAL(1u, stats.plans);
+    CHECK_EQUAL(1u, stats.replans);
+    CHECK_EQUAL(0u, stats.failedReplans);
+    CHECK(stats.tasksKept > 0);
+    CHECK(stats.tasksDecomposed > 0);
+
+    behaviac::Planner::SetPartialReplanning(false);
+
+    finlTestEnvHTNHouse(testAgent);
+}
+
 #endif
\ No newline at end of file
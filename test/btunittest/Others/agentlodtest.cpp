@@ -0,0 +1,206 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Tencent is pleased to support the open source community by making behaviac available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except in compliance with
+// the License. You may obtain a copy of the License at http://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and limitations under the License.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "../btloadtestsuite.h"
+
+static const int kLODContext = 3;
+static const int kAgentCount = 8;
+
+static AgentNodeTest* CreateLODAgent(const char* treePath, int lod)
+{
+    AgentNodeTest* pAgent = behaviac::Agent::Create<AgentNodeTest>(0, kLODContext, 0);
+    pAgent->resetProperties();
+    pAgent->btsetcurrent(treePath);
+    pAgent->SetLOD(lod);
+
+    return pAgent;
+}
+
+TEST(btunittest, agent_lod_tick_interval)
+{
+    behaviac::Workspace::EFileFormat format = behaviac::Workspace::GetInstance()->GetFileFormat();
+    behaviac::Workspace::GetInstance()->SetFileFormat(behaviac::Workspace::EFF_xml);
+
+    behaviac::Config::SetSocketing(false);
+    registerAllTypes();
+
+    //testVar_0 is 0, every tick runs the whole tree and sets testVar_1 to 1
+    const char* treePath = "node_test/action_ut_waitforsignal_0";
+    behaviac::Workspace::GetInstance()->Load(treePath);
+
+    behaviac::Context& context = behaviac::Context::GetContext(kLODContext);
+    context.SetLODTickInterval(1, 4);
+    CHECK_EQUAL(1, context.GetLODTickInterval(0));
+    CHECK_EQUAL(4, context.GetLODTickInterval(1));
+    CHECK_EQUAL(1, context.GetLODTickInterval(2));
+
+    AgentNodeTest* pFullDetail = CreateLODAgent(treePath, 0);
+    pFullDetail->testVar_0 = 0;
+
+    std::vector<AgentNodeTest*> agents;
+
+    for (int i = 0; i < kAgentCount; ++i)
+    {
+        AgentNodeTest* pAgent = CreateLODAgent(treePath, 1);
+        CHECK_EQUAL(1, pAgent->GetLOD());
+        pAgent->testVar_0 = 0;
+        agents.push_back(pAgent);
+    }
+
+    std::vector<int> tickCounts(kAgentCount, 0);
+
+    for (int frame = 0; frame < 12; ++frame)
+    {
+        pFullDetail->testVar_1 = -1;
+
+        for (int i = 0; i < kAgentCount; ++i)
+        {
+            agents[i]->testVar_1 = -1;
+        }
+
+        behaviac::Context::execAgents(kLODContext);
+
+        CHECK_EQUAL(1, pFullDetail->testVar_1);
+
+        //the agents of the level are spread evenly over the frames
+        int tickedCount = 0;
+
+        for (int i = 0; i < kAgentCount; ++i)
+        {
+            if (agents[i]->testVar_1 == 1)
+            {
+                tickedCount++;
+                tickCounts[i]++;
+            }
+        }
+
+        CHECK_EQUAL(kAgentCount / 4, tickedCount);
+    }
+
+    for (int i = 0; i < kAgentCount; ++i)
+    {
+        CHECK_EQUAL(3, tickCounts[i]);
+        behaviac::Agent::Destroy(agents[i]);
+    }
+
+    behaviac::Agent::Destroy(pFullDetail);
+    behaviac::Context::Cleanup(kLODContext);
+
+    unregisterAllTypes();
+
+    behaviac::Workspace::GetInstance()->SetFileFormat(format);
+}
+
+TEST(btunittest, agent_lod_tree)
+{
+    behaviac::Workspace::EFileFormat format = behaviac::Workspace::GetInstance()->GetFileFormat();
+    behaviac::Workspace::GetInstance()->SetFileFormat(behaviac::Workspace::EFF_xml);
+
+    behaviac::Config::SetSocketing(false);
+    registerAllTypes();
+
+    const char* treePath = "node_test/action_ut_waitforsignal_0";
+    const char* lodTreePath = "node_test/wait_ut_1";
+    behaviac::Workspace::GetInstance()->Load(treePath);
+    behaviac::Workspace::GetInstance()->Load(lodTreePath);
+
+    AgentNodeTest* pAgent = CreateLODAgent(treePath, 0);
+    pAgent->SetLODTree(2, lodTreePath);
+
+    //the level 1 has no tree of its own, it runs the tree of the level 0
+    pAgent->SetLOD(1);
+    CHECK(pAgent->btgetcurrent()->GetName() == treePath);
+
+    pAgent->SetLOD(3);
+    CHECK(pAgent->btgetcurrent()->GetName() == lodTreePath);
+
+    pAgent->SetLOD(0);
+    CHECK(pAgent->btgetcurrent()->GetName() == treePath);
+
+    pAgent->SetLODTree(2, 0);
+    pAgent->SetLOD(2);
+    CHECK(pAgent->btgetcurrent()->GetName() == treePath);
+
+    //the tree of the current level is switched to at once
+    pAgent->SetLODTree(1, lodTreePath);
+    CHECK(pAgent->btgetcurrent()->GetName() == lodTreePath);
+
+    pAgent->SetLODTree(1, 0);
+    CHECK(pAgent->btgetcurrent()->GetName() == treePath);
+
+    pAgent->SetLODTree(3, lodTreePath);
+    CHECK(pAgent->btgetcurrent()->GetName() == treePath);
+
+    behaviac::Agent::Destroy(pAgent);
+    behaviac::Context::Cleanup(kLODContext);
+
+    unregisterAllTypes();
+
+    behaviac::Workspace::GetInstance()->SetFileFormat(format);
+}
+
+TEST(btunittest, agent_lod_wait)
+{
+    behaviac::Workspace::EFileFormat format = behaviac::Workspace::GetInstance()->GetFileFormat();
+    behaviac::Workspace::GetInstance()->SetFileFormat(behaviac::Workspace::EFF_xml);
+
+    behaviac::Config::SetSocketing(false);
+    registerAllTypes();
+
+    //waits for 1000ms
+    const char* treePath = "node_test/wait_ut_1";
+    behaviac::Workspace::GetInstance()->Load(treePath);
+
+    behaviac::Context::GetContext(kLODContext).SetLODTickInterval(1, 3);
+
+    AgentNodeTest* pAgent = CreateLODAgent(treePath, 1);
+
+    //100ms a frame, the wait ends at the first tick after 1000ms however many frames are skipped
+    int endFrame = -1;
+    int lastTickFrame = -1;
+
+    for (int frame = 0; frame < 20 && endFrame < 0; ++frame)
+    {
+        behaviac::Workspace::GetInstance()->SetTimeSinceStartup(frame * 0.1);
+
+        pAgent->testVar_0 = -1;
+        behaviac::Context::execAgents(kLODContext);
+
+        if (pAgent->testVar_0 == 2)
+        {
+            endFrame = frame;
+        }
+        else if (pAgent->testVar_0 == 1)
+        {
+            CHECK(lastTickFrame < 0);
+            lastTickFrame = frame;
+        }
+        else if (lastTickFrame >= 0)
+        {
+            CHECK_EQUAL(behaviac::BT_RUNNING, pAgent->btgetcurrent()->GetStatus());
+        }
+    }
+
+    CHECK(lastTickFrame >= 0);
+    CHECK(endFrame - lastTickFrame >= 10);
+    CHECK(endFrame - lastTickFrame < 10 + 3);
+    CHECK_EQUAL(0, (endFrame - lastTickFrame) % 3);
+    CHECK_EQUAL(behaviac::BT_SUCCESS, pAgent->btgetcurrent()->GetStatus());
+
+    behaviac::Agent::Destroy(pAgent);
+    behaviac::Context::Cleanup(kLODContext);
+
+    unregisterAllTypes();
+
+    behaviac::Workspace::GetInstance()->SetFileFormat(format);
+}
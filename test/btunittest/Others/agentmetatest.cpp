@@ -0,0 +1,107 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Tencent is pleased to support the open source community by making behaviac available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except in compliance with
+// the License. You may obtain a copy of the License at http://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and limitations under the License.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "../btloadtestsuite.h"
+#include "behaviac/common/meta.h"
+
+TEST(btunittest, agent_meta_members)
+{
+    behaviac::Workspace::EFileFormat format = behaviac::Workspace::GetInstance()->GetFileFormat();
+    behaviac::Workspace::GetInstance()->SetFileFormat(behaviac::Workspace::EFF_xml);
+
+    behaviac::Config::SetSocketing(false);
+    registerAllTypes();
+
+    //the metas are registered when the workspace starts
+    behaviac::Workspace::GetInstance()->Load("node_test/action_ut_waitforsignal_0");
+
+    behaviac::AgentMeta* meta = BEHAVIAC_NEW behaviac::AgentMeta();
+
+    //enough to grow the table a few times
+    const int kCount = 200;
+    std::vector<behaviac::IProperty*> properties;
+
+    for (int i = 0; i < kCount; ++i)
+    {
+        char name[64];
+        string_sprintf(name, "member_%d", i);
+        uint32_t id = behaviac::MakeVariableId(name);
+
+        behaviac::IProperty* property = behaviac::AgentMeta::CreateProperty("int", id, name, "0");
+        CHECK(property != 0);
+        meta->RegisterMemberProperty(id, property);
+        properties.push_back(property);
+    }
+
+    for (int i = 0; i < kCount; ++i)
+    {
+        char name[64];
+        string_sprintf(name, "member_%d", i);
+        uint32_t id = behaviac::MakeVariableId(name);
+
+        CHECK(meta->GetProperty(id) == properties[i]);
+        CHECK(meta->GetMemberProperty(id) == properties[i]);
+        CHECK(meta->GetMethod(id) == 0);
+    }
+
+    CHECK(meta->GetProperty(behaviac::MakeVariableId("member_unknown")) == 0);
+    CHECK(meta->GetMemberProperty(behaviac::MakeVariableId("member_unknown")) == 0);
+    CHECK_EQUAL((size_t)kCount, meta->GetMemberProperties().size());
+
+    //a customized property hides the member of the same name
+    uint32_t id = behaviac::MakeVariableId("member_0");
+    behaviac::IProperty* customized = behaviac::AgentMeta::CreateCustomizedProperty("int", id, "member_0", "1");
+    meta->RegisterCustomizedProperty(id, customized);
+
+    CHECK(meta->GetProperty(id) == customized);
+    CHECK(meta->GetMemberProperty(id) == properties[0]);
+
+    BEHAVIAC_DELETE meta;
+
+    unregisterAllTypes();
+
+    behaviac::Workspace::GetInstance()->SetFileFormat(format);
+}
+
+TEST(btunittest, agent_meta_cached)
+{
+    behaviac::Workspace::EFileFormat format = behaviac::Workspace::GetInstance()->GetFileFormat();
+    behaviac::Workspace::GetInstance()->SetFileFormat(behaviac::Workspace::EFF_xml);
+
+    behaviac::Config::SetSocketing(false);
+    registerAllTypes();
+
+    //the metas are registered when the workspace starts
+    behaviac::Workspace::GetInstance()->Load("node_test/action_ut_waitforsignal_0");
+
+    AgentNodeTest* pAgent = behaviac::Agent::Create<AgentNodeTest>(0, 0, 0);
+
+    behaviac::AgentMeta* meta = behaviac::AgentMeta::GetMeta(behaviac::MakeVariableId(pAgent->GetObjectTypeName()));
+    CHECK(meta != 0);
+
+    uint32_t id = behaviac::MakeVariableId("testVar_0");
+    CHECK(pAgent->GetProperty(id) != 0);
+    CHECK(pAgent->GetProperty(id) == meta->GetProperty(id));
+    CHECK(pAgent->GetProperty(behaviac::MakeVariableId("testVar_unknown")) == 0);
+
+    pAgent->resetProperties();
+    pAgent->SetVariable("testVar_0", 3);
+    CHECK_EQUAL(3, pAgent->GetVariable<int>("testVar_0"));
+
+    behaviac::Agent::Destroy(pAgent);
+    behaviac::Context::Cleanup(0);
+
+    unregisterAllTypes();
+
+    behaviac::Workspace::GetInstance()->SetFileFormat(format);
+}
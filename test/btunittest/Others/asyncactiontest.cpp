@@ -0,0 +1,181 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Tencent is pleased to support the open source community by making behaviac available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except in compliance with
+// the License. You may obtain a copy of the License at http://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and limitations under the License.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "../btloadtestsuite.h"
+#include "behaviac/behaviortree/nodes/actions/action.h"
+
+//starts an async work and waits for it
+class AsyncAction : public behaviac::Action
+{
+public:
+    AsyncAction() : m_token(0), m_calls(0)
+    {
+    }
+
+    uint32_t	m_token;
+    int			m_calls;
+
+protected:
+    //not loaded, it has no agent type to check
+    virtual bool IsValid(behaviac::Agent* pAgent, behaviac::BehaviorTask* pTask) const
+    {
+        BEHAVIAC_UNUSED_VAR(pAgent);
+        BEHAVIAC_UNUSED_VAR(pTask);
+
+        return true;
+    }
+
+    virtual behaviac::EBTStatus update_impl(behaviac::Agent* pAgent, behaviac::EBTStatus childStatus)
+    {
+        BEHAVIAC_UNUSED_VAR(childStatus);
+
+        this->m_calls++;
+        this->m_token = pAgent->BeginAsync();
+
+        return behaviac::BT_RUNNING;
+    }
+};
+
+static bool IsTicked(behaviac::Agent* pAgent)
+{
+    behaviac::Context& context = behaviac::Context::GetContext(pAgent->GetContextId());
+
+    for (size_t i = 0; i < context.m_agents.size(); ++i)
+    {
+        if (context.m_agents[i].agents.find(pAgent->GetId()) != context.m_agents[i].agents.end())
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+TEST(btunittest, async_action)
+{
+    behaviac::Config::SetSocketing(false);
+    registerAllTypes();
+
+    //the agents can be created once behaviac is started by the first load
+    behaviac::Workspace::GetInstance()->Load("node_test/action_ut_0");
+    AgentNodeTest* pAgent = behaviac::Agent::Create<AgentNodeTest>();
+
+    const uint32_t parkedCount = behaviac::Context::GetParkedAgentCount();
+
+    AsyncAction action;
+    behaviac::BehaviorTask* pTask = action.CreateAndInitTask();
+
+    //the agent is parked until the work is completed, its method is not polled
+    CHECK_EQUAL(behaviac::BT_RUNNING, pTask->exec(pAgent));
+    CHECK(action.m_token != 0);
+    CHECK(pAgent->IsParked());
+    CHECK(!IsTicked(pAgent));
+    CHECK_EQUAL(parkedCount + 1, behaviac::Context::GetParkedAgentCount());
+
+    CHECK_EQUAL(behaviac::BT_RUNNING, pTask->exec(pAgent));
+    CHECK_EQUAL(1, action.m_calls);
+
+    //it is resumed by the next update with the status injected
+    behaviac::Context::CompleteAsync(action.m_token, behaviac::BT_FAILURE);
+    CHECK(!IsTicked(pAgent));
+
+    behaviac::Workspace::GetInstance()->Update();
+    CHECK(IsTicked(pAgent));
+    CHECK_EQUAL(parkedCount, behaviac::Context::GetParkedAgentCount());
+
+    CHECK_EQUAL(behaviac::BT_FAILURE, pTask->exec(pAgent));
+    CHECK_EQUAL(1, action.m_calls);
+    CHECK(!pAgent->IsParked());
+
+    //the work is cancelled when the action is aborted, its late completion is ignored
+    CHECK_EQUAL(behaviac::BT_RUNNING, pTask->exec(pAgent));
+    CHECK_EQUAL(2, action.m_calls);
+    CHECK(!IsTicked(pAgent));
+
+    pTask->abort(pAgent);
+    CHECK(IsTicked(pAgent));
+    CHECK(!pAgent->IsParked());
+    CHECK_EQUAL(parkedCount, behaviac::Context::GetParkedAgentCount());
+
+    behaviac::Context::CompleteAsync(action.m_token, behaviac::BT_SUCCESS);
+    behaviac::Workspace::GetInstance()->Update();
+    CHECK(IsTicked(pAgent));
+
+    //two actions waiting at the same time, e.g. in a Parallel, don't cancel each other
+    AsyncAction action2;
+    behaviac::BehaviorTask* pTask2 = action2.CreateAndInitTask();
+
+    CHECK_EQUAL(behaviac::BT_RUNNING, pTask->exec(pAgent));
+    CHECK_EQUAL(behaviac::BT_RUNNING, pTask2->exec(pAgent));
+    CHECK(action.m_token != action2.m_token);
+    CHECK_EQUAL(parkedCount + 1, behaviac::Context::GetParkedAgentCount());
+
+    CHECK_EQUAL(behaviac::BT_RUNNING, pTask->exec(pAgent));
+    CHECK_EQUAL(behaviac::BT_RUNNING, pTask2->exec(pAgent));
+    CHECK_EQUAL(3, action.m_calls);
+    CHECK_EQUAL(1, action2.m_calls);
+
+    //the agent is queued to its context, it is put back when the context is ticked
+    behaviac::Context::CompleteAsync(action2.m_token, behaviac::BT_SUCCESS);
+    behaviac::Context::ResumeCompletedAgents();
+    CHECK(!IsTicked(pAgent));
+
+    behaviac::Workspace::GetInstance()->Update();
+    CHECK(IsTicked(pAgent));
+
+    //the first one is still waiting, the agent is parked again
+    CHECK_EQUAL(behaviac::BT_RUNNING, pTask->exec(pAgent));
+    CHECK_EQUAL(behaviac::BT_SUCCESS, pTask2->exec(pAgent));
+    CHECK_EQUAL(3, action.m_calls);
+    CHECK_EQUAL(1, action2.m_calls);
+    CHECK(pAgent->IsParked());
+    CHECK(!IsTicked(pAgent));
+
+    behaviac::Context::CompleteAsync(action.m_token, behaviac::BT_FAILURE);
+    behaviac::Workspace::GetInstance()->Update();
+    CHECK_EQUAL(behaviac::BT_FAILURE, pTask->exec(pAgent));
+    CHECK_EQUAL(parkedCount, behaviac::Context::GetParkedAgentCount());
+
+    //aborting one keeps the work of the other, which parks the agent again
+    CHECK_EQUAL(behaviac::BT_RUNNING, pTask->exec(pAgent));
+    CHECK_EQUAL(behaviac::BT_RUNNING, pTask2->exec(pAgent));
+
+    pTask2->abort(pAgent);
+    CHECK(IsTicked(pAgent));
+    CHECK_EQUAL(behaviac::BT_RUNNING, pTask->exec(pAgent));
+    CHECK_EQUAL(4, action.m_calls);
+    CHECK(pAgent->IsParked());
+
+    behaviac::Context::CompleteAsync(action.m_token, behaviac::BT_SUCCESS);
+    behaviac::Workspace::GetInstance()->Update();
+    CHECK_EQUAL(behaviac::BT_SUCCESS, pTask->exec(pAgent));
+
+    //the agent destroyed while it is parked, and while it is queued to be resumed
+    CHECK_EQUAL(behaviac::BT_RUNNING, pTask->exec(pAgent));
+    CHECK_EQUAL(behaviac::BT_RUNNING, pTask2->exec(pAgent));
+    CHECK_EQUAL(parkedCount + 1, behaviac::Context::GetParkedAgentCount());
+
+    behaviac::Context::CompleteAsync(action2.m_token, behaviac::BT_SUCCESS);
+    behaviac::Context::ResumeCompletedAgents();
+
+    behaviac::BehaviorTask::DestroyTask(pTask);
+    behaviac::BehaviorTask::DestroyTask(pTask2);
+
+    behaviac::Agent::Destroy(pAgent);
+    CHECK_EQUAL(parkedCount, behaviac::Context::GetParkedAgentCount());
+
+    behaviac::Context::CompleteAsync(action.m_token, behaviac::BT_SUCCESS);
+    behaviac::Workspace::GetInstance()->Update();
+
+    unregisterAllTypes();
+}
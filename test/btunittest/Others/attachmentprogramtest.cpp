@@ -0,0 +1,120 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Tencent is pleased to support the open source community by making behaviac available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except in compliance with
+// the License. You may obtain a copy of the License at http://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and limitations under the License.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "behaviac/behaviac.h"
+#include "behaviac/behaviortree/nodes/composites/sequence.h"
+#include "behaviac/behaviortree/attachments/precondition.h"
+#include "behaviac/behaviortree/attachments/effector.h"
+#include "test.h"
+
+//the results are given, the evaluations are counted
+class CountingPrecondition : public behaviac::Precondition
+{
+public:
+    CountingPrecondition(bool bResult, bool bAnd, EPhase phase) : m_bResult(bResult), m_count(0)
+    {
+        this->SetIsAnd(bAnd);
+        this->SetPhase(phase);
+    }
+
+    bool	m_bResult;
+    int		m_count;
+
+protected:
+    virtual behaviac::EBTStatus update_impl(behaviac::Agent* pAgent, behaviac::EBTStatus childStatus)
+    {
+        BEHAVIAC_UNUSED_VAR(pAgent);
+        BEHAVIAC_UNUSED_VAR(childStatus);
+
+        this->m_count++;
+
+        return this->m_bResult ? behaviac::BT_SUCCESS : behaviac::BT_FAILURE;
+    }
+};
+
+class CountingEffector : public behaviac::Effector
+{
+public:
+    CountingEffector(behaviac::BehaviorNode::EPhase phase, int* order, int* applied) : m_order(order), m_applied(applied)
+    {
+        this->SetPhase(phase);
+    }
+
+    int*	m_order;
+    int*	m_applied;
+
+protected:
+    virtual behaviac::EBTStatus update_impl(behaviac::Agent* pAgent, behaviac::EBTStatus childStatus)
+    {
+        BEHAVIAC_UNUSED_VAR(pAgent);
+        BEHAVIAC_UNUSED_VAR(childStatus);
+
+        *this->m_applied = (*this->m_order)++;
+
+        return behaviac::BT_SUCCESS;
+    }
+};
+
+TEST(btunittest, attachment_program)
+{
+    //the attachments are deleted with the node
+    behaviac::Sequence node;
+
+    //true and false or true and false, combined from the left: ((true && false) || true) && false
+    CountingPrecondition* p0 = BEHAVIAC_NEW CountingPrecondition(true, true, behaviac::Precondition::E_ENTER);
+    CountingPrecondition* p1 = BEHAVIAC_NEW CountingPrecondition(false, true, behaviac::Precondition::E_BOTH);
+    CountingPrecondition* p2 = BEHAVIAC_NEW CountingPrecondition(true, false, behaviac::Precondition::E_ENTER);
+    CountingPrecondition* p3 = BEHAVIAC_NEW CountingPrecondition(false, true, behaviac::Precondition::E_UPDATE);
+    node.Attach(p0, true, false);
+    node.Attach(p1, true, false);
+    node.Attach(p2, true, false);
+    node.Attach(p3, true, false);
+
+    //enter: true && false || true
+    CHECK(node.CheckPreconditions(0, false));
+    CHECK_EQUAL(1, p0->m_count);
+    CHECK_EQUAL(1, p1->m_count);
+    CHECK_EQUAL(1, p2->m_count);
+    CHECK_EQUAL(0, p3->m_count);
+
+    //update: false && false, the second is not evaluated
+    CHECK(!node.CheckPreconditions(0, true));
+    CHECK_EQUAL(2, p1->m_count);
+    CHECK_EQUAL(0, p3->m_count);
+
+    //an 'or' after a true is not evaluated
+    p1->m_bResult = true;
+    p2->m_count = 0;
+    CHECK(node.CheckPreconditions(0, false));
+    CHECK_EQUAL(0, p2->m_count);
+
+    //the effectors of a phase are applied in the attached order
+    int order = 0;
+    int applied[3] = { -1, -1, -1 };
+    CountingEffector* e0 = BEHAVIAC_NEW CountingEffector(behaviac::BehaviorNode::E_SUCCESS, &order, &applied[0]);
+    CountingEffector* e1 = BEHAVIAC_NEW CountingEffector(behaviac::BehaviorNode::E_BOTH, &order, &applied[1]);
+    CountingEffector* e2 = BEHAVIAC_NEW CountingEffector(behaviac::BehaviorNode::E_FAILURE, &order, &applied[2]);
+    node.Attach(e0, false, true);
+    node.Attach(e1, false, true);
+    node.Attach(e2, false, true);
+
+    node.ApplyEffects(0, behaviac::BehaviorNode::E_FAILURE);
+    CHECK_EQUAL(-1, applied[0]);
+    CHECK_EQUAL(0, applied[1]);
+    CHECK_EQUAL(1, applied[2]);
+
+    node.ApplyEffects(0, behaviac::BehaviorNode::E_SUCCESS);
+    CHECK_EQUAL(2, applied[0]);
+    CHECK_EQUAL(3, applied[1]);
+    CHECK_EQUAL(1, applied[2]);
+}
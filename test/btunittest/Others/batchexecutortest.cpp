@@ -0,0 +1,153 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Tencent is pleased to support the open source community by making behaviac available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except in compliance with
+// the License. You may obtain a copy of the License at http://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and limitations under the License.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "../btloadtestsuite.h"
+#include "behaviac/agent/batchexecutor.h"
+
+static const int kBatchedContext = 1;
+static const int kPlainContext = 2;
+static const int kAgentCount = 8;
+
+static void CreateAgentPairs(const char* treePath, std::vector<AgentNodeTest*>& batched, std::vector<AgentNodeTest*>& plain)
+{
+    for (int i = 0; i < kAgentCount; ++i)
+    {
+        AgentNodeTest* pBatched = behaviac::Agent::Create<AgentNodeTest>(0, kBatchedContext, 0);
+        pBatched->resetProperties();
+        pBatched->btsetcurrent(treePath);
+        batched.push_back(pBatched);
+
+        AgentNodeTest* pPlain = behaviac::Agent::Create<AgentNodeTest>(0, kPlainContext, 0);
+        pPlain->resetProperties();
+        pPlain->btsetcurrent(treePath);
+        plain.push_back(pPlain);
+    }
+}
+
+static void DestroyAgentPairs(std::vector<AgentNodeTest*>& batched, std::vector<AgentNodeTest*>& plain)
+{
+    for (int i = 0; i < kAgentCount; ++i)
+    {
+        behaviac::Agent::Destroy(batched[i]);
+        behaviac::Agent::Destroy(plain[i]);
+    }
+
+    behaviac::Context::Cleanup(kBatchedContext);
+    behaviac::Context::Cleanup(kPlainContext);
+}
+
+//the batched agents behave as the ones ticked one by one
+static void CheckSameStates(const std::vector<AgentNodeTest*>& batched, const std::vector<AgentNodeTest*>& plain)
+{
+    for (int i = 0; i < kAgentCount; ++i)
+    {
+        CHECK_EQUAL(plain[i]->btgetcurrent()->GetStatus(), batched[i]->btgetcurrent()->GetStatus());
+        CHECK_EQUAL(plain[i]->testVar_0, batched[i]->testVar_0);
+        CHECK_EQUAL(plain[i]->testVar_1, batched[i]->testVar_1);
+        CHECK_EQUAL(plain[i]->testVar_2, batched[i]->testVar_2);
+    }
+}
+
+TEST(btunittest, batch_execution)
+{
+    behaviac::Workspace::EFileFormat format = behaviac::Workspace::GetInstance()->GetFileFormat();
+    behaviac::Workspace::GetInstance()->SetFileFormat(behaviac::Workspace::EFF_xml);
+
+    behaviac::Config::SetSocketing(false);
+    registerAllTypes();
+
+    //every agent waits for its testVar_0 to be 0
+    const char* treePath = "node_test/action_ut_waitforsignal_0";
+    behaviac::Workspace::GetInstance()->Load(treePath);
+
+    behaviac::Context::GetContext(kBatchedContext).SetBatchExecution(true);
+    behaviac::BatchExecutor* pExecutor = behaviac::Context::GetContext(kBatchedContext).GetBatchExecutor();
+    CHECK(pExecutor != 0);
+    pExecutor->SetMinBatchSize(2);
+
+    std::vector<AgentNodeTest*> batched;
+    std::vector<AgentNodeTest*> plain;
+    CreateAgentPairs(treePath, batched, plain);
+
+    for (int frame = 0; frame < 6; ++frame)
+    {
+        //the agents are signalled one group after another
+        for (int i = 0; i < kAgentCount; ++i)
+        {
+            if (i % 3 == frame % 3)
+            {
+                batched[i]->SetVariable("testVar_0", frame < 3 ? 0 : -1);
+                plain[i]->SetVariable("testVar_0", frame < 3 ? 0 : -1);
+            }
+        }
+
+        behaviac::Context::execAgents(kBatchedContext);
+        behaviac::Context::execAgents(kPlainContext);
+
+        CheckSameStates(batched, plain);
+    }
+
+    const behaviac::BatchExecutor::Stats_t& stats = pExecutor->GetStats();
+    CHECK(stats.batched > 0);
+    CHECK(stats.hits > 0);
+    CHECK(stats.groups > 0);
+
+    DestroyAgentPairs(batched, plain);
+
+    behaviac::Context::GetContext(kBatchedContext).SetBatchExecution(false);
+    CHECK(behaviac::Context::GetContext(kBatchedContext).GetBatchExecutor() == 0);
+
+    unregisterAllTypes();
+
+    behaviac::Workspace::GetInstance()->SetFileFormat(format);
+}
+
+TEST(btunittest, batch_execution_changed_input)
+{
+    behaviac::Workspace::EFileFormat format = behaviac::Workspace::GetInstance()->GetFileFormat();
+    behaviac::Workspace::GetInstance()->SetFileFormat(behaviac::Workspace::EFF_xml);
+
+    behaviac::Config::SetSocketing(false);
+    registerAllTypes();
+
+    //testVar_0 is set by an action in the tick before it is compared, the batched result is not taken
+    const char* treePath = "node_test/action_ut_2";
+    behaviac::Workspace::GetInstance()->Load(treePath);
+
+    behaviac::Context::GetContext(kBatchedContext).SetBatchExecution(true);
+    behaviac::BatchExecutor* pExecutor = behaviac::Context::GetContext(kBatchedContext).GetBatchExecutor();
+
+    std::vector<AgentNodeTest*> batched;
+    std::vector<AgentNodeTest*> plain;
+    CreateAgentPairs(treePath, batched, plain);
+
+    for (int frame = 0; frame < 3; ++frame)
+    {
+        behaviac::Context::execAgents(kBatchedContext);
+        behaviac::Context::execAgents(kPlainContext);
+
+        CheckSameStates(batched, plain);
+    }
+
+    const behaviac::BatchExecutor::Stats_t& stats = pExecutor->GetStats();
+    CHECK(stats.batched > 0);
+    CHECK(stats.stale > 0);
+
+    DestroyAgentPairs(batched, plain);
+
+    behaviac::Context::GetContext(kBatchedContext).SetBatchExecution(false);
+
+    unregisterAllTypes();
+
+    behaviac::Workspace::GetInstance()->SetFileFormat(format);
+}
@@ -0,0 +1,112 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Tencent is pleased to support the open source community by making behaviac available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except in compliance with
+// the License. You may obtain a copy of the License at http://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and limitations under the License.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "behaviac/common/file/behaviorbundle.h"
+#include "behaviac/common/file/filemanager.h"
+#include "behaviac/common/file/file.h"
+#include "../btloadtestsuite.h"
+
+static void AddBundleItem(const char* exportedPath, const char* relativePath, behaviac::Workspace::EFileFormat format,
+                          behaviac::vector<behaviac::CBehaviorBundle::Item_t>& items)
+{
+    behaviac::string path = behaviac::StringUtils::CombineDir(exportedPath, relativePath);
+    path += (format == behaviac::Workspace::EFF_xml ? ".xml" : ".bson.bytes");
+
+    behaviac::IFile* fp = behaviac::CFileManager::GetInstance()->FileOpen(path.c_str(), behaviac::CFileSystem::EOpenAccess_Read);
+    CHECK(fp != NULL);
+
+    behaviac::CBehaviorBundle::Item_t item;
+    item.relativePath = relativePath;
+    item.format = format;
+    item.data.resize((size_t)fp->GetSize());
+    fp->Read(&item.data[0], (uint32_t)item.data.size());
+
+    behaviac::CFileManager::GetInstance()->FileClose(fp);
+
+    items.push_back(item);
+}
+
+TEST(btunittest, behavior_bundle)
+{
+    behaviac::Config::SetSocketing(false);
+
+    //to be started with the metas in the bundle
+    behaviac::Workspace* pWorkspace = behaviac::Workspace::GetInstance();
+    pWorkspace->Cleanup();
+
+    const behaviac::string exportedPath = pWorkspace->GetFilePath();
+    const behaviac::Workspace::EFileFormat format = pWorkspace->GetFileFormat();
+    const char* kBundlePath = "btunittest.bundle";
+
+    behaviac::vector<behaviac::CBehaviorBundle::Item_t> items;
+    AddBundleItem(exportedPath.c_str(), "node_test/condition_ut_0", behaviac::Workspace::EFF_bson, items);
+    AddBundleItem(exportedPath.c_str(), "node_test/condition_ut_0", behaviac::Workspace::EFF_xml, items);
+    AddBundleItem(exportedPath.c_str(), "node_test/sequence_ut_0", behaviac::Workspace::EFF_bson, items);
+    AddBundleItem(exportedPath.c_str(), "behaviac.bb", behaviac::Workspace::EFF_xml, items);
+    CHECK(behaviac::CBehaviorBundle::Write(kBundlePath, items));
+
+    {
+        behaviac::CBehaviorBundle bundle;
+        CHECK(!bundle.Open("btunittest_none.bundle"));
+        CHECK(bundle.Open(kBundlePath));
+        CHECK_EQUAL(4u, bundle.GetEntryCount());
+
+        //the xml is preferred
+        const behaviac::CBehaviorBundle::Entry_t* pEntry = bundle.Find("node_test/condition_ut_0", behaviac::Workspace::EFF_default);
+        CHECK(pEntry != NULL);
+        CHECK_EQUAL((uint32_t)behaviac::Workspace::EFF_xml, pEntry->format);
+        CHECK_STR_EQUAL("node_test/condition_ut_0", bundle.GetPath(*pEntry));
+        CHECK(memcmp(items[1].data.c_str(), bundle.GetData(*pEntry), pEntry->size) == 0);
+
+        pEntry = bundle.Find("node_test/condition_ut_0", behaviac::Workspace::EFF_bson);
+        CHECK(pEntry != NULL);
+        CHECK_EQUAL((uint32_t)behaviac::Workspace::EFF_bson, pEntry->format);
+        CHECK_EQUAL(0u, pEntry->offset % behaviac::CBehaviorBundle::kAlignment);
+
+        CHECK(bundle.Find("node_test/sequence_ut_0", behaviac::Workspace::EFF_xml) == NULL);
+        CHECK(bundle.Find("node_test/selector_ut_0", behaviac::Workspace::EFF_default) == NULL);
+    }
+
+    //the trees and the metas are loaded from the bundle only, there is no file in the exported path
+    registerAllTypes();
+    pWorkspace->SetFilePath("./");
+    pWorkspace->SetFileFormat(behaviac::Workspace::EFF_default);
+    CHECK(pWorkspace->OpenBundle(kBundlePath));
+    CHECK(pWorkspace->GetBundle() != NULL);
+
+    CHECK(pWorkspace->Load("node_test/sequence_ut_0"));
+    CHECK(pWorkspace->Load("node_test/condition_ut_0"));
+
+    AgentNodeTest* testAgent = behaviac::Agent::Create<AgentNodeTest>();
+    testAgent->resetProperties();
+    testAgent->btsetcurrent("node_test/condition_ut_0");
+
+    CHECK_EQUAL(behaviac::BT_SUCCESS, testAgent->btexec());
+    CHECK_EQUAL(2, testAgent->testVar_0);
+
+    behaviac::Agent::Destroy(testAgent);
+
+    //reloaded from the bundle in bson
+    pWorkspace->SetFileFormat(behaviac::Workspace::EFF_bson);
+    CHECK(pWorkspace->Load("node_test/condition_ut_0", true));
+
+    pWorkspace->CloseBundle();
+    CHECK(pWorkspace->GetBundle() == NULL);
+
+    pWorkspace->UnLoadAll();
+    pWorkspace->SetFilePath(exportedPath.c_str());
+    pWorkspace->SetFileFormat(format);
+    remove(kBundlePath);
+
+    unregisterAllTypes();
+}
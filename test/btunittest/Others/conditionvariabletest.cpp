@@ -0,0 +1,48 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Tencent is pleased to support the open source community by making behaviac available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except in compliance with
+// the License. You may obtain a copy of the License at http://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and limitations under the License.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "behaviac/behaviac.h"
+#include "behaviac/common/thread/mutex_lock.h"
+#include "behaviac/common/thread/thread.h"
+#include "test.h"
+
+static unsigned int BEHAVIAC_STDCALL NotifyThread(void* arg)
+{
+    behaviac::ConditionVariable* pCondition = (behaviac::ConditionVariable*)arg;
+
+    behaviac::thread::Sleep(10);
+    pCondition->NotifyAll();
+
+    return 0;
+}
+
+TEST(btunittest, condition_variable)
+{
+    behaviac::ConditionVariable condition;
+
+    //nothing notifies it, it is timed out
+    uint32_t count = condition.GetCount();
+    CHECK(!condition.Wait(count, 10));
+
+    //a notification before the wait is not missed
+    condition.NotifyAll();
+    CHECK(condition.Wait(count, 10000));
+
+    count = condition.GetCount();
+    behaviac::thread::ThreadHandle thread = behaviac::thread::CreateAndStartThread(&NotifyThread, &condition, 64 * 1024);
+
+    CHECK(condition.Wait(count, 10000));
+    CHECK_EQUAL(count + 1, condition.GetCount());
+
+    behaviac::thread::StopThread(thread);
+}
@@ -0,0 +1,157 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Tencent is pleased to support the open source community by making behaviac available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except in compliance with
+// the License. You may obtain a copy of the License at http://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and limitations under the License.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "behaviac/common/base.h"
+#include "behaviac/agent/context.h"
+#include "test.h"
+#include "../behaviortest.h"
+#include "../btloadtestsuite.h"
+
+using namespace behaviac;
+
+static const int kBudgetContextId = 5;
+
+TEST(btunittest, context_tick_interval)
+{
+    registerAllTypes();
+
+    Context& c = Context::GetContext(kBudgetContextId);
+    c.SetFrameBudget(1000000);
+
+    PreconEffectorAgent* pEveryFrame = Agent::Create<PreconEffectorAgent>("everyFrame", kBudgetContextId, 0);
+    PreconEffectorAgent* pEvery3Frames = Agent::Create<PreconEffectorAgent>("every3Frames", kBudgetContextId, 0);
+    pEvery3Frames->SetTickInterval(3);
+    CHECK_EQUAL(3, pEvery3Frames->GetTickInterval());
+
+    for (int i = 0; i < 7; ++i)
+    {
+        Context::execAgents(kBudgetContextId);
+    }
+
+    //the first tick is never delayed, then every 3 frames: 1, 4, 7
+    CHECK_EQUAL(7u, pEveryFrame->GetTickStats().tickCount);
+    CHECK_EQUAL(3u, pEvery3Frames->GetTickStats().tickCount);
+    CHECK_EQUAL(0u, pEvery3Frames->GetTickStats().deferredCount);
+
+    Agent::Destroy(pEveryFrame);
+    Agent::Destroy(pEvery3Frames);
+
+    Context::Cleanup(kBudgetContextId);
+    unregisterAllTypes();
+}
+
+TEST(btunittest, context_tick_interval_without_budget)
+{
+    behaviac::Workspace::EFileFormat format = behaviac::Workspace::GetInstance()->GetFileFormat();
+    behaviac::Workspace::GetInstance()->SetFileFormat(behaviac::Workspace::EFF_xml);
+
+    behaviac::Config::SetSocketing(false);
+    registerAllTypes();
+
+    //testVar_0 is 0, every tick runs the whole tree and sets testVar_1 to 1
+    const char* treePath = "node_test/action_ut_waitforsignal_0";
+    behaviac::Workspace::GetInstance()->Load(treePath);
+
+    AgentNodeTest* pAgent = Agent::Create<AgentNodeTest>(0, kBudgetContextId, 0);
+    pAgent->resetProperties();
+    pAgent->btsetcurrent(treePath);
+    pAgent->testVar_0 = 0;
+    pAgent->SetTickInterval(3);
+
+    //the plain and the batched paths alike
+    for (int batch = 0; batch < 2; ++batch)
+    {
+        Context::GetContext(kBudgetContextId).SetBatchExecution(batch == 1);
+
+        int tickCount = 0;
+
+        for (int i = 0; i < 9; ++i)
+        {
+            pAgent->testVar_1 = -1;
+            Context::execAgents(kBudgetContextId);
+
+            if (pAgent->testVar_1 == 1)
+            {
+                tickCount++;
+            }
+        }
+
+        CHECK_EQUAL(3, tickCount);
+    }
+
+    Agent::Destroy(pAgent);
+
+    Context::Cleanup(kBudgetContextId);
+    unregisterAllTypes();
+
+    behaviac::Workspace::GetInstance()->SetFileFormat(format);
+}
+
+TEST(btunittest, context_frame_budget)
+{
+    registerAllTypes();
+
+    Context& c = Context::GetContext(kBudgetContextId);
+    //too small for more than one agent to be ticked for sure
+    c.SetFrameBudget(1);
+    CHECK_EQUAL(1u, c.GetFrameBudget());
+
+    const int kAgentCount = 4;
+    const int kFrameCount = 20;
+    PreconEffectorAgent* agents[kAgentCount];
+
+    for (int i = 0; i < kAgentCount; ++i)
+    {
+        agents[i] = Agent::Create<PreconEffectorAgent>(0, kBudgetContextId, 0);
+    }
+
+    uint32_t lastTotal = 0;
+
+    for (int f = 0; f < kFrameCount; ++f)
+    {
+        Context::execAgents(kBudgetContextId);
+
+        uint32_t total = 0;
+
+        for (int i = 0; i < kAgentCount; ++i)
+        {
+            total += agents[i]->GetTickStats().tickCount;
+        }
+
+        //at least one agent is ticked every frame
+        CHECK(total > lastTotal);
+        lastTotal = total;
+    }
+
+    for (int i = 0; i < kAgentCount; ++i)
+    {
+        const Agent::TickStats_t& stats = agents[i]->GetTickStats();
+
+        //every frame an agent is either ticked or carried over to the next one
+        CHECK_EQUAL((uint32_t)kFrameCount, stats.tickCount + stats.deferredCount);
+        CHECK(stats.tickCount > 0);
+        CHECK(stats.maxCost >= stats.lastCost);
+    }
+
+    //the carried over agents are ticked as usual without a budget
+    c.SetFrameBudget(0);
+    CHECK_EQUAL(0u, c.GetDeferredAgentCount());
+
+    for (int i = 0; i < kAgentCount; ++i)
+    {
+        Agent::Destroy(agents[i]);
+    }
+
+    Context::Cleanup(kBudgetContextId);
+    unregisterAllTypes();
+}
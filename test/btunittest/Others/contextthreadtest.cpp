@@ -0,0 +1,379 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Tencent is pleased to support the open source community by making behaviac available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except in compliance with
+// the License. You may obtain a copy of the License at http://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and limitations under the License.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "behaviac/common/base.h"
+#include "behaviac/agent/context.h"
+#include "behaviac/common/thread/thread.h"
+#include "behaviac/common/randomgenerator/randomgenerator.h"
+#include "behaviac/common/profiler/profiler.h"
+#include "behaviac/behaviortree/nodes/actions/action.h"
+#include "test.h"
+#include "../behaviortest.h"
+#include "../btloadtestsuite.h"
+
+using namespace behaviac;
+
+static const int kThreadContextCount = 2;
+static const int kThreadFrameCount = 200;
+
+static unsigned int BEHAVIAC_STDCALL ExecContextThread(void* arg)
+{
+    int contextId = *(int*)arg;
+
+    for (int i = 0; i < kThreadFrameCount; ++i)
+    {
+        Context::execAgents(contextId);
+    }
+
+    return 0;
+}
+
+TEST(btunittest, context_parallel_exec)
+{
+    behaviac::Profiler::CreateInstance();
+    behaviac::Config::SetSocketing(false);
+    behaviac::Config::SetLogging(false);
+
+    registerAllTypes();
+
+    const char* treePath = "node_test/PreconditionEffectorTest/PreconditionEffectorTest_0";
+    const int kAgentCount = 8;
+
+    int contextIds[kThreadContextCount] = { 6, 7 };
+    PreconEffectorAgent* agents[kThreadContextCount][kAgentCount];
+
+    //the trees are loaded before the threads start
+    for (int c = 0; c < kThreadContextCount; ++c)
+    {
+        //a budget which is never reached, only to collect the tick stats
+        Context::GetContext(contextIds[c]).SetFrameBudget(1000000000);
+
+        for (int i = 0; i < kAgentCount; ++i)
+        {
+            PreconEffectorAgent* pAgent = Agent::Create<PreconEffectorAgent>(0, contextIds[c], 0);
+            pAgent->btload(treePath);
+            pAgent->btsetcurrent(treePath);
+            pAgent->resetProperties();
+
+            agents[c][i] = pAgent;
+        }
+    }
+
+    CHECK(Context::GetContext(contextIds[0]).GetRandomGenerator() != Context::GetContext(contextIds[1]).GetRandomGenerator());
+
+    thread::ThreadHandle threads[kThreadContextCount];
+
+    for (int c = 0; c < kThreadContextCount; ++c)
+    {
+        threads[c] = thread::CreateAndStartThread(&ExecContextThread, &contextIds[c], 64 * 1024);
+    }
+
+    for (int c = 0; c < kThreadContextCount; ++c)
+    {
+        while (!thread::IsThreadTerminated(threads[c]))
+        {
+            thread::Sleep(1);
+        }
+
+        thread::StopThread(threads[c]);
+    }
+
+    for (int c = 0; c < kThreadContextCount; ++c)
+    {
+        for (int i = 0; i < kAgentCount; ++i)
+        {
+            CHECK_EQUAL((uint32_t)kThreadFrameCount, agents[c][i]->GetTickStats().tickCount);
+
+            Agent::Destroy(agents[c][i]);
+        }
+
+        Context::Cleanup(contextIds[c]);
+    }
+
+    unregisterAllTypes();
+    behaviac::Profiler::DestroyInstance();
+}
+
+//starts an async work, the agent is parked in its tick
+class ParkingAction : public behaviac::Action
+{
+public:
+    ParkingAction() : m_token(0)
+    {
+    }
+
+    //published to the thread completing the work
+    Atomic32	m_token;
+
+protected:
+    virtual bool IsValid(behaviac::Agent* pAgent, behaviac::BehaviorTask* pTask) const
+    {
+        BEHAVIAC_UNUSED_VAR(pAgent);
+        BEHAVIAC_UNUSED_VAR(pTask);
+
+        return true;
+    }
+
+    virtual behaviac::EBTStatus update_impl(behaviac::Agent* pAgent, behaviac::EBTStatus childStatus)
+    {
+        BEHAVIAC_UNUSED_VAR(childStatus);
+
+        Store_Release(this->m_token, (Atomic32)pAgent->BeginAsync());
+
+        return behaviac::BT_RUNNING;
+    }
+};
+
+//parks itself at its 'kParkFrame'th tick instead of running its tree
+class ParkingAgent : public AgentNodeTest
+{
+public:
+    BEHAVIAC_DECLARE_AGENTTYPE(ParkingAgent, AgentNodeTest);
+
+    enum { kParkFrame = 10 };
+
+    ParkingAgent() : m_ticks(0)
+    {
+        this->m_pTask = this->m_action.CreateAndInitTask();
+    }
+
+    virtual ~ParkingAgent()
+    {
+        behaviac::BehaviorTask::DestroyTask(this->m_pTask);
+    }
+
+    virtual EBTStatus btexec()
+    {
+        if (++this->m_ticks == kParkFrame)
+        {
+            return this->m_pTask->exec(this);
+        }
+
+        return BT_SUCCESS;
+    }
+
+    ParkingAction			m_action;
+    behaviac::BehaviorTask*	m_pTask;
+    int						m_ticks;
+};
+
+TEST(btunittest, context_parallel_exec_park)
+{
+    behaviac::Config::SetSocketing(false);
+    behaviac::Config::SetLogging(false);
+
+    registerAllTypes();
+
+    int contextIds[kThreadContextCount] = { 6, 7 };
+    ParkingAgent* agents[kThreadContextCount];
+
+    for (int c = 0; c < kThreadContextCount; ++c)
+    {
+        agents[c] = Agent::Create<ParkingAgent>(0, contextIds[c], 0);
+    }
+
+    const uint32_t parkedCount = Context::GetParkedAgentCount();
+
+    //the agents are removed from their contexts by the threads ticking them
+    thread::ThreadHandle threads[kThreadContextCount];
+
+    for (int c = 0; c < kThreadContextCount; ++c)
+    {
+        threads[c] = thread::CreateAndStartThread(&ExecContextThread, &contextIds[c], 64 * 1024);
+    }
+
+    for (int c = 0; c < kThreadContextCount; ++c)
+    {
+        while (!thread::IsThreadTerminated(threads[c]))
+        {
+            thread::Sleep(1);
+        }
+
+        thread::StopThread(threads[c]);
+    }
+
+    CHECK_EQUAL(parkedCount + kThreadContextCount, Context::GetParkedAgentCount());
+
+    for (int c = 0; c < kThreadContextCount; ++c)
+    {
+        CHECK_EQUAL((int)ParkingAgent::kParkFrame, agents[c]->m_ticks);
+        CHECK(agents[c]->IsParked());
+
+        Agent::Destroy(agents[c]);
+        Context::Cleanup(contextIds[c]);
+    }
+
+    CHECK_EQUAL(parkedCount, Context::GetParkedAgentCount());
+
+    unregisterAllTypes();
+}
+
+struct ResumeThreadArg_t
+{
+    int				contextId;
+    ParkingAgent*	agent;
+    Atomic32		done;
+};
+
+//ticks the context until its agent is resumed and ticked again
+static unsigned int BEHAVIAC_STDCALL ExecContextUntilResumed(void* arg)
+{
+    ResumeThreadArg_t* pArg = (ResumeThreadArg_t*)arg;
+
+    for (int i = 0; i < 1000000 && pArg->agent->m_ticks <= ParkingAgent::kParkFrame; ++i)
+    {
+        Context::execAgents(pArg->contextId);
+    }
+
+    Store_Release(pArg->done, (Atomic32)1);
+
+    return 0;
+}
+
+TEST(btunittest, context_parallel_exec_resume)
+{
+    behaviac::Config::SetSocketing(false);
+    behaviac::Config::SetLogging(false);
+
+    registerAllTypes();
+
+    int contextIds[kThreadContextCount] = { 6, 7 };
+    ResumeThreadArg_t args[kThreadContextCount];
+
+    for (int c = 0; c < kThreadContextCount; ++c)
+    {
+        args[c].contextId = contextIds[c];
+        args[c].agent = Agent::Create<ParkingAgent>(0, contextIds[c], 0);
+        args[c].done = 0;
+    }
+
+    const uint32_t parkedCount = Context::GetParkedAgentCount();
+
+    thread::ThreadHandle threads[kThreadContextCount];
+
+    for (int c = 0; c < kThreadContextCount; ++c)
+    {
+        threads[c] = thread::CreateAndStartThread(&ExecContextUntilResumed, &args[c], 64 * 1024);
+    }
+
+    //the works are completed and the agents resumed by this thread while the contexts are ticked
+    bool completed[kThreadContextCount] = { false, false };
+
+    for (int c = 0; c < kThreadContextCount; ++c)
+    {
+        while (Load_Acquire(args[c].done) == 0)
+        {
+            for (int k = 0; k < kThreadContextCount; ++k)
+            {
+                uint32_t token = (uint32_t)Load_Acquire(args[k].agent->m_action.m_token);
+
+                if (token != 0 && !completed[k])
+                {
+                    Context::CompleteAsync(token, BT_SUCCESS);
+                    completed[k] = true;
+                }
+            }
+
+            Context::ResumeCompletedAgents();
+        }
+
+        thread::StopThread(threads[c]);
+    }
+    CHECK_EQUAL(parkedCount, Context::GetParkedAgentCount());
+
+    for (int c = 0; c < kThreadContextCount; ++c)
+    {
+        CHECK(completed[c]);
+        CHECK(args[c].agent->m_ticks > ParkingAgent::kParkFrame);
+        CHECK(!args[c].agent->IsParked());
+
+        Agent::Destroy(args[c].agent);
+        Context::Cleanup(contextIds[c]);
+    }
+
+    unregisterAllTypes();
+}
+
+class HalfRandomGenerator : public RandomGenerator
+{
+public:
+    HalfRandomGenerator() : RandomGenerator(0, false)
+    {}
+
+private:
+    virtual double random()
+    {
+        return 0.5;
+    }
+};
+
+TEST(btunittest, context_random_generator)
+{
+    const int kRandomContextId = 7;
+    RandomGenerator* pInstance = RandomGenerator::GetInstance();
+    unsigned int seed = pInstance->getSeed();
+
+    //the generator of a context follows the seed of the instance when the context is created
+    double values[2][3];
+
+    for (int run = 0; run < 2; ++run)
+    {
+        pInstance->setSeed(123);
+        RandomGenerator* pRandomGenerator = Context::GetContext(kRandomContextId).GetRandomGenerator();
+
+        for (int i = 0; i < 3; ++i)
+        {
+            values[run][i] = (*pRandomGenerator)();
+        }
+
+        Context::Cleanup(kRandomContextId);
+    }
+
+    for (int i = 0; i < 3; ++i)
+    {
+        CHECK(values[0][i] == values[1][i]);
+    }
+
+    pInstance->setSeed(456);
+    CHECK((*Context::GetContext(kRandomContextId).GetRandomGenerator())() != values[0][0]);
+
+    //an installed generator is used until it is removed
+    HalfRandomGenerator halfRandomGenerator;
+    Context& context = Context::GetContext(kRandomContextId);
+    RandomGenerator* pOwn = context.GetRandomGenerator();
+
+    context.SetRandomGenerator(&halfRandomGenerator);
+    CHECK(context.GetRandomGenerator() == &halfRandomGenerator);
+    CHECK((*context.GetRandomGenerator())() == 0.5);
+
+    context.SetRandomGenerator(0);
+    CHECK(context.GetRandomGenerator() == pOwn);
+
+    //the context of an agent is cached until the contexts are cleaned up
+    registerAllTypes();
+
+    PreconEffectorAgent* pAgent = Agent::Create<PreconEffectorAgent>(0, kRandomContextId, 0);
+    CHECK(&pAgent->GetContext() == &context);
+    Agent::Destroy(pAgent);
+
+    Context::Cleanup(kRandomContextId);
+
+    pAgent = Agent::Create<PreconEffectorAgent>(0, kRandomContextId, 0);
+    CHECK(&pAgent->GetContext() == &Context::GetContext(kRandomContextId));
+    Agent::Destroy(pAgent);
+
+    Context::Cleanup(kRandomContextId);
+    unregisterAllTypes();
+
+    pInstance->setSeed(seed);
+}
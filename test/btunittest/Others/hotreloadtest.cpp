@@ -0,0 +1,188 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Tencent is pleased to support the open source community by making behaviac available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except in compliance with
+// the License. You may obtain a copy of the License at http://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and limitations under the License.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "behaviac/common/base.h"
+#include "behaviac/common/file/filesystem.h"
+#include "behaviac/common/thread/thread.h"
+#include "test.h"
+#include "../behaviortest.h"
+#include "../btloadtestsuite.h"
+
+#if BEHAVIAC_CCDEFINE_GCC_LINUX
+#include <stdlib.h>
+#include <unistd.h>
+#endif
+
+using namespace behaviac;
+
+extern PreconEffectorAgent* initTestEnvPreEff(const char* treePath, behaviac::Workspace::EFileFormat format);
+extern void finlTestEnvPreEff(PreconEffectorAgent* testAgent);
+
+#if BEHAVIAC_ENABLE_HOTRELOAD
+static behaviac::string ReadTextFile(const char* path)
+{
+    behaviac::string content;
+    FILE* fp = fopen(path, "rb");
+
+    if (fp)
+    {
+        char buffer[4096];
+        size_t size = 0;
+
+        while ((size = fread(buffer, 1, sizeof(buffer), fp)) > 0)
+        {
+            content.append(buffer, size);
+        }
+
+        fclose(fp);
+    }
+
+    return content;
+}
+
+static void WriteTextFile(const char* path, const behaviac::string& content)
+{
+    FILE* fp = fopen(path, "wb");
+    CHECK(fp != 0);
+
+    fwrite(content.c_str(), 1, content.size(), fp);
+    fclose(fp);
+}
+
+static void ReplaceFirst(behaviac::string& content, const char* from, const char* to)
+{
+    size_t pos = content.find(from);
+    CHECK(pos != behaviac::string::npos);
+
+    content.replace(pos, strlen(from), to);
+}
+
+static const char* kHotReloadTree = "node_test/PreconditionEffectorTest/PreconditionEffectorTest_3_hotreload";
+
+TEST(btunittest, hotreload_patch_changed_tree)
+{
+    behaviac::Workspace::EFileFormat format = behaviac::Workspace::GetInstance()->GetFileFormat();
+    behaviac::Workspace::GetInstance()->SetFileFormat(behaviac::Workspace::EFF_xml);
+
+    const char* exportPath = behaviac::Workspace::GetInstance()->GetFilePath();
+    behaviac::string sourcePath = behaviac::string(exportPath) + "node_test/PreconditionEffectorTest/PreconditionEffectorTest_3.xml";
+    behaviac::string path = behaviac::string(exportPath) + kHotReloadTree + ".xml";
+
+    behaviac::string content = ReadTextFile(sourcePath.c_str());
+    ReplaceFirst(content, "\"node_test/PreconditionEffectorTest/PreconditionEffectorTest_3\"", (behaviac::string("\"") + kHotReloadTree + "\"").c_str());
+    WriteTextFile(path.c_str(), content);
+
+    //the directory is monitored from the load on
+    behaviac::Config::SetHotReload(true);
+
+    PreconEffectorAgent* testAgent = initTestEnvPreEff(kHotReloadTree, behaviac::Workspace::EFF_xml);
+    testAgent->resetProperties();
+
+    //the second branch is running
+    testAgent->SetVariable("count_both", 1);
+    testAgent->btexec();
+
+    BehaviorTreeTask* pTask = testAgent->btgetcurrent();
+    const BehaviorTask* pRoot = pTask;
+    const BehaviorTask* pRunning = pRoot->GetTaskById(10);
+    CHECK(pRunning != 0);
+    CHECK_EQUAL(BT_RUNNING, pRunning->GetStatus());
+
+    const BehaviorTree* pOld = behaviac::Workspace::GetInstance()->GetBehaviorTrees().find(kHotReloadTree)->second;
+    BehaviorTree::TaskRefs_t* pOldRefs = BehaviorTree::AcquireTaskRefs(pOld->GetTaskRefs());
+
+    //the first action of the first branch, which is not running, fails from now on
+    ReplaceFirst(content, "<property ResultOption=\"BT_SUCCESS\" />", "<property ResultOption=\"BT_FAILURE\" />");
+
+    const BehaviorTree* pNew = pOld;
+
+    //the file is written again until the watcher, which starts asynchronously, reports it
+    for (int i = 0; i < 50 && pNew == pOld; ++i)
+    {
+        WriteTextFile(path.c_str(), content);
+
+        for (int j = 0; j < 20 && pNew == pOld; ++j)
+        {
+            behaviac::thread::Sleep(10);
+            behaviac::Workspace::GetInstance()->DebugUpdate();
+
+            pNew = behaviac::Workspace::GetInstance()->GetBehaviorTrees().find(kHotReloadTree)->second;
+        }
+    }
+
+    CHECK(pNew != pOld);
+
+    //patched in place, the running task is kept and the task doesn't use the retired tree
+    CHECK(testAgent->btgetcurrent() == pTask);
+    CHECK(pTask->GetNode() == pNew);
+    CHECK(pRoot->GetTaskById(10) == pRunning);
+    CHECK_EQUAL(BT_RUNNING, pRunning->GetStatus());
+    CHECK_EQUAL(2, (int)pOldRefs->refs);
+
+    //it is freed at the next frame boundary
+    BehaviorTree::ReleaseTaskRefs(pOldRefs);
+    behaviac::Workspace::GetInstance()->DebugUpdate();
+
+    //the first branch is reentered with the changed action
+    testAgent->SetVariable("count_both", 0);
+    testAgent->btexec();
+    CHECK_EQUAL(0, testAgent->count_success);
+    CHECK_EQUAL(2, testAgent->count_failure);
+    CHECK_EQUAL(3, testAgent->ret);
+
+    finlTestEnvPreEff(testAgent);
+
+    behaviac::Config::SetHotReload(false);
+    remove(path.c_str());
+
+    behaviac::Workspace::GetInstance()->SetFileFormat(format);
+}
+
+#if BEHAVIAC_CCDEFINE_GCC_LINUX
+TEST(btunittest, hotreload_prefetch_modified_file)
+{
+    char dir[] = "/tmp/behaviac_hotreloadXXXXXX";
+    CHECK(mkdtemp(dir) != 0);
+
+    behaviac::string dirPath = behaviac::string(dir) + "/";
+    behaviac::string path = dirPath + "prefetched.xml";
+
+    behaviac::wstring dirW = behaviac::StringUtils::Char2Wide(dirPath);
+    CHECK(CFileSystem::StartMonitoringDirectory(dirW.c_str()));
+
+    const behaviac::string content = "<behavior name=\"prefetched\"/>";
+    behaviac::vector<CFileSystem::SModifiedFile> modifiedFiles;
+
+    //the file is read by the watcher once the burst of events is over
+    for (int i = 0; i < 50 && modifiedFiles.empty(); ++i)
+    {
+        WriteTextFile(path.c_str(), content);
+
+        for (int j = 0; j < 20 && modifiedFiles.empty(); ++j)
+        {
+            behaviac::thread::Sleep(10);
+            CFileSystem::GetModifiedFiles(modifiedFiles);
+        }
+    }
+
+    CFileSystem::StopMonitoringDirectory();
+
+    CHECK_EQUAL(1u, modifiedFiles.size());
+    CHECK(modifiedFiles[0].path == "prefetched.xml");
+    CHECK(modifiedFiles[0].content == content);
+
+    remove(path.c_str());
+    rmdir(dir);
+}
+#endif//BEHAVIAC_CCDEFINE_GCC_LINUX
+#endif//BEHAVIAC_ENABLE_HOTRELOAD
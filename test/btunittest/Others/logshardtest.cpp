@@ -0,0 +1,155 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Tencent is pleased to support the open source community by making behaviac available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except in compliance with
+// the License. You may obtain a copy of the License at http://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and limitations under the License.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "behaviac/common/logger/logmanager.h"
+#include "test.h"
+#include "../behaviortest.h"
+#include "../btloadtestsuite.h"
+
+#include <stdio.h>
+
+static const char* kShardLogPath = "_behaviac_shards_.log";
+
+TEST(btunittest, log_shards)
+{
+    const int kShardCount = 2;
+    const int kAgentCount = 3;
+    const int kRecordCount = 20;
+    const uint32_t kSegmentSize = 256;
+
+    behaviac::Config::SetSocketing(false);
+    registerAllTypes();
+
+    behaviac::LogManager* pLogManager = behaviac::LogManager::GetInstance();
+    behaviac::Config::SetLogging(true);
+    pLogManager->SetLogFilePath(kShardLogPath);
+    pLogManager->SetLogShards(kShardCount, kSegmentSize);
+
+    //logged whatever the id mask is left by the other tests
+    const uint32_t idMask = behaviac::Agent::IdMask();
+    behaviac::Agent::SetIdMask(0xffffffff);
+
+    AgentNodeTest* agents[kAgentCount];
+
+    for (int a = 0; a < kAgentCount; ++a)
+    {
+        agents[a] = behaviac::Agent::Create<AgentNodeTest>();
+        agents[a]->SetIdFlag(0xffffffff);
+    }
+
+    for (int i = 0; i < kRecordCount; ++i)
+    {
+        for (int a = 0; a < kAgentCount; ++a)
+        {
+            char value[16];
+            string_sprintf(value, "%d", i);
+            pLogManager->Log(agents[a], "int", "testVar", value);
+        }
+    }
+
+    pLogManager->Log("[log]not logged by an agent\n");
+    pLogManager->Flush(0);
+
+    int agentRecords[kAgentCount] = { 0 };
+    int otherRecords = 0;
+
+    for (int shard = 0; shard < kShardCount; ++shard)
+    {
+        int segment = 0;
+
+        for (;; ++segment)
+        {
+            char fileName[256];
+            string_sprintf(fileName, "%s.%d.%03d", kShardLogPath, shard, segment);
+
+            FILE* fp = fopen(fileName, "rb");
+
+            if (fp == NULL)
+            {
+                break;
+            }
+
+            behaviac::LogSegmentHeader header;
+            CHECK_EQUAL(1u, (uint32_t)fread(&header, sizeof(header), 1, fp));
+            CHECK_EQUAL((uint32_t)behaviac::LogSegmentHeader::kMagic, header.magic);
+            CHECK_EQUAL((uint32_t)shard, header.shard);
+            CHECK_EQUAL((uint32_t)segment, header.segment);
+
+            uint32_t segmentSize = sizeof(header);
+            behaviac::LogRecordHeader record;
+
+            while (fread(&record, sizeof(record), 1, fp) == 1)
+            {
+                char text[1024];
+                CHECK(record.size < sizeof(text));
+                CHECK_EQUAL(record.size, (uint32_t)fread(text, 1, record.size, fp));
+                text[record.size] = '\0';
+                segmentSize += sizeof(record) + record.size;
+
+                //an agent is always in the same shard
+                CHECK_EQUAL((uint32_t)shard, (uint32_t)record.agentId % kShardCount);
+
+                if (record.agentId == -1)
+                {
+                    otherRecords++;
+                    continue;
+                }
+
+                int a = 0;
+
+                while (a < kAgentCount && agents[a]->GetId() != record.agentId)
+                {
+                    ++a;
+                }
+
+                CHECK(a < kAgentCount);
+
+                //the records of an agent are in the order they are logged
+                const char* value = strstr(text, "->");
+                CHECK(value != NULL);
+                CHECK_EQUAL(agentRecords[a], atoi(value + 2));
+                agentRecords[a]++;
+            }
+
+            fclose(fp);
+            remove(fileName);
+
+            CHECK(segmentSize <= kSegmentSize);
+        }
+
+        //the segments of the shards logged into by the agents are rotated
+        bool bLogged = false;
+
+        for (int a = 0; a < kAgentCount; ++a)
+        {
+            bLogged = bLogged || ((uint32_t)agents[a]->GetId() % kShardCount) == (uint32_t)shard;
+        }
+
+        CHECK(!bLogged || segment > 1);
+    }
+
+    for (int a = 0; a < kAgentCount; ++a)
+    {
+        CHECK_EQUAL(kRecordCount, agentRecords[a]);
+        behaviac::Agent::Destroy(agents[a]);
+    }
+
+    CHECK_EQUAL(1, otherRecords);
+
+    pLogManager->SetLogShards(0, 0);
+    pLogManager->SetLogFilePath(0);
+    behaviac::Config::SetLogging(false);
+    behaviac::Agent::SetIdMask(idMask);
+
+    unregisterAllTypes();
+}
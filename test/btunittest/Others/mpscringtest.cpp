@@ -0,0 +1,180 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Tencent is pleased to support the open source community by making behaviac available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except in compliance with
+// the License. You may obtain a copy of the License at http://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and limitations under the License.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "behaviac/common/base.h"
+#include "behaviac/common/container/mpscring.h"
+#include "behaviac/common/thread/thread.h"
+#include "test.h"
+
+using namespace behaviac;
+
+typedef MPSCRing<1024> TestRing;
+
+TEST(btunittest, mpscring_read_release)
+{
+    TestRing* pRing = BEHAVIAC_NEW TestRing;
+
+    CHECK(pRing->IsEmpty());
+    CHECK(pRing->Reserve(1024, 0) == 0);
+
+    //the records are read in the order they are reserved in, not the order they are committed in
+    uint8_t* pFirst = pRing->Reserve(3, 1);
+    uint8_t* pSecond = pRing->Reserve(5, 2);
+    memcpy(pFirst, "abc", 3);
+    memcpy(pSecond, "defgh", 5);
+    pRing->Commit(pSecond);
+
+    uint32_t readIndex = pRing->GetReadIndex();
+    CHECK(pRing->Read(readIndex) == 0);
+
+    pRing->Commit(pFirst);
+
+    TestRing::Record* pRecord = pRing->Read(readIndex);
+    CHECK(pRecord != 0);
+    CHECK_EQUAL(3u, pRecord->dataSize);
+    CHECK_EQUAL(1u, pRecord->tag);
+    CHECK(memcmp(pRecord->GetData(), "abc", 3) == 0);
+
+    pRecord = pRing->Read(readIndex);
+    CHECK(pRecord != 0);
+    CHECK_EQUAL(2u, pRecord->tag);
+    CHECK(pRing->Read(readIndex) == 0);
+
+    pRing->Release(readIndex);
+    CHECK(pRing->IsEmpty());
+
+    //the records don't wrap around the end of the ring, the rest of it is skipped
+    const uint32_t kDataSize = 200;
+    int written = 0;
+    int read = 0;
+
+    for (int i = 0; i < 20; ++i)
+    {
+        uint8_t* pData = pRing->Reserve(kDataSize, i);
+
+        while (pData == 0)
+        {
+            readIndex = pRing->GetReadIndex();
+
+            while ((pRecord = pRing->Read(readIndex)) != 0)
+            {
+                CHECK_EQUAL((uint32_t)read, pRecord->tag);
+                CHECK_EQUAL((uint8_t)read, pRecord->GetData()[kDataSize - 1]);
+                read++;
+            }
+
+            pRing->Release(readIndex);
+            pData = pRing->Reserve(kDataSize, i);
+        }
+
+        memset(pData, i, kDataSize);
+        pRing->Commit(pData);
+        written++;
+    }
+
+    pRing->Drop();
+    CHECK(pRing->IsEmpty());
+    CHECK(read > 0 && read < written);
+
+    BEHAVIAC_DELETE(pRing);
+}
+
+static const int kWriterCount = 4;
+static const int kWriterRecords = 2000;
+
+struct WriterArg
+{
+    TestRing*	pRing;
+    uint32_t	writer;
+};
+
+static unsigned int BEHAVIAC_STDCALL RingWriterThread(void* arg)
+{
+    WriterArg* pArg = (WriterArg*)arg;
+
+    for (uint32_t i = 0; i < kWriterRecords; ++i)
+    {
+        const uint32_t dataSize = sizeof(uint32_t) + (i % 37);
+        uint8_t* pData = pArg->pRing->Reserve(dataSize, pArg->writer);
+
+        while (pData == 0)
+        {
+            thread::Sleep(0);
+            pData = pArg->pRing->Reserve(dataSize, pArg->writer);
+        }
+
+        memcpy(pData, &i, sizeof(i));
+        pArg->pRing->Commit(pData);
+    }
+
+    return 0;
+}
+
+TEST(btunittest, mpscring_writers)
+{
+    TestRing* pRing = BEHAVIAC_NEW TestRing;
+
+    WriterArg args[kWriterCount];
+    thread::ThreadHandle threads[kWriterCount];
+
+    for (int w = 0; w < kWriterCount; ++w)
+    {
+        args[w].pRing = pRing;
+        args[w].writer = w;
+        threads[w] = thread::CreateAndStartThread(&RingWriterThread, &args[w], 64 * 1024);
+    }
+
+    //each writer's records are read in the order it writes them, none is lost
+    uint32_t nextRecord[kWriterCount] = { 0 };
+    uint32_t nextIndex = pRing->GetReadIndex();
+    int total = 0;
+    bool bOrdered = true;
+
+    while (total < kWriterCount * kWriterRecords)
+    {
+        uint32_t readIndex = pRing->GetReadIndex();
+        TestRing::Record* pRecord = 0;
+
+        while ((pRecord = pRing->Read(readIndex)) != 0)
+        {
+            uint32_t record = 0;
+            memcpy(&record, pRecord->GetData(), sizeof(record));
+
+            bOrdered = bOrdered && pRecord->tag < (uint32_t)kWriterCount && record == nextRecord[pRecord->tag] &&
+                       pRecord->dataSize == sizeof(uint32_t) + (record % 37) && pRecord->index - nextIndex < 1024;
+
+            nextRecord[pRecord->tag % kWriterCount]++;
+            nextIndex = pRecord->index;
+            total++;
+        }
+
+        pRing->Release(readIndex);
+    }
+
+    CHECK(bOrdered);
+    CHECK(pRing->IsEmpty());
+
+    for (int w = 0; w < kWriterCount; ++w)
+    {
+        CHECK_EQUAL((uint32_t)kWriterRecords, nextRecord[w]);
+
+        while (!thread::IsThreadTerminated(threads[w]))
+        {
+            thread::Sleep(1);
+        }
+
+        thread::StopThread(threads[w]);
+    }
+
+    BEHAVIAC_DELETE(pRing);
+}
@@ -0,0 +1,145 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Tencent is pleased to support the open source community by making behaviac available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except in compliance with
+// the License. You may obtain a copy of the License at http://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and limitations under the License.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "../btloadtestsuite.h"
+#include "behaviac/behaviortree/generator.h"
+#include "behaviac/htn/plannertask.h"
+
+//walks 'steps' steps, one step a tick
+class WalkAction : public behaviac::Action
+{
+public:
+    WalkAction(int steps) : m_steps(steps), m_walked(0)
+    {
+    }
+
+    int		m_steps;
+    int		m_walked;
+
+protected:
+    //not loaded, it has no agent type to check
+    virtual bool IsValid(behaviac::Agent* pAgent, behaviac::BehaviorTask* pTask) const
+    {
+        BEHAVIAC_UNUSED_VAR(pAgent);
+        BEHAVIAC_UNUSED_VAR(pTask);
+
+        return true;
+    }
+
+    virtual behaviac::EBTStatus update_impl(behaviac::Agent* pAgent, behaviac::EBTStatus childStatus)
+    {
+        BEHAVIAC_UNUSED_VAR(childStatus);
+
+        $resumable_state(pAgent);
+
+        int& i = _rs.ints[0];
+        float& distance = _rs.floats[0];
+
+        $resumable_begin
+
+        for (i = 0; i < this->m_steps; ++i)
+        {
+            this->m_walked++;
+            distance += 0.5f;
+
+            $suspend;
+        }
+
+        $resumable_end(distance > 0.0f ? behaviac::BT_SUCCESS : behaviac::BT_FAILURE);
+    }
+};
+
+TEST(btunittest, resumable_action)
+{
+    behaviac::Config::SetSocketing(false);
+    registerAllTypes();
+
+    //the agents can be created once behaviac is started by the first load
+    behaviac::Workspace::GetInstance()->Load("node_test/action_ut_0");
+    AgentNodeTest* pAgent = behaviac::Agent::Create<AgentNodeTest>();
+
+    CHECK(pAgent->GetResumeState() == NULL);
+
+    WalkAction walk(3);
+    behaviac::BehaviorTask* pTask = walk.CreateAndInitTask();
+
+    //it continues from where it suspended, not from the beginning
+    CHECK_EQUAL(behaviac::BT_RUNNING, pTask->exec(pAgent));
+    CHECK_EQUAL(behaviac::BT_RUNNING, pTask->exec(pAgent));
+    CHECK_EQUAL(2, walk.m_walked);
+    CHECK(pAgent->GetResumeState() == NULL);
+
+    //the continuation is copied with the task
+    behaviac::BehaviorTask* pCopy = walk.CreateAndInitTask();
+    pTask->copyto(pCopy);
+
+    CHECK_EQUAL(behaviac::BT_RUNNING, pCopy->exec(pAgent));
+    CHECK_EQUAL(behaviac::BT_SUCCESS, pCopy->exec(pAgent));
+    CHECK_EQUAL(3, walk.m_walked);
+
+    //and is kept in the snapshot
+    uint8_t buffer[256];
+    behaviac::SnapshotWriter writer(buffer, sizeof(buffer));
+    pTask->saveSnapshot(writer);
+    CHECK(writer.GetSize() <= sizeof(buffer));
+
+    behaviac::BehaviorTask::DestroyTask(pCopy);
+    pCopy = walk.CreateAndInitTask();
+
+    behaviac::SnapshotReader reader(buffer, writer.GetSize());
+    CHECK(pCopy->loadSnapshot(pAgent, reader));
+
+    CHECK_EQUAL(behaviac::BT_RUNNING, pCopy->exec(pAgent));
+    CHECK_EQUAL(behaviac::BT_SUCCESS, pCopy->exec(pAgent));
+    CHECK_EQUAL(4, walk.m_walked);
+
+    //it starts from the beginning once it has ended
+    walk.m_walked = 0;
+    CHECK_EQUAL(behaviac::BT_RUNNING, pCopy->exec(pAgent));
+    CHECK_EQUAL(behaviac::BT_RUNNING, pCopy->exec(pAgent));
+    CHECK_EQUAL(behaviac::BT_RUNNING, pCopy->exec(pAgent));
+    CHECK_EQUAL(behaviac::BT_SUCCESS, pCopy->exec(pAgent));
+    CHECK_EQUAL(3, walk.m_walked);
+
+    behaviac::BehaviorTask::DestroyTask(pCopy);
+    behaviac::BehaviorTask::DestroyTask(pTask);
+
+    behaviac::Agent::Destroy(pAgent);
+    unregisterAllTypes();
+}
+
+#if BEHAVIAC_USE_HTN
+TEST(btunittest, resumable_action_planner)
+{
+    behaviac::Config::SetSocketing(false);
+    registerAllTypes();
+
+    behaviac::Workspace::GetInstance()->Load("node_test/action_ut_0");
+    AgentNodeTest* pAgent = behaviac::Agent::Create<AgentNodeTest>();
+
+    //the action of a plan keeps its continuation as well
+    WalkAction walk(2);
+    behaviac::PlannerTask* pTask = behaviac::PlannerTask::Create(&walk, pAgent);
+
+    CHECK_EQUAL(behaviac::BT_RUNNING, pTask->exec(pAgent));
+    CHECK_EQUAL(behaviac::BT_RUNNING, pTask->exec(pAgent));
+    CHECK_EQUAL(behaviac::BT_SUCCESS, pTask->exec(pAgent));
+    CHECK_EQUAL(2, walk.m_walked);
+    CHECK(pAgent->GetResumeState() == NULL);
+
+    BEHAVIAC_DELETE(pTask);
+
+    behaviac::Agent::Destroy(pAgent);
+    unregisterAllTypes();
+}
+#endif//BEHAVIAC_USE_HTN
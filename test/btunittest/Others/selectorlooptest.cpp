@@ -19,6 +19,8 @@
 #include "behaviac/behaviortree/nodes/composites/withprecondition.h"
 #include "behaviac/behaviortree/nodes/decorators/decoratorlog.h"
 #include "behaviac/behaviortree/nodes/conditions/true.h"
+#include "behaviac/behaviortree/nodes/conditions/and.h"
+#include "behaviac/behaviortree/nodes/actions/action.h"
 
 using namespace behaviac;
 
@@ -51,3 +53,88 @@ using namespace behaviac;
 //    BEHAVIAC_DELETE(node);
 //
 //}
+
+#include "../btloadtestsuite.h"
+
+extern PreconEffectorAgent* initTestEnvPreEff(const char* treePath, behaviac::Workspace::EFileFormat format);
+extern void finlTestEnvPreEff(PreconEffectorAgent* testAgent);
+
+TEST(btunittest, selectorloop_reevaluate_on_change)
+{
+    //the inputs are inferred from the loaded conditions, not from the generated ones
+    behaviac::Workspace::EFileFormat format = behaviac::Workspace::GetInstance()->GetFileFormat();
+    behaviac::Workspace::GetInstance()->SetFileFormat(behaviac::Workspace::EFF_xml);
+
+    PreconEffectorAgent* testAgent = initTestEnvPreEff("node_test/PreconditionEffectorTest/PreconditionEffectorTest_3", behaviac::Workspace::EFF_xml);
+    testAgent->resetProperties();
+
+    //DecoratorLoop -> SelectorLoop
+    const BehaviorNode* pTree = testAgent->btgetcurrent()->GetNode();
+    SelectorLoop* pSelectorLoop = (SelectorLoop*)pTree->GetChild(0)->GetChild(0);
+    CHECK(SelectorLoop::DynamicCast(pSelectorLoop) != 0);
+
+    const WithPrecondition* pBranch0 = WithPrecondition::DynamicCast(pSelectorLoop->GetChild(0));
+    CHECK(pBranch0->IsInputKnown());
+
+    pSelectorLoop->SetReevaluateOnChange(true);
+
+    //count_both == 0 fails and is cached, count_both == 1 runs
+    testAgent->SetVariable("count_both", 1);
+    testAgent->btexec();
+    CHECK(testAgent->IsChangeTrackingEnabled());
+    CHECK_EQUAL(0, testAgent->count_success);
+    CHECK_EQUAL(0, testAgent->count_failure);
+    CHECK_EQUAL(0, testAgent->ret);
+
+    //set by behaviac, it is tracked
+    testAgent->SetVariable("count_both", 0);
+    testAgent->btexec();
+    CHECK_EQUAL(1, testAgent->count_success);
+    CHECK_EQUAL(1, testAgent->count_failure);
+    CHECK_EQUAL(2, testAgent->ret);
+
+    testAgent->SetVariable("count_both", 1);
+    testAgent->btexec();
+    CHECK_EQUAL(1, testAgent->count_success);
+    CHECK_EQUAL(2, testAgent->count_failure);
+    CHECK_EQUAL(3, testAgent->ret);
+
+    //set directly, it is not seen until it is notified
+    uint32_t countBothId = behaviac::MakeVariableId("count_both");
+    uint64_t stamp = testAgent->GetChangeStamp();
+    testAgent->count_both = 0;
+    CHECK(testAgent->GetVariableChangeStamp(countBothId) <= stamp);
+
+    testAgent->NotifyVariableChanged("count_both");
+    CHECK(testAgent->GetVariableChangeStamp(countBothId) > stamp);
+
+    testAgent->btexec();
+    CHECK_EQUAL(2, testAgent->count_success);
+    CHECK_EQUAL(3, testAgent->count_failure);
+    CHECK_EQUAL(5, testAgent->ret);
+
+    pSelectorLoop->SetReevaluateOnChange(false);
+
+    finlTestEnvPreEff(testAgent);
+
+    behaviac::Workspace::GetInstance()->SetFileFormat(format);
+}
+
+TEST(btunittest, selectorloop_infer_input_built_in_code)
+{
+    //like the generated trees, the precondition is added before its own children
+    WithPrecondition* pBranch = BEHAVIAC_NEW WithPrecondition();
+    And* pAnd = BEHAVIAC_NEW And();
+    pBranch->AddChild(pAnd);
+
+    behaviac::vector<uint32_t> inputIds;
+    CHECK(!pAnd->GetInputIds(inputIds));
+
+    pAnd->AddChild(BEHAVIAC_NEW True());
+    pAnd->AddChild(BEHAVIAC_NEW Action());
+
+    //an action can't be inferred, it is not taken as constants only
+    CHECK(!pBranch->IsInputKnown());
+
+    BEHAVIAC_DELETE(pBranch);
+}
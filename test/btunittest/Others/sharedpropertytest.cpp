@@ -0,0 +1,75 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Tencent is pleased to support the open source community by making behaviac available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except in compliance with
+// the License. You may obtain a copy of the License at http://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and limitations under the License.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "../btloadtestsuite.h"
+
+TEST(btunittest, shared_property)
+{
+    behaviac::Config::SetSocketing(false);
+    registerAllTypes();
+    behaviac::Workspace::GetInstance()->UnLoadAll();
+
+    //the trees exported as cpp have no operand to parse
+    behaviac::Workspace::EFileFormat format = behaviac::Workspace::GetInstance()->GetFileFormat();
+    behaviac::Workspace::GetInstance()->SetFileFormat(behaviac::Workspace::EFF_xml);
+
+    typedef behaviac::AgentMeta::SharedPropertyStats Stats_t;
+    Stats_t before = behaviac::AgentMeta::GetSharedPropertyStats();
+
+    //the nodes loaded share their operands, Opl of both the conditions is the same property
+    behaviac::Workspace::GetInstance()->Load("node_test/condition_ut_0");
+
+    Stats_t loaded = behaviac::AgentMeta::GetSharedPropertyStats();
+    CHECK(loaded.hits > before.hits);
+    CHECK(loaded.operands - before.operands < loaded.requests - before.requests);
+
+    //the same value is parsed once
+    behaviac::IInstanceMember* pConst = behaviac::AgentMeta::ParseSharedProperty("const int 3");
+    behaviac::IInstanceMember* pConst2 = behaviac::AgentMeta::ParseSharedProperty("const int 3");
+    behaviac::IInstanceMember* pOther = behaviac::AgentMeta::ParseSharedProperty("const int 4");
+    behaviac::IInstanceMember* pProperty = behaviac::AgentMeta::ParseSharedProperty("int Self.AgentNodeTest::testVar_0");
+
+    CHECK(pConst != NULL);
+    CHECK(pConst == pConst2);
+    CHECK(pConst != pOther);
+    CHECK(pProperty != NULL);
+
+    Stats_t parsed = behaviac::AgentMeta::GetSharedPropertyStats();
+    CHECK_EQUAL(4u, parsed.requests - loaded.requests);
+    CHECK_EQUAL(2u, parsed.hits - loaded.hits);
+    CHECK_EQUAL(2u, parsed.operands - loaded.operands);
+
+    //an operand is kept until the last one using it releases it
+    behaviac::AgentMeta::ReleaseSharedProperty(pConst);
+    CHECK_EQUAL(parsed.operands, behaviac::AgentMeta::GetSharedPropertyStats().operands);
+
+    behaviac::AgentMeta::ReleaseSharedProperty(pConst2);
+    behaviac::AgentMeta::ReleaseSharedProperty(pOther);
+    behaviac::AgentMeta::ReleaseSharedProperty(pProperty);
+    CHECK_EQUAL(loaded.operands, behaviac::AgentMeta::GetSharedPropertyStats().operands);
+
+    AgentNodeTest* testAgent = behaviac::Agent::Create<AgentNodeTest>();
+    testAgent->resetProperties();
+    testAgent->btsetcurrent("node_test/condition_ut_0");
+
+    CHECK_EQUAL(behaviac::BT_SUCCESS, testAgent->btexec());
+    CHECK_EQUAL(2, testAgent->testVar_0);
+
+    behaviac::Agent::Destroy(testAgent);
+
+    behaviac::Workspace::GetInstance()->UnLoadAll();
+    CHECK_EQUAL(before.operands, behaviac::AgentMeta::GetSharedPropertyStats().operands);
+
+    behaviac::Workspace::GetInstance()->SetFileFormat(format);
+    unregisterAllTypes();
+}
@@ -0,0 +1,111 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Tencent is pleased to support the open source community by making behaviac available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except in compliance with
+// the License. You may obtain a copy of the License at http://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and limitations under the License.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "behaviac/behaviac.h"
+#include "behaviac/common/memory/slaballocator.h"
+#include "behaviac/common/thread/thread.h"
+#include "test.h"
+
+TEST(btunittest, slaballocator)
+{
+    behaviac::MemSlabAllocator allocator;
+
+    const int kCount = 1000;
+    void* blocks[kCount];
+
+    for (int i = 0; i < kCount; ++i)
+    {
+        size_t size = 1 + (i * 7) % 700;
+        blocks[i] = allocator.Alloc(size, "test", __FILE__, __LINE__);
+        CHECK(blocks[i] != 0);
+        //as aligned as the system heap
+        CHECK(BEHAVIAC_ALIGNED(blocks[i], behaviac::MemSlabAllocator::kAlignment));
+        memset(blocks[i], i & 0xff, size);
+    }
+
+    for (int i = 0; i < kCount; ++i)
+    {
+        CHECK_EQUAL(i & 0xff, ((unsigned char*)blocks[i])[0]);
+        allocator.Free(blocks[i], "test", __FILE__, __LINE__);
+    }
+
+    behaviac::MemSlabAllocator::Stats stats;
+    allocator.GetStats(stats);
+    CHECK_EQUAL(0, stats.allocatedBytes);
+    CHECK_EQUAL(1u, stats.threadCacheCount);
+    CHECK_EQUAL(stats.largeAllocCount, stats.largeFreeCount);
+
+    //the content survives growing from a small block to a large one
+    char* p = (char*)allocator.Alloc(10, "test", __FILE__, __LINE__);
+    strcpy(p, "behaviac");
+    p = (char*)allocator.Realloc(p, 100, "test", __FILE__, __LINE__);
+    CHECK_EQUAL(0, strcmp(p, "behaviac"));
+    p = (char*)allocator.Realloc(p, 4000, "test", __FILE__, __LINE__);
+    CHECK_EQUAL(0, strcmp(p, "behaviac"));
+    allocator.Free(p, "test", __FILE__, __LINE__);
+
+    void* pAligned = allocator.AllocAligned(48, 64, "test", __FILE__, __LINE__);
+    CHECK(BEHAVIAC_ALIGNED(pAligned, 64));
+    allocator.FreeAligned(pAligned, 64, "test", __FILE__, __LINE__);
+
+    //blocks from the system heap are handed back to it
+    void* pSystem = malloc(32);
+    allocator.Free(pSystem, "test", __FILE__, __LINE__);
+
+    allocator.FlushThreadCache();
+    allocator.GetStats(stats);
+    CHECK_EQUAL(0, stats.allocatedBytes);
+}
+
+static unsigned int BEHAVIAC_STDCALL AllocOnSlabThread(void* arg)
+{
+    behaviac::MemSlabAllocator* pAllocator = (behaviac::MemSlabAllocator*)arg;
+
+    void* blocks[100];
+
+    for (int i = 0; i < 100; ++i)
+    {
+        blocks[i] = pAllocator->Alloc(16 + i, "test", __FILE__, __LINE__);
+    }
+
+    for (int i = 0; i < 100; ++i)
+    {
+        pAllocator->Free(blocks[i], "test", __FILE__, __LINE__);
+    }
+
+    return 0;
+}
+
+TEST(btunittest, slaballocator_thread_exit)
+{
+    behaviac::MemSlabAllocator allocator;
+
+    void* pMine = allocator.Alloc(32, "test", __FILE__, __LINE__);
+
+    behaviac::MemSlabAllocator::Stats stats;
+    allocator.GetStats(stats);
+    CHECK_EQUAL(1u, stats.threadCacheCount);
+    size_t allocatedBytes = stats.allocatedBytes;
+
+    behaviac::thread::ThreadHandle thread = behaviac::thread::CreateAndStartThread(&AllocOnSlabThread, &allocator, 64 * 1024);
+    behaviac::thread::StopThread(thread);
+
+    //the magazine of the exited thread went back to the depot, its counters are kept
+    allocator.GetStats(stats);
+    CHECK_EQUAL(1u, stats.threadCacheCount);
+    CHECK_EQUAL(allocatedBytes, stats.allocatedBytes);
+
+    allocator.Free(pMine, "test", __FILE__, __LINE__);
+    allocator.GetStats(stats);
+    CHECK_EQUAL(0, stats.allocatedBytes);
+}
@@ -0,0 +1,94 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Tencent is pleased to support the open source community by making behaviac available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except in compliance with
+// the License. You may obtain a copy of the License at http://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and limitations under the License.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "behaviac/common/base.h"
+#include "behaviac/common/serialization/snapshot.h"
+#include "behaviac/common/profiler/profiler.h"
+#include "test.h"
+#include "../behaviortest.h"
+#include "../btloadtestsuite.h"
+
+TEST(btunittest, agent_snapshot)
+{
+    const char* treePath = "node_test/action_waitframes_ut_0";
+
+    AgentNodeTest* pSource = initTestEnvNode(treePath, behaviac::Workspace::EFF_xml);
+    pSource->resetProperties();
+
+    behaviac::Workspace::GetInstance()->SetFrameSinceStartup(0);
+
+    //frame 0 enters the WaitFrames of 5 frames
+    pSource->btexec();
+    CHECK_EQUAL(1, pSource->testVar_0);
+    behaviac::Workspace::GetInstance()->SetFrameSinceStartup(1);
+    pSource->btexec();
+
+    pSource->SetVariable("testInt", 42);
+
+    uint32_t size = pSource->btsnapshotsize();
+    CHECK(size > sizeof(behaviac::SnapshotHeader));
+
+    char buffer[1024];
+    CHECK(size <= sizeof(buffer));
+    CHECK_EQUAL(0u, pSource->btsavesnapshot(buffer, size - 1));
+    CHECK_EQUAL(size, pSource->btsavesnapshot(buffer, sizeof(buffer)));
+
+    //restored into an agent which has not set the tree yet
+    AgentNodeTest* pTarget = AgentNodeTest::DynamicCast(behaviac::Agent::Create<AgentNodeTest>());
+    pTarget->resetProperties();
+    CHECK(pTarget->btloadsnapshot(buffer, size));
+    CHECK(pTarget->btgetcurrent() != 0);
+    CHECK_EQUAL(behaviac::BT_RUNNING, pTarget->btgetcurrent()->GetStatus());
+    CHECK_EQUAL(42, pTarget->GetVariable<int>("testInt"));
+
+    //it resumes in the WaitFrames, the first assignment is not executed again
+    for (int frame = 2; frame < 4; ++frame)
+    {
+        behaviac::Workspace::GetInstance()->SetFrameSinceStartup(frame);
+        CHECK_EQUAL(behaviac::BT_RUNNING, pTarget->btexec());
+        CHECK(pTarget->testVar_0 != 1);
+    }
+
+    behaviac::Workspace::GetInstance()->SetFrameSinceStartup(4);
+    CHECK_EQUAL(behaviac::BT_SUCCESS, pTarget->btexec());
+    CHECK_EQUAL(2, pTarget->testVar_0);
+
+    //restored in place into the source's tree, which has ended meanwhile
+    pSource->btexec();
+    behaviac::BehaviorTreeTask* pTree = pSource->btgetcurrent();
+    CHECK(pSource->btloadsnapshot(buffer, size));
+    CHECK(pTree == pSource->btgetcurrent());
+    CHECK_EQUAL(behaviac::BT_RUNNING, pTree->GetStatus());
+
+    //a truncated snapshot is rejected without restoring any part of it
+    pSource->SetVariable("testInt", 7);
+
+    for (uint32_t length = sizeof(behaviac::SnapshotHeader); length < size; ++length)
+    {
+        char truncated[1024];
+        memcpy(truncated, buffer, length);
+        ((behaviac::SnapshotHeader*)truncated)->size = length;
+
+        CHECK(!pSource->btloadsnapshot(truncated, length));
+        CHECK_EQUAL(7, pSource->GetVariable<int>("testInt"));
+        CHECK(pTree == pSource->btgetcurrent());
+        CHECK_EQUAL(behaviac::BT_RUNNING, pTree->GetStatus());
+    }
+
+    //another version is rejected
+    ((behaviac::SnapshotHeader*)buffer)->version = behaviac::SnapshotHeader::kVersion + 1;
+    CHECK(!pTarget->btloadsnapshot(buffer, size));
+
+    behaviac::Agent::Destroy(pTarget);
+    finlTestEnvNode(pSource);
+}
@@ -0,0 +1,65 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Tencent is pleased to support the open source community by making behaviac available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except in compliance with
+// the License. You may obtain a copy of the License at http://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and limitations under the License.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "../btloadtestsuite.h"
+
+TEST(btunittest, string_atom)
+{
+    behaviac::CStringAtom empty;
+    CHECK(empty.empty());
+    CHECK_STR_EQUAL("", empty.c_str());
+    CHECK(behaviac::CStringAtom("") == empty);
+
+    behaviac::CStringAtom sequence("Sequence");
+    behaviac::CStringAtom sequence2(behaviac::string("Sequence").c_str());
+    behaviac::CStringAtom selector("Selector");
+
+    CHECK(!sequence.empty());
+    CHECK(sequence == sequence2);
+    CHECK(sequence != selector);
+    CHECK_STR_EQUAL("Sequence", sequence.c_str());
+    CHECK_STR_EQUAL("Selector", selector.c_str());
+
+    //the same string is kept once
+    CHECK(sequence.c_str() == sequence2.c_str());
+
+    //a string longer than the chunks has its own allocation
+    behaviac::string longName(5000, 'x');
+    behaviac::CStringAtom longAtom(longName.c_str());
+    CHECK(longName == longAtom.c_str());
+    CHECK_STR_EQUAL("Sequence", sequence.c_str());
+
+    //loading a tree interns the class names and the agent type of its nodes
+    registerAllTypes();
+    behaviac::Workspace::GetInstance()->UnLoadAll();
+
+    behaviac::StringTable::Stats before = behaviac::StringTable::GetStats();
+    behaviac::Workspace::GetInstance()->Load("node_test/sequence_ut_0");
+    behaviac::Workspace::GetInstance()->Load("node_test/selector_ut_0");
+    behaviac::StringTable::Stats after = behaviac::StringTable::GetStats();
+
+    CHECK(after.requests > before.requests);
+    CHECK(after.requests - before.requests > after.strings - before.strings);
+    CHECK(after.requestedBytes - before.requestedBytes > after.bytes - before.bytes);
+
+    //the table is kept until behaviac is stopped, the atoms not in the trees are still valid
+    behaviac::Workspace::GetInstance()->UnLoadAll();
+
+    behaviac::StringTable::Stats unloaded = behaviac::StringTable::GetStats();
+    CHECK_EQUAL(after.strings, unloaded.strings);
+    CHECK_STR_EQUAL("Sequence", sequence.c_str());
+
+    CHECK_STR_EQUAL("SubBT", behaviac::StringTable::GetString(behaviac::StringTable::GetSubBTIndex()));
+
+    unregisterAllTypes();
+}
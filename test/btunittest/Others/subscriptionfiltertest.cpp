@@ -0,0 +1,75 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Tencent is pleased to support the open source community by making behaviac available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except in compliance with
+// the License. You may obtain a copy of the License at http://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and limitations under the License.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "behaviac/behaviac.h"
+#include "behaviac/common/socket/socketconnect.h"
+#include "test.h"
+
+TEST(btunittest, subscription_filter)
+{
+    using behaviac::MessageKind::MSGKIND_TICK;
+    using behaviac::MessageKind::MSGKIND_PROPERTY;
+    using behaviac::MessageKind::MSGKIND_LOG;
+
+    const uint32_t shipTree = behaviac::CRC32::CalcCRC("ships/suicide");
+    const uint32_t otherTree = behaviac::CRC32::CalcCRC("ships/attack");
+
+    behaviac::SubscriptionFilter filter;
+
+    //nothing subscribed watches everything
+    CHECK(filter.Match(MSGKIND_TICK, 3, shipTree));
+    CHECK(filter.Match(MSGKIND_LOG, -1, 0));
+
+    //the other lines are left to the workspace
+    CHECK(!filter.Parse("[breakpoint]ships/suicide.xml->Sequence[1]:enter all Hit=1\n"));
+    CHECK(!filter.Parse("[start]\n"));
+
+    CHECK(filter.Parse("[subscribe] agent 3\n"));
+    CHECK(filter.Parse("[subscribe] agent 5\n"));
+    CHECK(filter.Match(MSGKIND_TICK, 3, shipTree));
+    CHECK(filter.Match(MSGKIND_TICK, 5, otherTree));
+    CHECK(!filter.Match(MSGKIND_TICK, 4, shipTree));
+
+    //the messages not about an agent are only filtered by the kinds
+    CHECK(filter.Match(MSGKIND_LOG, -1, 0));
+
+    CHECK(filter.Parse("[subscribe] tree ships/suicide\n"));
+    CHECK(filter.Match(MSGKIND_TICK, 3, shipTree));
+    CHECK(!filter.Match(MSGKIND_TICK, 5, otherTree));
+
+    CHECK(filter.Parse("[subscribe] kind property\n"));
+    CHECK(filter.Match(MSGKIND_PROPERTY, 3, shipTree));
+    CHECK(filter.Match(MSGKIND_TICK | MSGKIND_PROPERTY, 3, shipTree));
+    CHECK(!filter.Match(MSGKIND_TICK, 3, shipTree));
+    CHECK(!filter.Match(MSGKIND_LOG, -1, 0));
+
+    //an unknown kind is consumed but adds nothing
+    CHECK(filter.Parse("[subscribe] kind nothing\n"));
+    CHECK(!filter.Match(MSGKIND_TICK, 3, shipTree));
+
+    CHECK(filter.Parse("[unsubscribe]\n"));
+    CHECK(filter.Match(MSGKIND_TICK, 4, otherTree));
+
+    //the sets are bounded, the subscriptions beyond them are dropped
+    for (int i = 0; i < behaviac::SubscriptionFilter::kMaxAgents; ++i)
+    {
+        CHECK(filter.AddAgent(100 + i));
+    }
+
+    CHECK(filter.AddAgent(100));
+    CHECK(!filter.AddAgent(1));
+    CHECK_EQUAL((int)behaviac::SubscriptionFilter::kMaxAgents, filter.agentCount);
+
+    //nobody is connected in the unit tests
+    CHECK_EQUAL(0u, behaviac::Socket::GetSubscribers(0, behaviac::MessageKind::MSGKIND_ALL));
+}
@@ -0,0 +1,196 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Tencent is pleased to support the open source community by making behaviac available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except in compliance with
+// the License. You may obtain a copy of the License at http://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and limitations under the License.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "../btloadtestsuite.h"
+#include "behaviac/agent/tickrecorder.h"
+
+static const int kRecordedContext = 1;
+static const int kReplayedContext = 2;
+static const int kAgentCount = 4;
+
+static behaviac::Agent* CreateReplayedAgent(const char* agentType, int contextId, void* pUserData)
+{
+    BEHAVIAC_UNUSED_VAR(pUserData);
+
+    CHECK(strcmp(agentType, AgentNodeTest::GetClassTypeName()) == 0);
+
+    AgentNodeTest* pAgent = behaviac::Agent::Create<AgentNodeTest>(0, contextId, 0);
+    pAgent->resetProperties();
+
+    return pAgent;
+}
+
+static void RecordFrames(const char* treePath, int frames, std::vector<AgentNodeTest*>& agents)
+{
+    for (int i = 0; i < kAgentCount; ++i)
+    {
+        AgentNodeTest* pAgent = behaviac::Agent::Create<AgentNodeTest>(0, kRecordedContext, 0);
+        pAgent->resetProperties();
+        pAgent->btsetcurrent(treePath);
+        agents.push_back(pAgent);
+    }
+
+    for (int frame = 0; frame < frames; ++frame)
+    {
+        //the agents are signalled one after another, the writes are the inputs of the frames
+        for (int i = 0; i < kAgentCount; ++i)
+        {
+            agents[i]->SetVariable("testVar_0", (frame + i) % 3 == 0 ? 0 : -1);
+        }
+
+        behaviac::Workspace::GetInstance()->SetFrameSinceStartup(100 + frame);
+        behaviac::Workspace::GetInstance()->SetTimeSinceStartup(0.5 * frame);
+
+        behaviac::Context::execAgents(kRecordedContext);
+    }
+}
+
+static void ReplayFrames(const behaviac::vector<uint8_t>& trace, behaviac::TickReplay& replay, const std::vector<AgentNodeTest*>& agents)
+{
+    CHECK(replay.Open(&trace[0], (uint32_t)trace.size(), kReplayedContext, CreateReplayedAgent, 0));
+
+    while (replay.ReplayFrame())
+    {
+    }
+
+    CHECK_EQUAL(replay.GetFrameCount(), replay.GetReplayedFrameCount());
+    CHECK_EQUAL(0u, replay.GetDivergedFrameCount());
+    CHECK_EQUAL(0u, replay.GetSkippedCount());
+
+    for (int i = 0; i < kAgentCount; ++i)
+    {
+        AgentNodeTest* pReplayed = (AgentNodeTest*)replay.GetAgent(agents[i]->GetId());
+        CHECK(pReplayed != 0);
+
+        CHECK_EQUAL(agents[i]->btgetcurrent()->GetStatus(), pReplayed->btgetcurrent()->GetStatus());
+        CHECK_EQUAL(agents[i]->testVar_0, pReplayed->testVar_0);
+    }
+}
+
+static void DestroyAgents(std::vector<AgentNodeTest*>& agents, behaviac::TickReplay& replay)
+{
+    for (int i = 0; i < kAgentCount; ++i)
+    {
+        behaviac::Agent::Destroy(agents[i]);
+    }
+
+    behaviac::vector<behaviac::Agent*> replayed;
+    replay.GetAgents(replayed);
+
+    for (unsigned int i = 0; i < replayed.size(); ++i)
+    {
+        behaviac::Agent::Destroy(replayed[i]);
+    }
+
+    behaviac::Context::Cleanup(kRecordedContext);
+    behaviac::Context::Cleanup(kReplayedContext);
+}
+
+TEST(btunittest, tick_recorder_replay)
+{
+    behaviac::Workspace::EFileFormat format = behaviac::Workspace::GetInstance()->GetFileFormat();
+    behaviac::Workspace::GetInstance()->SetFileFormat(behaviac::Workspace::EFF_xml);
+
+    behaviac::Config::SetSocketing(false);
+    registerAllTypes();
+
+    const char* treePath = "node_test/action_ut_waitforsignal_0";
+    behaviac::Workspace::GetInstance()->Load(treePath);
+
+    behaviac::Context::GetContext(kRecordedContext).StartRecording(64 * 1024, 4);
+
+    std::vector<AgentNodeTest*> agents;
+    RecordFrames(treePath, 10, agents);
+
+    const behaviac::TickRecorder* pRecorder = behaviac::Context::GetContext(kRecordedContext).GetTickRecorder();
+    CHECK(pRecorder != 0);
+    CHECK_EQUAL(10u, pRecorder->GetStats().frames);
+    CHECK_EQUAL(3u, pRecorder->GetStats().keyframes);
+    CHECK_EQUAL(0u, pRecorder->GetStats().overwritten);
+
+    behaviac::vector<uint8_t> trace;
+    CHECK(pRecorder->SaveTrace(trace));
+
+    //an agent out of the context doesn't keep the recorder stopped
+    behaviac::Context::GetContext(kRecordedContext).RemoveAgent(agents[0]);
+
+    behaviac::Context::GetContext(kRecordedContext).StopRecording();
+    CHECK(behaviac::Context::GetContext(kRecordedContext).GetTickRecorder() == 0);
+
+    agents[0]->btexec();
+    behaviac::Context::GetContext(kRecordedContext).AddAgent(agents[0]);
+
+    //the replay sets the time and the frame since startup of each frame
+    behaviac::Workspace::GetInstance()->SetFrameSinceStartup(0);
+    behaviac::Workspace::GetInstance()->SetTimeSinceStartup(0.0);
+
+    behaviac::TickReplay replay;
+    ReplayFrames(trace, replay, agents);
+    CHECK_EQUAL(10u, replay.GetFrameCount());
+    CHECK_EQUAL(109, behaviac::Workspace::GetInstance()->GetFrameSinceStartup());
+    CHECK_FLOAT_EQUAL(4.5, behaviac::Workspace::GetInstance()->GetTimeSinceStartup());
+
+    for (int i = 0; i < kAgentCount; ++i)
+    {
+        AgentNodeTest* pReplayed = (AgentNodeTest*)replay.GetAgent(agents[i]->GetId());
+
+        CHECK_EQUAL(agents[i]->testVar_1, pReplayed->testVar_1);
+        CHECK_FLOAT_EQUAL(agents[i]->testVar_2, pReplayed->testVar_2);
+    }
+
+    DestroyAgents(agents, replay);
+
+    unregisterAllTypes();
+
+    behaviac::Workspace::GetInstance()->SetFileFormat(format);
+}
+
+TEST(btunittest, tick_recorder_ring)
+{
+    behaviac::Workspace::EFileFormat format = behaviac::Workspace::GetInstance()->GetFileFormat();
+    behaviac::Workspace::GetInstance()->SetFileFormat(behaviac::Workspace::EFF_xml);
+
+    behaviac::Config::SetSocketing(false);
+    registerAllTypes();
+
+    const char* treePath = "node_test/action_ut_waitforsignal_0";
+    behaviac::Workspace::GetInstance()->Load(treePath);
+
+    //the ring keeps only the last frames
+    behaviac::Context::GetContext(kRecordedContext).StartRecording(4 * 1024, 4);
+
+    std::vector<AgentNodeTest*> agents;
+    RecordFrames(treePath, 40, agents);
+
+    const behaviac::TickRecorder* pRecorder = behaviac::Context::GetContext(kRecordedContext).GetTickRecorder();
+    CHECK(pRecorder->GetStats().overwritten > 0);
+    CHECK_EQUAL(0u, pRecorder->GetStats().dropped);
+
+    behaviac::vector<uint8_t> trace;
+    CHECK(pRecorder->SaveTrace(trace));
+    CHECK(trace.size() <= 4 * 1024 + sizeof(behaviac::TraceHeader));
+
+    behaviac::Context::GetContext(kRecordedContext).StopRecording();
+
+    //the replay starts from the oldest keyframe left, the agents are restored from its snapshots
+    behaviac::TickReplay replay;
+    ReplayFrames(trace, replay, agents);
+    CHECK(replay.GetFrameCount() < 40u);
+    CHECK(replay.GetFrameCount() >= 4u);
+
+    DestroyAgents(agents, replay);
+
+    unregisterAllTypes();
+
+    behaviac::Workspace::GetInstance()->SetFileFormat(format);
+}
@@ -0,0 +1,61 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Tencent is pleased to support the open source community by making behaviac available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except in compliance with
+// the License. You may obtain a copy of the License at http://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and limitations under the License.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "test.h"
+#include "../behaviortest.h"
+#include "../btloadtestsuite.h"
+
+TEST(btunittest, variable_binding)
+{
+    AgentNodeTest* pAgent = initTestEnvNode("node_test/action_ut_0", behaviac::Workspace::EFF_xml);
+    pAgent->resetProperties();
+
+    const uint32_t testIntId = behaviac::MakeVariableId("testInt");
+    const uint32_t redirectCountId = behaviac::MakeVariableId("redirectCount");
+
+    behaviac::CProperty<int>* pTestInt = (behaviac::CProperty<int>*)pAgent->GetProperty(testIntId);
+    behaviac::CProperty<uint32_t>* pRedirectCount = (behaviac::CProperty<uint32_t>*)pAgent->GetProperty(redirectCountId);
+    CHECK(pTestInt != NULL && pTestInt->IsCustomized());
+    CHECK(pRedirectCount != NULL && pRedirectCount->IsCustomized());
+
+    //the properties of the same meta are kept in different slots
+    int testInt = 5;
+    uint32_t redirectCount = 3;
+    pTestInt->SetValue(pAgent, &testInt);
+    pRedirectCount->SetValue(pAgent, &redirectCount);
+    CHECK_EQUAL(5, *(const int*)pTestInt->GetValue(pAgent));
+    CHECK_EQUAL(3u, *(const uint32_t*)pRedirectCount->GetValue(pAgent));
+    CHECK_EQUAL(5, pAgent->GetVariable<int>("testInt"));
+
+    pAgent->SetVariable("testInt", 7);
+    CHECK_EQUAL(7, *(const int*)pTestInt->GetValue(pAgent));
+
+    //the states pushed are looked up as long as they are there
+    behaviac::AgentState* pState = pAgent->GetVariables();
+    behaviac::AgentState* pTop = pState->Push(true);
+
+    testInt = 20;
+    pTestInt->SetValue(pAgent, &testInt);
+    CHECK_EQUAL(20, *(const int*)pTestInt->GetValue(pAgent));
+
+    pTop->Pop();
+    CHECK_EQUAL(7, *(const int*)pTestInt->GetValue(pAgent));
+
+    //the variables replaced are looked up again
+    pState->Clear(true);
+    pState->AddVariable(testIntId, pTestInt->Instantiate(), 0);
+    CHECK_EQUAL(10, *(const int*)pTestInt->GetValue(pAgent));
+    CHECK_EQUAL(10, pAgent->GetVariable<int>("testInt"));
+
+    finlTestEnvNode(pAgent);
+}
@@ -0,0 +1,32 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Tencent is pleased to support the open source community by making behaviac available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except in compliance with
+// the License. You may obtain a copy of the License at http://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and limitations under the License.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "behaviac/behaviac.h"
+#include "test.h"
+
+TEST(btunittest, variable_id)
+{
+    BEHAVIAC_ASSERT_VARID("par_SmallDisance", 4142645218u);
+
+    CHECK_EQUAL(4142645218u, BEHAVIAC_VARID("par_SmallDisance"));
+    CHECK_EQUAL(behaviac::MakeVariableId(""), BEHAVIAC_VARID(""));
+    CHECK_EQUAL(behaviac::MakeVariableId("_$local_task_param_$_0"), BEHAVIAC_VARID("_$local_task_param_$_0"));
+
+    //the length is mixed in modulo 256
+    const char* kLongName = "a_very_long_variable_name_0123456789_0123456789_0123456789_0123456789_0123456789_0123456789"
+                            "_0123456789_0123456789_0123456789_0123456789_0123456789_0123456789_0123456789_0123456789"
+                            "_0123456789_0123456789_0123456789_0123456789_0123456789_0123456789_0123456789_0123456789";
+    CHECK_EQUAL(behaviac::MakeVariableId(kLongName), BEHAVIAC_VARID("a_very_long_variable_name_0123456789_0123456789_0123456789_0123456789_0123456789_0123456789"
+                                                                    "_0123456789_0123456789_0123456789_0123456789_0123456789_0123456789_0123456789_0123456789"
+                                                                    "_0123456789_0123456789_0123456789_0123456789_0123456789_0123456789_0123456789_0123456789"));
+}
@@ -191,3 +191,29 @@ LOAD_TEST(btunittest, preconditioneffectortest_4)
 
 	finlTestEnvPreEff(testAgent);
 }
+
+TEST(btunittest, tick_info_descriptor)
+{
+    PreconEffectorAgent* testAgent = initTestEnvPreEff("node_test/PreconditionEffectorTest/PreconditionEffectorTest_3", behaviac::Workspace::EFF_xml);
+
+    const behaviac::BehaviorNode* pNode = testAgent->btgetcurrent()->GetNode()->GetChild(0);
+
+    //built when the tree is loaded
+    CHECK(!pNode->GetTickInfoDescriptor().empty());
+
+    char buffer[1024];
+    uint32_t length = behaviac::BehaviorTask::GetTickInfo(testAgent, pNode, "enter", buffer, sizeof(buffer));
+    behaviac::string tickInfo = behaviac::BehaviorTask::GetTickInfo(testAgent, pNode, "enter");
+
+    CHECK(length == tickInfo.size());
+    CHECK_EQUAL(0, strcmp(buffer, tickInfo.c_str()));
+    CHECK(strstr(buffer, "PreconditionEffectorTest_3.xml->") != 0);
+    CHECK_EQUAL(0, strcmp(buffer + length - 6, ":enter"));
+
+    //truncated to the buffer
+    char small[8];
+    CHECK(behaviac::BehaviorTask::GetTickInfo(testAgent, pNode, "enter", small, sizeof(small)) == 7);
+    CHECK_EQUAL(0, strncmp(small, buffer, 7));
+
+    finlTestEnvPreEff(testAgent);
+}
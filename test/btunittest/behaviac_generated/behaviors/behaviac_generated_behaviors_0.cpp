@@ -40,7 +40,7 @@ namespace behaviac
 			EBTStatus result = BT_SUCCESS;
 			float opr1 = 0.5f;
 			float opr2 = 1.3f;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par_float_type_0") == 569873069u);
+			BEHAVIAC_ASSERT_VARID("par_float_type_0", 569873069u);
 			pAgent->SetVariable("par_float_type_0", 569873069u, (float)(opr1 + opr2));
 			return result;
 		}
@@ -58,7 +58,7 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par_float_type_0") == 569873069u);
+			BEHAVIAC_ASSERT_VARID("par_float_type_0", 569873069u);
 			float& method_p0 = (float&)pAgent->GetVariable<float >(569873069u);
 			((AgentNodeTest*)pAgent)->_Execute_Method_<METHOD_TYPE_AgentNodeTest_setTestVar_2, void, float >(method_p0);
 			return BT_SUCCESS;
@@ -79,7 +79,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
 			float opr = ((AgentNodeTest*)pAgent)->_Get_Property_<PROPERTY_TYPE_AgentNodeTest_testVar_2, float >();
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par_float_type_1") == 955032556u);
+			BEHAVIAC_ASSERT_VARID("par_float_type_1", 955032556u);
 			pAgent->SetVariable("par_float_type_1", 955032556u, opr);
 			return result;
 		}
@@ -98,11 +98,11 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par_float_type_1") == 955032556u);
+			BEHAVIAC_ASSERT_VARID("par_float_type_1", 955032556u);
 			float& opr1 = (float&)pAgent->GetVariable<float >(955032556u);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par_float_type_2") == 331477039u);
+			BEHAVIAC_ASSERT_VARID("par_float_type_2", 331477039u);
 			float& opr2 = (float&)pAgent->GetVariable<float >(331477039u);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par_float_type_0") == 569873069u);
+			BEHAVIAC_ASSERT_VARID("par_float_type_0", 569873069u);
 			pAgent->SetVariable("par_float_type_0", 569873069u, (float)(opr1 + opr2));
 			return result;
 		}
@@ -120,7 +120,7 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par_float_type_0") == 569873069u);
+			BEHAVIAC_ASSERT_VARID("par_float_type_0", 569873069u);
 			float& method_p0 = (float&)pAgent->GetVariable<float >(569873069u);
 			((AgentNodeTest*)pAgent)->_Execute_Method_<METHOD_TYPE_AgentNodeTest_setTestVar_3, void, float >(method_p0);
 			return BT_SUCCESS;
@@ -141,7 +141,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
 			UnityEngine::GameObject* opr = ((AgentNodeTest*)pAgent)->_Execute_Method_<METHOD_TYPE_AgentNodeTest_createGameObject, UnityEngine::GameObject* >();
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par_go") == 464621558u);
+			BEHAVIAC_ASSERT_VARID("par_go", 464621558u);
 			pAgent->SetVariable("par_go", 464621558u, opr);
 			return result;
 		}
@@ -159,7 +159,7 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par_go") == 464621558u);
+			BEHAVIAC_ASSERT_VARID("par_go", 464621558u);
 			UnityEngine::GameObject*& method_p0 = (UnityEngine::GameObject*&)pAgent->GetVariable<UnityEngine::GameObject* >(464621558u);
 			((AgentNodeTest*)pAgent)->_Execute_Method_<METHOD_TYPE_AgentNodeTest_testGameObject, void, UnityEngine::GameObject* >(method_p0);
 			return BT_SUCCESS;
@@ -290,7 +290,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
 			int opr = -1;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("FoodCount") == 3299892854u);
+			BEHAVIAC_ASSERT_VARID("FoodCount", 3299892854u);
 			pAgent->SetVariable("FoodCount", 3299892854u, opr);
 			return result;
 		}
@@ -642,7 +642,7 @@ namespace behaviac
 		{
 			EBTStatus result = BT_SUCCESS;
 			int opr2 = 0;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("InactiveCount") == 1246269412u);
+			BEHAVIAC_ASSERT_VARID("InactiveCount", 1246269412u);
 			pAgent->SetVariable("InactiveCount", 1246269412u, opr2);
 			return result;
 		}
@@ -683,10 +683,10 @@ namespace behaviac
 		virtual EBTStatus update_impl(Agent* pAgent, EBTStatus childStatus)
 		{
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("InactiveCount") == 1246269412u);
+			BEHAVIAC_ASSERT_VARID("InactiveCount", 1246269412u);
 			int& opr1 = (int&)pAgent->GetVariable<int >(1246269412u);
 			int opr2 = 1;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("InactiveCount") == 1246269412u);
+			BEHAVIAC_ASSERT_VARID("InactiveCount", 1246269412u);
 			pAgent->SetVariable("InactiveCount", 1246269412u, (int)(opr1 + opr2));
 			return result;
 		}
@@ -746,7 +746,7 @@ namespace behaviac
 		{
 			EBTStatus result = BT_SUCCESS;
 			long opr2 = 0;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("ExitCount") == 1184325508u);
+			BEHAVIAC_ASSERT_VARID("ExitCount", 1184325508u);
 			pAgent->SetVariable("ExitCount", 1184325508u, opr2);
 			return result;
 		}
@@ -764,10 +764,10 @@ namespace behaviac
 		virtual EBTStatus update_impl(Agent* pAgent, EBTStatus childStatus)
 		{
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("ExitCount") == 1184325508u);
+			BEHAVIAC_ASSERT_VARID("ExitCount", 1184325508u);
 			long& opr1 = (long&)pAgent->GetVariable<long >(1184325508u);
 			long opr2 = 1;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("ExitCount") == 1184325508u);
+			BEHAVIAC_ASSERT_VARID("ExitCount", 1184325508u);
 			pAgent->SetVariable("ExitCount", 1184325508u, (long)(opr1 + opr2));
 			return result;
 		}
@@ -805,7 +805,7 @@ namespace behaviac
 		{
 			EBTStatus result = BT_SUCCESS;
 			short opr2 = 0;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("PauseCount") == 3020354788u);
+			BEHAVIAC_ASSERT_VARID("PauseCount", 3020354788u);
 			pAgent->SetVariable("PauseCount", 3020354788u, opr2);
 			return result;
 		}
@@ -869,10 +869,10 @@ namespace behaviac
 		virtual EBTStatus update_impl(Agent* pAgent, EBTStatus childStatus)
 		{
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("PauseCount") == 3020354788u);
+			BEHAVIAC_ASSERT_VARID("PauseCount", 3020354788u);
 			short& opr1 = (short&)pAgent->GetVariable<short >(3020354788u);
 			short opr2 = 1;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("PauseCount") == 3020354788u);
+			BEHAVIAC_ASSERT_VARID("PauseCount", 3020354788u);
 			pAgent->SetVariable("PauseCount", 3020354788u, (short)(opr1 + opr2));
 			return result;
 		}
@@ -916,7 +916,7 @@ namespace behaviac
 		{
 			EBTStatus result = BT_SUCCESS;
 			unsigned int opr2 = 0;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("ActiveCount") == 177115358u);
+			BEHAVIAC_ASSERT_VARID("ActiveCount", 177115358u);
 			pAgent->SetVariable("ActiveCount", 177115358u, opr2);
 			return result;
 		}
@@ -957,10 +957,10 @@ namespace behaviac
 		virtual EBTStatus update_impl(Agent* pAgent, EBTStatus childStatus)
 		{
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("ActiveCount") == 177115358u);
+			BEHAVIAC_ASSERT_VARID("ActiveCount", 177115358u);
 			unsigned int& opr1 = (unsigned int&)pAgent->GetVariable<unsigned int >(177115358u);
 			unsigned int opr2 = 1;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("ActiveCount") == 177115358u);
+			BEHAVIAC_ASSERT_VARID("ActiveCount", 177115358u);
 			pAgent->SetVariable("ActiveCount", 177115358u, (unsigned int)(opr1 + opr2));
 			return result;
 		}
@@ -1198,7 +1198,7 @@ namespace behaviac
 		{
 			EBTStatus result = BT_SUCCESS;
 			int opr2 = 0;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("FoodCount") == 3299892854u);
+			BEHAVIAC_ASSERT_VARID("FoodCount", 3299892854u);
 			pAgent->SetVariable("FoodCount", 3299892854u, opr2);
 			return result;
 		}
@@ -1217,10 +1217,10 @@ namespace behaviac
 		virtual EBTStatus update_impl(Agent* pAgent, EBTStatus childStatus)
 		{
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("FoodCount") == 3299892854u);
+			BEHAVIAC_ASSERT_VARID("FoodCount", 3299892854u);
 			int& opr1 = (int&)pAgent->GetVariable<int >(3299892854u);
 			int opr2 = 1;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("FoodCount") == 3299892854u);
+			BEHAVIAC_ASSERT_VARID("FoodCount", 3299892854u);
 			pAgent->SetVariable("FoodCount", 3299892854u, (int)(opr1 + opr2));
 			return result;
 		}
@@ -1240,7 +1240,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("FoodCount") == 3299892854u);
+			BEHAVIAC_ASSERT_VARID("FoodCount", 3299892854u);
 			int& opl = (int&)pAgent->GetVariable<int >(3299892854u);
 			int opr2 = 10;
 			bool op = PrivateDetails::GreaterEqual(opl, opr2);
@@ -1281,10 +1281,10 @@ namespace behaviac
 		virtual EBTStatus update_impl(Agent* pAgent, EBTStatus childStatus)
 		{
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("FoodCount") == 3299892854u);
+			BEHAVIAC_ASSERT_VARID("FoodCount", 3299892854u);
 			int& opr1 = (int&)pAgent->GetVariable<int >(3299892854u);
 			int opr2 = 2;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("FoodCount") == 3299892854u);
+			BEHAVIAC_ASSERT_VARID("FoodCount", 3299892854u);
 			pAgent->SetVariable("FoodCount", 3299892854u, (int)(opr1 - opr2));
 			return result;
 		}
@@ -1303,10 +1303,10 @@ namespace behaviac
 		virtual EBTStatus update_impl(Agent* pAgent, EBTStatus childStatus)
 		{
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("EnergyCount") == 881465299u);
+			BEHAVIAC_ASSERT_VARID("EnergyCount", 881465299u);
 			int& opr1 = (int&)pAgent->GetVariable<int >(881465299u);
 			int opr2 = 1;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("EnergyCount") == 881465299u);
+			BEHAVIAC_ASSERT_VARID("EnergyCount", 881465299u);
 			pAgent->SetVariable("EnergyCount", 881465299u, (int)(opr1 + opr2));
 			return result;
 		}
@@ -1326,7 +1326,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("FoodCount") == 3299892854u);
+			BEHAVIAC_ASSERT_VARID("FoodCount", 3299892854u);
 			int& opl = (int&)pAgent->GetVariable<int >(3299892854u);
 			int opr2 = 0;
 			bool op = PrivateDetails::LessEqual(opl, opr2);
@@ -1350,7 +1350,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("EnergyCount") == 881465299u);
+			BEHAVIAC_ASSERT_VARID("EnergyCount", 881465299u);
 			int& opl = (int&)pAgent->GetVariable<int >(881465299u);
 			int opr2 = 5;
 			bool op = PrivateDetails::GreaterEqual(opl, opr2);
@@ -1391,10 +1391,10 @@ namespace behaviac
 		virtual EBTStatus update_impl(Agent* pAgent, EBTStatus childStatus)
 		{
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("FoodCount") == 3299892854u);
+			BEHAVIAC_ASSERT_VARID("FoodCount", 3299892854u);
 			int& opr1 = (int&)pAgent->GetVariable<int >(3299892854u);
 			int opr2 = 1;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("FoodCount") == 3299892854u);
+			BEHAVIAC_ASSERT_VARID("FoodCount", 3299892854u);
 			pAgent->SetVariable("FoodCount", 3299892854u, (int)(opr1 - opr2));
 			return result;
 		}
@@ -1414,7 +1414,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("FoodCount") == 3299892854u);
+			BEHAVIAC_ASSERT_VARID("FoodCount", 3299892854u);
 			int& opl = (int&)pAgent->GetVariable<int >(3299892854u);
 			int opr2 = 0;
 			bool op = PrivateDetails::LessEqual(opl, opr2);
@@ -1605,7 +1605,7 @@ namespace behaviac
 		{
 			EBTStatus result = BT_SUCCESS;
 			int opr2 = 0;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("InactiveCount") == 1246269412u);
+			BEHAVIAC_ASSERT_VARID("InactiveCount", 1246269412u);
 			pAgent->SetVariable("InactiveCount", 1246269412u, opr2);
 			return result;
 		}
@@ -1669,10 +1669,10 @@ namespace behaviac
 		virtual EBTStatus update_impl(Agent* pAgent, EBTStatus childStatus)
 		{
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("InactiveCount") == 1246269412u);
+			BEHAVIAC_ASSERT_VARID("InactiveCount", 1246269412u);
 			int& opr1 = (int&)pAgent->GetVariable<int >(1246269412u);
 			int opr2 = 1;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("InactiveCount") == 1246269412u);
+			BEHAVIAC_ASSERT_VARID("InactiveCount", 1246269412u);
 			pAgent->SetVariable("InactiveCount", 1246269412u, (int)(opr1 + opr2));
 			return result;
 		}
@@ -1710,7 +1710,7 @@ namespace behaviac
 		{
 			EBTStatus result = BT_SUCCESS;
 			unsigned int opr2 = 0;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("ActiveCount") == 177115358u);
+			BEHAVIAC_ASSERT_VARID("ActiveCount", 177115358u);
 			pAgent->SetVariable("ActiveCount", 177115358u, opr2);
 			return result;
 		}
@@ -1751,10 +1751,10 @@ namespace behaviac
 		virtual EBTStatus update_impl(Agent* pAgent, EBTStatus childStatus)
 		{
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("ActiveCount") == 177115358u);
+			BEHAVIAC_ASSERT_VARID("ActiveCount", 177115358u);
 			unsigned int& opr1 = (unsigned int&)pAgent->GetVariable<unsigned int >(177115358u);
 			unsigned int opr2 = 1;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("ActiveCount") == 177115358u);
+			BEHAVIAC_ASSERT_VARID("ActiveCount", 177115358u);
 			pAgent->SetVariable("ActiveCount", 177115358u, (unsigned int)(opr1 + opr2));
 			return result;
 		}
@@ -1791,7 +1791,7 @@ namespace behaviac
 		{
 			EBTStatus result = BT_SUCCESS;
 			long opr2 = 0;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("ExitCount") == 1184325508u);
+			BEHAVIAC_ASSERT_VARID("ExitCount", 1184325508u);
 			pAgent->SetVariable("ExitCount", 1184325508u, opr2);
 			return result;
 		}
@@ -1809,10 +1809,10 @@ namespace behaviac
 		virtual EBTStatus update_impl(Agent* pAgent, EBTStatus childStatus)
 		{
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("ExitCount") == 1184325508u);
+			BEHAVIAC_ASSERT_VARID("ExitCount", 1184325508u);
 			long& opr1 = (long&)pAgent->GetVariable<long >(1184325508u);
 			long opr2 = 1;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("ExitCount") == 1184325508u);
+			BEHAVIAC_ASSERT_VARID("ExitCount", 1184325508u);
 			pAgent->SetVariable("ExitCount", 1184325508u, (long)(opr1 + opr2));
 			return result;
 		}
@@ -1850,7 +1850,7 @@ namespace behaviac
 		{
 			EBTStatus result = BT_SUCCESS;
 			short opr2 = 0;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("PauseCount") == 3020354788u);
+			BEHAVIAC_ASSERT_VARID("PauseCount", 3020354788u);
 			pAgent->SetVariable("PauseCount", 3020354788u, opr2);
 			return result;
 		}
@@ -1914,10 +1914,10 @@ namespace behaviac
 		virtual EBTStatus update_impl(Agent* pAgent, EBTStatus childStatus)
 		{
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("PauseCount") == 3020354788u);
+			BEHAVIAC_ASSERT_VARID("PauseCount", 3020354788u);
 			short& opr1 = (short&)pAgent->GetVariable<short >(3020354788u);
 			short opr2 = 1;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("PauseCount") == 3020354788u);
+			BEHAVIAC_ASSERT_VARID("PauseCount", 3020354788u);
 			pAgent->SetVariable("PauseCount", 3020354788u, (short)(opr1 + opr2));
 			return result;
 		}
@@ -2196,7 +2196,7 @@ namespace behaviac
 		virtual EBTStatus update_impl(Agent* pAgent, EBTStatus childStatus)
 		{
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("Land") == 1676779868u);
+			BEHAVIAC_ASSERT_VARID("Land", 1676779868u);
 			bool& opl = (bool&)pAgent->GetVariable<bool >(1676779868u);
 			bool opr2 = true;
 			bool op = PrivateDetails::Equal(opl, opr2);
@@ -2219,7 +2219,7 @@ namespace behaviac
 		{
 			EBTStatus result = BT_SUCCESS;
 			bool opr2 = true;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("House") == 3571637003u);
+			BEHAVIAC_ASSERT_VARID("House", 3571637003u);
 			pAgent->SetVariable("House", 3571637003u, opr2);
 			return result;
 		}
@@ -2269,7 +2269,7 @@ namespace behaviac
 		virtual EBTStatus update_impl(Agent* pAgent, EBTStatus childStatus)
 		{
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("Land") == 1676779868u);
+			BEHAVIAC_ASSERT_VARID("Land", 1676779868u);
 			bool& opl = (bool&)pAgent->GetVariable<bool >(1676779868u);
 			bool opr2 = true;
 			bool op = PrivateDetails::Equal(opl, opr2);
@@ -2292,7 +2292,7 @@ namespace behaviac
 		{
 			EBTStatus result = BT_SUCCESS;
 			bool opr2 = true;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("Permit") == 3054969542u);
+			BEHAVIAC_ASSERT_VARID("Permit", 3054969542u);
 			pAgent->SetVariable("Permit", 3054969542u, opr2);
 			return result;
 		}
@@ -2328,7 +2328,7 @@ namespace behaviac
 		{
 			EBTStatus result = BT_SUCCESS;
 			bool opr2 = true;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("Contract") == 3012131995u);
+			BEHAVIAC_ASSERT_VARID("Contract", 3012131995u);
 			pAgent->SetVariable("Contract", 3012131995u, opr2);
 			return result;
 		}
@@ -2390,7 +2390,7 @@ namespace behaviac
 		virtual EBTStatus update_impl(Agent* pAgent, EBTStatus childStatus)
 		{
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("Money") == 4260042937u);
+			BEHAVIAC_ASSERT_VARID("Money", 4260042937u);
 			int& opl = (int&)pAgent->GetVariable<int >(4260042937u);
 			int opr2 = 50;
 			bool op = PrivateDetails::GreaterEqual(opl, opr2);
@@ -2413,7 +2413,7 @@ namespace behaviac
 		virtual EBTStatus update_impl(Agent* pAgent, EBTStatus childStatus)
 		{
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("HouseBuilt") == 1186824470u);
+			BEHAVIAC_ASSERT_VARID("HouseBuilt", 1186824470u);
 			bool& opl = (bool&)pAgent->GetVariable<bool >(1186824470u);
 			bool opr2 = true;
 			bool op = PrivateDetails::Equal(opl, opr2);
@@ -2435,10 +2435,10 @@ namespace behaviac
 		virtual EBTStatus update_impl(Agent* pAgent, EBTStatus childStatus)
 		{
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("Money") == 4260042937u);
+			BEHAVIAC_ASSERT_VARID("Money", 4260042937u);
 			int& opr1 = (int&)pAgent->GetVariable<int >(4260042937u);
 			int opr2 = 50;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("Money") == 4260042937u);
+			BEHAVIAC_ASSERT_VARID("Money", 4260042937u);
 			pAgent->SetVariable("Money", 4260042937u, (int)(opr1 - opr2));
 			return result;
 		}
@@ -2457,7 +2457,7 @@ namespace behaviac
 		{
 			EBTStatus result = BT_SUCCESS;
 			bool opr2 = true;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("House") == 3571637003u);
+			BEHAVIAC_ASSERT_VARID("House", 3571637003u);
 			pAgent->SetVariable("House", 3571637003u, opr2);
 			return result;
 		}
@@ -2476,7 +2476,7 @@ namespace behaviac
 		{
 			EBTStatus result = BT_SUCCESS;
 			bool opr2 = false;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("Contract") == 3012131995u);
+			BEHAVIAC_ASSERT_VARID("Contract", 3012131995u);
 			pAgent->SetVariable("Contract", 3012131995u, opr2);
 			return result;
 		}
@@ -2526,7 +2526,7 @@ namespace behaviac
 		virtual EBTStatus update_impl(Agent* pAgent, EBTStatus childStatus)
 		{
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("Land") == 1676779868u);
+			BEHAVIAC_ASSERT_VARID("Land", 1676779868u);
 			bool& opl = (bool&)pAgent->GetVariable<bool >(1676779868u);
 			bool opr2 = true;
 			bool op = PrivateDetails::Equal(opl, opr2);
@@ -2549,7 +2549,7 @@ namespace behaviac
 		{
 			EBTStatus result = BT_SUCCESS;
 			bool opr2 = true;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("Permit") == 3054969542u);
+			BEHAVIAC_ASSERT_VARID("Permit", 3054969542u);
 			pAgent->SetVariable("Permit", 3054969542u, opr2);
 			return result;
 		}
@@ -2941,7 +2941,7 @@ namespace behaviac
 		virtual EBTStatus update_impl(Agent* pAgent, EBTStatus childStatus)
 		{
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("Permit") == 3054969542u);
+			BEHAVIAC_ASSERT_VARID("Permit", 3054969542u);
 			bool& opl = (bool&)pAgent->GetVariable<bool >(3054969542u);
 			bool opr2 = true;
 			bool op = PrivateDetails::Equal(opl, opr2);
@@ -2964,7 +2964,7 @@ namespace behaviac
 		{
 			EBTStatus result = BT_SUCCESS;
 			bool opr2 = true;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("HouseBuilt") == 1186824470u);
+			BEHAVIAC_ASSERT_VARID("HouseBuilt", 1186824470u);
 			pAgent->SetVariable("HouseBuilt", 1186824470u, opr2);
 			return result;
 		}
@@ -3252,7 +3252,7 @@ namespace behaviac
 		virtual EBTStatus update_impl(Agent* pAgent, EBTStatus childStatus)
 		{
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("Money") == 4260042937u);
+			BEHAVIAC_ASSERT_VARID("Money", 4260042937u);
 			int& opl = (int&)pAgent->GetVariable<int >(4260042937u);
 			int opr2 = 100;
 			bool op = PrivateDetails::Greater(opl, opr2);
@@ -3274,10 +3274,10 @@ namespace behaviac
 		virtual EBTStatus update_impl(Agent* pAgent, EBTStatus childStatus)
 		{
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("Money") == 4260042937u);
+			BEHAVIAC_ASSERT_VARID("Money", 4260042937u);
 			int& opr1 = (int&)pAgent->GetVariable<int >(4260042937u);
 			int opr2 = 100;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("Money") == 4260042937u);
+			BEHAVIAC_ASSERT_VARID("Money", 4260042937u);
 			pAgent->SetVariable("Money", 4260042937u, (int)(opr1 - opr2));
 			return result;
 		}
@@ -3296,7 +3296,7 @@ namespace behaviac
 		{
 			EBTStatus result = BT_SUCCESS;
 			bool opr2 = true;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("Land") == 1676779868u);
+			BEHAVIAC_ASSERT_VARID("Land", 1676779868u);
 			pAgent->SetVariable("Land", 1676779868u, opr2);
 			return result;
 		}
@@ -3332,7 +3332,7 @@ namespace behaviac
 		virtual EBTStatus update_impl(Agent* pAgent, EBTStatus childStatus)
 		{
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("GoodCredit") == 2793604018u);
+			BEHAVIAC_ASSERT_VARID("GoodCredit", 2793604018u);
 			bool& opl = (bool&)pAgent->GetVariable<bool >(2793604018u);
 			bool opr2 = true;
 			bool op = PrivateDetails::Equal(opl, opr2);
@@ -3354,10 +3354,10 @@ namespace behaviac
 		virtual EBTStatus update_impl(Agent* pAgent, EBTStatus childStatus)
 		{
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("Money") == 4260042937u);
+			BEHAVIAC_ASSERT_VARID("Money", 4260042937u);
 			int& opr1 = (int&)pAgent->GetVariable<int >(4260042937u);
 			int opr2 = 50;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("Money") == 4260042937u);
+			BEHAVIAC_ASSERT_VARID("Money", 4260042937u);
 			pAgent->SetVariable("Money", 4260042937u, (int)(opr1 + opr2));
 			return result;
 		}
@@ -3376,7 +3376,7 @@ namespace behaviac
 		{
 			EBTStatus result = BT_SUCCESS;
 			bool opr2 = true;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("Mortgage") == 669368973u);
+			BEHAVIAC_ASSERT_VARID("Mortgage", 669368973u);
 			pAgent->SetVariable("Mortgage", 669368973u, opr2);
 			return result;
 		}
@@ -3581,10 +3581,10 @@ namespace behaviac
 		virtual EBTStatus update_impl(Agent* pAgent, EBTStatus childStatus)
 		{
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("start") == 537854745u);
+			BEHAVIAC_ASSERT_VARID("start", 537854745u);
 			int& opl_p0 = (int&)pAgent->GetVariable<int >(537854745u);
 			bool opl = ((HTNAgentTravel*)pAgent)->_Execute_Method_<METHOD_TYPE_HTNAgentTravel_exist_start, bool, int& >(opl_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("start") == 537854745u);
+			BEHAVIAC_ASSERT_VARID("start", 537854745u);
 			pAgent->SetVariable("start", 537854745u, opl_p0);
 			bool opr2 = true;
 			bool op = PrivateDetails::Equal(opl, opr2);
@@ -3607,10 +3607,10 @@ namespace behaviac
 		virtual EBTStatus update_impl(Agent* pAgent, EBTStatus childStatus)
 		{
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("finish") == 3620922618u);
+			BEHAVIAC_ASSERT_VARID("finish", 3620922618u);
 			int& opl_p0 = (int&)pAgent->GetVariable<int >(3620922618u);
 			bool opl = ((HTNAgentTravel*)pAgent)->_Execute_Method_<METHOD_TYPE_HTNAgentTravel_exist_finish, bool, int& >(opl_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("finish") == 3620922618u);
+			BEHAVIAC_ASSERT_VARID("finish", 3620922618u);
 			pAgent->SetVariable("finish", 3620922618u, opl_p0);
 			bool opr2 = true;
 			bool op = PrivateDetails::Equal(opl, opr2);
@@ -3741,9 +3741,9 @@ namespace behaviac
 		virtual EBTStatus update_impl(Agent* pAgent, EBTStatus childStatus)
 		{
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("_$local_task_param_$_0") == 2009726548u);
+			BEHAVIAC_ASSERT_VARID("_$local_task_param_$_0", 2009726548u);
 			int& opl_p0 = (int&)pAgent->GetVariable<int >(2009726548u);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("_$local_task_param_$_1") == 1859309333u);
+			BEHAVIAC_ASSERT_VARID("_$local_task_param_$_1", 1859309333u);
 			int& opl_p1 = (int&)pAgent->GetVariable<int >(1859309333u);
 			bool opl = ((HTNAgentTravel*)pAgent)->_Execute_Method_<METHOD_TYPE_HTNAgentTravel_short_distance, bool, int, int >(opl_p0, opl_p1);
 			bool opr2 = true;
@@ -3766,9 +3766,9 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("_$local_task_param_$_0") == 2009726548u);
+			BEHAVIAC_ASSERT_VARID("_$local_task_param_$_0", 2009726548u);
 			int& method_p0 = (int&)pAgent->GetVariable<int >(2009726548u);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("_$local_task_param_$_1") == 1859309333u);
+			BEHAVIAC_ASSERT_VARID("_$local_task_param_$_1", 1859309333u);
 			int& method_p1 = (int&)pAgent->GetVariable<int >(1859309333u);
 			((HTNAgentTravel*)pAgent)->_Execute_Method_<METHOD_TYPE_HTNAgentTravel_ride_taxi, void, int, int >(method_p0, method_p1);
 			return BT_SUCCESS;
@@ -3788,9 +3788,9 @@ namespace behaviac
 		virtual EBTStatus update_impl(Agent* pAgent, EBTStatus childStatus)
 		{
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("_$local_task_param_$_0") == 2009726548u);
+			BEHAVIAC_ASSERT_VARID("_$local_task_param_$_0", 2009726548u);
 			int& opl_p0 = (int&)pAgent->GetVariable<int >(2009726548u);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("_$local_task_param_$_1") == 1859309333u);
+			BEHAVIAC_ASSERT_VARID("_$local_task_param_$_1", 1859309333u);
 			int& opl_p1 = (int&)pAgent->GetVariable<int >(1859309333u);
 			bool opl = ((HTNAgentTravel*)pAgent)->_Execute_Method_<METHOD_TYPE_HTNAgentTravel_long_distance, bool, int, int >(opl_p0, opl_p1);
 			bool opr2 = true;
@@ -3943,12 +3943,12 @@ namespace behaviac
 		virtual EBTStatus update_impl(Agent* pAgent, EBTStatus childStatus)
 		{
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("_$local_task_param_$_0") == 2009726548u);
+			BEHAVIAC_ASSERT_VARID("_$local_task_param_$_0", 2009726548u);
 			int& opl_p0 = (int&)pAgent->GetVariable<int >(2009726548u);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("as") == 2746731747u);
+			BEHAVIAC_ASSERT_VARID("as", 2746731747u);
 			behaviac::vector<int>& opl_p1 = (behaviac::vector<int>&)pAgent->GetVariable<behaviac::vector<int> >(2746731747u);
 			bool opl = ((HTNAgentTravel*)pAgent)->_Execute_Method_<METHOD_TYPE_HTNAgentTravel_exist_airports, bool, int, behaviac::vector<int>& >(opl_p0, opl_p1);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("as") == 2746731747u);
+			BEHAVIAC_ASSERT_VARID("as", 2746731747u);
 			pAgent->SetVariable("as", 2746731747u, opl_p1);
 			bool opr2 = true;
 			bool op = PrivateDetails::Equal(opl, opr2);
@@ -3971,12 +3971,12 @@ namespace behaviac
 		virtual EBTStatus update_impl(Agent* pAgent, EBTStatus childStatus)
 		{
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("_$local_task_param_$_1") == 1859309333u);
+			BEHAVIAC_ASSERT_VARID("_$local_task_param_$_1", 1859309333u);
 			int& opl_p0 = (int&)pAgent->GetVariable<int >(1859309333u);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("ay") == 1498948713u);
+			BEHAVIAC_ASSERT_VARID("ay", 1498948713u);
 			int& opl_p1 = (int&)pAgent->GetVariable<int >(1498948713u);
 			bool opl = ((HTNAgentTravel*)pAgent)->_Execute_Method_<METHOD_TYPE_HTNAgentTravel_exist_airport, bool, int, int& >(opl_p0, opl_p1);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("ay") == 1498948713u);
+			BEHAVIAC_ASSERT_VARID("ay", 1498948713u);
 			pAgent->SetVariable("ay", 1498948713u, opl_p1);
 			bool opr2 = true;
 			bool op = PrivateDetails::Equal(opl, opr2);
@@ -4040,9 +4040,9 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("ax") == 1078138152u);
+			BEHAVIAC_ASSERT_VARID("ax", 1078138152u);
 			int& method_p0 = (int&)pAgent->GetVariable<int >(1078138152u);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("ay") == 1498948713u);
+			BEHAVIAC_ASSERT_VARID("ay", 1498948713u);
 			int& method_p1 = (int&)pAgent->GetVariable<int >(1498948713u);
 			((HTNAgentTravel*)pAgent)->_Execute_Method_<METHOD_TYPE_HTNAgentTravel_fly, void, int, int >(method_p0, method_p1);
 			return BT_SUCCESS;
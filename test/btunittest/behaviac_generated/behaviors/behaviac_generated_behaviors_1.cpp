@@ -1715,7 +1715,7 @@ namespace behaviac
 			EBTStatus result = BT_SUCCESS;
 			int opr1 = ((AgentNodeTest*)pAgent)->_Execute_Method_<METHOD_TYPE_AgentNodeTest_getConstThousand, int, int, int >(opr1_p0, opr1_p1);
 			int opr2 = 500;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par_int_type_0") == 4028995106u);
+			BEHAVIAC_ASSERT_VARID("par_int_type_0", 4028995106u);
 			pAgent->SetVariable("par_int_type_0", 4028995106u, (int)(opr1 + opr2));
 			return result;
 		}
@@ -1735,7 +1735,7 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par_int_type_0") == 4028995106u);
+			BEHAVIAC_ASSERT_VARID("par_int_type_0", 4028995106u);
 			int& method_p0 = (int&)pAgent->GetVariable<int >(4028995106u);
 			((AgentNodeTest*)pAgent)->_Execute_Method_<METHOD_TYPE_AgentNodeTest_setTestVar_0, void, int >(method_p0);
 			return BT_SUCCESS;
@@ -1756,7 +1756,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
 			int opr = ((AgentNodeTest*)pAgent)->_Get_Property_<PROPERTY_TYPE_AgentNodeTest_testVar_0, int >();
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par_int_type_1") == 3913197411u);
+			BEHAVIAC_ASSERT_VARID("par_int_type_1", 3913197411u);
 			pAgent->SetVariable("par_int_type_1", 3913197411u, opr);
 			return result;
 		}
@@ -1775,11 +1775,11 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par_int_type_1") == 3913197411u);
+			BEHAVIAC_ASSERT_VARID("par_int_type_1", 3913197411u);
 			int& opr1 = (int&)pAgent->GetVariable<int >(3913197411u);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par_int_type_2") == 3256087712u);
+			BEHAVIAC_ASSERT_VARID("par_int_type_2", 3256087712u);
 			int& opr2 = (int&)pAgent->GetVariable<int >(3256087712u);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par_int_type_0") == 4028995106u);
+			BEHAVIAC_ASSERT_VARID("par_int_type_0", 4028995106u);
 			pAgent->SetVariable("par_int_type_0", 4028995106u, (int)(opr1 + opr2));
 			return result;
 		}
@@ -1797,7 +1797,7 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par_int_type_0") == 4028995106u);
+			BEHAVIAC_ASSERT_VARID("par_int_type_0", 4028995106u);
 			int& method_p0 = (int&)pAgent->GetVariable<int >(4028995106u);
 			((AgentNodeTest*)pAgent)->_Execute_Method_<METHOD_TYPE_AgentNodeTest_setTestVar_1, void, int >(method_p0);
 			return BT_SUCCESS;
@@ -2118,7 +2118,7 @@ namespace behaviac
 			EBTStatus result = BT_SUCCESS;
 			float opr1 = 0.5f;
 			float opr2 = 1.3f;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par_float_type_0") == 569873069u);
+			BEHAVIAC_ASSERT_VARID("par_float_type_0", 569873069u);
 			pAgent->SetVariable("par_float_type_0", 569873069u, (float)(opr1 + opr2));
 			return result;
 		}
@@ -2136,7 +2136,7 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par_float_type_0") == 569873069u);
+			BEHAVIAC_ASSERT_VARID("par_float_type_0", 569873069u);
 			float& method_p0 = (float&)pAgent->GetVariable<float >(569873069u);
 			((AgentNodeTest*)pAgent)->_Execute_Method_<METHOD_TYPE_AgentNodeTest_setTestVar_2, void, float >(method_p0);
 			return BT_SUCCESS;
@@ -2157,7 +2157,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
 			float opr = ((AgentNodeTest*)pAgent)->_Get_Property_<PROPERTY_TYPE_AgentNodeTest_testVar_2, float >();
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par_float_type_1") == 955032556u);
+			BEHAVIAC_ASSERT_VARID("par_float_type_1", 955032556u);
 			pAgent->SetVariable("par_float_type_1", 955032556u, opr);
 			return result;
 		}
@@ -2176,11 +2176,11 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par_float_type_1") == 955032556u);
+			BEHAVIAC_ASSERT_VARID("par_float_type_1", 955032556u);
 			float& opr1 = (float&)pAgent->GetVariable<float >(955032556u);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par_float_type_2") == 331477039u);
+			BEHAVIAC_ASSERT_VARID("par_float_type_2", 331477039u);
 			float& opr2 = (float&)pAgent->GetVariable<float >(331477039u);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par_float_type_0") == 569873069u);
+			BEHAVIAC_ASSERT_VARID("par_float_type_0", 569873069u);
 			pAgent->SetVariable("par_float_type_0", 569873069u, (float)(opr1 + opr2));
 			return result;
 		}
@@ -2198,7 +2198,7 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par_float_type_0") == 569873069u);
+			BEHAVIAC_ASSERT_VARID("par_float_type_0", 569873069u);
 			float& method_p0 = (float&)pAgent->GetVariable<float >(569873069u);
 			((AgentNodeTest*)pAgent)->_Execute_Method_<METHOD_TYPE_AgentNodeTest_setTestVar_3, void, float >(method_p0);
 			return BT_SUCCESS;
@@ -2219,7 +2219,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
 			UnityEngine::GameObject* opr = ((AgentNodeTest*)pAgent)->_Execute_Method_<METHOD_TYPE_AgentNodeTest_createGameObject, UnityEngine::GameObject* >();
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par_go") == 464621558u);
+			BEHAVIAC_ASSERT_VARID("par_go", 464621558u);
 			pAgent->SetVariable("par_go", 464621558u, opr);
 			return result;
 		}
@@ -2237,7 +2237,7 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par_go") == 464621558u);
+			BEHAVIAC_ASSERT_VARID("par_go", 464621558u);
 			UnityEngine::GameObject*& method_p0 = (UnityEngine::GameObject*&)pAgent->GetVariable<UnityEngine::GameObject* >(464621558u);
 			((AgentNodeTest*)pAgent)->_Execute_Method_<METHOD_TYPE_AgentNodeTest_testGameObject, void, UnityEngine::GameObject* >(method_p0);
 			return BT_SUCCESS;
@@ -2258,7 +2258,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
 			TestNS::Node* opr = ((AgentNodeTest*)pAgent)->_Execute_Method_<METHOD_TYPE_AgentNodeTest_createExtendedNode, TestNS::Node* >();
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("local_node") == 3573395359u);
+			BEHAVIAC_ASSERT_VARID("local_node", 3573395359u);
 			pAgent->SetVariable("local_node", 3573395359u, opr);
 			return result;
 		}
@@ -2276,7 +2276,7 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("local_node") == 3573395359u);
+			BEHAVIAC_ASSERT_VARID("local_node", 3573395359u);
 			TestNS::Node*& method_p0 = (TestNS::Node*&)pAgent->GetVariable<TestNS::Node* >(3573395359u);
 			((AgentNodeTest*)pAgent)->_Execute_Method_<METHOD_TYPE_AgentNodeTest_testExtendedRefType, void, TestNS::Node* >(method_p0);
 			return BT_SUCCESS;
@@ -2295,10 +2295,10 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("testFloat2") == 2452701783u);
+			BEHAVIAC_ASSERT_VARID("testFloat2", 2452701783u);
 			TestNS::Float2& method_p0 = (TestNS::Float2&)pAgent->GetVariable<TestNS::Float2 >(2452701783u);
 			((AgentNodeTest*)pAgent)->_Execute_Method_<METHOD_TYPE_AgentNodeTest_testExtendedStruct, void, TestNS::Float2& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("testFloat2") == 2452701783u);
+			BEHAVIAC_ASSERT_VARID("testFloat2", 2452701783u);
 			pAgent->SetVariable("testFloat2", 2452701783u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -2318,7 +2318,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
 			TestNS::Float2& opr = ((AgentNodeTest*)pAgent)->_Execute_Method_<METHOD_TYPE_AgentNodeTest_getExtendedStruct, TestNS::Float2& >();
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("c_ReturnFloat2") == 257770974u);
+			BEHAVIAC_ASSERT_VARID("c_ReturnFloat2", 257770974u);
 			pAgent->SetVariable("c_ReturnFloat2", 257770974u, opr);
 			return result;
 		}
@@ -2338,7 +2338,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
 			const TestNS::Float2& opr = ((AgentNodeTest*)pAgent)->_Execute_Method_<METHOD_TYPE_AgentNodeTest_getConstExtendedStruct, const TestNS::Float2& >();
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("c_ReturnFloat2Const") == 2482280992u);
+			BEHAVIAC_ASSERT_VARID("c_ReturnFloat2Const", 2482280992u);
 			pAgent->SetVariable("c_ReturnFloat2Const", 2482280992u, opr);
 			return result;
 		}
@@ -2563,7 +2563,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
 			int opr = 1;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par_int_type_0") == 4028995106u);
+			BEHAVIAC_ASSERT_VARID("par_int_type_0", 4028995106u);
 			pAgent->SetVariable("par_int_type_0", 4028995106u, opr);
 			return result;
 		}
@@ -2583,8 +2583,8 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
 			int opr = 5;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("test_int_array") == 4065205216u);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par_int_type_0") == 4028995106u);
+			BEHAVIAC_ASSERT_VARID("test_int_array", 4065205216u);
+			BEHAVIAC_ASSERT_VARID("par_int_type_0", 4028995106u);
 			int& opl_index = (int&)pAgent->GetVariable<int >(4028995106u);
 			((behaviac::vector<int>&)pAgent->GetVariable<behaviac::vector<int> >(4065205216u))[opl_index] = opr;
 			return result;
@@ -2603,8 +2603,8 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("test_int_array") == 4065205216u);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par_int_type_0") == 4028995106u);
+			BEHAVIAC_ASSERT_VARID("test_int_array", 4065205216u);
+			BEHAVIAC_ASSERT_VARID("par_int_type_0", 4028995106u);
 			int& opl_index = (int&)pAgent->GetVariable<int >(4028995106u);
 			int& opl = ((behaviac::vector<int>&)pAgent->GetVariable<behaviac::vector<int> >(4065205216u))[opl_index];
 			int opr = 5;
@@ -2625,8 +2625,8 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("test_int_array") == 4065205216u);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par_int_type_0") == 4028995106u);
+			BEHAVIAC_ASSERT_VARID("test_int_array", 4065205216u);
+			BEHAVIAC_ASSERT_VARID("par_int_type_0", 4028995106u);
 			int& method_p0_index = (int&)pAgent->GetVariable<int >(4028995106u);
 			((AgentNodeTest*)pAgent)->_Execute_Method_<METHOD_TYPE_AgentNodeTest_setTestVar_0, void, int >(((behaviac::vector<int>&)pAgent->GetVariable<behaviac::vector<int> >(4065205216u))[method_p0_index]);
 			return BT_SUCCESS;
@@ -2667,7 +2667,7 @@ namespace behaviac
 			EBTStatus result = BT_SUCCESS;
 			int opr1 = 1000;
 			int opr2 = 500;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par_int_type_0") == 4028995106u);
+			BEHAVIAC_ASSERT_VARID("par_int_type_0", 4028995106u);
 			pAgent->SetVariable("par_int_type_0", 4028995106u, (int)(opr1 * opr2));
 			return result;
 		}
@@ -2685,7 +2685,7 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par_int_type_0") == 4028995106u);
+			BEHAVIAC_ASSERT_VARID("par_int_type_0", 4028995106u);
 			int& method_p0 = (int&)pAgent->GetVariable<int >(4028995106u);
 			((AgentNodeTest*)pAgent)->_Execute_Method_<METHOD_TYPE_AgentNodeTest_setTestVar_0, void, int >(method_p0);
 			return BT_SUCCESS;
@@ -2706,7 +2706,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
 			int opr = ((AgentNodeTest*)pAgent)->_Get_Property_<PROPERTY_TYPE_AgentNodeTest_testVar_0, int >();
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par_int_type_1") == 3913197411u);
+			BEHAVIAC_ASSERT_VARID("par_int_type_1", 3913197411u);
 			pAgent->SetVariable("par_int_type_1", 3913197411u, opr);
 			return result;
 		}
@@ -2725,11 +2725,11 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par_int_type_1") == 3913197411u);
+			BEHAVIAC_ASSERT_VARID("par_int_type_1", 3913197411u);
 			int& opr1 = (int&)pAgent->GetVariable<int >(3913197411u);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par_int_type_2") == 3256087712u);
+			BEHAVIAC_ASSERT_VARID("par_int_type_2", 3256087712u);
 			int& opr2 = (int&)pAgent->GetVariable<int >(3256087712u);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par_int_type_0") == 4028995106u);
+			BEHAVIAC_ASSERT_VARID("par_int_type_0", 4028995106u);
 			pAgent->SetVariable("par_int_type_0", 4028995106u, (int)(opr1 / opr2));
 			return result;
 		}
@@ -2747,7 +2747,7 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par_int_type_0") == 4028995106u);
+			BEHAVIAC_ASSERT_VARID("par_int_type_0", 4028995106u);
 			int& method_p0 = (int&)pAgent->GetVariable<int >(4028995106u);
 			((AgentNodeTest*)pAgent)->_Execute_Method_<METHOD_TYPE_AgentNodeTest_setTestVar_1, void, int >(method_p0);
 			return BT_SUCCESS;
@@ -2945,7 +2945,7 @@ namespace behaviac
 			int opr = ((AgentNodeTest*)pAgent)->_Get_Property_<PROPERTY_TYPE_AgentNodeTest_testVar_0, int >();
 			Agent* pAgent_opl = Agent::GetInstance(pAgent, "par_child_agent_1");
 			BEHAVIAC_ASSERT(pAgent_opl);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("testInt") == 2614050066u);
+			BEHAVIAC_ASSERT_VARID("testInt", 2614050066u);
 			pAgent_opl->SetVariable("testInt", 2614050066u, opr);
 			return result;
 		}
@@ -2965,7 +2965,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			Agent* pAgent_opl = Agent::GetInstance(pAgent, "par_child_agent_1");
 			BEHAVIAC_ASSERT(pAgent_opl);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("testInt") == 2614050066u);
+			BEHAVIAC_ASSERT_VARID("testInt", 2614050066u);
 			int& opl = (int&)pAgent_opl->GetVariable<int >(2614050066u);
 			int& opr = ((AgentNodeTest*)pAgent)->_Get_Property_<PROPERTY_TYPE_AgentNodeTest_testVar_0, int >();
 			bool op = PrivateDetails::Equal(opl, opr);
@@ -2988,7 +2988,7 @@ namespace behaviac
 			EBTStatus result = BT_SUCCESS;
 			float opr1 = 0.5f;
 			float opr2 = 4.8f;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par_float_type_0") == 569873069u);
+			BEHAVIAC_ASSERT_VARID("par_float_type_0", 569873069u);
 			pAgent->SetVariable("par_float_type_0", 569873069u, (float)(opr1 * opr2));
 			return result;
 		}
@@ -3006,7 +3006,7 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par_float_type_0") == 569873069u);
+			BEHAVIAC_ASSERT_VARID("par_float_type_0", 569873069u);
 			float& method_p0 = (float&)pAgent->GetVariable<float >(569873069u);
 			((AgentNodeTest*)pAgent)->_Execute_Method_<METHOD_TYPE_AgentNodeTest_setTestVar_2, void, float >(method_p0);
 			return BT_SUCCESS;
@@ -3027,7 +3027,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
 			float opr = ((AgentNodeTest*)pAgent)->_Get_Property_<PROPERTY_TYPE_AgentNodeTest_testVar_2, float >();
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par_float_type_1") == 955032556u);
+			BEHAVIAC_ASSERT_VARID("par_float_type_1", 955032556u);
 			pAgent->SetVariable("par_float_type_1", 955032556u, opr);
 			return result;
 		}
@@ -3046,11 +3046,11 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par_float_type_1") == 955032556u);
+			BEHAVIAC_ASSERT_VARID("par_float_type_1", 955032556u);
 			float& opr1 = (float&)pAgent->GetVariable<float >(955032556u);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par_float_type_2") == 331477039u);
+			BEHAVIAC_ASSERT_VARID("par_float_type_2", 331477039u);
 			float& opr2 = (float&)pAgent->GetVariable<float >(331477039u);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par_float_type_0") == 569873069u);
+			BEHAVIAC_ASSERT_VARID("par_float_type_0", 569873069u);
 			pAgent->SetVariable("par_float_type_0", 569873069u, (float)(opr1 / opr2));
 			return result;
 		}
@@ -3068,7 +3068,7 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par_float_type_0") == 569873069u);
+			BEHAVIAC_ASSERT_VARID("par_float_type_0", 569873069u);
 			float& method_p0 = (float&)pAgent->GetVariable<float >(569873069u);
 			((AgentNodeTest*)pAgent)->_Execute_Method_<METHOD_TYPE_AgentNodeTest_setTestVar_3, void, float >(method_p0);
 			return BT_SUCCESS;
@@ -3087,9 +3087,9 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("redirectCount") == 767249388u);
+			BEHAVIAC_ASSERT_VARID("redirectCount", 767249388u);
 			unsigned int& opl = (unsigned int&)pAgent->GetVariable<unsigned int >(767249388u);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("redirectTime") == 3775965105u);
+			BEHAVIAC_ASSERT_VARID("redirectTime", 3775965105u);
 			unsigned int& opr = (unsigned int&)pAgent->GetVariable<unsigned int >(3775965105u);
 			bool op = PrivateDetails::GreaterEqual(opl, opr);
 			return op ? BT_SUCCESS : BT_FAILURE;
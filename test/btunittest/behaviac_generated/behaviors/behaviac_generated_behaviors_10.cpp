@@ -917,7 +917,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			behaviac::Agent* method_p0 = ((EmployeeParTestAgent*)pAgent)->_Get_Property_<PROPERTY_TYPE_EmployeeParTestAgent_TV_AGENT_0, behaviac::Agent* >();
 			((EmployeeParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_EmployeeParTestAgent_Func_AgentRef, void, behaviac::Agent*& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("TV_AGENT_0") == 2234467067u);
+			BEHAVIAC_ASSERT_VARID("TV_AGENT_0", 2234467067u);
 			pAgent->SetVariable("TV_AGENT_0", 2234467067u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -937,7 +937,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			behaviac::vector<behaviac::Agent*> method_p0 = ((EmployeeParTestAgent*)pAgent)->_Get_Property_<PROPERTY_TYPE_EmployeeParTestAgent_TV_LIST_AGENT_0, behaviac::vector<behaviac::Agent*> >();
 			((EmployeeParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_EmployeeParTestAgent_Func_AgentListRef, void, behaviac::vector<behaviac::Agent*>& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("TV_LIST_AGENT_0") == 350152458u);
+			BEHAVIAC_ASSERT_VARID("TV_LIST_AGENT_0", 350152458u);
 			pAgent->SetVariable("TV_LIST_AGENT_0", 350152458u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -957,7 +957,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			double method_p0 = ((EmployeeParTestAgent*)pAgent)->_Get_Property_<PROPERTY_TYPE_EmployeeParTestAgent_TV_D_0, double >();
 			((EmployeeParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_EmployeeParTestAgent_Func_DoubleRef, void, double& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("TV_D_0") == 2418961396u);
+			BEHAVIAC_ASSERT_VARID("TV_D_0", 2418961396u);
 			pAgent->SetVariable("TV_D_0", 2418961396u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -977,7 +977,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			float method_p0 = ((EmployeeParTestAgent*)pAgent)->_Get_Property_<PROPERTY_TYPE_EmployeeParTestAgent_TV_F_0, float >();
 			((EmployeeParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_EmployeeParTestAgent_Func_SingleRef, void, float& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("TV_F_0") == 975676287u);
+			BEHAVIAC_ASSERT_VARID("TV_F_0", 975676287u);
 			pAgent->SetVariable("TV_F_0", 975676287u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -997,7 +997,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			behaviac::vector<float> method_p0 = ((EmployeeParTestAgent*)pAgent)->_Get_Property_<PROPERTY_TYPE_EmployeeParTestAgent_TV_LIST_F_0, behaviac::vector<float> >();
 			((EmployeeParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_EmployeeParTestAgent_Func_SingleListRef, void, behaviac::vector<float>& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("TV_LIST_F_0") == 3277708114u);
+			BEHAVIAC_ASSERT_VARID("TV_LIST_F_0", 3277708114u);
 			pAgent->SetVariable("TV_LIST_F_0", 3277708114u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -1017,7 +1017,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			behaviac::string method_p0 = ((EmployeeParTestAgent*)pAgent)->_Get_Property_<PROPERTY_TYPE_EmployeeParTestAgent_TV_STR_0, behaviac::string >();
 			((EmployeeParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_EmployeeParTestAgent_Func_StringRef, void, behaviac::string& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("TV_STR_0") == 3765213955u);
+			BEHAVIAC_ASSERT_VARID("TV_STR_0", 3765213955u);
 			pAgent->SetVariable("TV_STR_0", 3765213955u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -1039,7 +1039,7 @@ namespace behaviac
 			BEHAVIAC_ASSERT(pAgent_method_p0);
 			behaviac::string method_p0 = ((ParTestRegNameAgent*)pAgent_method_p0)->_Get_Property_<PROPERTY_TYPE_ParTestRegNameAgent_TV_STR_0, behaviac::string >();
 			((EmployeeParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_EmployeeParTestAgent_Func_StringRef, void, behaviac::string& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("TV_STR_0") == 3765213955u);
+			BEHAVIAC_ASSERT_VARID("TV_STR_0", 3765213955u);
 			pAgent_method_p0->SetVariable("TV_STR_0", 3765213955u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -1059,7 +1059,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			behaviac::vector<behaviac::string> method_p0 = ((EmployeeParTestAgent*)pAgent)->_Get_Property_<PROPERTY_TYPE_EmployeeParTestAgent_TV_LIST_STR_0, behaviac::vector<behaviac::string> >();
 			((EmployeeParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_EmployeeParTestAgent_Func_StringListRef, void, behaviac::vector<behaviac::string>& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("TV_LIST_STR_0") == 3861554756u);
+			BEHAVIAC_ASSERT_VARID("TV_LIST_STR_0", 3861554756u);
 			pAgent->SetVariable("TV_LIST_STR_0", 3861554756u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -1079,7 +1079,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			unsigned int method_p0 = ((EmployeeParTestAgent*)pAgent)->_Get_Property_<PROPERTY_TYPE_EmployeeParTestAgent_TV_UINT_0, unsigned int >();
 			((EmployeeParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_EmployeeParTestAgent_Func_UIntRef, void, unsigned int& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("TV_UINT_0") == 447245470u);
+			BEHAVIAC_ASSERT_VARID("TV_UINT_0", 447245470u);
 			pAgent->SetVariable("TV_UINT_0", 447245470u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -1099,7 +1099,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			unsigned long method_p0 = ((EmployeeParTestAgent*)pAgent)->_Get_Property_<PROPERTY_TYPE_EmployeeParTestAgent_TV_ULONG_0, unsigned long >();
 			((EmployeeParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_EmployeeParTestAgent_Func_ULongRef, void, unsigned long& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("TV_ULONG_0") == 2632905415u);
+			BEHAVIAC_ASSERT_VARID("TV_ULONG_0", 2632905415u);
 			pAgent->SetVariable("TV_ULONG_0", 2632905415u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -1119,7 +1119,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			long long method_p0 = ((EmployeeParTestAgent*)pAgent)->_Get_Property_<PROPERTY_TYPE_EmployeeParTestAgent_TV_LL_0, long long >();
 			((EmployeeParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_EmployeeParTestAgent_Func_LongLongRef, void, long long& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("TV_LL_0") == 2624529173u);
+			BEHAVIAC_ASSERT_VARID("TV_LL_0", 2624529173u);
 			pAgent->SetVariable("TV_LL_0", 2624529173u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -1139,7 +1139,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			unsigned long long method_p0 = ((EmployeeParTestAgent*)pAgent)->_Get_Property_<PROPERTY_TYPE_EmployeeParTestAgent_TV_ULL_0, unsigned long long >();
 			((EmployeeParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_EmployeeParTestAgent_Func_ULongLongRef, void, unsigned long long& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("TV_ULL_0") == 3596846321u);
+			BEHAVIAC_ASSERT_VARID("TV_ULL_0", 3596846321u);
 			pAgent->SetVariable("TV_ULL_0", 3596846321u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -1159,7 +1159,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			short method_p0 = ((ParTestAgent*)pAgent)->_Get_Property_<PROPERTY_TYPE_ParTestAgent_TV_SHORT_0, short >();
 			((ParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgent_Func_ShortRef, void, short& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("TV_SHORT_0") == 1232231841u);
+			BEHAVIAC_ASSERT_VARID("TV_SHORT_0", 1232231841u);
 			pAgent->SetVariable("TV_SHORT_0", 1232231841u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -1179,7 +1179,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			int method_p0 = ((ParTestAgent*)pAgent)->_Get_Property_<PROPERTY_TYPE_ParTestAgent_TV_INT_0, int >();
 			((ParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgent_Func_IntRef, void, int& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("TV_INT_0") == 1293576705u);
+			BEHAVIAC_ASSERT_VARID("TV_INT_0", 1293576705u);
 			pAgent->SetVariable("TV_INT_0", 1293576705u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -1199,7 +1199,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			behaviac::vector<int> method_p0 = ((ParTestAgent*)pAgent)->_Get_Property_<PROPERTY_TYPE_ParTestAgent_TV_LIST_INT_0, behaviac::vector<int> >();
 			((ParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgent_Func_IntListRef, void, behaviac::vector<int>& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("TV_LIST_INT_0") == 1264342854u);
+			BEHAVIAC_ASSERT_VARID("TV_LIST_INT_0", 1264342854u);
 			pAgent->SetVariable("TV_LIST_INT_0", 1264342854u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -1219,7 +1219,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			long method_p0 = ((ParTestAgent*)pAgent)->_Get_Property_<PROPERTY_TYPE_ParTestAgent_TV_LONG_0, long >();
 			((ParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgent_Func_LongRef, void, long& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("TV_LONG_0") == 2082189039u);
+			BEHAVIAC_ASSERT_VARID("TV_LONG_0", 2082189039u);
 			pAgent->SetVariable("TV_LONG_0", 2082189039u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -1239,7 +1239,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			TNS::ST::PER::WRK::kEmployee method_p0 = ((ParTestAgent*)pAgent)->_Get_Property_<PROPERTY_TYPE_ParTestAgent_TV_KEMPLOYEE_0, TNS::ST::PER::WRK::kEmployee >();
 			((ParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgent_Func_kEmployeeRef, void, TNS::ST::PER::WRK::kEmployee& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("TV_KEMPLOYEE_0") == 2788553297u);
+			BEHAVIAC_ASSERT_VARID("TV_KEMPLOYEE_0", 2788553297u);
 			pAgent->SetVariable("TV_KEMPLOYEE_0", 2788553297u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -1259,7 +1259,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			behaviac::vector<TNS::ST::PER::WRK::kEmployee> method_p0 = ((ParTestAgent*)pAgent)->_Get_Property_<PROPERTY_TYPE_ParTestAgent_TV_LIST_KEMPLOYEE_0, behaviac::vector<TNS::ST::PER::WRK::kEmployee> >();
 			((ParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgent_Func_kEmployeeListRef, void, behaviac::vector<TNS::ST::PER::WRK::kEmployee>& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("TV_LIST_KEMPLOYEE_0") == 1712688287u);
+			BEHAVIAC_ASSERT_VARID("TV_LIST_KEMPLOYEE_0", 1712688287u);
 			pAgent->SetVariable("TV_LIST_KEMPLOYEE_0", 1712688287u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -1279,7 +1279,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			unsigned short method_p0 = ((ParTestAgent*)pAgent)->_Get_Property_<PROPERTY_TYPE_ParTestAgent_TV_USHORT_0, unsigned short >();
 			((ParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgent_Func_UShortRef, void, unsigned short& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("TV_USHORT_0") == 537748306u);
+			BEHAVIAC_ASSERT_VARID("TV_USHORT_0", 537748306u);
 			pAgent->SetVariable("TV_USHORT_0", 537748306u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -1299,7 +1299,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			bool method_p0 = ((ParTestAgentBase*)pAgent)->_Get_Property_<PROPERTY_TYPE_ParTestAgentBase_TV_BOOL_0, bool >();
 			((ParTestAgentBase*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgentBase_Func_BooleanRef, void, bool& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("TV_BOOL_0") == 3326442243u);
+			BEHAVIAC_ASSERT_VARID("TV_BOOL_0", 3326442243u);
 			pAgent->SetVariable("TV_BOOL_0", 3326442243u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -1319,7 +1319,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			behaviac::vector<bool> method_p0 = ((ParTestAgentBase*)pAgent)->_Get_Property_<PROPERTY_TYPE_ParTestAgentBase_TV_LIST_BOOL_0, behaviac::vector<bool> >();
 			((ParTestAgentBase*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgentBase_Func_BooleanListRef, void, behaviac::vector<bool>& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("TV_LIST_BOOL_0") == 3454568683u);
+			BEHAVIAC_ASSERT_VARID("TV_LIST_BOOL_0", 3454568683u);
 			pAgent->SetVariable("TV_LIST_BOOL_0", 3454568683u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -1339,7 +1339,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			unsigned char method_p0 = ((ParTestAgentBase*)pAgent)->_Get_Property_<PROPERTY_TYPE_ParTestAgentBase_TV_BYTE_0, unsigned char >();
 			((ParTestAgentBase*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgentBase_Func_ByteRef, void, unsigned char& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("TV_BYTE_0") == 2045932444u);
+			BEHAVIAC_ASSERT_VARID("TV_BYTE_0", 2045932444u);
 			pAgent->SetVariable("TV_BYTE_0", 2045932444u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -1359,7 +1359,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			behaviac::vector<unsigned char> method_p0 = ((ParTestAgentBase*)pAgent)->_Get_Property_<PROPERTY_TYPE_ParTestAgentBase_TV_LIST_BYTE_0, behaviac::vector<unsigned char> >();
 			((ParTestAgentBase*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgentBase_Func_ByteListRef, void, behaviac::vector<unsigned char>& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("TV_LIST_BYTE_0") == 1918861428u);
+			BEHAVIAC_ASSERT_VARID("TV_LIST_BYTE_0", 1918861428u);
 			pAgent->SetVariable("TV_LIST_BYTE_0", 1918861428u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -1379,7 +1379,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			char method_p0 = ((ParTestAgentBase*)pAgent)->_Get_Property_<PROPERTY_TYPE_ParTestAgentBase_TV_CHAR_0, char >();
 			((ParTestAgentBase*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgentBase_Func_CharRef, void, char& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("TV_CHAR_0") == 1925308098u);
+			BEHAVIAC_ASSERT_VARID("TV_CHAR_0", 1925308098u);
 			pAgent->SetVariable("TV_CHAR_0", 1925308098u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -1399,7 +1399,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			behaviac::vector<char> method_p0 = ((ParTestAgentBase*)pAgent)->_Get_Property_<PROPERTY_TYPE_ParTestAgentBase_TV_LIST_CHAR_0, behaviac::vector<char> >();
 			((ParTestAgentBase*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgentBase_Func_CharListRef, void, behaviac::vector<char>& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("TV_LIST_CHAR_0") == 2037132586u);
+			BEHAVIAC_ASSERT_VARID("TV_LIST_CHAR_0", 2037132586u);
 			pAgent->SetVariable("TV_LIST_CHAR_0", 2037132586u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -1419,7 +1419,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			TNS::NE::NAT::eColor method_p0 = ((ParTestAgentBase*)pAgent)->_Get_Property_<PROPERTY_TYPE_ParTestAgentBase_TV_ECOLOR_0, TNS::NE::NAT::eColor >();
 			((ParTestAgentBase*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgentBase_Func_eColorRef, void, TNS::NE::NAT::eColor& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("TV_ECOLOR_0") == 241062087u);
+			BEHAVIAC_ASSERT_VARID("TV_ECOLOR_0", 241062087u);
 			pAgent->SetVariable("TV_ECOLOR_0", 241062087u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -1439,7 +1439,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			behaviac::vector<TNS::NE::NAT::eColor> method_p0 = ((ParTestAgentBase*)pAgent)->_Get_Property_<PROPERTY_TYPE_ParTestAgentBase_TV_LIST_ECOLOR_0, behaviac::vector<TNS::NE::NAT::eColor> >();
 			((ParTestAgentBase*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgentBase_Func_eColorListRef, void, behaviac::vector<TNS::NE::NAT::eColor>& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("TV_LIST_ECOLOR_0") == 862412353u);
+			BEHAVIAC_ASSERT_VARID("TV_LIST_ECOLOR_0", 862412353u);
 			pAgent->SetVariable("TV_LIST_ECOLOR_0", 862412353u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -1459,7 +1459,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			signed char method_p0 = ((ParTestAgentBase*)pAgent)->_Get_Property_<PROPERTY_TYPE_ParTestAgentBase_TV_SBYTE_0, signed char >();
 			((ParTestAgentBase*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgentBase_Func_SByteRef, void, signed char& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("TV_SBYTE_0") == 1600661043u);
+			BEHAVIAC_ASSERT_VARID("TV_SBYTE_0", 1600661043u);
 			pAgent->SetVariable("TV_SBYTE_0", 1600661043u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -1479,7 +1479,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			behaviac::vector<signed char> method_p0 = ((ParTestAgentBase*)pAgent)->_Get_Property_<PROPERTY_TYPE_ParTestAgentBase_TV_LIST_SBYTE_0, behaviac::vector<signed char> >();
 			((ParTestAgentBase*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgentBase_Func_SByteListRef, void, behaviac::vector<signed char>& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("TV_LIST_SBYTE_0") == 3466167234u);
+			BEHAVIAC_ASSERT_VARID("TV_LIST_SBYTE_0", 3466167234u);
 			pAgent->SetVariable("TV_LIST_SBYTE_0", 3466167234u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -1906,10 +1906,10 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("c_Int") == 3849503314u);
+			BEHAVIAC_ASSERT_VARID("c_Int", 3849503314u);
 			int& method_p0 = (int&)pAgent->GetVariable<int >(3849503314u);
 			((PropertyReadonlyAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_PropertyReadonlyAgent_FnWithOutParam, void, int& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("c_Int") == 3849503314u);
+			BEHAVIAC_ASSERT_VARID("c_Int", 3849503314u);
 			pAgent->SetVariable("c_Int", 3849503314u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -1930,7 +1930,7 @@ namespace behaviac
 			EBTStatus result = BT_SUCCESS;
 			int opr1 = ((PropertyReadonlyAgent*)pAgent)->_Get_Property_<PROPERTY_TYPE_PropertyReadonlyAgent_MemberReadonly, int >();
 			int opr2 = ((PropertyReadonlyAgent*)pAgent)->_Get_Property_<PROPERTY_TYPE_PropertyReadonlyAgent_PropertyGetterOnly, int >();
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("c_ResultStatic") == 450204216u);
+			BEHAVIAC_ASSERT_VARID("c_ResultStatic", 450204216u);
 			pAgent->SetVariable("c_ResultStatic", 450204216u, (int)(opr1 + opr2));
 			return result;
 		}
@@ -3381,7 +3381,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			TNS::NE::NAT::eColor method_p0 = ((ParTestAgentBase*)pAgent)->_Get_Property_<PROPERTY_TYPE_ParTestAgentBase_STV_ECOLOR_0, TNS::NE::NAT::eColor >();
 			((ParTestAgentBase*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgentBase_Func_eColorRef, void, TNS::NE::NAT::eColor& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("STV_ECOLOR_0") == 1356537398u);
+			BEHAVIAC_ASSERT_VARID("STV_ECOLOR_0", 1356537398u);
 			pAgent->SetVariable("STV_ECOLOR_0", 1356537398u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -3401,7 +3401,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			bool method_p0 = ((ParTestAgentBase*)pAgent)->_Get_Property_<PROPERTY_TYPE_ParTestAgentBase_STV_BOOL_0, bool >();
 			((ParTestAgentBase*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgentBase_Func_BooleanRef, void, bool& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("STV_BOOL_0") == 907888646u);
+			BEHAVIAC_ASSERT_VARID("STV_BOOL_0", 907888646u);
 			pAgent->SetVariable("STV_BOOL_0", 907888646u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -3421,7 +3421,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			char method_p0 = ((ParTestAgentBase*)pAgent)->_Get_Property_<PROPERTY_TYPE_ParTestAgentBase_STV_CHAR_0, char >();
 			((ParTestAgentBase*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgentBase_Func_CharRef, void, char& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("STV_CHAR_0") == 2191125959u);
+			BEHAVIAC_ASSERT_VARID("STV_CHAR_0", 2191125959u);
 			pAgent->SetVariable("STV_CHAR_0", 2191125959u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -3441,7 +3441,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			behaviac::vector<TNS::NE::NAT::eColor> method_p0 = ((ParTestAgentBase*)pAgent)->_Get_Property_<PROPERTY_TYPE_ParTestAgentBase_STV_LIST_ECOLOR_0, behaviac::vector<TNS::NE::NAT::eColor> >();
 			((ParTestAgentBase*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgentBase_Func_eColorListRef, void, behaviac::vector<TNS::NE::NAT::eColor>& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("STV_LIST_ECOLOR_0") == 2487001405u);
+			BEHAVIAC_ASSERT_VARID("STV_LIST_ECOLOR_0", 2487001405u);
 			pAgent->SetVariable("STV_LIST_ECOLOR_0", 2487001405u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -3461,7 +3461,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			behaviac::vector<bool> method_p0 = ((ParTestAgentBase*)pAgent)->_Get_Property_<PROPERTY_TYPE_ParTestAgentBase_STV_LIST_BOOL_0, behaviac::vector<bool> >();
 			((ParTestAgentBase*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgentBase_Func_BooleanListRef, void, behaviac::vector<bool>& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("STV_LIST_BOOL_0") == 1612090457u);
+			BEHAVIAC_ASSERT_VARID("STV_LIST_BOOL_0", 1612090457u);
 			pAgent->SetVariable("STV_LIST_BOOL_0", 1612090457u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -3481,7 +3481,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			behaviac::vector<char> method_p0 = ((ParTestAgentBase*)pAgent)->_Get_Property_<PROPERTY_TYPE_ParTestAgentBase_STV_LIST_CHAR_0, behaviac::vector<char> >();
 			((ParTestAgentBase*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgentBase_Func_CharListRef, void, behaviac::vector<char>& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("STV_LIST_CHAR_0") == 3566348696u);
+			BEHAVIAC_ASSERT_VARID("STV_LIST_CHAR_0", 3566348696u);
 			pAgent->SetVariable("STV_LIST_CHAR_0", 3566348696u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -3501,7 +3501,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			behaviac::vector<signed char> method_p0 = ((ParTestAgentBase*)pAgent)->_Get_Property_<PROPERTY_TYPE_ParTestAgentBase_STV_LIST_SBYTE_0, behaviac::vector<signed char> >();
 			((ParTestAgentBase*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgentBase_Func_SByteListRef, void, behaviac::vector<signed char>& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("STV_LIST_SBYTE_0") == 2135462866u);
+			BEHAVIAC_ASSERT_VARID("STV_LIST_SBYTE_0", 2135462866u);
 			pAgent->SetVariable("STV_LIST_SBYTE_0", 2135462866u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -3521,7 +3521,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			int method_p0 = ((ParTestAgent*)pAgent)->_Get_Property_<PROPERTY_TYPE_ParTestAgent_STV_INT_0, int >();
 			((ParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgent_Func_IntRef, void, int& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("STV_INT_0") == 1841109764u);
+			BEHAVIAC_ASSERT_VARID("STV_INT_0", 1841109764u);
 			pAgent->SetVariable("STV_INT_0", 1841109764u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -3541,7 +3541,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			TNS::ST::PER::WRK::kEmployee method_p0 = ((ParTestAgent*)pAgent)->_Get_Property_<PROPERTY_TYPE_ParTestAgent_STV_KEMPLOYEE_0, TNS::ST::PER::WRK::kEmployee >();
 			((ParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgent_Func_kEmployeeRef, void, TNS::ST::PER::WRK::kEmployee& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("STV_KEMPLOYEE_0") == 197916387u);
+			BEHAVIAC_ASSERT_VARID("STV_KEMPLOYEE_0", 197916387u);
 			pAgent->SetVariable("STV_KEMPLOYEE_0", 197916387u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -3561,7 +3561,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			behaviac::vector<int> method_p0 = ((ParTestAgent*)pAgent)->_Get_Property_<PROPERTY_TYPE_ParTestAgent_STV_LIST_INT_0, behaviac::vector<int> >();
 			((ParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgent_Func_IntListRef, void, behaviac::vector<int>& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("STV_LIST_INT_0") == 1272574615u);
+			BEHAVIAC_ASSERT_VARID("STV_LIST_INT_0", 1272574615u);
 			pAgent->SetVariable("STV_LIST_INT_0", 1272574615u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -3581,7 +3581,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			behaviac::vector<TNS::ST::PER::WRK::kEmployee> method_p0 = ((ParTestAgent*)pAgent)->_Get_Property_<PROPERTY_TYPE_ParTestAgent_STV_LIST_KEMPLOYEE_0, behaviac::vector<TNS::ST::PER::WRK::kEmployee> >();
 			((ParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgent_Func_kEmployeeListRef, void, behaviac::vector<TNS::ST::PER::WRK::kEmployee>& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("STV_LIST_KEMPLOYEE_0") == 1924897476u);
+			BEHAVIAC_ASSERT_VARID("STV_LIST_KEMPLOYEE_0", 1924897476u);
 			pAgent->SetVariable("STV_LIST_KEMPLOYEE_0", 1924897476u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -3601,7 +3601,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			float method_p0 = ((EmployeeParTestAgent*)pAgent)->_Get_Property_<PROPERTY_TYPE_EmployeeParTestAgent_STV_F_0, float >();
 			((EmployeeParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_EmployeeParTestAgent_Func_SingleRef, void, float& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("STV_F_0") == 1858562011u);
+			BEHAVIAC_ASSERT_VARID("STV_F_0", 1858562011u);
 			pAgent->SetVariable("STV_F_0", 1858562011u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -3621,7 +3621,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			behaviac::string method_p0 = ((EmployeeParTestAgent*)pAgent)->_Get_Property_<PROPERTY_TYPE_EmployeeParTestAgent_STV_STR_0, behaviac::string >();
 			((EmployeeParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_EmployeeParTestAgent_Func_StringRef, void, behaviac::string& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("STV_STR_0") == 3234589190u);
+			BEHAVIAC_ASSERT_VARID("STV_STR_0", 3234589190u);
 			pAgent->SetVariable("STV_STR_0", 3234589190u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -3641,7 +3641,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			behaviac::Agent* method_p0 = ((EmployeeParTestAgent*)pAgent)->_Get_Property_<PROPERTY_TYPE_EmployeeParTestAgent_STV_AGENT_0, behaviac::Agent* >();
 			((EmployeeParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_EmployeeParTestAgent_Func_AgentRef, void, behaviac::Agent*& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("STV_AGENT_0") == 2845805842u);
+			BEHAVIAC_ASSERT_VARID("STV_AGENT_0", 2845805842u);
 			pAgent->SetVariable("STV_AGENT_0", 2845805842u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -3661,7 +3661,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			behaviac::vector<float> method_p0 = ((EmployeeParTestAgent*)pAgent)->_Get_Property_<PROPERTY_TYPE_EmployeeParTestAgent_STV_LIST_F_0, behaviac::vector<float> >();
 			((EmployeeParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_EmployeeParTestAgent_Func_SingleListRef, void, behaviac::vector<float>& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("STV_LIST_F_0") == 2648216995u);
+			BEHAVIAC_ASSERT_VARID("STV_LIST_F_0", 2648216995u);
 			pAgent->SetVariable("STV_LIST_F_0", 2648216995u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -3681,7 +3681,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			behaviac::vector<behaviac::string> method_p0 = ((EmployeeParTestAgent*)pAgent)->_Get_Property_<PROPERTY_TYPE_EmployeeParTestAgent_STV_LIST_STR_0, behaviac::vector<behaviac::string> >();
 			((EmployeeParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_EmployeeParTestAgent_Func_StringListRef, void, behaviac::vector<behaviac::string>& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("STV_LIST_STR_0") == 3870229397u);
+			BEHAVIAC_ASSERT_VARID("STV_LIST_STR_0", 3870229397u);
 			pAgent->SetVariable("STV_LIST_STR_0", 3870229397u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -3701,7 +3701,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			behaviac::vector<behaviac::Agent*> method_p0 = ((EmployeeParTestAgent*)pAgent)->_Get_Property_<PROPERTY_TYPE_EmployeeParTestAgent_STV_LIST_AGENT_0, behaviac::vector<behaviac::Agent*> >();
 			((EmployeeParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_EmployeeParTestAgent_Func_AgentListRef, void, behaviac::vector<behaviac::Agent*>& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("STV_LIST_AGENT_0") == 2769286938u);
+			BEHAVIAC_ASSERT_VARID("STV_LIST_AGENT_0", 2769286938u);
 			pAgent->SetVariable("STV_LIST_AGENT_0", 2769286938u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -3965,9 +3965,9 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("c_ListInts") == 2521109666u);
+			BEHAVIAC_ASSERT_VARID("c_ListInts", 2521109666u);
 			vector<int >& opr = (vector<int >&)pAgent->GetVariable<vector<int > >(2521109666u);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("c_Int") == 3849503314u);
+			BEHAVIAC_ASSERT_VARID("c_Int", 3849503314u);
 			int opr_index = 0;
 			pAgent->SetVariable("c_Int", 3849503314u, (opr)[opr_index]);
 			return result;
@@ -3988,7 +3988,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
 			int opr = 100;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("l_ListInts") == 96329828u);
+			BEHAVIAC_ASSERT_VARID("l_ListInts", 96329828u);
 			int opl_index = 0;
 			((behaviac::vector<int >&)pAgent->GetVariable<behaviac::vector<int > >(96329828u))[opl_index] = opr;
 			return result;
@@ -4008,9 +4008,9 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("l_ListInts") == 96329828u);
+			BEHAVIAC_ASSERT_VARID("l_ListInts", 96329828u);
 			vector<int >& opr = (vector<int >&)pAgent->GetVariable<vector<int > >(96329828u);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("l_Int") == 337932423u);
+			BEHAVIAC_ASSERT_VARID("l_Int", 337932423u);
 			int opr_index = 0;
 			pAgent->SetVariable("l_Int", 337932423u, (opr)[opr_index]);
 			return result;
@@ -4031,7 +4031,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
 			int opr = 0;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("l_index") == 1109890112u);
+			BEHAVIAC_ASSERT_VARID("l_index", 1109890112u);
 			pAgent->SetVariable("l_index", 1109890112u, opr);
 			return result;
 		}
@@ -4050,11 +4050,11 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("c_Int") == 3849503314u);
+			BEHAVIAC_ASSERT_VARID("c_Int", 3849503314u);
 			int& opr1 = (int&)pAgent->GetVariable<int >(3849503314u);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("l_Int") == 337932423u);
+			BEHAVIAC_ASSERT_VARID("l_Int", 337932423u);
 			int& opr2 = (int&)pAgent->GetVariable<int >(337932423u);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("l_index") == 1109890112u);
+			BEHAVIAC_ASSERT_VARID("l_index", 1109890112u);
 			int& opl_index = (int&)pAgent->GetVariable<int >(1109890112u);
 			(((TestNS::AgentArrayAccessTest*)pAgent)->_Get_Property_<TestNS::PROPERTY_TYPE_TestNS_AgentArrayAccessTest_ListInts, behaviac::vector<int> >())[opl_index] = (int)(opr1 + opr2);
 			return result;
@@ -4074,10 +4074,10 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("l_ListInts") == 96329828u);
+			BEHAVIAC_ASSERT_VARID("l_ListInts", 96329828u);
 			TList<vector<int> > opr_p0 = &((behaviac::vector<int>&)pAgent->GetVariable<behaviac::vector<int> >(96329828u));
 			int opr = ((behaviac::Agent*)pAgent)->_Execute_Method_<behaviac::METHOD_TYPE_behaviac_Agent_VectorLength, int, IList& >(opr_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("c_Count") == 1209342235u);
+			BEHAVIAC_ASSERT_VARID("c_Count", 1209342235u);
 			pAgent->SetVariable("c_Count", 1209342235u, opr);
 			return result;
 		}
@@ -4095,11 +4095,11 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("c_ListInts") == 2521109666u);
+			BEHAVIAC_ASSERT_VARID("c_ListInts", 2521109666u);
 			TList<vector<int> > method_p0 = &((behaviac::vector<int>&)pAgent->GetVariable<behaviac::vector<int> >(2521109666u));
 			int method_p1 = ((TestNS::AgentArrayAccessTest*)pAgent)->_Get_Property_<TestNS::PROPERTY_TYPE_TestNS_AgentArrayAccessTest_Int, int >();
 			((behaviac::Agent*)pAgent)->_Execute_Method_<behaviac::METHOD_TYPE_behaviac_Agent_VectorAdd, void, IList&, System::Object& >(method_p0, *(System::Object*)&method_p1);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("c_ListInts") == 2521109666u);
+			BEHAVIAC_ASSERT_VARID("c_ListInts", 2521109666u);
 			pAgent->SetVariable("c_ListInts", 2521109666u, *method_p0.vector_);
 			return BT_SUCCESS;
 		}
@@ -4117,12 +4117,12 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("c_ListInts") == 2521109666u);
+			BEHAVIAC_ASSERT_VARID("c_ListInts", 2521109666u);
 			TList<vector<int> > method_p0 = &((behaviac::vector<int>&)pAgent->GetVariable<behaviac::vector<int> >(2521109666u));
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("c_Int") == 3849503314u);
+			BEHAVIAC_ASSERT_VARID("c_Int", 3849503314u);
 			int& method_p1 = (int&)pAgent->GetVariable<int >(3849503314u);
 			((behaviac::Agent*)pAgent)->_Execute_Method_<behaviac::METHOD_TYPE_behaviac_Agent_VectorRemove, void, IList&, System::Object& >(method_p0, *(System::Object*)&method_p1);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("c_ListInts") == 2521109666u);
+			BEHAVIAC_ASSERT_VARID("c_ListInts", 2521109666u);
 			pAgent->SetVariable("c_ListInts", 2521109666u, *method_p0.vector_);
 			return BT_SUCCESS;
 		}
@@ -4159,7 +4159,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
 			double opr = 0.03f;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("c_douleVec") == 2212380943u);
+			BEHAVIAC_ASSERT_VARID("c_douleVec", 2212380943u);
 			int opl_index = 2;
 			((behaviac::vector<double>&)pAgent->GetVariable<behaviac::vector<double> >(2212380943u))[opl_index] = opr;
 			return result;
@@ -4178,12 +4178,12 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("c_douleVec") == 2212380943u);
+			BEHAVIAC_ASSERT_VARID("c_douleVec", 2212380943u);
 			TList<vector<double> > method_p0 = &((behaviac::vector<double>&)pAgent->GetVariable<behaviac::vector<double> >(2212380943u));
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("c_douleVec") == 2212380943u);
+			BEHAVIAC_ASSERT_VARID("c_douleVec", 2212380943u);
 			int method_p1_index = 2;
 			((behaviac::Agent*)pAgent)->_Execute_Method_<behaviac::METHOD_TYPE_behaviac_Agent_VectorAdd, void, IList&, System::Object& >(method_p0, *(System::Object*)&((behaviac::vector<double>&)pAgent->GetVariable<behaviac::vector<double> >(2212380943u))[method_p1_index]);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("c_douleVec") == 2212380943u);
+			BEHAVIAC_ASSERT_VARID("c_douleVec", 2212380943u);
 			pAgent->SetVariable("c_douleVec", 2212380943u, *method_p0.vector_);
 			return BT_SUCCESS;
 		}
@@ -4220,7 +4220,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
 			double opr = 0.05f;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("c_doubleVal") == 1155710363u);
+			BEHAVIAC_ASSERT_VARID("c_doubleVal", 1155710363u);
 			pAgent->SetVariable("c_doubleVal", 1155710363u, opr);
 			return result;
 		}
@@ -4238,12 +4238,12 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("c_doubleVec2") == 3835017610u);
+			BEHAVIAC_ASSERT_VARID("c_doubleVec2", 3835017610u);
 			TList<vector<double> > method_p0 = &((behaviac::vector<double>&)pAgent->GetVariable<behaviac::vector<double> >(3835017610u));
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("c_doubleVal") == 1155710363u);
+			BEHAVIAC_ASSERT_VARID("c_doubleVal", 1155710363u);
 			double& method_p1 = (double&)pAgent->GetVariable<double >(1155710363u);
 			((behaviac::Agent*)pAgent)->_Execute_Method_<behaviac::METHOD_TYPE_behaviac_Agent_VectorAdd, void, IList&, System::Object& >(method_p0, *(System::Object*)&method_p1);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("c_doubleVec2") == 3835017610u);
+			BEHAVIAC_ASSERT_VARID("c_doubleVec2", 3835017610u);
 			pAgent->SetVariable("c_doubleVec2", 3835017610u, *method_p0.vector_);
 			return BT_SUCCESS;
 		}
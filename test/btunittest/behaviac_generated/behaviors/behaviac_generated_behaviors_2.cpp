@@ -329,7 +329,7 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par_agent") == 239606442u);
+			BEHAVIAC_ASSERT_VARID("par_agent", 239606442u);
 			ParTestAgent*& opl = (ParTestAgent*&)pAgent->GetVariable<ParTestAgent* >(239606442u);
 			bool op = PrivateDetails::Equal(opl, opr);
 			return op ? BT_SUCCESS : BT_FAILURE;
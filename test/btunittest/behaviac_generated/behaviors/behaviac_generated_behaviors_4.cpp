@@ -444,7 +444,7 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("_$local_task_param_$_0") == 2009726548u);
+			BEHAVIAC_ASSERT_VARID("_$local_task_param_$_0", 2009726548u);
 			int& method_p0 = (int&)pAgent->GetVariable<int >(2009726548u);
 			((AgentNodeTest*)pAgent)->_Execute_Method_<METHOD_TYPE_AgentNodeTest_setEventVarInt, void, int >(method_p0);
 			return BT_SUCCESS;
@@ -533,7 +533,7 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("_$local_task_param_$_0") == 2009726548u);
+			BEHAVIAC_ASSERT_VARID("_$local_task_param_$_0", 2009726548u);
 			int& method_p0 = (int&)pAgent->GetVariable<int >(2009726548u);
 			((AgentNodeTest*)pAgent)->_Execute_Method_<METHOD_TYPE_AgentNodeTest_setEventVarInt, void, int >(method_p0);
 			return BT_SUCCESS;
@@ -552,7 +552,7 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("_$local_task_param_$_1") == 1859309333u);
+			BEHAVIAC_ASSERT_VARID("_$local_task_param_$_1", 1859309333u);
 			bool& method_p0 = (bool&)pAgent->GetVariable<bool >(1859309333u);
 			((AgentNodeTest*)pAgent)->_Execute_Method_<METHOD_TYPE_AgentNodeTest_setEventVarBool, void, bool >(method_p0);
 			return BT_SUCCESS;
@@ -642,7 +642,7 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("_$local_task_param_$_0") == 2009726548u);
+			BEHAVIAC_ASSERT_VARID("_$local_task_param_$_0", 2009726548u);
 			int& method_p0 = (int&)pAgent->GetVariable<int >(2009726548u);
 			((AgentNodeTest*)pAgent)->_Execute_Method_<METHOD_TYPE_AgentNodeTest_setEventVarInt, void, int >(method_p0);
 			return BT_SUCCESS;
@@ -661,7 +661,7 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("_$local_task_param_$_1") == 1859309333u);
+			BEHAVIAC_ASSERT_VARID("_$local_task_param_$_1", 1859309333u);
 			bool& method_p0 = (bool&)pAgent->GetVariable<bool >(1859309333u);
 			((AgentNodeTest*)pAgent)->_Execute_Method_<METHOD_TYPE_AgentNodeTest_setEventVarBool, void, bool >(method_p0);
 			return BT_SUCCESS;
@@ -680,7 +680,7 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("_$local_task_param_$_2") == 1174379734u);
+			BEHAVIAC_ASSERT_VARID("_$local_task_param_$_2", 1174379734u);
 			float& method_p0 = (float&)pAgent->GetVariable<float >(1174379734u);
 			((AgentNodeTest*)pAgent)->_Execute_Method_<METHOD_TYPE_AgentNodeTest_setEventVarFloat, void, float >(method_p0);
 			return BT_SUCCESS;
@@ -781,7 +781,7 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("_$local_task_param_$_0") == 2009726548u);
+			BEHAVIAC_ASSERT_VARID("_$local_task_param_$_0", 2009726548u);
 			AgentNodeTest*& method_p0 = (AgentNodeTest*&)pAgent->GetVariable<AgentNodeTest* >(2009726548u);
 			((AgentNodeTest*)pAgent)->_Execute_Method_<METHOD_TYPE_AgentNodeTest_setEventVarAgent, void, AgentNodeTest* >(method_p0);
 			return BT_SUCCESS;
@@ -877,7 +877,7 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("_$local_task_param_$_0") == 2009726548u);
+			BEHAVIAC_ASSERT_VARID("_$local_task_param_$_0", 2009726548u);
 			int& method_p0 = (int&)pAgent->GetVariable<int >(2009726548u);
 			((AgentNodeTest*)pAgent)->_Execute_Method_<METHOD_TYPE_AgentNodeTest_setTestVar_0, void, int >(method_p0);
 			return BT_SUCCESS;
@@ -966,7 +966,7 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("_$local_task_param_$_0") == 2009726548u);
+			BEHAVIAC_ASSERT_VARID("_$local_task_param_$_0", 2009726548u);
 			int& method_p0 = (int&)pAgent->GetVariable<int >(2009726548u);
 			((AgentNodeTest*)pAgent)->_Execute_Method_<METHOD_TYPE_AgentNodeTest_setTestVar_0, void, int >(method_p0);
 			return BT_SUCCESS;
@@ -1862,7 +1862,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("_$local_task_param_$_0") == 2009726548u);
+			BEHAVIAC_ASSERT_VARID("_$local_task_param_$_0", 2009726548u);
 			int& opr = (int&)pAgent->GetVariable<int >(2009726548u);
 			((AgentNodeTest*)pAgent)->_Get_Property_<PROPERTY_TYPE_AgentNodeTest_testVar_0, int >() = opr;
 			return result;
@@ -1882,7 +1882,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("_$local_task_param_$_1") == 1859309333u);
+			BEHAVIAC_ASSERT_VARID("_$local_task_param_$_1", 1859309333u);
 			float& opr = (float&)pAgent->GetVariable<float >(1859309333u);
 			((AgentNodeTest*)pAgent)->_Get_Property_<PROPERTY_TYPE_AgentNodeTest_testVar_2, float >() = opr;
 			return result;
@@ -2040,7 +2040,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
 			behaviac::string opr = (char*)("node_test/reference_sub_0");
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("subTreePath") == 526556242u);
+			BEHAVIAC_ASSERT_VARID("subTreePath", 526556242u);
 			pAgent->SetVariable("subTreePath", 526556242u, opr);
 			return result;
 		}
@@ -603,7 +603,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
 			int opr = 1;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("l_IntVar") == 1949893163u);
+			BEHAVIAC_ASSERT_VARID("l_IntVar", 1949893163u);
 			pAgent->SetVariable("l_IntVar", 1949893163u, opr);
 			return result;
 		}
@@ -622,7 +622,7 @@ namespace behaviac
 		virtual EBTStatus update_impl(Agent* pAgent, EBTStatus childStatus)
 		{
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("l_IntVar") == 1949893163u);
+			BEHAVIAC_ASSERT_VARID("l_IntVar", 1949893163u);
 			int& opl = (int&)pAgent->GetVariable<int >(1949893163u);
 			int opr2 = 1;
 			bool op = PrivateDetails::Equal(opl, opr2);
@@ -680,7 +680,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
 			int opr = 2;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("l_IntVar") == 1949893163u);
+			BEHAVIAC_ASSERT_VARID("l_IntVar", 1949893163u);
 			pAgent->SetVariable("l_IntVar", 1949893163u, opr);
 			return result;
 		}
@@ -881,7 +881,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("C_Agent") == 2630010392u);
+			BEHAVIAC_ASSERT_VARID("C_Agent", 2630010392u);
 			ParTestAgent*& opr = (ParTestAgent*&)pAgent->GetVariable<ParTestAgent* >(2630010392u);
 			((EmployeeParTestAgent*)pAgent)->_Get_Property_<PROPERTY_TYPE_EmployeeParTestAgent_TV_AGENT_0, behaviac::Agent* >() = (behaviac::Agent*)opr;
 			return result;
@@ -1079,7 +1079,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
 			bool opr = true;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("c_Bool") == 130231588u);
+			BEHAVIAC_ASSERT_VARID("c_Bool", 130231588u);
 			pAgent->SetVariable("c_Bool", 130231588u, opr);
 			return result;
 		}
@@ -1103,7 +1103,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("c_IntArray") == 1799035077u);
+			BEHAVIAC_ASSERT_VARID("c_IntArray", 1799035077u);
 			pAgent->SetVariable("c_IntArray", 1799035077u, opr);
 			return result;
 		}
@@ -1124,7 +1124,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
 			behaviac::string opr = (char*)("test string");
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("c_StaticString") == 2438934774u);
+			BEHAVIAC_ASSERT_VARID("c_StaticString", 2438934774u);
 			pAgent->SetVariable("c_StaticString", 2438934774u, opr);
 			return result;
 		}
@@ -1144,7 +1144,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
 			TNS::NE::NAT::eColor opr = TNS::NE::NAT::GREEN;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("c_Enum") == 99975606u);
+			BEHAVIAC_ASSERT_VARID("c_Enum", 99975606u);
 			pAgent->SetVariable("c_Enum", 99975606u, opr);
 			return result;
 		}
@@ -1164,7 +1164,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
 			int opr = 2;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("l_Int") == 337932423u);
+			BEHAVIAC_ASSERT_VARID("l_Int", 337932423u);
 			pAgent->SetVariable("l_Int", 337932423u, opr);
 			return result;
 		}
@@ -1206,7 +1206,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
 			UnityEngine::Vector3 opr = ((CustomPropertyAgent*)pAgent)->_Get_Property_<PROPERTY_TYPE_CustomPropertyAgent_Location, UnityEngine::Vector3 >();
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("c_Location") == 1335260864u);
+			BEHAVIAC_ASSERT_VARID("c_Location", 1335260864u);
 			pAgent->SetVariable("c_Location", 1335260864u, opr);
 			return result;
 		}
@@ -1228,7 +1228,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("l_Location") == 3698229766u);
+			BEHAVIAC_ASSERT_VARID("l_Location", 3698229766u);
 			pAgent->SetVariable("l_Location", 3698229766u, opr);
 			return result;
 		}
@@ -1248,7 +1248,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("l_Location") == 3698229766u);
+			BEHAVIAC_ASSERT_VARID("l_Location", 3698229766u);
 			UnityEngine::Vector3& opr = (UnityEngine::Vector3&)pAgent->GetVariable<UnityEngine::Vector3 >(3698229766u);
 			((CustomPropertyAgent*)pAgent)->_Get_Property_<PROPERTY_TYPE_CustomPropertyAgent_Location, UnityEngine::Vector3 >() = opr;
 			return result;
@@ -1432,7 +1432,7 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("testInt") == 2614050066u);
+			BEHAVIAC_ASSERT_VARID("testInt", 2614050066u);
 			int& method_p0 = (int&)pAgent->GetVariable<int >(2614050066u);
 			((AgentNodeTest*)pAgent)->_Execute_Method_<METHOD_TYPE_AgentNodeTest_setTestVar_1, void, int >(method_p0);
 			return BT_SUCCESS;
@@ -1453,7 +1453,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
 			int opr = 20;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("testInt") == 2614050066u);
+			BEHAVIAC_ASSERT_VARID("testInt", 2614050066u);
 			pAgent->SetVariable("testInt", 2614050066u, opr);
 			return result;
 		}
@@ -1521,7 +1521,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
 			bool opr = true;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("c_Bool") == 130231588u);
+			BEHAVIAC_ASSERT_VARID("c_Bool", 130231588u);
 			pAgent->SetVariable("c_Bool", 130231588u, opr);
 			return result;
 		}
@@ -1545,7 +1545,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("c_IntArray") == 1799035077u);
+			BEHAVIAC_ASSERT_VARID("c_IntArray", 1799035077u);
 			pAgent->SetVariable("c_IntArray", 1799035077u, opr);
 			return result;
 		}
@@ -1566,7 +1566,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
 			behaviac::string opr = (char*)("test string");
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("c_StaticString") == 2438934774u);
+			BEHAVIAC_ASSERT_VARID("c_StaticString", 2438934774u);
 			pAgent->SetVariable("c_StaticString", 2438934774u, opr);
 			return result;
 		}
@@ -1586,7 +1586,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
 			TNS::NE::NAT::eColor opr = TNS::NE::NAT::GREEN;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("c_Enum") == 99975606u);
+			BEHAVIAC_ASSERT_VARID("c_Enum", 99975606u);
 			pAgent->SetVariable("c_Enum", 99975606u, opr);
 			return result;
 		}
@@ -1719,10 +1719,10 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par2_agent_0") == 3876418331u);
+			BEHAVIAC_ASSERT_VARID("par2_agent_0", 3876418331u);
 			behaviac::Agent*& opr_p0 = (behaviac::Agent*&)pAgent->GetVariable<behaviac::Agent* >(3876418331u);
 			behaviac::Agent* opr = ((EmployeeParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_EmployeeParTestAgent_Func_AgentIR, behaviac::Agent*, behaviac::Agent* >(opr_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par2_agent_0") == 3876418331u);
+			BEHAVIAC_ASSERT_VARID("par2_agent_0", 3876418331u);
 			pAgent->SetVariable("par2_agent_0", 3876418331u, opr);
 			return result;
 		}
@@ -1741,10 +1741,10 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par2_ParTestAgentBase_0") == 2489994139u);
+			BEHAVIAC_ASSERT_VARID("par2_ParTestAgentBase_0", 2489994139u);
 			ParTestAgentBase*& opr_p0 = (ParTestAgentBase*&)pAgent->GetVariable<ParTestAgentBase* >(2489994139u);
 			ParTestAgentBase* opr = ((EmployeeParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_EmployeeParTestAgent_Func_ParTestAgentBaseIR, ParTestAgentBase*, ParTestAgentBase* >(opr_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par2_ParTestAgentBase_0") == 2489994139u);
+			BEHAVIAC_ASSERT_VARID("par2_ParTestAgentBase_0", 2489994139u);
 			pAgent->SetVariable("par2_ParTestAgentBase_0", 2489994139u, opr);
 			return result;
 		}
@@ -1763,10 +1763,10 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par2_agent_list_0") == 1126732011u);
+			BEHAVIAC_ASSERT_VARID("par2_agent_list_0", 1126732011u);
 			behaviac::vector<behaviac::Agent*>& opr_p0 = (behaviac::vector<behaviac::Agent*>&)pAgent->GetVariable<behaviac::vector<behaviac::Agent*> >(1126732011u);
 			behaviac::vector<behaviac::Agent*> opr = ((EmployeeParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_EmployeeParTestAgent_Func_AgentListIR, behaviac::vector<behaviac::Agent*>, behaviac::vector<behaviac::Agent*> >(opr_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par2_agent_list_0") == 1126732011u);
+			BEHAVIAC_ASSERT_VARID("par2_agent_list_0", 1126732011u);
 			pAgent->SetVariable("par2_agent_list_0", 1126732011u, opr);
 			return result;
 		}
@@ -1785,10 +1785,10 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par2_ParTestAgentBaseList_0") == 3110436684u);
+			BEHAVIAC_ASSERT_VARID("par2_ParTestAgentBaseList_0", 3110436684u);
 			behaviac::vector<ParTestAgentBase*>& opr_p0 = (behaviac::vector<ParTestAgentBase*>&)pAgent->GetVariable<behaviac::vector<ParTestAgentBase*> >(3110436684u);
 			behaviac::vector<ParTestAgentBase*> opr = ((EmployeeParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_EmployeeParTestAgent_Func_ParTestAgentBaseListIR, behaviac::vector<ParTestAgentBase*>, behaviac::vector<ParTestAgentBase*> >(opr_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par2_ParTestAgentBaseList_0") == 3110436684u);
+			BEHAVIAC_ASSERT_VARID("par2_ParTestAgentBaseList_0", 3110436684u);
 			pAgent->SetVariable("par2_ParTestAgentBaseList_0", 3110436684u, opr);
 			return result;
 		}
@@ -1807,10 +1807,10 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par2_double_0") == 2183367433u);
+			BEHAVIAC_ASSERT_VARID("par2_double_0", 2183367433u);
 			double& opr_p0 = (double&)pAgent->GetVariable<double >(2183367433u);
 			double opr = ((EmployeeParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_EmployeeParTestAgent_Func_DoubleIR, double, double >(opr_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par2_double_0") == 2183367433u);
+			BEHAVIAC_ASSERT_VARID("par2_double_0", 2183367433u);
 			pAgent->SetVariable("par2_double_0", 2183367433u, opr);
 			return result;
 		}
@@ -1829,10 +1829,10 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par2_single_0") == 3120166065u);
+			BEHAVIAC_ASSERT_VARID("par2_single_0", 3120166065u);
 			float& opr_p0 = (float&)pAgent->GetVariable<float >(3120166065u);
 			float opr = ((EmployeeParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_EmployeeParTestAgent_Func_SingleIR, float, float >(opr_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par2_single_0") == 3120166065u);
+			BEHAVIAC_ASSERT_VARID("par2_single_0", 3120166065u);
 			pAgent->SetVariable("par2_single_0", 3120166065u, opr);
 			return result;
 		}
@@ -1851,10 +1851,10 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par2_single_list_0") == 3448877207u);
+			BEHAVIAC_ASSERT_VARID("par2_single_list_0", 3448877207u);
 			behaviac::vector<float>& opr_p0 = (behaviac::vector<float>&)pAgent->GetVariable<behaviac::vector<float> >(3448877207u);
 			behaviac::vector<float> opr = ((EmployeeParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_EmployeeParTestAgent_Func_SingleListIR, behaviac::vector<float>, behaviac::vector<float> >(opr_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par2_single_list_0") == 3448877207u);
+			BEHAVIAC_ASSERT_VARID("par2_single_list_0", 3448877207u);
 			pAgent->SetVariable("par2_single_list_0", 3448877207u, opr);
 			return result;
 		}
@@ -1873,10 +1873,10 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par2_string_0") == 351984746u);
+			BEHAVIAC_ASSERT_VARID("par2_string_0", 351984746u);
 			behaviac::string& opr_p0 = (behaviac::string&)pAgent->GetVariable<behaviac::string >(351984746u);
 			behaviac::string opr = ((EmployeeParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_EmployeeParTestAgent_Func_StringIR, behaviac::string, behaviac::string& >(opr_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par2_string_0") == 351984746u);
+			BEHAVIAC_ASSERT_VARID("par2_string_0", 351984746u);
 			pAgent->SetVariable("par2_string_0", 351984746u, opr);
 			return result;
 		}
@@ -1895,10 +1895,10 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par2_string_list_0") == 1339885043u);
+			BEHAVIAC_ASSERT_VARID("par2_string_list_0", 1339885043u);
 			behaviac::vector<behaviac::string>& opr_p0 = (behaviac::vector<behaviac::string>&)pAgent->GetVariable<behaviac::vector<behaviac::string> >(1339885043u);
 			behaviac::vector<behaviac::string> opr = ((EmployeeParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_EmployeeParTestAgent_Func_StringListIR, behaviac::vector<behaviac::string>, behaviac::vector<behaviac::string> >(opr_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par2_string_list_0") == 1339885043u);
+			BEHAVIAC_ASSERT_VARID("par2_string_list_0", 1339885043u);
 			pAgent->SetVariable("par2_string_list_0", 1339885043u, opr);
 			return result;
 		}
@@ -1917,10 +1917,10 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par2_uint_0") == 868709384u);
+			BEHAVIAC_ASSERT_VARID("par2_uint_0", 868709384u);
 			unsigned int& opr_p0 = (unsigned int&)pAgent->GetVariable<unsigned int >(868709384u);
 			unsigned int opr = ((EmployeeParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_EmployeeParTestAgent_Func_UIntIR, unsigned int, unsigned int >(opr_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par2_uint_0") == 868709384u);
+			BEHAVIAC_ASSERT_VARID("par2_uint_0", 868709384u);
 			pAgent->SetVariable("par2_uint_0", 868709384u, opr);
 			return result;
 		}
@@ -1939,10 +1939,10 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par2_ulong_0") == 4274832167u);
+			BEHAVIAC_ASSERT_VARID("par2_ulong_0", 4274832167u);
 			unsigned long& opr_p0 = (unsigned long&)pAgent->GetVariable<unsigned long >(4274832167u);
 			unsigned long opr = ((EmployeeParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_EmployeeParTestAgent_Func_ULongIR, unsigned long, unsigned long >(opr_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par2_ulong_0") == 4274832167u);
+			BEHAVIAC_ASSERT_VARID("par2_ulong_0", 4274832167u);
 			pAgent->SetVariable("par2_ulong_0", 4274832167u, opr);
 			return result;
 		}
@@ -1961,10 +1961,10 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par2_longlong_0") == 1021248696u);
+			BEHAVIAC_ASSERT_VARID("par2_longlong_0", 1021248696u);
 			long long& opr_p0 = (long long&)pAgent->GetVariable<long long >(1021248696u);
 			long long opr = ((EmployeeParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_EmployeeParTestAgent_Func_LongLongIR, long long, long long >(opr_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par2_longlong_0") == 1021248696u);
+			BEHAVIAC_ASSERT_VARID("par2_longlong_0", 1021248696u);
 			pAgent->SetVariable("par2_longlong_0", 1021248696u, opr);
 			return result;
 		}
@@ -1983,10 +1983,10 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par2_ulonglong_0") == 386357671u);
+			BEHAVIAC_ASSERT_VARID("par2_ulonglong_0", 386357671u);
 			unsigned long long& opr_p0 = (unsigned long long&)pAgent->GetVariable<unsigned long long >(386357671u);
 			unsigned long long opr = ((EmployeeParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_EmployeeParTestAgent_Func_ULongLongIR, unsigned long long, unsigned long long >(opr_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par2_ulonglong_0") == 386357671u);
+			BEHAVIAC_ASSERT_VARID("par2_ulonglong_0", 386357671u);
 			pAgent->SetVariable("par2_ulonglong_0", 386357671u, opr);
 			return result;
 		}
@@ -2005,10 +2005,10 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par2_SzString_0") == 2318984205u);
+			BEHAVIAC_ASSERT_VARID("par2_SzString_0", 2318984205u);
 			behaviac::string& opr_p0 = (behaviac::string&)pAgent->GetVariable<behaviac::string >(2318984205u);
 			behaviac::string opr = ((EmployeeParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_EmployeeParTestAgent_Func_StringIR, behaviac::string, behaviac::string& >(opr_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par2_SzString_0") == 2318984205u);
+			BEHAVIAC_ASSERT_VARID("par2_SzString_0", 2318984205u);
 			pAgent->SetVariable("par2_SzString_0", 2318984205u, opr);
 			return result;
 		}
@@ -2027,10 +2027,10 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par1_short_0") == 3228030786u);
+			BEHAVIAC_ASSERT_VARID("par1_short_0", 3228030786u);
 			short& opr_p0 = (short&)pAgent->GetVariable<short >(3228030786u);
 			short opr = ((ParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgent_Func_ShortIR, short, short >(opr_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par1_short_0") == 3228030786u);
+			BEHAVIAC_ASSERT_VARID("par1_short_0", 3228030786u);
 			pAgent->SetVariable("par1_short_0", 3228030786u, opr);
 			return result;
 		}
@@ -2049,10 +2049,10 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par1_int_0") == 2735162453u);
+			BEHAVIAC_ASSERT_VARID("par1_int_0", 2735162453u);
 			int& opr_p0 = (int&)pAgent->GetVariable<int >(2735162453u);
 			int opr = ((ParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgent_Func_IntIR, int, int >(opr_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par1_int_0") == 2735162453u);
+			BEHAVIAC_ASSERT_VARID("par1_int_0", 2735162453u);
 			pAgent->SetVariable("par1_int_0", 2735162453u, opr);
 			return result;
 		}
@@ -2071,10 +2071,10 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par1_int_list_0") == 2093180786u);
+			BEHAVIAC_ASSERT_VARID("par1_int_list_0", 2093180786u);
 			behaviac::vector<int>& opr_p0 = (behaviac::vector<int>&)pAgent->GetVariable<behaviac::vector<int> >(2093180786u);
 			behaviac::vector<int> opr = ((ParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgent_Func_IntListIR, behaviac::vector<int>, behaviac::vector<int> >(opr_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par1_int_list_0") == 2093180786u);
+			BEHAVIAC_ASSERT_VARID("par1_int_list_0", 2093180786u);
 			pAgent->SetVariable("par1_int_list_0", 2093180786u, opr);
 			return result;
 		}
@@ -2093,10 +2093,10 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par1_long_0") == 1828293308u);
+			BEHAVIAC_ASSERT_VARID("par1_long_0", 1828293308u);
 			long& opr_p0 = (long&)pAgent->GetVariable<long >(1828293308u);
 			long opr = ((ParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgent_Func_LongIR, long, long >(opr_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par1_long_0") == 1828293308u);
+			BEHAVIAC_ASSERT_VARID("par1_long_0", 1828293308u);
 			pAgent->SetVariable("par1_long_0", 1828293308u, opr);
 			return result;
 		}
@@ -2115,10 +2115,10 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par1_kemployee_0") == 4045482770u);
+			BEHAVIAC_ASSERT_VARID("par1_kemployee_0", 4045482770u);
 			TNS::ST::PER::WRK::kEmployee& opr_p0 = (TNS::ST::PER::WRK::kEmployee&)pAgent->GetVariable<TNS::ST::PER::WRK::kEmployee >(4045482770u);
 			TNS::ST::PER::WRK::kEmployee opr = ((ParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgent_Func_kEmployeeIR, TNS::ST::PER::WRK::kEmployee, TNS::ST::PER::WRK::kEmployee >(opr_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par1_kemployee_0") == 4045482770u);
+			BEHAVIAC_ASSERT_VARID("par1_kemployee_0", 4045482770u);
 			pAgent->SetVariable("par1_kemployee_0", 4045482770u, opr);
 			return result;
 		}
@@ -2137,10 +2137,10 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par1_kemployee_list_0") == 506976637u);
+			BEHAVIAC_ASSERT_VARID("par1_kemployee_list_0", 506976637u);
 			behaviac::vector<TNS::ST::PER::WRK::kEmployee>& opr_p0 = (behaviac::vector<TNS::ST::PER::WRK::kEmployee>&)pAgent->GetVariable<behaviac::vector<TNS::ST::PER::WRK::kEmployee> >(506976637u);
 			behaviac::vector<TNS::ST::PER::WRK::kEmployee> opr = ((ParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgent_Func_kEmployeeListIR, behaviac::vector<TNS::ST::PER::WRK::kEmployee>, behaviac::vector<TNS::ST::PER::WRK::kEmployee> >(opr_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par1_kemployee_list_0") == 506976637u);
+			BEHAVIAC_ASSERT_VARID("par1_kemployee_list_0", 506976637u);
 			pAgent->SetVariable("par1_kemployee_list_0", 506976637u, opr);
 			return result;
 		}
@@ -2159,10 +2159,10 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par1_ushort_0") == 109865111u);
+			BEHAVIAC_ASSERT_VARID("par1_ushort_0", 109865111u);
 			unsigned short& opr_p0 = (unsigned short&)pAgent->GetVariable<unsigned short >(109865111u);
 			unsigned short opr = ((ParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgent_Func_UShortIR, unsigned short, unsigned short >(opr_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par1_ushort_0") == 109865111u);
+			BEHAVIAC_ASSERT_VARID("par1_ushort_0", 109865111u);
 			pAgent->SetVariable("par1_ushort_0", 109865111u, opr);
 			return result;
 		}
@@ -2181,10 +2181,10 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par0_boolean_0") == 1912381985u);
+			BEHAVIAC_ASSERT_VARID("par0_boolean_0", 1912381985u);
 			bool& opr_p0 = (bool&)pAgent->GetVariable<bool >(1912381985u);
 			bool opr = ((ParTestAgentBase*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgentBase_Func_BooleanIR, bool, bool >(opr_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par0_boolean_0") == 1912381985u);
+			BEHAVIAC_ASSERT_VARID("par0_boolean_0", 1912381985u);
 			pAgent->SetVariable("par0_boolean_0", 1912381985u, opr);
 			return result;
 		}
@@ -2203,10 +2203,10 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par0_boolean_list_0") == 109714028u);
+			BEHAVIAC_ASSERT_VARID("par0_boolean_list_0", 109714028u);
 			behaviac::vector<bool>& opr_p0 = (behaviac::vector<bool>&)pAgent->GetVariable<behaviac::vector<bool> >(109714028u);
 			behaviac::vector<bool> opr = ((ParTestAgentBase*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgentBase_Func_BooleanListIR, behaviac::vector<bool>, behaviac::vector<bool> >(opr_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par0_boolean_list_0") == 109714028u);
+			BEHAVIAC_ASSERT_VARID("par0_boolean_list_0", 109714028u);
 			pAgent->SetVariable("par0_boolean_list_0", 109714028u, opr);
 			return result;
 		}
@@ -2225,10 +2225,10 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par0_byte_0") == 2120958860u);
+			BEHAVIAC_ASSERT_VARID("par0_byte_0", 2120958860u);
 			unsigned char& opr_p0 = (unsigned char&)pAgent->GetVariable<unsigned char >(2120958860u);
 			unsigned char opr = ((ParTestAgentBase*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgentBase_Func_ByteIR, unsigned char, unsigned char >(opr_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par0_byte_0") == 2120958860u);
+			BEHAVIAC_ASSERT_VARID("par0_byte_0", 2120958860u);
 			pAgent->SetVariable("par0_byte_0", 2120958860u, opr);
 			return result;
 		}
@@ -2247,10 +2247,10 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par0_byte_list_0") == 1459492261u);
+			BEHAVIAC_ASSERT_VARID("par0_byte_list_0", 1459492261u);
 			behaviac::vector<unsigned char>& opr_p0 = (behaviac::vector<unsigned char>&)pAgent->GetVariable<behaviac::vector<unsigned char> >(1459492261u);
 			behaviac::vector<unsigned char> opr = ((ParTestAgentBase*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgentBase_Func_ByteListIR, behaviac::vector<unsigned char>, behaviac::vector<unsigned char> >(opr_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par0_byte_list_0") == 1459492261u);
+			BEHAVIAC_ASSERT_VARID("par0_byte_list_0", 1459492261u);
 			pAgent->SetVariable("par0_byte_list_0", 1459492261u, opr);
 			return result;
 		}
@@ -2269,10 +2269,10 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par0_char_0") == 1968762578u);
+			BEHAVIAC_ASSERT_VARID("par0_char_0", 1968762578u);
 			char& opr_p0 = (char&)pAgent->GetVariable<char >(1968762578u);
 			char opr = ((ParTestAgentBase*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgentBase_Func_CharIR, char, char >(opr_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par0_char_0") == 1968762578u);
+			BEHAVIAC_ASSERT_VARID("par0_char_0", 1968762578u);
 			pAgent->SetVariable("par0_char_0", 1968762578u, opr);
 			return result;
 		}
@@ -2291,10 +2291,10 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par0_char_list_0") == 2869241813u);
+			BEHAVIAC_ASSERT_VARID("par0_char_list_0", 2869241813u);
 			behaviac::vector<char>& opr_p0 = (behaviac::vector<char>&)pAgent->GetVariable<behaviac::vector<char> >(2869241813u);
 			behaviac::vector<char> opr = ((ParTestAgentBase*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgentBase_Func_CharListIR, behaviac::vector<char>, behaviac::vector<char> >(opr_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par0_char_list_0") == 2869241813u);
+			BEHAVIAC_ASSERT_VARID("par0_char_list_0", 2869241813u);
 			pAgent->SetVariable("par0_char_list_0", 2869241813u, opr);
 			return result;
 		}
@@ -2313,10 +2313,10 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par0_ecolor_0") == 3914433730u);
+			BEHAVIAC_ASSERT_VARID("par0_ecolor_0", 3914433730u);
 			TNS::NE::NAT::eColor& opr_p0 = (TNS::NE::NAT::eColor&)pAgent->GetVariable<TNS::NE::NAT::eColor >(3914433730u);
 			TNS::NE::NAT::eColor opr = ((ParTestAgentBase*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgentBase_Func_eColorIR, TNS::NE::NAT::eColor, TNS::NE::NAT::eColor >(opr_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par0_ecolor_0") == 3914433730u);
+			BEHAVIAC_ASSERT_VARID("par0_ecolor_0", 3914433730u);
 			pAgent->SetVariable("par0_ecolor_0", 3914433730u, opr);
 			return result;
 		}
@@ -2335,10 +2335,10 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par0_ecolor_list_0") == 1963776920u);
+			BEHAVIAC_ASSERT_VARID("par0_ecolor_list_0", 1963776920u);
 			behaviac::vector<TNS::NE::NAT::eColor>& opr_p0 = (behaviac::vector<TNS::NE::NAT::eColor>&)pAgent->GetVariable<behaviac::vector<TNS::NE::NAT::eColor> >(1963776920u);
 			behaviac::vector<TNS::NE::NAT::eColor> opr = ((ParTestAgentBase*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgentBase_Func_eColorListIR, behaviac::vector<TNS::NE::NAT::eColor>, behaviac::vector<TNS::NE::NAT::eColor> >(opr_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par0_ecolor_list_0") == 1963776920u);
+			BEHAVIAC_ASSERT_VARID("par0_ecolor_list_0", 1963776920u);
 			pAgent->SetVariable("par0_ecolor_list_0", 1963776920u, opr);
 			return result;
 		}
@@ -2357,10 +2357,10 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par0_sbyte_0") == 968869870u);
+			BEHAVIAC_ASSERT_VARID("par0_sbyte_0", 968869870u);
 			signed char& opr_p0 = (signed char&)pAgent->GetVariable<signed char >(968869870u);
 			signed char opr = ((ParTestAgentBase*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgentBase_Func_SByteIR, signed char, signed char >(opr_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par0_sbyte_0") == 968869870u);
+			BEHAVIAC_ASSERT_VARID("par0_sbyte_0", 968869870u);
 			pAgent->SetVariable("par0_sbyte_0", 968869870u, opr);
 			return result;
 		}
@@ -2379,10 +2379,10 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par0_sbyte_list_0") == 2290963684u);
+			BEHAVIAC_ASSERT_VARID("par0_sbyte_list_0", 2290963684u);
 			behaviac::vector<signed char>& opr_p0 = (behaviac::vector<signed char>&)pAgent->GetVariable<behaviac::vector<signed char> >(2290963684u);
 			behaviac::vector<signed char> opr = ((ParTestAgentBase*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgentBase_Func_SByteListIR, behaviac::vector<signed char>, behaviac::vector<signed char> >(opr_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par0_sbyte_list_0") == 2290963684u);
+			BEHAVIAC_ASSERT_VARID("par0_sbyte_list_0", 2290963684u);
 			pAgent->SetVariable("par0_sbyte_list_0", 2290963684u, opr);
 			return result;
 		}
@@ -2845,10 +2845,10 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par2_agent_0") == 3876418331u);
+			BEHAVIAC_ASSERT_VARID("par2_agent_0", 3876418331u);
 			behaviac::Agent*& method_p0 = (behaviac::Agent*&)pAgent->GetVariable<behaviac::Agent* >(3876418331u);
 			((EmployeeParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_EmployeeParTestAgent_Func_AgentRef, void, behaviac::Agent*& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par2_agent_0") == 3876418331u);
+			BEHAVIAC_ASSERT_VARID("par2_agent_0", 3876418331u);
 			pAgent->SetVariable("par2_agent_0", 3876418331u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -2866,10 +2866,10 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par2_agent_list_0") == 1126732011u);
+			BEHAVIAC_ASSERT_VARID("par2_agent_list_0", 1126732011u);
 			behaviac::vector<behaviac::Agent*>& method_p0 = (behaviac::vector<behaviac::Agent*>&)pAgent->GetVariable<behaviac::vector<behaviac::Agent*> >(1126732011u);
 			((EmployeeParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_EmployeeParTestAgent_Func_AgentListRef, void, behaviac::vector<behaviac::Agent*>& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par2_agent_list_0") == 1126732011u);
+			BEHAVIAC_ASSERT_VARID("par2_agent_list_0", 1126732011u);
 			pAgent->SetVariable("par2_agent_list_0", 1126732011u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -2887,10 +2887,10 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par2_double_0") == 2183367433u);
+			BEHAVIAC_ASSERT_VARID("par2_double_0", 2183367433u);
 			double& method_p0 = (double&)pAgent->GetVariable<double >(2183367433u);
 			((EmployeeParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_EmployeeParTestAgent_Func_DoubleRef, void, double& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par2_double_0") == 2183367433u);
+			BEHAVIAC_ASSERT_VARID("par2_double_0", 2183367433u);
 			pAgent->SetVariable("par2_double_0", 2183367433u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -2908,10 +2908,10 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par2_single_0") == 3120166065u);
+			BEHAVIAC_ASSERT_VARID("par2_single_0", 3120166065u);
 			float& method_p0 = (float&)pAgent->GetVariable<float >(3120166065u);
 			((EmployeeParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_EmployeeParTestAgent_Func_SingleRef, void, float& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par2_single_0") == 3120166065u);
+			BEHAVIAC_ASSERT_VARID("par2_single_0", 3120166065u);
 			pAgent->SetVariable("par2_single_0", 3120166065u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -2929,10 +2929,10 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par2_single_list_0") == 3448877207u);
+			BEHAVIAC_ASSERT_VARID("par2_single_list_0", 3448877207u);
 			behaviac::vector<float>& method_p0 = (behaviac::vector<float>&)pAgent->GetVariable<behaviac::vector<float> >(3448877207u);
 			((EmployeeParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_EmployeeParTestAgent_Func_SingleListRef, void, behaviac::vector<float>& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par2_single_list_0") == 3448877207u);
+			BEHAVIAC_ASSERT_VARID("par2_single_list_0", 3448877207u);
 			pAgent->SetVariable("par2_single_list_0", 3448877207u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -2950,10 +2950,10 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par2_string_0") == 351984746u);
+			BEHAVIAC_ASSERT_VARID("par2_string_0", 351984746u);
 			behaviac::string& method_p0 = (behaviac::string&)pAgent->GetVariable<behaviac::string >(351984746u);
 			((EmployeeParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_EmployeeParTestAgent_Func_StringRef, void, behaviac::string& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par2_string_0") == 351984746u);
+			BEHAVIAC_ASSERT_VARID("par2_string_0", 351984746u);
 			pAgent->SetVariable("par2_string_0", 351984746u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -2971,10 +2971,10 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par2_string_list_0") == 1339885043u);
+			BEHAVIAC_ASSERT_VARID("par2_string_list_0", 1339885043u);
 			behaviac::vector<behaviac::string>& method_p0 = (behaviac::vector<behaviac::string>&)pAgent->GetVariable<behaviac::vector<behaviac::string> >(1339885043u);
 			((EmployeeParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_EmployeeParTestAgent_Func_StringListRef, void, behaviac::vector<behaviac::string>& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par2_string_list_0") == 1339885043u);
+			BEHAVIAC_ASSERT_VARID("par2_string_list_0", 1339885043u);
 			pAgent->SetVariable("par2_string_list_0", 1339885043u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -2992,10 +2992,10 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par2_uint_0") == 868709384u);
+			BEHAVIAC_ASSERT_VARID("par2_uint_0", 868709384u);
 			unsigned int& method_p0 = (unsigned int&)pAgent->GetVariable<unsigned int >(868709384u);
 			((EmployeeParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_EmployeeParTestAgent_Func_UIntRef, void, unsigned int& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par2_uint_0") == 868709384u);
+			BEHAVIAC_ASSERT_VARID("par2_uint_0", 868709384u);
 			pAgent->SetVariable("par2_uint_0", 868709384u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -3013,10 +3013,10 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par2_ulong_0") == 4274832167u);
+			BEHAVIAC_ASSERT_VARID("par2_ulong_0", 4274832167u);
 			unsigned long& method_p0 = (unsigned long&)pAgent->GetVariable<unsigned long >(4274832167u);
 			((EmployeeParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_EmployeeParTestAgent_Func_ULongRef, void, unsigned long& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par2_ulong_0") == 4274832167u);
+			BEHAVIAC_ASSERT_VARID("par2_ulong_0", 4274832167u);
 			pAgent->SetVariable("par2_ulong_0", 4274832167u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -3034,10 +3034,10 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par2_longlong_0") == 1021248696u);
+			BEHAVIAC_ASSERT_VARID("par2_longlong_0", 1021248696u);
 			long long& method_p0 = (long long&)pAgent->GetVariable<long long >(1021248696u);
 			((EmployeeParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_EmployeeParTestAgent_Func_LongLongRef, void, long long& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par2_longlong_0") == 1021248696u);
+			BEHAVIAC_ASSERT_VARID("par2_longlong_0", 1021248696u);
 			pAgent->SetVariable("par2_longlong_0", 1021248696u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -3055,10 +3055,10 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par2_ulonglong_0") == 386357671u);
+			BEHAVIAC_ASSERT_VARID("par2_ulonglong_0", 386357671u);
 			unsigned long long& method_p0 = (unsigned long long&)pAgent->GetVariable<unsigned long long >(386357671u);
 			((EmployeeParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_EmployeeParTestAgent_Func_ULongLongRef, void, unsigned long long& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par2_ulonglong_0") == 386357671u);
+			BEHAVIAC_ASSERT_VARID("par2_ulonglong_0", 386357671u);
 			pAgent->SetVariable("par2_ulonglong_0", 386357671u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -3076,10 +3076,10 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par2_SzString_0") == 2318984205u);
+			BEHAVIAC_ASSERT_VARID("par2_SzString_0", 2318984205u);
 			char* method_p0 = (char*)((behaviac::string&)pAgent->GetVariable<behaviac::string>(2318984205u)).c_str();
 			((EmployeeParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_EmployeeParTestAgent_Func_SzStringRef, void, char*& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par2_SzString_0") == 2318984205u);
+			BEHAVIAC_ASSERT_VARID("par2_SzString_0", 2318984205u);
 			pAgent->SetVariable("par2_SzString_0", 2318984205u, behaviac::string(method_p0));
 			return BT_SUCCESS;
 		}
@@ -3097,7 +3097,7 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par2_CSzStrng_0") == 1084657673u);
+			BEHAVIAC_ASSERT_VARID("par2_CSzStrng_0", 1084657673u);
 			char* method_p0 = (char*)((behaviac::string&)pAgent->GetVariable<behaviac::string>(1084657673u)).c_str();
 			((EmployeeParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_EmployeeParTestAgent_Func_CSzStringRef, void, char* >(method_p0);
 			return BT_SUCCESS;
@@ -3116,10 +3116,10 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par1_short_0") == 3228030786u);
+			BEHAVIAC_ASSERT_VARID("par1_short_0", 3228030786u);
 			short& method_p0 = (short&)pAgent->GetVariable<short >(3228030786u);
 			((ParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgent_Func_ShortRef, void, short& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par1_short_0") == 3228030786u);
+			BEHAVIAC_ASSERT_VARID("par1_short_0", 3228030786u);
 			pAgent->SetVariable("par1_short_0", 3228030786u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -3137,10 +3137,10 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par1_int_0") == 2735162453u);
+			BEHAVIAC_ASSERT_VARID("par1_int_0", 2735162453u);
 			int& method_p0 = (int&)pAgent->GetVariable<int >(2735162453u);
 			((ParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgent_Func_IntRef, void, int& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par1_int_0") == 2735162453u);
+			BEHAVIAC_ASSERT_VARID("par1_int_0", 2735162453u);
 			pAgent->SetVariable("par1_int_0", 2735162453u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -3158,10 +3158,10 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par1_int_list_0") == 2093180786u);
+			BEHAVIAC_ASSERT_VARID("par1_int_list_0", 2093180786u);
 			behaviac::vector<int>& method_p0 = (behaviac::vector<int>&)pAgent->GetVariable<behaviac::vector<int> >(2093180786u);
 			((ParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgent_Func_IntListRef, void, behaviac::vector<int>& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par1_int_list_0") == 2093180786u);
+			BEHAVIAC_ASSERT_VARID("par1_int_list_0", 2093180786u);
 			pAgent->SetVariable("par1_int_list_0", 2093180786u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -3179,10 +3179,10 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par1_long_0") == 1828293308u);
+			BEHAVIAC_ASSERT_VARID("par1_long_0", 1828293308u);
 			long& method_p0 = (long&)pAgent->GetVariable<long >(1828293308u);
 			((ParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgent_Func_LongRef, void, long& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par1_long_0") == 1828293308u);
+			BEHAVIAC_ASSERT_VARID("par1_long_0", 1828293308u);
 			pAgent->SetVariable("par1_long_0", 1828293308u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -3200,10 +3200,10 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par1_kemployee_0") == 4045482770u);
+			BEHAVIAC_ASSERT_VARID("par1_kemployee_0", 4045482770u);
 			TNS::ST::PER::WRK::kEmployee& method_p0 = (TNS::ST::PER::WRK::kEmployee&)pAgent->GetVariable<TNS::ST::PER::WRK::kEmployee >(4045482770u);
 			((ParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgent_Func_kEmployeeRef, void, TNS::ST::PER::WRK::kEmployee& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par1_kemployee_0") == 4045482770u);
+			BEHAVIAC_ASSERT_VARID("par1_kemployee_0", 4045482770u);
 			pAgent->SetVariable("par1_kemployee_0", 4045482770u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -3221,10 +3221,10 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par1_kemployee_list_0") == 506976637u);
+			BEHAVIAC_ASSERT_VARID("par1_kemployee_list_0", 506976637u);
 			behaviac::vector<TNS::ST::PER::WRK::kEmployee>& method_p0 = (behaviac::vector<TNS::ST::PER::WRK::kEmployee>&)pAgent->GetVariable<behaviac::vector<TNS::ST::PER::WRK::kEmployee> >(506976637u);
 			((ParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgent_Func_kEmployeeListRef, void, behaviac::vector<TNS::ST::PER::WRK::kEmployee>& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par1_kemployee_list_0") == 506976637u);
+			BEHAVIAC_ASSERT_VARID("par1_kemployee_list_0", 506976637u);
 			pAgent->SetVariable("par1_kemployee_list_0", 506976637u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -3242,10 +3242,10 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par1_ushort_0") == 109865111u);
+			BEHAVIAC_ASSERT_VARID("par1_ushort_0", 109865111u);
 			unsigned short& method_p0 = (unsigned short&)pAgent->GetVariable<unsigned short >(109865111u);
 			((ParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgent_Func_UShortRef, void, unsigned short& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par1_ushort_0") == 109865111u);
+			BEHAVIAC_ASSERT_VARID("par1_ushort_0", 109865111u);
 			pAgent->SetVariable("par1_ushort_0", 109865111u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -3263,10 +3263,10 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par0_boolean_0") == 1912381985u);
+			BEHAVIAC_ASSERT_VARID("par0_boolean_0", 1912381985u);
 			bool& method_p0 = (bool&)pAgent->GetVariable<bool >(1912381985u);
 			((ParTestAgentBase*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgentBase_Func_BooleanRef, void, bool& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par0_boolean_0") == 1912381985u);
+			BEHAVIAC_ASSERT_VARID("par0_boolean_0", 1912381985u);
 			pAgent->SetVariable("par0_boolean_0", 1912381985u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -3284,10 +3284,10 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par0_boolean_list_0") == 109714028u);
+			BEHAVIAC_ASSERT_VARID("par0_boolean_list_0", 109714028u);
 			behaviac::vector<bool>& method_p0 = (behaviac::vector<bool>&)pAgent->GetVariable<behaviac::vector<bool> >(109714028u);
 			((ParTestAgentBase*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgentBase_Func_BooleanListRef, void, behaviac::vector<bool>& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par0_boolean_list_0") == 109714028u);
+			BEHAVIAC_ASSERT_VARID("par0_boolean_list_0", 109714028u);
 			pAgent->SetVariable("par0_boolean_list_0", 109714028u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -3305,10 +3305,10 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par0_byte_0") == 2120958860u);
+			BEHAVIAC_ASSERT_VARID("par0_byte_0", 2120958860u);
 			unsigned char& method_p0 = (unsigned char&)pAgent->GetVariable<unsigned char >(2120958860u);
 			((ParTestAgentBase*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgentBase_Func_ByteRef, void, unsigned char& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par0_byte_0") == 2120958860u);
+			BEHAVIAC_ASSERT_VARID("par0_byte_0", 2120958860u);
 			pAgent->SetVariable("par0_byte_0", 2120958860u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -3326,10 +3326,10 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par0_byte_list_0") == 1459492261u);
+			BEHAVIAC_ASSERT_VARID("par0_byte_list_0", 1459492261u);
 			behaviac::vector<unsigned char>& method_p0 = (behaviac::vector<unsigned char>&)pAgent->GetVariable<behaviac::vector<unsigned char> >(1459492261u);
 			((ParTestAgentBase*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgentBase_Func_ByteListRef, void, behaviac::vector<unsigned char>& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par0_byte_list_0") == 1459492261u);
+			BEHAVIAC_ASSERT_VARID("par0_byte_list_0", 1459492261u);
 			pAgent->SetVariable("par0_byte_list_0", 1459492261u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -3347,10 +3347,10 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par0_char_0") == 1968762578u);
+			BEHAVIAC_ASSERT_VARID("par0_char_0", 1968762578u);
 			char& method_p0 = (char&)pAgent->GetVariable<char >(1968762578u);
 			((ParTestAgentBase*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgentBase_Func_CharRef, void, char& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par0_char_0") == 1968762578u);
+			BEHAVIAC_ASSERT_VARID("par0_char_0", 1968762578u);
 			pAgent->SetVariable("par0_char_0", 1968762578u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -3368,10 +3368,10 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par0_char_list_0") == 2869241813u);
+			BEHAVIAC_ASSERT_VARID("par0_char_list_0", 2869241813u);
 			behaviac::vector<char>& method_p0 = (behaviac::vector<char>&)pAgent->GetVariable<behaviac::vector<char> >(2869241813u);
 			((ParTestAgentBase*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgentBase_Func_CharListRef, void, behaviac::vector<char>& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par0_char_list_0") == 2869241813u);
+			BEHAVIAC_ASSERT_VARID("par0_char_list_0", 2869241813u);
 			pAgent->SetVariable("par0_char_list_0", 2869241813u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -3389,10 +3389,10 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par0_ecolor_0") == 3914433730u);
+			BEHAVIAC_ASSERT_VARID("par0_ecolor_0", 3914433730u);
 			TNS::NE::NAT::eColor& method_p0 = (TNS::NE::NAT::eColor&)pAgent->GetVariable<TNS::NE::NAT::eColor >(3914433730u);
 			((ParTestAgentBase*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgentBase_Func_eColorRef, void, TNS::NE::NAT::eColor& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par0_ecolor_0") == 3914433730u);
+			BEHAVIAC_ASSERT_VARID("par0_ecolor_0", 3914433730u);
 			pAgent->SetVariable("par0_ecolor_0", 3914433730u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -3410,10 +3410,10 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par0_ecolor_list_0") == 1963776920u);
+			BEHAVIAC_ASSERT_VARID("par0_ecolor_list_0", 1963776920u);
 			behaviac::vector<TNS::NE::NAT::eColor>& method_p0 = (behaviac::vector<TNS::NE::NAT::eColor>&)pAgent->GetVariable<behaviac::vector<TNS::NE::NAT::eColor> >(1963776920u);
 			((ParTestAgentBase*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgentBase_Func_eColorListRef, void, behaviac::vector<TNS::NE::NAT::eColor>& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par0_ecolor_list_0") == 1963776920u);
+			BEHAVIAC_ASSERT_VARID("par0_ecolor_list_0", 1963776920u);
 			pAgent->SetVariable("par0_ecolor_list_0", 1963776920u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -3431,10 +3431,10 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par0_sbyte_0") == 968869870u);
+			BEHAVIAC_ASSERT_VARID("par0_sbyte_0", 968869870u);
 			signed char& method_p0 = (signed char&)pAgent->GetVariable<signed char >(968869870u);
 			((ParTestAgentBase*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgentBase_Func_SByteRef, void, signed char& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par0_sbyte_0") == 968869870u);
+			BEHAVIAC_ASSERT_VARID("par0_sbyte_0", 968869870u);
 			pAgent->SetVariable("par0_sbyte_0", 968869870u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -3452,10 +3452,10 @@ namespace behaviac
 		{
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par0_sbyte_list_0") == 2290963684u);
+			BEHAVIAC_ASSERT_VARID("par0_sbyte_list_0", 2290963684u);
 			behaviac::vector<signed char>& method_p0 = (behaviac::vector<signed char>&)pAgent->GetVariable<behaviac::vector<signed char> >(2290963684u);
 			((ParTestAgentBase*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgentBase_Func_SByteListRef, void, behaviac::vector<signed char>& >(method_p0);
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par0_sbyte_list_0") == 2290963684u);
+			BEHAVIAC_ASSERT_VARID("par0_sbyte_list_0", 2290963684u);
 			pAgent->SetVariable("par0_sbyte_list_0", 2290963684u, method_p0);
 			return BT_SUCCESS;
 		}
@@ -3907,7 +3907,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par2_agent_0") == 3876418331u);
+			BEHAVIAC_ASSERT_VARID("par2_agent_0", 3876418331u);
 			behaviac::Agent*& opr_p0 = (behaviac::Agent*&)pAgent->GetVariable<behaviac::Agent* >(3876418331u);
 			behaviac::Agent* opr = ((EmployeeParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_EmployeeParTestAgent_Func_AgentIR, behaviac::Agent*, behaviac::Agent* >(opr_p0);
 			((EmployeeParTestAgent*)pAgent)->_Get_Property_<PROPERTY_TYPE_EmployeeParTestAgent_TV_AGENT_0, behaviac::Agent* >() = opr;
@@ -3928,7 +3928,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par2_agent_list_0") == 1126732011u);
+			BEHAVIAC_ASSERT_VARID("par2_agent_list_0", 1126732011u);
 			behaviac::vector<behaviac::Agent*>& opr_p0 = (behaviac::vector<behaviac::Agent*>&)pAgent->GetVariable<behaviac::vector<behaviac::Agent*> >(1126732011u);
 			behaviac::vector<behaviac::Agent*> opr = ((EmployeeParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_EmployeeParTestAgent_Func_AgentListIR, behaviac::vector<behaviac::Agent*>, behaviac::vector<behaviac::Agent*> >(opr_p0);
 			((EmployeeParTestAgent*)pAgent)->_Get_Property_<PROPERTY_TYPE_EmployeeParTestAgent_TV_LIST_AGENT_0, behaviac::vector<behaviac::Agent*> >() = opr;
@@ -3949,7 +3949,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par2_double_0") == 2183367433u);
+			BEHAVIAC_ASSERT_VARID("par2_double_0", 2183367433u);
 			double& opr_p0 = (double&)pAgent->GetVariable<double >(2183367433u);
 			double opr = ((EmployeeParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_EmployeeParTestAgent_Func_DoubleIR, double, double >(opr_p0);
 			((EmployeeParTestAgent*)pAgent)->_Get_Property_<PROPERTY_TYPE_EmployeeParTestAgent_TV_D_0, double >() = opr;
@@ -3970,7 +3970,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par2_single_0") == 3120166065u);
+			BEHAVIAC_ASSERT_VARID("par2_single_0", 3120166065u);
 			float& opr_p0 = (float&)pAgent->GetVariable<float >(3120166065u);
 			float opr = ((EmployeeParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_EmployeeParTestAgent_Func_SingleIR, float, float >(opr_p0);
 			((EmployeeParTestAgent*)pAgent)->_Get_Property_<PROPERTY_TYPE_EmployeeParTestAgent_TV_F_0, float >() = opr;
@@ -3991,7 +3991,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par2_single_list_0") == 3448877207u);
+			BEHAVIAC_ASSERT_VARID("par2_single_list_0", 3448877207u);
 			behaviac::vector<float>& opr_p0 = (behaviac::vector<float>&)pAgent->GetVariable<behaviac::vector<float> >(3448877207u);
 			behaviac::vector<float> opr = ((EmployeeParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_EmployeeParTestAgent_Func_SingleListIR, behaviac::vector<float>, behaviac::vector<float> >(opr_p0);
 			((EmployeeParTestAgent*)pAgent)->_Get_Property_<PROPERTY_TYPE_EmployeeParTestAgent_TV_LIST_F_0, behaviac::vector<float> >() = opr;
@@ -4012,7 +4012,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par2_string_0") == 351984746u);
+			BEHAVIAC_ASSERT_VARID("par2_string_0", 351984746u);
 			behaviac::string& opr_p0 = (behaviac::string&)pAgent->GetVariable<behaviac::string >(351984746u);
 			behaviac::string opr = ((EmployeeParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_EmployeeParTestAgent_Func_StringIR, behaviac::string, behaviac::string& >(opr_p0);
 			((EmployeeParTestAgent*)pAgent)->_Get_Property_<PROPERTY_TYPE_EmployeeParTestAgent_TV_STR_0, behaviac::string >() = opr;
@@ -4033,7 +4033,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par2_string_list_0") == 1339885043u);
+			BEHAVIAC_ASSERT_VARID("par2_string_list_0", 1339885043u);
 			behaviac::vector<behaviac::string>& opr_p0 = (behaviac::vector<behaviac::string>&)pAgent->GetVariable<behaviac::vector<behaviac::string> >(1339885043u);
 			behaviac::vector<behaviac::string> opr = ((EmployeeParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_EmployeeParTestAgent_Func_StringListIR, behaviac::vector<behaviac::string>, behaviac::vector<behaviac::string> >(opr_p0);
 			((EmployeeParTestAgent*)pAgent)->_Get_Property_<PROPERTY_TYPE_EmployeeParTestAgent_TV_LIST_STR_0, behaviac::vector<behaviac::string> >() = opr;
@@ -4054,7 +4054,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par2_uint_0") == 868709384u);
+			BEHAVIAC_ASSERT_VARID("par2_uint_0", 868709384u);
 			unsigned int& opr_p0 = (unsigned int&)pAgent->GetVariable<unsigned int >(868709384u);
 			unsigned int opr = ((EmployeeParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_EmployeeParTestAgent_Func_UIntIR, unsigned int, unsigned int >(opr_p0);
 			((EmployeeParTestAgent*)pAgent)->_Get_Property_<PROPERTY_TYPE_EmployeeParTestAgent_TV_UINT_0, unsigned int >() = opr;
@@ -4075,7 +4075,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par2_ulong_0") == 4274832167u);
+			BEHAVIAC_ASSERT_VARID("par2_ulong_0", 4274832167u);
 			unsigned long& opr_p0 = (unsigned long&)pAgent->GetVariable<unsigned long >(4274832167u);
 			unsigned long opr = ((EmployeeParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_EmployeeParTestAgent_Func_ULongIR, unsigned long, unsigned long >(opr_p0);
 			((EmployeeParTestAgent*)pAgent)->_Get_Property_<PROPERTY_TYPE_EmployeeParTestAgent_TV_ULONG_0, unsigned long >() = opr;
@@ -4134,7 +4134,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par1_short_0") == 3228030786u);
+			BEHAVIAC_ASSERT_VARID("par1_short_0", 3228030786u);
 			short& opr_p0 = (short&)pAgent->GetVariable<short >(3228030786u);
 			short opr = ((ParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgent_Func_ShortIR, short, short >(opr_p0);
 			((ParTestAgent*)pAgent)->_Get_Property_<PROPERTY_TYPE_ParTestAgent_TV_SHORT_0, short >() = opr;
@@ -4155,7 +4155,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par1_int_0") == 2735162453u);
+			BEHAVIAC_ASSERT_VARID("par1_int_0", 2735162453u);
 			int& opr_p0 = (int&)pAgent->GetVariable<int >(2735162453u);
 			int opr = ((ParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgent_Func_IntIR, int, int >(opr_p0);
 			((ParTestAgent*)pAgent)->_Get_Property_<PROPERTY_TYPE_ParTestAgent_TV_INT_0, int >() = opr;
@@ -4176,7 +4176,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par1_int_list_0") == 2093180786u);
+			BEHAVIAC_ASSERT_VARID("par1_int_list_0", 2093180786u);
 			behaviac::vector<int>& opr_p0 = (behaviac::vector<int>&)pAgent->GetVariable<behaviac::vector<int> >(2093180786u);
 			behaviac::vector<int> opr = ((ParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgent_Func_IntListIR, behaviac::vector<int>, behaviac::vector<int> >(opr_p0);
 			((ParTestAgent*)pAgent)->_Get_Property_<PROPERTY_TYPE_ParTestAgent_TV_LIST_INT_0, behaviac::vector<int> >() = opr;
@@ -4197,7 +4197,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par1_long_0") == 1828293308u);
+			BEHAVIAC_ASSERT_VARID("par1_long_0", 1828293308u);
 			long& opr_p0 = (long&)pAgent->GetVariable<long >(1828293308u);
 			long opr = ((ParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgent_Func_LongIR, long, long >(opr_p0);
 			((ParTestAgent*)pAgent)->_Get_Property_<PROPERTY_TYPE_ParTestAgent_TV_LONG_0, long >() = opr;
@@ -4218,7 +4218,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par1_kemployee_0") == 4045482770u);
+			BEHAVIAC_ASSERT_VARID("par1_kemployee_0", 4045482770u);
 			TNS::ST::PER::WRK::kEmployee& opr_p0 = (TNS::ST::PER::WRK::kEmployee&)pAgent->GetVariable<TNS::ST::PER::WRK::kEmployee >(4045482770u);
 			TNS::ST::PER::WRK::kEmployee opr = ((ParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgent_Func_kEmployeeIR, TNS::ST::PER::WRK::kEmployee, TNS::ST::PER::WRK::kEmployee >(opr_p0);
 			((ParTestAgent*)pAgent)->_Get_Property_<PROPERTY_TYPE_ParTestAgent_TV_KEMPLOYEE_0, TNS::ST::PER::WRK::kEmployee >() = opr;
@@ -4239,7 +4239,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par1_kemployee_list_0") == 506976637u);
+			BEHAVIAC_ASSERT_VARID("par1_kemployee_list_0", 506976637u);
 			behaviac::vector<TNS::ST::PER::WRK::kEmployee>& opr_p0 = (behaviac::vector<TNS::ST::PER::WRK::kEmployee>&)pAgent->GetVariable<behaviac::vector<TNS::ST::PER::WRK::kEmployee> >(506976637u);
 			behaviac::vector<TNS::ST::PER::WRK::kEmployee> opr = ((ParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgent_Func_kEmployeeListIR, behaviac::vector<TNS::ST::PER::WRK::kEmployee>, behaviac::vector<TNS::ST::PER::WRK::kEmployee> >(opr_p0);
 			((ParTestAgent*)pAgent)->_Get_Property_<PROPERTY_TYPE_ParTestAgent_TV_LIST_KEMPLOYEE_0, behaviac::vector<TNS::ST::PER::WRK::kEmployee> >() = opr;
@@ -4260,7 +4260,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par1_ushort_0") == 109865111u);
+			BEHAVIAC_ASSERT_VARID("par1_ushort_0", 109865111u);
 			unsigned short& opr_p0 = (unsigned short&)pAgent->GetVariable<unsigned short >(109865111u);
 			unsigned short opr = ((ParTestAgent*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgent_Func_UShortIR, unsigned short, unsigned short >(opr_p0);
 			((ParTestAgent*)pAgent)->_Get_Property_<PROPERTY_TYPE_ParTestAgent_TV_USHORT_0, unsigned short >() = opr;
@@ -4281,7 +4281,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par0_boolean_0") == 1912381985u);
+			BEHAVIAC_ASSERT_VARID("par0_boolean_0", 1912381985u);
 			bool& opr_p0 = (bool&)pAgent->GetVariable<bool >(1912381985u);
 			bool opr = ((ParTestAgentBase*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgentBase_Func_BooleanIR, bool, bool >(opr_p0);
 			((ParTestAgentBase*)pAgent)->_Get_Property_<PROPERTY_TYPE_ParTestAgentBase_TV_BOOL_0, bool >() = opr;
@@ -4302,7 +4302,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par0_boolean_list_0") == 109714028u);
+			BEHAVIAC_ASSERT_VARID("par0_boolean_list_0", 109714028u);
 			behaviac::vector<bool>& opr_p0 = (behaviac::vector<bool>&)pAgent->GetVariable<behaviac::vector<bool> >(109714028u);
 			behaviac::vector<bool> opr = ((ParTestAgentBase*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgentBase_Func_BooleanListIR, behaviac::vector<bool>, behaviac::vector<bool> >(opr_p0);
 			((ParTestAgentBase*)pAgent)->_Get_Property_<PROPERTY_TYPE_ParTestAgentBase_TV_LIST_BOOL_0, behaviac::vector<bool> >() = opr;
@@ -4323,7 +4323,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par0_byte_0") == 2120958860u);
+			BEHAVIAC_ASSERT_VARID("par0_byte_0", 2120958860u);
 			unsigned char& opr_p0 = (unsigned char&)pAgent->GetVariable<unsigned char >(2120958860u);
 			unsigned char opr = ((ParTestAgentBase*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgentBase_Func_ByteIR, unsigned char, unsigned char >(opr_p0);
 			((ParTestAgentBase*)pAgent)->_Get_Property_<PROPERTY_TYPE_ParTestAgentBase_TV_BYTE_0, unsigned char >() = opr;
@@ -4344,7 +4344,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par0_byte_list_0") == 1459492261u);
+			BEHAVIAC_ASSERT_VARID("par0_byte_list_0", 1459492261u);
 			behaviac::vector<unsigned char>& opr_p0 = (behaviac::vector<unsigned char>&)pAgent->GetVariable<behaviac::vector<unsigned char> >(1459492261u);
 			behaviac::vector<unsigned char> opr = ((ParTestAgentBase*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgentBase_Func_ByteListIR, behaviac::vector<unsigned char>, behaviac::vector<unsigned char> >(opr_p0);
 			((ParTestAgentBase*)pAgent)->_Get_Property_<PROPERTY_TYPE_ParTestAgentBase_TV_LIST_BYTE_0, behaviac::vector<unsigned char> >() = opr;
@@ -4365,7 +4365,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par0_char_0") == 1968762578u);
+			BEHAVIAC_ASSERT_VARID("par0_char_0", 1968762578u);
 			char& opr_p0 = (char&)pAgent->GetVariable<char >(1968762578u);
 			char opr = ((ParTestAgentBase*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgentBase_Func_CharIR, char, char >(opr_p0);
 			((ParTestAgentBase*)pAgent)->_Get_Property_<PROPERTY_TYPE_ParTestAgentBase_TV_CHAR_0, char >() = opr;
@@ -4386,7 +4386,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par0_char_list_0") == 2869241813u);
+			BEHAVIAC_ASSERT_VARID("par0_char_list_0", 2869241813u);
 			behaviac::vector<char>& opr_p0 = (behaviac::vector<char>&)pAgent->GetVariable<behaviac::vector<char> >(2869241813u);
 			behaviac::vector<char> opr = ((ParTestAgentBase*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgentBase_Func_CharListIR, behaviac::vector<char>, behaviac::vector<char> >(opr_p0);
 			((ParTestAgentBase*)pAgent)->_Get_Property_<PROPERTY_TYPE_ParTestAgentBase_TV_LIST_CHAR_0, behaviac::vector<char> >() = opr;
@@ -4407,7 +4407,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par0_ecolor_0") == 3914433730u);
+			BEHAVIAC_ASSERT_VARID("par0_ecolor_0", 3914433730u);
 			TNS::NE::NAT::eColor& opr_p0 = (TNS::NE::NAT::eColor&)pAgent->GetVariable<TNS::NE::NAT::eColor >(3914433730u);
 			TNS::NE::NAT::eColor opr = ((ParTestAgentBase*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgentBase_Func_eColorIR, TNS::NE::NAT::eColor, TNS::NE::NAT::eColor >(opr_p0);
 			((ParTestAgentBase*)pAgent)->_Get_Property_<PROPERTY_TYPE_ParTestAgentBase_TV_ECOLOR_0, TNS::NE::NAT::eColor >() = opr;
@@ -4428,7 +4428,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par0_ecolor_list_0") == 1963776920u);
+			BEHAVIAC_ASSERT_VARID("par0_ecolor_list_0", 1963776920u);
 			behaviac::vector<TNS::NE::NAT::eColor>& opr_p0 = (behaviac::vector<TNS::NE::NAT::eColor>&)pAgent->GetVariable<behaviac::vector<TNS::NE::NAT::eColor> >(1963776920u);
 			behaviac::vector<TNS::NE::NAT::eColor> opr = ((ParTestAgentBase*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgentBase_Func_eColorListIR, behaviac::vector<TNS::NE::NAT::eColor>, behaviac::vector<TNS::NE::NAT::eColor> >(opr_p0);
 			((ParTestAgentBase*)pAgent)->_Get_Property_<PROPERTY_TYPE_ParTestAgentBase_TV_LIST_ECOLOR_0, behaviac::vector<TNS::NE::NAT::eColor> >() = opr;
@@ -4449,7 +4449,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par0_sbyte_0") == 968869870u);
+			BEHAVIAC_ASSERT_VARID("par0_sbyte_0", 968869870u);
 			signed char& opr_p0 = (signed char&)pAgent->GetVariable<signed char >(968869870u);
 			signed char opr = ((ParTestAgentBase*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgentBase_Func_SByteIR, signed char, signed char >(opr_p0);
 			((ParTestAgentBase*)pAgent)->_Get_Property_<PROPERTY_TYPE_ParTestAgentBase_TV_SBYTE_0, signed char >() = opr;
@@ -4470,7 +4470,7 @@ namespace behaviac
 			BEHAVIAC_UNUSED_VAR(pAgent);
 			BEHAVIAC_UNUSED_VAR(childStatus);
 			EBTStatus result = BT_SUCCESS;
-			BEHAVIAC_ASSERT(behaviac::MakeVariableId("par0_sbyte_list_0") == 2290963684u);
+			BEHAVIAC_ASSERT_VARID("par0_sbyte_list_0", 2290963684u);
 			behaviac::vector<signed char>& opr_p0 = (behaviac::vector<signed char>&)pAgent->GetVariable<behaviac::vector<signed char> >(2290963684u);
 			behaviac::vector<signed char> opr = ((ParTestAgentBase*)pAgent)->_Execute_Method_<METHOD_TYPE_ParTestAgentBase_Func_SByteListIR, behaviac::vector<signed char>, behaviac::vector<signed char> >(opr_p0);
 			((ParTestAgentBase*)pAgent)->_Get_Property_<PROPERTY_TYPE_ParTestAgentBase_TV_LIST_SBYTE_0, behaviac::vector<signed char> >() = opr;
@@ -0,0 +1,131 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Tencent is pleased to support the open source community by making behaviac available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except in compliance with
+// the License. You may obtain a copy of the License at http://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and limitations under the License.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//packs the exported trees into a bundle to be opened by Workspace::OpenBundle
+#include "behaviac/common/file/behaviorbundle.h"
+#include "behaviac/common/workspace.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include <string>
+
+static bool EndsWith(const std::string& str, const char* suffix)
+{
+    size_t length = strlen(suffix);
+
+    return str.size() >= length && str.compare(str.size() - length, length, suffix) == 0;
+}
+
+//'file' is relative to the exported directory, with its extension
+static bool AddTree(const char* exportedDir, const std::string& file, behaviac::vector<behaviac::CBehaviorBundle::Item_t>& items)
+{
+    behaviac::CBehaviorBundle::Item_t item;
+    std::string relativePath;
+
+    if (EndsWith(file, ".xml"))
+    {
+        relativePath = file.substr(0, file.size() - strlen(".xml"));
+        item.format = behaviac::Workspace::EFF_xml;
+    }
+    else if (EndsWith(file, ".bson.bytes"))
+    {
+        relativePath = file.substr(0, file.size() - strlen(".bson.bytes"));
+        item.format = behaviac::Workspace::EFF_bson;
+    }
+    else
+    {
+        fprintf(stderr, "'%s' is neither xml nor bson, skipped\n", file.c_str());
+        return true;
+    }
+
+    std::string path = std::string(exportedDir) + "/" + file;
+    FILE* fp = fopen(path.c_str(), "rb");
+
+    if (fp == NULL)
+    {
+        fprintf(stderr, "can't read '%s'\n", path.c_str());
+        return false;
+    }
+
+    char buffer[64 * 1024];
+    size_t size = 0;
+
+    while ((size = fread(buffer, 1, sizeof(buffer), fp)) > 0)
+    {
+        item.data.append(buffer, size);
+    }
+
+    fclose(fp);
+
+    item.relativePath = relativePath.c_str();
+    items.push_back(item);
+
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 3)
+    {
+        printf("usage: bundler <exported directory> <bundle file> [trees...]\n");
+        printf("  the trees are relative to the exported directory with their extensions, .xml or .bson.bytes,\n");
+        printf("  they are read from the standard input, one per line, if none is given\n");
+        return 1;
+    }
+
+    const char* exportedDir = argv[1];
+    const char* bundlePath = argv[2];
+
+    behaviac::vector<behaviac::CBehaviorBundle::Item_t> items;
+
+    if (argc > 3)
+    {
+        for (int i = 3; i < argc; ++i)
+        {
+            if (!AddTree(exportedDir, argv[i], items))
+            {
+                return 1;
+            }
+        }
+    }
+    else
+    {
+        char line[1024];
+
+        while (fgets(line, sizeof(line), stdin))
+        {
+            std::string file(line);
+
+            while (!file.empty() && (file[file.size() - 1] == '\n' || file[file.size() - 1] == '\r'))
+            {
+                file.erase(file.size() - 1);
+            }
+
+            if (!file.empty() && !AddTree(exportedDir, file, items))
+            {
+                return 1;
+            }
+        }
+    }
+
+    if (!behaviac::CBehaviorBundle::Write(bundlePath, items))
+    {
+        fprintf(stderr, "can't write '%s'\n", bundlePath);
+        return 1;
+    }
+
+    printf("%d trees in '%s'\n", (int)items.size(), bundlePath);
+
+    return 0;
+}
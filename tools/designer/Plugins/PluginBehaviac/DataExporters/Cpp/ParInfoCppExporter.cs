@@ -66,7 +66,7 @@ namespace PluginBehaviac.DataExporters
 
             if (!string.IsNullOrEmpty(var))
             {
-                stream.WriteLine("{0}BEHAVIAC_ASSERT(behaviac::MakeVariableId(\"{1}\") == {2}u);", indent, propBasicName, id);
+                stream.WriteLine("{0}BEHAVIAC_ASSERT_VARID(\"{1}\", {2}u);", indent, propBasicName, id);
 
                 if (shouldDefineType || isRefParam)
                 {
@@ -107,7 +107,7 @@ namespace PluginBehaviac.DataExporters
                 var = string.Format("behaviac::string({0})", var);
             }
 
-            stream.WriteLine("{0}BEHAVIAC_ASSERT(behaviac::MakeVariableId(\"{1}\") == {2}u);", indent, propBasicName, id);
+            stream.WriteLine("{0}BEHAVIAC_ASSERT_VARID(\"{1}\", {2}u);", indent, propBasicName, id);
             stream.WriteLine("{0}pAgent->SetVariable(\"{1}\", {2}u, {3});", indent, propBasicName, id, var);
         }
 
@@ -130,7 +130,7 @@ namespace PluginBehaviac.DataExporters
                 string propBasicName = property.BasicName.Replace("[]", "");
                 uint id = Behaviac.Design.CRC32.CalcCRC(propBasicName);
 
-                stream.WriteLine("{0}BEHAVIAC_ASSERT(behaviac::MakeVariableId(\"{1}\") == {2}u);", indent, propBasicName, id);
+                stream.WriteLine("{0}BEHAVIAC_ASSERT_VARID(\"{1}\", {2}u);", indent, propBasicName, id);
                 retStr = string.Format("({0}&){1}->GetVariable<{0} >({2}u)", typename, agentName, id);
             }
 
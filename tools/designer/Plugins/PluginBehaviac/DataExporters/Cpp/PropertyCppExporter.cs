@@ -70,7 +70,7 @@ namespace PluginBehaviac.DataExporters
 
             string propBasicName = property.BasicName.Replace("[]", "");
             uint id = Behaviac.Design.CRC32.CalcCRC(propBasicName);
-            stream.WriteLine("{0}BEHAVIAC_ASSERT(behaviac::MakeVariableId(\"{1}\") == {2}u);", indent, propBasicName, id);
+            stream.WriteLine("{0}BEHAVIAC_ASSERT_VARID(\"{1}\", {2}u);", indent, propBasicName, id);
             stream.WriteLine("{0}{1}->SetVariable(\"{2}\", {3}u, {4});", indent, agentName, propBasicName, id, prop);
         }
 
@@ -0,0 +1,192 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Tencent is pleased to support the open source community by making behaviac available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except in compliance with
+// the License. You may obtain a copy of the License at http://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and limitations under the License.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//splits the shard files logged with LogManager::SetLogShards into a log per agent, in the form of the default log file
+#include "behaviac/common/logger/logmanager.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+
+struct SegmentFile
+{
+    std::string					path;
+    behaviac::LogSegmentHeader	header;
+
+    bool operator<(const SegmentFile& other) const
+    {
+        if (header.shard != other.header.shard)
+        {
+            return header.shard < other.header.shard;
+        }
+
+        return header.segment < other.header.segment;
+    }
+};
+
+struct AgentLog
+{
+    AgentLog() : bCreated(false)
+    {
+    }
+
+    std::string	text;
+    bool		bCreated;
+};
+
+//the texts are kept until they are large enough, so that only one file is open at a time however many agents there are
+static const size_t kAgentBufferSize = 1024 * 1024;
+
+static std::string GetAgentLogPath(const char* outputDir, int agentId)
+{
+    char fileName[64];
+
+    if (agentId == -1)
+    {
+        string_snprintf(fileName, sizeof(fileName), "_behaviac_$_.log");
+    }
+    else
+    {
+        string_snprintf(fileName, sizeof(fileName), "Agent_$_%03d.log", agentId);
+    }
+
+    return std::string(outputDir) + "/" + fileName;
+}
+
+static bool WriteAgentLog(const char* outputDir, int agentId, AgentLog& log)
+{
+    const std::string path = GetAgentLogPath(outputDir, agentId);
+    FILE* fp = fopen(path.c_str(), log.bCreated ? "ab" : "wb");
+
+    if (fp == NULL)
+    {
+        fprintf(stderr, "can't write '%s'\n", path.c_str());
+        return false;
+    }
+
+    fwrite(log.text.c_str(), 1, log.text.size(), fp);
+    fclose(fp);
+
+    log.text.clear();
+    log.bCreated = true;
+
+    return true;
+}
+
+static bool ReadSegmentHeader(const char* path, behaviac::LogSegmentHeader& header)
+{
+    FILE* fp = fopen(path, "rb");
+
+    if (fp == NULL)
+    {
+        return false;
+    }
+
+    const bool bRead = fread(&header, sizeof(header), 1, fp) == 1;
+    fclose(fp);
+
+    return bRead && header.magic == behaviac::LogSegmentHeader::kMagic && header.version == behaviac::LogSegmentHeader::kVersion;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 3)
+    {
+        printf("usage: logsplitter <output directory> <shard files...>\n");
+        printf("  the shard files are named as <log file path>.<shard>.<segment>\n");
+        return 1;
+    }
+
+    const char* outputDir = argv[1];
+    std::vector<SegmentFile> segments;
+
+    for (int i = 2; i < argc; ++i)
+    {
+        SegmentFile segment;
+        segment.path = argv[i];
+
+        if (ReadSegmentHeader(argv[i], segment.header))
+        {
+            segments.push_back(segment);
+        }
+        else
+        {
+            fprintf(stderr, "'%s' is not a shard file, skipped\n", argv[i]);
+        }
+    }
+
+    //an agent is always logged into the same shard, its records are in the order of the segments
+    std::sort(segments.begin(), segments.end());
+
+    std::map<int, AgentLog> agentLogs;
+    std::vector<char> text;
+    size_t records = 0;
+
+    for (size_t i = 0; i < segments.size(); ++i)
+    {
+        FILE* fp = fopen(segments[i].path.c_str(), "rb");
+
+        if (fp == NULL)
+        {
+            continue;
+        }
+
+        fseek(fp, sizeof(behaviac::LogSegmentHeader), SEEK_SET);
+
+        behaviac::LogRecordHeader record;
+
+        while (fread(&record, sizeof(record), 1, fp) == 1)
+        {
+            text.resize(record.size);
+
+            if (record.size > 0 && fread(&text[0], 1, record.size, fp) != record.size)
+            {
+                fprintf(stderr, "'%s' is truncated\n", segments[i].path.c_str());
+                break;
+            }
+
+            AgentLog& log = agentLogs[record.agentId];
+
+            if (record.size > 0)
+            {
+                log.text.append(&text[0], record.size);
+            }
+
+            records++;
+
+            if (log.text.size() >= kAgentBufferSize && !WriteAgentLog(outputDir, record.agentId, log))
+            {
+                fclose(fp);
+                return 1;
+            }
+        }
+
+        fclose(fp);
+    }
+
+    for (std::map<int, AgentLog>::iterator it = agentLogs.begin(); it != agentLogs.end(); ++it)
+    {
+        if (!WriteAgentLog(outputDir, it->first, it->second))
+        {
+            return 1;
+        }
+    }
+
+    printf("%d records of %d agents in %d shard files\n", (int)records, (int)agentLogs.size(), (int)segments.size());
+
+    return 0;
+}